@@ -61,6 +61,7 @@ DANSource::DANSource() :
     useAbsoluteTime = false;
     absoluteStartTime = 0LLU;
     interleave = true;
+    numberOfCyclesPerBlock = 1u;
     danStreams = NULL_PTR(DANStream **);
     filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
@@ -237,6 +238,15 @@ bool DANSource::Initialise(StructuredDataI& data) {
         interleave = (interleaveU8 > 0u);
         REPORT_ERROR(ErrorManagement::Information, "Interleave parameter set to %d", interleave ? 1u : 0u);
     }
+    if (ok) {
+        if (!data.Read("NumberOfCyclesPerBlock", numberOfCyclesPerBlock)) {
+            numberOfCyclesPerBlock = 1u;
+        }
+        ok = (numberOfCyclesPerBlock > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfCyclesPerBlock shall be > 0u");
+        }
+    }
 
     if (ok) {
         ok = (stackSize > 0u);
@@ -438,6 +448,7 @@ bool DANSource::SetConfiguredDatabase(StructuredDataI& data) {
                         danStreams = newDanStreams;
 
                         danStreams[nOfDANStreams] = new DANStream(typeDesc, GetName(), danBufferMultiplier, samplingFrequency, numberOfElements, interleave);
+                        danStreams[nOfDANStreams]->SetNumberOfCyclesPerBlock(numberOfCyclesPerBlock);
                         danStreams[nOfDANStreams]->AddSignal(n);
                         nOfDANStreams++;
                     }
@@ -582,6 +593,10 @@ uint32 DANSource::GetDANBufferMultiplier() const {
     return danBufferMultiplier;
 }
 
+uint32 DANSource::GetNumberOfCyclesPerBlock() const {
+    return numberOfCyclesPerBlock;
+}
+
 void DANSource::Purge(ReferenceContainer &purgeList) {
     if (brokerAsyncTrigger.IsValid()) {
         (void) brokerAsyncTrigger->FlushAllTriggers();
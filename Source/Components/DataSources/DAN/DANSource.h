@@ -65,7 +65,9 @@ namespace MARTe {
  *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
  *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
  *     ICProgName = "MARTeApp.ex" //Optional. If set it will call dan_initLibrary_icprog with the specified name.
- *     Interleave = 1 //Optional. If == 1 => that the data is expected to be interleaved by the DANStream, if == 0, it can be assumed that the data is already interleaved.
+ *     Interleave = 1 //Optional. If == 1 => that the data is expected to be interleaved by the DANStream, if == 0, it can be assumed that the data is already interleaved (and it is submitted to DAN without any further copy).
+ *     NumberOfCyclesPerBlock = 10 //Optional. Number of cycles accumulated by each DANStream before submitting them to DAN in a single block. Shall be > 0. Default = 1.
+ *                                 //A cycle whose time (see TimeSignal) is not contiguous with the accumulated ones (e.g. a new StoreOnTrigger window) submits the incomplete block first.
  *
  *     Signals = {
  *         Trigger = { //Compulsory when StoreOnTrigger = 1. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored into the DAN database. Shall not be added if StoreOnTrigger = 0.
@@ -260,6 +262,12 @@ DANSource    ();
      */
     uint32 GetDANBufferMultiplier() const;
 
+    /**
+     * @brief Gets the number of cycles accumulated by each DANStream before submitting them to DAN in a single block.
+     * @return the number of cycles per block.
+     */
+    uint32 GetNumberOfCyclesPerBlock() const;
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -376,6 +384,11 @@ private:
      * If true the data will be interleaved by the DANStream
      */
     bool interleave;
+
+    /**
+     * Number of cycles accumulated by each DANStream before submitting them to DAN.
+     */
+    uint32 numberOfCyclesPerBlock;
  
 };
 }
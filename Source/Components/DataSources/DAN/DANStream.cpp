@@ -38,6 +38,48 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Side (in samples and in signals) of the square tiles transposed by DANStreamInterleave.
+ */
+const MARTe::uint32 DAN_STREAM_INTERLEAVE_TILE = 8u;
+
+/**
+ * @brief Transposes the numberOfSignals x numberOfSamples matrix of elements of type T stored in src into dest.
+ * @details The matrix is walked in DAN_STREAM_INTERLEAVE_TILE x DAN_STREAM_INTERLEAVE_TILE tiles so that both the rows read
+ * from src and the columns written in dest stay in cache. The element copy is a plain typed assignment which the compiler can vectorise.
+ */
+template<typename T>
+void DANStreamInterleave(const MARTe::char8 * const src, MARTe::char8 * const dest, const MARTe::uint32 numberOfSignals, const MARTe::uint32 numberOfSamples) {
+    using namespace MARTe;
+    /*lint -e{927} -e{826} src and dest are allocated with a size multiple of sizeof(T) and with the alignment given by the heap*/
+    const T * const srcT = reinterpret_cast<const T *>(src);
+    /*lint -e{927} -e{826} see above*/
+    T * const destT = reinterpret_cast<T *>(dest);
+    uint32 s0;
+    for (s0 = 0u; s0 < numberOfSignals; s0 += DAN_STREAM_INTERLEAVE_TILE) {
+        uint32 sEnd = (s0 + DAN_STREAM_INTERLEAVE_TILE);
+        if (sEnd > numberOfSignals) {
+            sEnd = numberOfSignals;
+        }
+        uint32 z0;
+        for (z0 = 0u; z0 < numberOfSamples; z0 += DAN_STREAM_INTERLEAVE_TILE) {
+            uint32 zEnd = (z0 + DAN_STREAM_INTERLEAVE_TILE);
+            if (zEnd > numberOfSamples) {
+                zEnd = numberOfSamples;
+            }
+            uint32 s;
+            for (s = s0; s < sEnd; s++) {
+                const T * const srcRow = &srcT[s * numberOfSamples];
+                uint32 z;
+                for (z = z0; z < zEnd; z++) {
+                    destT[(z * numberOfSignals) + s] = srcRow[z];
+                }
+            }
+        }
+    }
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -67,6 +109,9 @@ DANStream::DANStream(const TypeDescriptor & tdIn, const StreamString baseNameIn,
     writeCounts = 0u;
     danSourceName = "";
     interleave = interleaveIn;
+    numberOfCyclesPerBlock = 1u;
+    batchCycle = 0u;
+    batchTimeStamp = 0u;
 }
 
 /*lint -e{1551} the destructor must guarantee that the DANSource is unpublished at the of the object life-cycle. The internal buffering memory is also cleaned in this function.*/
@@ -102,8 +147,23 @@ uint32 DANStream::GetNumberOfSamples() const {
     return numberOfSamples;
 }
 
+uint32 DANStream::GetNumberOfCyclesPerBlock() const {
+    return numberOfCyclesPerBlock;
+}
+
+uint32 DANStream::GetNumberOfBatchedCycles() const {
+    return batchCycle;
+}
+
+void DANStream::SetNumberOfCyclesPerBlock(const uint32 numberOfCyclesPerBlockIn) {
+    if ((blockMemory == NULL_PTR(char8 *)) && (numberOfCyclesPerBlockIn > 0u)) {
+        numberOfCyclesPerBlock = numberOfCyclesPerBlockIn;
+    }
+}
+
 void DANStream::Reset() {
     writeCounts = 0u;
+    batchCycle = 0u;
 }
 
 void DANStream::SetAbsoluteStartTime(const uint64 absoluteStartTimeIn) {
@@ -126,6 +186,7 @@ void DANStream::SetRelativeTimeSignal(uint32 * const timeRelativeSignalIn) {
 
 bool DANStream::PutData() {
     bool ok = true;
+    bool flushed = true;
     uint64 timeStamp = 0u;
     if (useExternalAbsoluteTimingSignal) {
         /*lint -e{613} timeAbsoluteSignal cannot be NULL as otherwise useExternalAbsoluteTimingSignal=false*/
@@ -144,39 +205,69 @@ bool DANStream::PutData() {
         timeStamp += writeCounts * static_cast<uint64>(numberOfSamples) * periodNanos;
         writeCounts++;
     }
-    if ((blockInterleavedMemory != NULL_PTR(char8 *)) && (blockMemory != NULL_PTR(char8 *))) {
-        char8 *src = NULL_PTR(char8 *);
-        char8 *dest = NULL_PTR(char8 *);
-        if (interleave) {
-            uint32 s;
-            uint32 z;
-            //Interleave the memory data
-            for (s = 0u; (s < numberOfSignals) && (ok); s++) {
-                for (z = 0u; (z < numberOfSamples) && (ok); z++) {
-                    uint32 blockMemoryIdx = s * numberOfSamples * typeSize;
-                    blockMemoryIdx += (z * typeSize);
-                    src = &blockMemory[blockMemoryIdx];
-
-                    uint32 blockInterleavedMemoryIdx = s * typeSize;
-                    blockInterleavedMemoryIdx += (z * numberOfSignals * typeSize);
-                    dest = &blockInterleavedMemory[blockInterleavedMemoryIdx];
-                    ok = MemoryOperationsHelper::Copy(dest, src, typeSize);
-                }
+    if (blockMemory != NULL_PTR(char8 *)) {
+        if (batchCycle > 0u) {
+            //The batch is submitted with the time stamp of its first cycle, so DAN assumes that the batched cycles are contiguous.
+            //A cycle which is not (e.g. the time signal jumped or a new trigger window started) closes the batch.
+            uint64 contiguousTimeStamp = batchTimeStamp + (static_cast<uint64>(batchCycle) * static_cast<uint64>(numberOfSamples) * periodNanos);
+            if (timeStamp != contiguousTimeStamp) {
+                flushed = FlushBatch();
             }
         }
-        else {
-            src = &blockMemory[0u];
-            dest = &blockInterleavedMemory[0u];
-            ok = MemoryOperationsHelper::Copy(dest, src, blockSize);
+        if (batchCycle == 0u) {
+            batchTimeStamp = timeStamp;
         }
-        if (ok) {
-            //Check for >= 0 as true means == 1 but on CCS 6.0 true will be == 0
-            ok = DANAPI::PutDataBlock(danSource, timeStamp, blockInterleavedMemory, blockSize);
+        if (blockInterleavedMemory == NULL_PTR(char8 *)) {
+            //Data already in the DAN layout and no batching: submit the block directly
+            ok = DANAPI::PutDataBlock(danSource, batchTimeStamp, blockMemory, blockSize);
+        }
+        else {
+            char8 *dest = &blockInterleavedMemory[batchCycle * blockSize];
+            if (RequiresInterleaving()) {
+                if (typeSize == 1u) {
+                    DANStreamInterleave<uint8>(blockMemory, dest, numberOfSignals, numberOfSamples);
+                }
+                else if (typeSize == 2u) {
+                    DANStreamInterleave<uint16>(blockMemory, dest, numberOfSignals, numberOfSamples);
+                }
+                else if (typeSize == 4u) {
+                    DANStreamInterleave<uint32>(blockMemory, dest, numberOfSignals, numberOfSamples);
+                }
+                else if (typeSize == 8u) {
+                    DANStreamInterleave<uint64>(blockMemory, dest, numberOfSignals, numberOfSamples);
+                }
+                else {
+                    uint32 s;
+                    uint32 z;
+                    for (s = 0u; (s < numberOfSignals) && (ok); s++) {
+                        for (z = 0u; (z < numberOfSamples) && (ok); z++) {
+                            uint32 blockMemoryIdx = s * numberOfSamples * typeSize;
+                            blockMemoryIdx += (z * typeSize);
+                            uint32 blockInterleavedMemoryIdx = s * typeSize;
+                            blockInterleavedMemoryIdx += (z * numberOfSignals * typeSize);
+                            ok = MemoryOperationsHelper::Copy(&dest[blockInterleavedMemoryIdx], &blockMemory[blockMemoryIdx], typeSize);
+                        }
+                    }
+                }
+            }
+            else {
+                ok = MemoryOperationsHelper::Copy(dest, &blockMemory[0u], blockSize);
+            }
+            if (ok) {
+                batchCycle++;
+                if (batchCycle == numberOfCyclesPerBlock) {
+                    batchCycle = 0u;
+                    ok = DANAPI::PutDataBlock(danSource, batchTimeStamp, blockInterleavedMemory, blockSize * numberOfCyclesPerBlock);
+                }
+            }
         }
     }
     else {
         ok = false;
     }
+    if (!flushed) {
+        ok = false;
+    }
     return ok;
 }
 
@@ -189,17 +280,25 @@ bool DANStream::OpenStream() {
 }
 
 bool DANStream::CloseStream() {
-    return DANAPI::CloseStream(danSource);
+    bool ok = FlushBatch();
+    if (!DANAPI::CloseStream(danSource)) {
+        ok = false;
+    }
+    return ok;
 }
 
 void DANStream::Finalise() {
     blockSize = numberOfSignals * typeSize * numberOfSamples;
     blockMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(blockSize));
-    blockInterleavedMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(blockSize));
+    uint32 batchSize = blockSize * numberOfCyclesPerBlock;
+    //The staging memory is only needed if the data has to be transposed or if several cycles are batched in a single block
+    if ((RequiresInterleaving()) || (numberOfCyclesPerBlock > 1u)) {
+        blockInterleavedMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(batchSize));
+    }
     (void) danSourceName.Seek(0LLU);
     (void) danSourceName.Printf("%s_%s", baseName.Buffer(), TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
     (void) danSourceName.Seek(0LLU);
-    uint32 danBufferSize = blockSize * danBufferMultiplier;
+    uint32 danBufferSize = batchSize * danBufferMultiplier;
     danSource = DANAPI::PublishSource(danSourceName.Buffer(), danBufferSize);
 }
 
@@ -219,6 +318,20 @@ void DANStream::AddSignal(const uint32 signalIdx) {
     numberOfSignals++;
 }
 
+bool DANStream::FlushBatch() {
+    bool ok = true;
+    if ((batchCycle > 0u) && (blockInterleavedMemory != NULL_PTR(char8 *))) {
+        ok = DANAPI::PutDataBlock(danSource, batchTimeStamp, blockInterleavedMemory, blockSize * batchCycle);
+        batchCycle = 0u;
+    }
+    return ok;
+}
+
+bool DANStream::RequiresInterleaving() const {
+    //With one sample per signal the signal-major and the sample-major layouts are the same
+    return (interleave && (numberOfSamples > 1u) && (numberOfSignals > 1u));
+}
+
 bool DANStream::GetSignalMemoryBuffer(const uint32 signalIdx, void*& signalAddress) {
     uint32 s;
     bool found = false;
@@ -42,6 +42,11 @@ namespace MARTe {
 /**
  * @brief Wraps a DAN stream (see dan_publisher_openStream).
  * @details The DANSource will create a new DANStream for each signal type/signal frequency pair.
+ *
+ * The signals are written (by the broker) signal after signal and, if interleave is true, transposed into the sample after sample layout expected by DAN
+ * using a cache-blocked kernel specialised for each type size. When no transposition is required (interleave is false or there is only one sample/signal)
+ * and no batching is configured the block is submitted to DAN directly, without any staging copy.
+ * Several cycles can be accumulated and submitted in a single dan_publisher_putDataBlock (see SetNumberOfCyclesPerBlock).
  */
 class DANStream {
 public:
@@ -93,7 +98,7 @@ public:
 
     /**
      * @brief All the signals have been added. Call dan_publisher_publishSource_withDAQBuffer with the final buffer size.
-     * @details The computed buffer size will be given by numberOfSignals * typeSize * numberOfSamples * danBufferMultiplier
+     * @details The computed buffer size will be given by numberOfSignals * typeSize * numberOfSamples * numberOfCyclesPerBlock * danBufferMultiplier
      */
     void Finalise();
 
@@ -103,7 +108,10 @@ public:
      * - if useExternalAbsoluteTimingSignal the time is read directly from the signal set with SetAbsoluteTimeSignal and is assumed to be the absolute time in nano-seconds from the Epoch.
      * - if useExternalRelativeTimingSignal the relative time will be read directly from the signal set with SetRelativeTimeSignal and added to the time set in SetAbsoluteStartTime.
      * - otherwise the number of times this function has been called (stored in the counter), multiplied by the period in nano-seconds will be added to the time set in SetAbsoluteStartTime.
-     * @return true if dan_publisher_putDataBlock returns >= 0.
+     * When numberOfCyclesPerBlock > 1 the data is accumulated and only submitted every numberOfCyclesPerBlock calls, with the time stamp of the first cycle of the batch.
+     * If the time stamp of a cycle is not contiguous with the batch (i.e. it differs from the time stamp of the first cycle plus the number of samples
+     * already batched times the period) the incomplete batch is submitted first and a new batch is started with this cycle.
+     * @return true if the data was successfully interleaved and, when submitted, dan_publisher_putDataBlock returns >= 0.
      */
     bool PutData();
 
@@ -115,6 +123,7 @@ public:
 
     /**
      * @brief Close the DANStream.
+     * @details Any incomplete batch of cycles is submitted before closing the stream.
      * @return true if dan_publisher_closeStream returns 0.
      */
     bool CloseStream();
@@ -128,7 +137,26 @@ public:
     bool GetSignalMemoryBuffer(const uint32 signalIdx, void*& signalAddress);
 
     /**
-     * @brief Resets the counter used by PutData.
+     * @brief Sets the number of PutData cycles that are submitted in a single dan_publisher_putDataBlock.
+     * @details Only effective if called before Finalise and if numberOfCyclesPerBlockIn > 0.
+     * @param[in] numberOfCyclesPerBlockIn the number of cycles per block.
+     */
+    void SetNumberOfCyclesPerBlock(uint32 numberOfCyclesPerBlockIn);
+
+    /**
+     * @brief Gets the number of PutData cycles that are submitted in a single dan_publisher_putDataBlock.
+     * @return the number of cycles per block.
+     */
+    uint32 GetNumberOfCyclesPerBlock() const;
+
+    /**
+     * @brief Gets the number of PutData cycles accumulated in the current (incomplete) batch.
+     * @return the number of cycles waiting to be submitted.
+     */
+    uint32 GetNumberOfBatchedCycles() const;
+
+    /**
+     * @brief Resets the counter used by PutData and discards any incomplete batch of cycles.
      */
     void Reset();
 
@@ -151,6 +179,17 @@ public:
     void SetAbsoluteStartTime(uint64 absoluteStartTimeIn);
 
 private:
+    /**
+     * @brief Returns true if the blockMemory has to be transposed before being submitted to DAN.
+     */
+    bool RequiresInterleaving() const;
+
+    /**
+     * @brief Submits the cycles of an incomplete batch (if any) with dan_publisher_putDataBlock.
+     * @return true if there was nothing to submit or if dan_publisher_putDataBlock returns >= 0.
+     */
+    bool FlushBatch();
+
     /**
      * The type descriptor of the stream.
      */
@@ -168,6 +207,7 @@ private:
 
     /**
      * The DAN memory is interleaved so that the blockMemory needs to be translated into the this interleaved memory.
+     * Holds numberOfCyclesPerBlock blocks. Not allocated if the blockMemory can be directly submitted to DAN.
      */
     char8 *blockInterleavedMemory;
 
@@ -256,6 +296,21 @@ private:
      */
     bool interleave;
 
+    /**
+     * Number of PutData cycles submitted in a single dan_publisher_putDataBlock.
+     */
+    uint32 numberOfCyclesPerBlock;
+
+    /**
+     * Index of the current cycle in the batch.
+     */
+    uint32 batchCycle;
+
+    /**
+     * Time stamp of the first cycle in the batch.
+     */
+    uint64 batchTimeStamp;
+
     /*lint -e{1712} This class does not have a default constructor because
      * the constructor input parameters must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -31,7 +31,8 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "EPICSCAInput.h"
-#include "MemoryMapInputBroker.h"
+#include "HighResolutionTimer.h"
+#include "MemoryMapSynchronisedInputBroker.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -39,18 +40,29 @@
 
 namespace MARTe {
 /**
- * @brief Callback function for the ca_create_subscription. Single point of access which
- * delegates the events to the corresponding EPICSPV instance.
+ * Protects the creation and destruction of the channels and of the PVs memory.
  */
 static FastPollingMutexSem eventCallbackFastMux;
+
+/**
+ * @brief Callback function for the ca_create_subscription. Stores the value on the back buffer
+ * of the corresponding PV and exchanges it with the shared buffer. Does not take any lock.
+ */
 /*lint -e{1746} function must match required prototype and thus cannot be changed to constant reference.*/
 void EPICSCAInputEventCallback(struct event_handler_args const args) {
-    (void) eventCallbackFastMux.FastLock();
     PVWrapper *pv = static_cast<PVWrapper *>(args.usr);
-    if (pv != NULL_PTR(PVWrapper *)) {
-        (void) MemoryOperationsHelper::Copy(pv->memory, args.dbr, pv->memorySize);
+    if ((pv != NULL_PTR(PVWrapper *)) && (args.status == ECA_NORMAL) && (args.dbr != NULL_PTR(const void *))) {
+        if (pv->buffers != NULL_PTR(char8 *)) {
+            uint32 b = pv->backBuffer;
+            (void) MemoryOperationsHelper::Copy(&pv->buffers[b * pv->memorySize], args.dbr, pv->memorySize);
+            pv->numberOfUpdates++;
+            pv->updateInfo[b].numberOfUpdates = pv->numberOfUpdates;
+            pv->updateInfo[b].timestamp = HighResolutionTimer::Counter();
+            //The exchange is also a full memory barrier, i.e. the buffer is completely written before being published.
+            int32 previous = Atomic::Exchange(&pv->sharedBuffer, (static_cast<int32>(b) | EPICSCA_INPUT_FRESH_BUFFER));
+            pv->backBuffer = static_cast<uint32>(previous & (EPICSCA_INPUT_FRESH_BUFFER - 1));
+        }
     }
-    eventCallbackFastMux.FastUnLock();
 }
 }
 /*---------------------------------------------------------------------------*/
@@ -80,6 +92,9 @@ EPICSCAInput::~EPICSCAInput() {
             if (pvs[n].memory != NULL_PTR(void *)) {
                 GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(pvs[n].memory);
             }
+            if (pvs[n].buffers != NULL_PTR(char8 *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(pvs[n].buffers));
+            }
         }
         delete[] pvs;
     }
@@ -158,6 +173,16 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
+            pvs[n].buffers = NULL_PTR(char8 *);
+            pvs[n].backBuffer = 0u;
+            pvs[n].sharedBuffer = 1;
+            pvs[n].frontBuffer = 2u;
+            pvs[n].numberOfUpdates = 0u;
+            pvs[n].numberOfUpdatesSignal = NULL_PTR(uint32 *);
+            pvs[n].timestampSignal = NULL_PTR(uint64 *);
+            pvs[n].pvSignalIdx = 0u;
+            pvs[n].isPV = true;
+            pvs[n].pvName[0] = '\0';
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
             //Note that the RealTimeApplicationConfigurationBuilder is allowed to change the order of the signals w.r.t. to the originalSignalInformation
@@ -168,75 +193,148 @@ bool EPICSCAInput::SetConfiguredDatabase(StructuredDataI & data) {
                 //and the ones which are later added by the RealTimeApplicationConfigurationBuilder
                 ok = originalSignalInformation.MoveRelative(orderedSignalName.Buffer());
             }
-            StreamString pvName;
+            StreamString pvSignalName;
+            bool isUpdateCounter = false;
+            bool isTimestamp = false;
             if (ok) {
-                ok = originalSignalInformation.Read("PVName", pvName);
-                if (!ok) {
-                    uint32 nn = n;
-                    REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
+                isUpdateCounter = originalSignalInformation.Read("UpdateCounterOf", pvSignalName);
+                if (!isUpdateCounter) {
+                    isTimestamp = originalSignalInformation.Read("TimestampOf", pvSignalName);
                 }
             }
-            TypeDescriptor td = GetSignalType(n);
-            if (ok) {
-                pvs[n].td = td;
-                (void) StringHelper::CopyN(&pvs[n].pvName[0], pvName.Buffer(), PV_NAME_MAX_SIZE);
-                if (td == CharString) {
-                    pvs[n].pvType = DBR_STRING;
+            if ((ok) && ((isUpdateCounter) || (isTimestamp))) {
+                pvs[n].isPV = false;
+                TypeDescriptor expectedType = UnsignedInteger32Bit;
+                if (isTimestamp) {
+                    expectedType = UnsignedInteger64Bit;
                 }
-                else if (td == Character8Bit) {
-                    pvs[n].pvType = DBR_STRING;
+                uint32 numberOfElements = 0u;
+                ok = ((GetSignalType(n) == expectedType) && (GetSignalNumberOfElements(n, numberOfElements)));
+                if (ok) {
+                    ok = (numberOfElements == 1u);
                 }
-                else if (td == SignedInteger8Bit) {
-                    pvs[n].pvType = DBR_CHAR;
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The signal %s shall be a scalar %s", orderedSignalName.Buffer(),
+                                 TypeDescriptor::GetTypeNameFromTypeDescriptor(expectedType));
                 }
-                else if (td == UnsignedInteger8Bit) {
-                    pvs[n].pvType = DBR_CHAR;
+                if (ok) {
+                    ok = GetSignalIndex(pvs[n].pvSignalIdx, pvSignalName.Buffer());
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "The signal %s is not defined", pvSignalName.Buffer());
+                    }
                 }
-                else if (td == SignedInteger16Bit) {
-                    pvs[n].pvType = DBR_SHORT;
+                if (ok) {
+                    pvs[n].td = expectedType;
+                    pvs[n].numberOfElements = 1u;
+                    pvs[n].memorySize = expectedType.numberOfBits;
+                    pvs[n].memorySize /= 8u;
+                    pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                    ok = MemoryOperationsHelper::Set(pvs[n].memory, '\0', pvs[n].memorySize);
                 }
-                else if (td == UnsignedInteger16Bit) {
-                    pvs[n].pvType = DBR_SHORT;
+                if (ok) {
+                    ok = originalSignalInformation.MoveToAncestor(1u);
                 }
-                else if (td == SignedInteger32Bit) {
-                    pvs[n].pvType = DBR_LONG;
+            }
+            else {
+                StreamString pvName;
+                if (ok) {
+                    ok = originalSignalInformation.Read("PVName", pvName);
+                    if (!ok) {
+                        uint32 nn = n;
+                        REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
+                    }
                 }
-                else if (td == UnsignedInteger32Bit) {
-                    pvs[n].pvType = DBR_LONG;
+                TypeDescriptor td = GetSignalType(n);
+                if (ok) {
+                    pvs[n].td = td;
+                    (void) StringHelper::CopyN(&pvs[n].pvName[0], pvName.Buffer(), PV_NAME_MAX_SIZE);
+                    if (td == CharString) {
+                        pvs[n].pvType = DBR_STRING;
+                    }
+                    else if (td == Character8Bit) {
+                        pvs[n].pvType = DBR_STRING;
+                    }
+                    else if (td == SignedInteger8Bit) {
+                        pvs[n].pvType = DBR_CHAR;
+                    }
+                    else if (td == UnsignedInteger8Bit) {
+                        pvs[n].pvType = DBR_CHAR;
+                    }
+                    else if (td == SignedInteger16Bit) {
+                        pvs[n].pvType = DBR_SHORT;
+                    }
+                    else if (td == UnsignedInteger16Bit) {
+                        pvs[n].pvType = DBR_SHORT;
+                    }
+                    else if (td == SignedInteger32Bit) {
+                        pvs[n].pvType = DBR_LONG;
+                    }
+                    else if (td == UnsignedInteger32Bit) {
+                        pvs[n].pvType = DBR_LONG;
+                    }
+                    else if (td == Float32Bit) {
+                        pvs[n].pvType = DBR_FLOAT;
+                    }
+                    else if (td == Float64Bit) {
+                        pvs[n].pvType = DBR_DOUBLE;
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Type %s is not supported", TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
+                        ok = false;
+                    }
                 }
-                else if (td == Float32Bit) {
-                    pvs[n].pvType = DBR_FLOAT;
+                uint32 numberOfElements = 1u;
+                if (ok) {
+                    ok = GetSignalNumberOfElements(n, numberOfElements);
                 }
-                else if (td == Float64Bit) {
-                    pvs[n].pvType = DBR_DOUBLE;
+                if (ok) {
+                    if (pvs[n].pvType == DBR_STRING) {
+                        ok = (numberOfElements == 40u);
+                    }
+                    if (!ok) {
+                        //Could support arrays of strings with multiples of char8[40]
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Strings shall be defined with 40 elements char8[40]. Arrays of strings are not currently supported");
+                    }
                 }
-                else {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "Type %s is not supported", TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
-                    ok = false;
+                if (ok) {
+                    pvs[n].numberOfElements = numberOfElements;
                 }
-            }
-            uint32 numberOfElements = 1u;
-            if (ok) {
-                ok = GetSignalNumberOfElements(n, numberOfElements);
-            }
-            if (ok) {
-                if (pvs[n].pvType == DBR_STRING) {
-                    ok = (numberOfElements == 40u);
+                if (ok) {
+                    pvs[n].memorySize = td.numberOfBits;
+                    pvs[n].memorySize /= 8u;
+                    pvs[n].memorySize *= numberOfElements;
+                    pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                    ok = MemoryOperationsHelper::Set(pvs[n].memory, '\0', pvs[n].memorySize);
                 }
-                if (!ok) {
-                    //Could support arrays of strings with multiples of char8[40]
-                    REPORT_ERROR(ErrorManagement::ParametersError, "Strings shall be defined with 40 elements char8[40]. Arrays of strings are not currently supported");
+                if (ok) {
+                    uint32 buffersSize = (pvs[n].memorySize * EPICSCA_INPUT_NUMBER_OF_BUFFERS);
+                    pvs[n].buffers = static_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(buffersSize));
+                    ok = MemoryOperationsHelper::Set(pvs[n].buffers, '\0', buffersSize);
+                }
+                if (ok) {
+                    ok = originalSignalInformation.MoveToAncestor(1u);
                 }
             }
-            if (ok) {
-                pvs[n].numberOfElements = numberOfElements;
-            }
-            if (ok) {
-                pvs[n].memorySize = td.numberOfBits;
-                pvs[n].memorySize /= 8u;
-                pvs[n].memorySize *= numberOfElements;
-                pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
-                ok = originalSignalInformation.MoveToAncestor(1u);
+        }
+    }
+    if (ok) {
+        //Associate the UpdateCounterOf and TimestampOf signals to their PVs
+        uint32 n;
+        for (n = 0u; (n < nOfSignals) && (ok); n++) {
+            if (!pvs[n].isPV) {
+                uint32 pvIdx = pvs[n].pvSignalIdx;
+                ok = pvs[pvIdx].isPV;
+                if (!ok) {
+                    StreamString signalName;
+                    (void) GetSignalName(n, signalName);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The signal %s shall refer to a signal with a PVName", signalName.Buffer());
+                }
+                else if (pvs[n].td == UnsignedInteger32Bit) {
+                    pvs[pvIdx].numberOfUpdatesSignal = static_cast<uint32 *>(pvs[n].memory);
+                }
+                else {
+                    pvs[pvIdx].timestampSignal = static_cast<uint64 *>(pvs[n].memory);
+                }
             }
         }
     }
@@ -273,13 +371,13 @@ bool EPICSCAInput::GetSignalMemoryBuffer(const uint32 signalIdx, const uint32 bu
 const char8* EPICSCAInput::GetBrokerName(StructuredDataI& data, const SignalDirection direction) {
     const char8* brokerName = "";
     if (direction == InputSignals) {
-        brokerName = "MemoryMapInputBroker";
+        brokerName = "MemoryMapSynchronisedInputBroker";
     }
     return brokerName;
 }
 
 bool EPICSCAInput::GetInputBrokers(ReferenceContainer& inputBrokers, const char8* const functionName, void* const gamMemPtr) {
-    ReferenceT<MemoryMapInputBroker> broker("MemoryMapInputBroker");
+    ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
     bool ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
     if (ok) {
         ok = inputBrokers.Insert(broker);
@@ -312,17 +410,19 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
         uint32 nOfSignals = GetNumberOfSignals();
         if (pvs != NULL_PTR(PVWrapper *)) {
             for (n = 0u; (n < nOfSignals); n++) {
-                /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                if (ca_create_channel(&pvs[n].pvName[0], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvs[n].pvChid) != ECA_NORMAL) {
-                    err = ErrorManagement::FatalError;
-                    REPORT_ERROR(err, "ca_create_channel failed for PV with name %s", pvs[n].pvName);
-                }
-                if (err.ErrorsCleared()) {
+                if (pvs[n].isPV) {
                     /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                    if (ca_create_subscription(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE, &EPICSCAInputEventCallback, &pvs[n],
-                                               &pvs[n].pvEvid) != ECA_NORMAL) {
+                    if (ca_create_channel(&pvs[n].pvName[0], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvs[n].pvChid) != ECA_NORMAL) {
                         err = ErrorManagement::FatalError;
-                        REPORT_ERROR(err, "ca_create_subscription failed for PV %s", pvs[n].pvName);
+                        REPORT_ERROR(err, "ca_create_channel failed for PV with name %s", pvs[n].pvName);
+                    }
+                    if (err.ErrorsCleared()) {
+                        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+                        if (ca_create_subscription(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, DBE_VALUE, &EPICSCAInputEventCallback, &pvs[n],
+                                                   &pvs[n].pvEvid) != ECA_NORMAL) {
+                            err = ErrorManagement::FatalError;
+                            REPORT_ERROR(err, "ca_create_subscription failed for PV %s", pvs[n].pvName);
+                        }
                     }
                 }
             }
@@ -338,9 +438,11 @@ ErrorManagement::ErrorType EPICSCAInput::Execute(ExecutionInfo& info) {
         uint32 nOfSignals = GetNumberOfSignals();
         if (pvs != NULL_PTR(PVWrapper *)) {
             for (n = 0u; (n < nOfSignals); n++) {
-                (void) ca_clear_subscription(pvs[n].pvEvid);
-                (void) ca_clear_event(pvs[n].pvEvid);
-                (void) ca_clear_channel(pvs[n].pvChid);
+                if (pvs[n].isPV) {
+                    (void) ca_clear_subscription(pvs[n].pvEvid);
+                    (void) ca_clear_event(pvs[n].pvEvid);
+                    (void) ca_clear_channel(pvs[n].pvChid);
+                }
             }
         }
         ca_detach_context();
@@ -360,7 +462,27 @@ uint32 EPICSCAInput::GetCPUMask() const {
 }
 
 bool EPICSCAInput::Synchronise() {
-    return false;
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (pvs != NULL_PTR(PVWrapper *)) {
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            //Only the callback sets the fresh flag and only Synchronise clears it, so that the shared buffer can be safely taken.
+            bool fresh = ((pvs[n].isPV) && ((pvs[n].sharedBuffer & EPICSCA_INPUT_FRESH_BUFFER) != 0));
+            if (fresh) {
+                int32 previous = Atomic::Exchange(&pvs[n].sharedBuffer, static_cast<int32>(pvs[n].frontBuffer));
+                uint32 b = static_cast<uint32>(previous & (EPICSCA_INPUT_FRESH_BUFFER - 1));
+                pvs[n].frontBuffer = b;
+                (void) MemoryOperationsHelper::Copy(pvs[n].memory, &pvs[n].buffers[b * pvs[n].memorySize], pvs[n].memorySize);
+                if (pvs[n].numberOfUpdatesSignal != NULL_PTR(uint32 *)) {
+                    *pvs[n].numberOfUpdatesSignal = pvs[n].updateInfo[b].numberOfUpdates;
+                }
+                if (pvs[n].timestampSignal != NULL_PTR(uint64 *)) {
+                    *pvs[n].timestampSignal = pvs[n].updateInfo[b].timestamp;
+                }
+            }
+        }
+    }
+    return true;
 }
 
 CLASS_REGISTER(EPICSCAInput, "1.0")
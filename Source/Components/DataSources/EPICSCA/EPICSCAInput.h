@@ -33,6 +33,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
@@ -48,6 +49,32 @@ namespace MARTe {
 /*lint -esym(551, MARTe::PV_NAME_MAX_SIZE) the symbol is used to define the size of PVWrapper below*/
 const uint32 PV_NAME_MAX_SIZE = 64u;
 
+/**
+ * Number of buffers of each PV (triple buffering between the subscription callback and the real-time thread).
+ */
+/*lint -esym(551, MARTe::EPICSCA_INPUT_NUMBER_OF_BUFFERS) the symbol is used to define the size of PVWrapper below*/
+const uint32 EPICSCA_INPUT_NUMBER_OF_BUFFERS = 3u;
+
+/**
+ * Set on the PVWrapper::shared index when the shared buffer holds a value which was not yet read.
+ */
+const int32 EPICSCA_INPUT_FRESH_BUFFER = 0x100;
+
+/**
+ * Information stored with each buffered value of a PV.
+ */
+struct PVUpdateInfo {
+    /**
+     * The number of updates received when this value was stored.
+     */
+    uint32 numberOfUpdates;
+
+    /**
+     * The HighResolutionTimer::Counter() when this value was stored.
+     */
+    uint64 timestamp;
+};
+
 /**
  * Wraps a PV
  */
@@ -69,10 +96,60 @@ struct PVWrapper {
     chtype pvType;
 
     /**
-     * The memory of the signal associated to this channel
+     * The memory of the signal associated to this channel (only written by Synchronise)
      */
     void *memory;
 
+    /**
+     * EPICSCA_INPUT_NUMBER_OF_BUFFERS buffers with memorySize each.
+     */
+    char8 *buffers;
+
+    /**
+     * Information about the value stored in each buffer.
+     */
+    PVUpdateInfo updateInfo[EPICSCA_INPUT_NUMBER_OF_BUFFERS];
+
+    /**
+     * The buffer being written by the callback.
+     */
+    uint32 backBuffer;
+
+    /**
+     * The buffer exchanged between the callback and Synchronise (ORed with EPICSCA_INPUT_FRESH_BUFFER when not yet read).
+     */
+    volatile int32 sharedBuffer;
+
+    /**
+     * The buffer last read by Synchronise.
+     */
+    uint32 frontBuffer;
+
+    /**
+     * The number of updates received (only written by the callback).
+     */
+    uint32 numberOfUpdates;
+
+    /**
+     * The memory of the UpdateCounterOf signal associated to this PV (NULL if not defined).
+     */
+    uint32 *numberOfUpdatesSignal;
+
+    /**
+     * The memory of the TimestampOf signal associated to this PV (NULL if not defined).
+     */
+    uint64 *timestampSignal;
+
+    /**
+     * Index of the PV signal if this is an UpdateCounterOf or TimestampOf signal.
+     */
+    uint32 pvSignalIdx;
+
+    /**
+     * True if the signal is associated to a PV (and not an UpdateCounterOf or TimestampOf signal).
+     */
+    bool isPV;
+
     /**
      * The number of elements > 0
      */
@@ -98,6 +175,15 @@ struct PVWrapper {
  * @brief A DataSource which allows to retrieved data from any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously retrieved using ca_create_subscriptions in the context of a different thread (w.r.t. to the real-time thread).
  *
+ * Each PV is triple buffered: the subscription callback writes on a buffer that is only owned by the callback and exchanges it
+ * (atomically) with the shared buffer. In Synchronise (called by the MemoryMapSynchronisedInputBroker) the real-time thread exchanges
+ * its buffer with the shared one, only if the latter holds a new value, and copies it to the signal memory.
+ * The callbacks of different PVs never share a lock and the GAMs always read a complete (not torn) value of each PV.
+ *
+ * The number of updates received and the time (HighResolutionTimer::Counter()) of the update of each PV can be
+ * read using signals with UpdateCounterOf (uint32) and TimestampOf (uint64) instead of PVName. These are consistent with the value
+ * of the PV signal read in the same cycle.
+ *
  * The configuration syntax is (names are only given as an example):
  *
  * <pre>
@@ -111,6 +197,14 @@ struct PVWrapper {
  *             Type = uint32 //Compulsory. Supported types are char8[40], string[40], uint8, int8, uint16, int16, int32, uint32, uint64, int64, float32 and float64
  *             NumberOfElements = 1 //Arrays also supported
  *          }
+ *          PV1Updates = { //Optional
+ *             UpdateCounterOf = PV1 //Name of the signal of the PV. Number of updates received.
+ *             Type = uint32 //Compulsory. Shall be uint32
+ *          }
+ *          PV1Time = { //Optional
+ *             TimestampOf = PV1 //Name of the signal of the PV. HighResolutionTimer::Counter() of the last update received.
+ *             Type = uint64 //Compulsory. Shall be uint64
+ *          }
  *          ...
  *     }
  * }
@@ -154,16 +248,16 @@ public:
             void *&signalAddress);
 
     /**
-     * @brief See DataSourceI::GetNumberOfMemoryBuffers.
+     * @brief See DataSourceI::GetBrokerName.
      * @details Only InputSignals are supported.
-     * @return MemoryMapInputBroker.
+     * @return MemoryMapSynchronisedInputBroker.
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @details adds a memory MemoryMapInputBroker instance to the inputBrokers
+     * @details adds a memory MemoryMapSynchronisedInputBroker instance to the inputBrokers
      * @return true.
      */
     virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
@@ -196,7 +290,7 @@ public:
      * @details This method verifies that all the parameters requested by the GAMs interacting with this DataSource
      *  are valid and consistent with the parameters set during the initialisation phase.
      * In particular the following conditions shall be met:
-     * - All the signals have the PVName defined
+     * - All the signals have the PVName defined (or UpdateCounterOf/TimestampOf with the name of a PV signal)
      * - All the signals have one of the following types: uint32, int32, float32 or float64.
      * @return true if all the parameters are valid and the conditions above are met.
      */
@@ -225,13 +319,14 @@ public:
 
     /**
      * @brief See DataSourceI::Synchronise.
-     * @return false.
+     * @details Copies the last value received of each PV (together with its UpdateCounterOf and TimestampOf) to the signals memory.
+     * @return true.
      */
     virtual bool Synchronise();
 
     /**
      * @brief Registered as the ca_create_subscription callback function.
-     * It calls updates the memory of the corresponding PV variable.
+     * It stores the value on the back buffer of the corresponding PV and publishes it.
      */
     friend void EPICSCAInputEventCallback(struct event_handler_args args);
 
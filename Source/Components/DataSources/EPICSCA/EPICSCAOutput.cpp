@@ -30,13 +30,68 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CLASSMETHODREGISTER.h"
 #include "EPICSCAOutput.h"
+#include "MemoryOperationsHelper.h"
 #include "RegisteredMethodsMessageFilter.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Callback function for the ca_array_put_callback. Called (in the context of a CA thread) when the put completes.
+ */
+/*lint -e{1746} function must match required prototype and thus cannot be changed to constant reference.*/
+void EPICSCAOutputPutCallback(struct event_handler_args const args) {
+    EPICSCAOutputPutState *state = static_cast<EPICSCAOutputPutState *>(args.usr);
+    if (state != NULL_PTR(EPICSCAOutputPutState *)) {
+        if (args.status != ECA_NORMAL) {
+            Atomic::Increment(state->failedPuts);
+        }
+        state->pending = 0;
+        Atomic::Decrement(state->pendingPuts);
+    }
+}
+
+/**
+ * @brief Gets an element of a numeric signal as a float64.
+ */
+static float64 EPICSCAOutputGetElement(const TypeDescriptor &td,
+                                       const void * const memory,
+                                       const uint32 idx) {
+    float64 value = 0.0;
+    if (td == SignedInteger8Bit) {
+        value = static_cast<float64>(static_cast<const int8 *>(memory)[idx]);
+    }
+    else if (td == UnsignedInteger8Bit) {
+        value = static_cast<float64>(static_cast<const uint8 *>(memory)[idx]);
+    }
+    else if (td == SignedInteger16Bit) {
+        value = static_cast<float64>(static_cast<const int16 *>(memory)[idx]);
+    }
+    else if (td == UnsignedInteger16Bit) {
+        value = static_cast<float64>(static_cast<const uint16 *>(memory)[idx]);
+    }
+    else if (td == SignedInteger32Bit) {
+        value = static_cast<float64>(static_cast<const int32 *>(memory)[idx]);
+    }
+    else if (td == UnsignedInteger32Bit) {
+        value = static_cast<float64>(static_cast<const uint32 *>(memory)[idx]);
+    }
+    else if (td == Float32Bit) {
+        value = static_cast<float64>(static_cast<const float32 *>(memory)[idx]);
+    }
+    else if (td == Float64Bit) {
+        value = static_cast<const float64 *>(memory)[idx];
+    }
+    else {
+        //NOOP
+    }
+    return value;
+}
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -51,6 +106,16 @@ EPICSCAOutput::EPICSCAOutput() :
     ignoreBufferOverrun = 1u;
     threadContextSet = false;
     signalFlag = NULL_PTR(uint8*);
+    putMode = EPICSCAOutputPutBlocking;
+    onlyOnChange = 0u;
+    putStates = NULL_PTR(EPICSCAOutputPutState *);
+    pendingPuts = 0;
+    failedPuts = 0;
+    sentPuts = 0u;
+    hasPutCounters = false;
+    pendingPutsSignal = NULL_PTR(uint32 *);
+    failedPutsSignal = NULL_PTR(uint32 *);
+    sentPutsSignal = NULL_PTR(uint32 *);
     ReferenceT < RegisteredMethodsMessageFilter > filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -77,6 +142,18 @@ EPICSCAOutput::~EPICSCAOutput() {
     if (signalFlag != NULL_PTR(uint8*)) {
         delete[] signalFlag;
     }
+    if (putStates != NULL_PTR(EPICSCAOutputPutState *)) {
+        uint32 n;
+        for (n = 0u; (n < nOfSignals); n++) {
+            if (putStates[n].lastValue != NULL_PTR(void *)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(putStates[n].lastValue);
+            }
+        }
+        delete[] putStates;
+    }
+    pendingPutsSignal = NULL_PTR(uint32 *);
+    failedPutsSignal = NULL_PTR(uint32 *);
+    sentPutsSignal = NULL_PTR(uint32 *);
 }
 
 void EPICSCAOutput::Purge(ReferenceContainer &purgeList) {
@@ -107,7 +184,30 @@ bool EPICSCAOutput::Initialise(StructuredDataI & data) {
         if (!data.Read("IgnoreBufferOverrun", ignoreBufferOverrun)) {
             REPORT_ERROR(ErrorManagement::Information, "No IgnoreBufferOverrun defined. Using default = %d", ignoreBufferOverrun);
         }
-
+        StreamString putModeStr;
+        if (data.Read("PutMode", putModeStr)) {
+            if (putModeStr == "Blocking") {
+                putMode = EPICSCAOutputPutBlocking;
+            }
+            else if (putModeStr == "Batched") {
+                putMode = EPICSCAOutputPutBatched;
+            }
+            else if (putModeStr == "Callback") {
+                putMode = EPICSCAOutputPutCallback;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::ParametersError, "PutMode shall be Blocking, Batched or Callback");
+                ok = false;
+            }
+        }
+    }
+    if (ok) {
+        if (data.Read("OnlyOnChange", onlyOnChange)) {
+            ok = ((onlyOnChange == 0u) || (putMode != EPICSCAOutputPutBlocking));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "OnlyOnChange is only supported with PutMode = Batched or Callback");
+            }
+        }
     }
     if (ok) {
         ok = data.MoveRelative("Signals");
@@ -120,6 +220,14 @@ bool EPICSCAOutput::Initialise(StructuredDataI & data) {
         if (ok) {
             ok = originalSignalInformation.MoveToRoot();
         }
+        const char8 * const putCounterNames[] = { "PendingPuts", "FailedPuts", "SentPuts" };
+        uint32 c;
+        for (c = 0u; (c < 3u) && (ok) && (!hasPutCounters); c++) {
+            hasPutCounters = originalSignalInformation.MoveRelative(putCounterNames[c]);
+            if (hasPutCounters) {
+                ok = originalSignalInformation.MoveToRoot();
+            }
+        }
         //Do not allow to add signals in run-time
         if (ok) {
             ok = signalsDatabase.MoveRelative("Signals");
@@ -175,11 +283,19 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
     if (ok) {
         pvs = new PVWrapper[nOfSignals];
         signalFlag = new uint8[nOfSignals];
+        putStates = new EPICSCAOutputPutState[nOfSignals];
         uint32 n;
         for (n = 0u; (n < nOfSignals); n++) {
             pvs[n].memory = NULL_PTR(void *);
             pvs[n].pvChid = NULL_PTR(chid);
+            pvs[n].pvName[0] = '\0';
             signalFlag[n] = 0u;
+            putStates[n].lastValue = NULL_PTR(void *);
+            putStates[n].lastValueValid = false;
+            putStates[n].deadband = 0.0;
+            putStates[n].pending = 0;
+            putStates[n].pendingPuts = &pendingPuts;
+            putStates[n].failedPuts = &failedPuts;
         }
         for (n = 0u; (n < nOfSignals) && (ok); n++) {
             //Note that the RealTimeApplicationConfigurationBuilder is allowed to change the order of the signals w.r.t. to the originalSignalInformation
@@ -190,77 +306,121 @@ bool EPICSCAOutput::SetConfiguredDatabase(StructuredDataI & data) {
                 //and the ones which are later added by the RealTimeApplicationConfigurationBuilder
                 ok = originalSignalInformation.MoveRelative(orderedSignalName.Buffer());
             }
-            StreamString pvName;
-            if (ok) {
-                ok = originalSignalInformation.Read("PVName", pvName);
-                if (!ok) {
-                    uint32 nn = n;
-                    REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
-                }
-            }
-            TypeDescriptor td = GetSignalType(n);
-
-            if (ok) {
-                (void) StringHelper::CopyN(&pvs[n].pvName[0], pvName.Buffer(), PV_NAME_MAX_SIZE);
-                if (td == CharString) {
-                    pvs[n].pvType = DBR_STRING;
-                }
-                else if (td == Character8Bit) {
-                    pvs[n].pvType = DBR_STRING;
-                }
-                else if (td == SignedInteger8Bit) {
-                    pvs[n].pvType = DBR_CHAR;
+            bool isPutCounter = ((orderedSignalName == "PendingPuts") || (orderedSignalName == "FailedPuts") || (orderedSignalName == "SentPuts"));
+            if ((ok) && (isPutCounter)) {
+                uint32 numberOfElements = 0u;
+                ok = ((GetSignalType(n) == UnsignedInteger32Bit) && (GetSignalNumberOfElements(n, numberOfElements)));
+                if (ok) {
+                    ok = (numberOfElements == 1u);
                 }
-                else if (td == UnsignedInteger8Bit) {
-                    pvs[n].pvType = DBR_CHAR;
+                if (ok) {
+                    pvs[n].pvType = DBR_LONG;
+                    pvs[n].numberOfElements = 1u;
+                    pvs[n].memorySize = static_cast<uint32>(sizeof(uint32));
+                    pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                    ok = MemoryOperationsHelper::Set(pvs[n].memory, '\0', pvs[n].memorySize);
                 }
-                else if (td == SignedInteger16Bit) {
-                    pvs[n].pvType = DBR_SHORT;
+                if (ok) {
+                    if (orderedSignalName == "PendingPuts") {
+                        pendingPutsSignal = static_cast<uint32 *>(pvs[n].memory);
+                    }
+                    else if (orderedSignalName == "FailedPuts") {
+                        failedPutsSignal = static_cast<uint32 *>(pvs[n].memory);
+                    }
+                    else {
+                        sentPutsSignal = static_cast<uint32 *>(pvs[n].memory);
+                    }
+                    ok = originalSignalInformation.MoveToAncestor(1u);
                 }
-                else if (td == UnsignedInteger16Bit) {
-                    pvs[n].pvType = DBR_SHORT;
+                else {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "The %s signal shall be a scalar uint32", orderedSignalName.Buffer());
                 }
-                else if (td == SignedInteger32Bit) {
-                    pvs[n].pvType = DBR_LONG;
+            }
+            else {
+                StreamString pvName;
+                if (ok) {
+                    ok = originalSignalInformation.Read("PVName", pvName);
+                    if (!ok) {
+                        uint32 nn = n;
+                        REPORT_ERROR(ErrorManagement::ParametersError, "No PVName specified for signal at index %d", nn);
+                    }
                 }
-                else if (td == UnsignedInteger32Bit) {
-                    pvs[n].pvType = DBR_LONG;
+                TypeDescriptor td = GetSignalType(n);
+
+                if (ok) {
+                    (void) StringHelper::CopyN(&pvs[n].pvName[0], pvName.Buffer(), PV_NAME_MAX_SIZE);
+                    if (td == CharString) {
+                        pvs[n].pvType = DBR_STRING;
+                    }
+                    else if (td == Character8Bit) {
+                        pvs[n].pvType = DBR_STRING;
+                    }
+                    else if (td == SignedInteger8Bit) {
+                        pvs[n].pvType = DBR_CHAR;
+                    }
+                    else if (td == UnsignedInteger8Bit) {
+                        pvs[n].pvType = DBR_CHAR;
+                    }
+                    else if (td == SignedInteger16Bit) {
+                        pvs[n].pvType = DBR_SHORT;
+                    }
+                    else if (td == UnsignedInteger16Bit) {
+                        pvs[n].pvType = DBR_SHORT;
+                    }
+                    else if (td == SignedInteger32Bit) {
+                        pvs[n].pvType = DBR_LONG;
+                    }
+                    else if (td == UnsignedInteger32Bit) {
+                        pvs[n].pvType = DBR_LONG;
+                    }
+                    else if (td == Float32Bit) {
+                        pvs[n].pvType = DBR_FLOAT;
+                    }
+                    else if (td == Float64Bit) {
+                        pvs[n].pvType = DBR_DOUBLE;
+                    }
+                    else {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "Type %s is not supported", TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
+                        ok = false;
+                    }
                 }
-                else if (td == Float32Bit) {
-                    pvs[n].pvType = DBR_FLOAT;
+                uint32 numberOfElements = 1u;
+                if (ok) {
+                    ok = GetSignalNumberOfElements(n, numberOfElements);
                 }
-                else if (td == Float64Bit) {
-                    pvs[n].pvType = DBR_DOUBLE;
+                if (ok) {
+                    if (pvs[n].pvType == DBR_STRING) {
+                        ok = (numberOfElements == 40u);
+                    }
+                    if (!ok) {
+                        //Could support arrays of strings with multiples of char8[40]
+                        REPORT_ERROR(ErrorManagement::ParametersError,
+                                     "Strings shall be defined with 40 elements char8[40]. Arrays of strings are not currently supported");
+                    }
                 }
-                else {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "Type %s is not supported", TypeDescriptor::GetTypeNameFromTypeDescriptor(td));
-                    ok = false;
+                if (ok) {
+                    pvs[n].numberOfElements = numberOfElements;
+                    pvs[n].td = td;
                 }
-            }
-            uint32 numberOfElements = 1u;
-            if (ok) {
-                ok = GetSignalNumberOfElements(n, numberOfElements);
-            }
-            if (ok) {
-                if (pvs[n].pvType == DBR_STRING) {
-                    ok = (numberOfElements == 40u);
+                if (ok) {
+                    pvs[n].memorySize = td.numberOfBits;
+                    pvs[n].memorySize /= 8u;
+                    pvs[n].memorySize *= numberOfElements;
+                    pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                    if (onlyOnChange == 1u) {
+                        putStates[n].lastValue = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
+                        if (originalSignalInformation.Read("Deadband", putStates[n].deadband)) {
+                            ok = ((putStates[n].deadband >= 0.0) && (pvs[n].pvType != DBR_STRING));
+                            if (!ok) {
+                                REPORT_ERROR(ErrorManagement::ParametersError, "The Deadband of %s shall be >= 0 and is not supported for strings", pvs[n].pvName);
+                            }
+                        }
+                    }
                 }
-                if (!ok) {
-                    //Could support arrays of strings with multiples of char8[40]
-                    REPORT_ERROR(ErrorManagement::ParametersError,
-                                 "Strings shall be defined with 40 elements char8[40]. Arrays of strings are not currently supported");
+                if (ok) {
+                    ok = originalSignalInformation.MoveToAncestor(1u);
                 }
             }
-            if (ok) {
-                pvs[n].numberOfElements = numberOfElements;
-            }
-            if (ok) {
-                pvs[n].memorySize = td.numberOfBits;
-                pvs[n].memorySize /= 8u;
-                pvs[n].memorySize *= numberOfElements;
-                pvs[n].memory = GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(pvs[n].memorySize);
-                ok = originalSignalInformation.MoveToAncestor(1u);
-            }
         }
     }
     return ok;
@@ -293,12 +453,26 @@ const char8* EPICSCAOutput::GetBrokerName(StructuredDataI& data, const SignalDir
     if (direction == OutputSignals) {
         brokerName = "MemoryMapAsyncOutputBroker";
     }
+    else if (hasPutCounters) {
+        brokerName = "MemoryMapInputBroker";
+    }
+    else {
+        //NOOP
+    }
     return brokerName;
 }
 
-/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: InputBrokers are not supported. Function returns false irrespectively of the parameters.*/
 bool EPICSCAOutput::GetInputBrokers(ReferenceContainer& inputBrokers, const char8* const functionName, void* const gamMemPtr) {
-    return false;
+    //Only the PendingPuts, FailedPuts and SentPuts signals can be read.
+    bool ok = hasPutCounters;
+    if (ok) {
+        ReferenceT<MemoryMapInputBroker> inputBroker("MemoryMapInputBroker");
+        ok = inputBroker->Init(InputSignals, *this, functionName, gamMemPtr);
+        if (ok) {
+            ok = inputBrokers.Insert(inputBroker);
+        }
+    }
+    return ok;
 }
 
 bool EPICSCAOutput::GetOutputBrokers(ReferenceContainer& outputBrokers, const char8* const functionName, void* const gamMemPtr) {
@@ -361,35 +535,121 @@ bool EPICSCAOutput::Synchronise() {
                 }
             }
         }
+        if ((threadContextSet) && (putMode != EPICSCAOutputPutBlocking)) {
+            //Wait (only once) for the channels to connect, as the non-blocking puts fail on disconnected channels.
+            (void) ca_pend_io(0.5);
+        }
     }
 
     //Allow to write event at the first time!
     if (threadContextSet) {
         if ((pvs != NULL_PTR(PVWrapper *)) && (signalFlag != NULL_PTR(uint8*))) {
-            for (n = 0u; (n < nOfSignals); n++) {
-                if (signalFlag[n] > 0u) {
+            if (putMode == EPICSCAOutputPutBlocking) {
+                for (n = 0u; (n < nOfSignals); n++) {
+                    if (signalFlag[n] > 0u) {
 
-                    uint32 nRetries = 5u;
-                    ok = false;
-                    while ((nRetries > 0u) && (!ok)) {
-                        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-                        if (pvs[n].pvType == DBR_STRING) {
-                            ok = (ca_put(pvs[n].pvType, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                        uint32 nRetries = 5u;
+                        ok = false;
+                        while ((nRetries > 0u) && (!ok)) {
+                            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+                            if (pvs[n].pvType == DBR_STRING) {
+                                ok = (ca_put(pvs[n].pvType, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                            }
+                            else {
+                                ok = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                            }
+                            nRetries--;
+                            (void) ca_pend_io(0.5);
                         }
-                        else {
-                            ok = (ca_array_put(pvs[n].pvType, pvs[n].numberOfElements, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
                         }
-                        nRetries--;
-                        (void) ca_pend_io(0.5);
                     }
-                    if (!ok) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "ca_put failed for PV: %s", pvs[n].pvName);
+                }
+            }
+            else {
+                //Queue all the puts and flush them once. Failures are counted (FailedPuts) and do not stop the other puts.
+                for (n = 0u; (n < nOfSignals); n++) {
+                    if (signalFlag[n] > 0u) {
+                        /*lint -e{613} putStates is allocated together with pvs*/
+                        bool putIt = (putStates[n].pending == 0);
+                        if ((putIt) && (onlyOnChange == 1u)) {
+                            putIt = HasChanged(n);
+                        }
+                        if (putIt) {
+                            if (PutNonBlocking(n)) {
+                                sentPuts++;
+                            }
+                            else {
+                                Atomic::Increment(&failedPuts);
+                            }
+                        }
                     }
                 }
+                (void) ca_flush_io();
+            }
+        }
+        if (pendingPutsSignal != NULL_PTR(uint32 *)) {
+            *pendingPutsSignal = static_cast<uint32>(pendingPuts);
+        }
+        if (failedPutsSignal != NULL_PTR(uint32 *)) {
+            *failedPutsSignal = static_cast<uint32>(failedPuts);
+        }
+        if (sentPutsSignal != NULL_PTR(uint32 *)) {
+            *sentPutsSignal = sentPuts;
+        }
+    }
+
+    return ok;
+}
+
+bool EPICSCAOutput::HasChanged(const uint32 n) const {
+    /*lint -e{613} pvs and putStates are allocated at SetConfiguredDatabase*/
+    const EPICSCAOutputPutState &state = putStates[n];
+    bool changed = (!state.lastValueValid);
+    if (!changed) {
+        if (pvs[n].pvType == DBR_STRING) {
+            changed = (MemoryOperationsHelper::Compare(pvs[n].memory, state.lastValue, pvs[n].memorySize) != 0);
+        }
+        else {
+            uint32 e;
+            for (e = 0u; (e < pvs[n].numberOfElements) && (!changed); e++) {
+                float64 value = EPICSCAOutputGetElement(pvs[n].td, pvs[n].memory, e);
+                float64 lastValue = EPICSCAOutputGetElement(pvs[n].td, state.lastValue, e);
+                float64 difference = (value > lastValue) ? (value - lastValue) : (lastValue - value);
+                //lint -e{777} exact comparison intended when no deadband is set.
+                changed = (state.deadband > 0.0) ? (difference > state.deadband) : (value != lastValue);
             }
         }
     }
+    return changed;
+}
 
+/*lint -e{613} pvs and putStates are allocated at SetConfiguredDatabase*/
+bool EPICSCAOutput::PutNonBlocking(const uint32 n) {
+    bool ok = (ca_state(pvs[n].pvChid) == cs_conn);
+    //Strings are written as one DBR_STRING element.
+    uint32 count = (pvs[n].pvType == DBR_STRING) ? 1u : pvs[n].numberOfElements;
+    if (ok) {
+        if (putMode == EPICSCAOutputPutCallback) {
+            //Mark as pending before the put, as the callback may be called before ca_array_put_callback returns.
+            putStates[n].pending = 1;
+            Atomic::Increment(&pendingPuts);
+            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+            ok = (ca_array_put_callback(pvs[n].pvType, count, pvs[n].pvChid, pvs[n].memory, &EPICSCAOutputPutCallback, &putStates[n]) == ECA_NORMAL);
+            if (!ok) {
+                putStates[n].pending = 0;
+                Atomic::Decrement(&pendingPuts);
+            }
+        }
+        else {
+            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+            ok = (ca_array_put(pvs[n].pvType, count, pvs[n].pvChid, pvs[n].memory) == ECA_NORMAL);
+        }
+    }
+    if ((ok) && (putStates[n].lastValue != NULL_PTR(void *))) {
+        putStates[n].lastValueValid = MemoryOperationsHelper::Copy(putStates[n].lastValue, pvs[n].memory, pvs[n].memorySize);
+    }
     return ok;
 }
 
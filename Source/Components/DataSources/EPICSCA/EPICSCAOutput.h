@@ -38,6 +38,7 @@
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
 #include "FastPollingMutexSem.h"
+#include "MemoryMapInputBroker.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MessageI.h"
 #include "SingleThreadService.h"
@@ -48,6 +49,61 @@
 namespace MARTe {
 //Maximum size that a PV name may have
 
+/**
+ * @brief How the EPICSCAOutput writes the PVs at every Synchronise.
+ */
+enum EPICSCAOutputPutMode {
+    /**
+     * ca_put followed by ca_pend_io for every PV (with retries).
+     */
+    EPICSCAOutputPutBlocking,
+
+    /**
+     * ca_array_put for all the PVs followed by a single ca_flush_io.
+     */
+    EPICSCAOutputPutBatched,
+
+    /**
+     * As EPICSCAOutputPutBatched but with ca_array_put_callback, so that the completion of each put is tracked.
+     */
+    EPICSCAOutputPutCallback
+};
+
+/**
+ * @brief Non-blocking put state of a PV.
+ */
+struct EPICSCAOutputPutState {
+    /**
+     * Copy of the last value that was put (only allocated if OnlyOnChange = 1).
+     */
+    void *lastValue;
+
+    /**
+     * True if lastValue holds a value.
+     */
+    bool lastValueValid;
+
+    /**
+     * The put is skipped if no element changed more than the deadband (numeric PVs).
+     */
+    float64 deadband;
+
+    /**
+     * 1 while a ca_array_put_callback is waiting for its completion.
+     */
+    volatile int32 pending;
+
+    /**
+     * The counter of the puts waiting for completion in the EPICSCAOutput.
+     */
+    volatile int32 *pendingPuts;
+
+    /**
+     * The counter of the failed puts in the EPICSCAOutput.
+     */
+    volatile int32 *failedPuts;
+};
+
 /**
  * @brief A DataSource which allows to output data into any number of PVs using the EPICS channel access client protocol.
  * Data is asynchronously ca_put in the context of a different thread (w.r.t. to the real-time thread).
@@ -61,12 +117,26 @@ namespace MARTe {
  *     CPUs = 0xff //Optional the affinity of the EmbeddedThread (where the EPICS context is attached).
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the PV values. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     PutMode = Batched //Optional. Blocking (default): each PV is put and waited with ca_pend_io (up to 5 retries).
+ *                       //Batched: all the PVs are put (without waiting) and a single ca_flush_io is issued per cycle. Puts on disconnected PVs fail immediately.
+ *                       //Callback: as Batched but using ca_array_put_callback. A PV is not put again until its previous put has completed.
+ *     OnlyOnChange = 1 //Optional (only for Batched and Callback). If 1 a PV is only put if its value changed since the last successful put. Default = 0.
  *     Signals = {
  *          PV1 = { //At least one shall be defined
  *             PVName = My::PV1 //Compulsory. Name of the PV.
  *             Type = uint32 //Compulsory. Supported types are char8[40], string[40], uint8, int8, uint16, int16, int32, uint32, float32 and float64
+ *             Deadband = 0.5 //Optional (only with OnlyOnChange = 1). The PV is only put if an element changed more than the Deadband. Default = 0.
  *          }
  *          ...
+ *          PendingPuts = { //Optional. Number of puts waiting for completion (PutMode = Callback). Can be read by the GAM which writes the PVs.
+ *             Type = uint32
+ *          }
+ *          FailedPuts = { //Optional. Total number of puts that could not be issued or completed (PutMode = Batched or Callback).
+ *             Type = uint32
+ *          }
+ *          SentPuts = { //Optional. Total number of puts that were issued (PutMode = Batched or Callback). Puts skipped by OnlyOnChange are not counted.
+ *             Type = uint32
+ *          }
  *     }
  * }
  *
@@ -110,15 +180,16 @@ public:
 
     /**
      * @brief See DataSourceI::GetNumberOfMemoryBuffers.
-     * @details Only OutputSignals are supported.
-     * @return MemoryMapAsyncOutputBroker.
+     * @details Only OutputSignals are supported (and the PendingPuts, FailedPuts and SentPuts InputSignals).
+     * @return MemoryMapAsyncOutputBroker (MemoryMapInputBroker for InputSignals).
      */
     virtual const char8 *GetBrokerName(StructuredDataI &data,
             const SignalDirection direction);
 
     /**
      * @brief See DataSourceI::GetInputBrokers.
-     * @return false.
+     * @details Only the PendingPuts, FailedPuts and SentPuts signals can be read (with a MemoryMapInputBroker).
+     * @return true if the function reads any of the PendingPuts, FailedPuts and SentPuts signals.
      */
     virtual bool GetInputBrokers(ReferenceContainer &inputBrokers,
             const char8* const functionName,
@@ -238,6 +309,70 @@ private:
      * If true no error will be triggered when the data cannot be consumed by the thread doing the caputs.
      */
     uint32 ignoreBufferOverrun;
+
+    /**
+     * How the PVs are put.
+     */
+    EPICSCAOutputPutMode putMode;
+
+    /**
+     * If 1 the PVs are only put if their value changed.
+     */
+    uint32 onlyOnChange;
+
+    /**
+     * Non-blocking put state of each signal.
+     */
+    EPICSCAOutputPutState *putStates;
+
+    /**
+     * Number of puts waiting for completion.
+     */
+    volatile int32 pendingPuts;
+
+    /**
+     * Number of failed puts.
+     */
+    volatile int32 failedPuts;
+
+    /**
+     * Number of issued puts (only updated by the thread which calls Synchronise).
+     */
+    uint32 sentPuts;
+
+    /**
+     * True if any of the PendingPuts, FailedPuts or SentPuts signals is defined.
+     */
+    bool hasPutCounters;
+
+    /**
+     * Memory of the PendingPuts signal (if defined).
+     */
+    uint32 *pendingPutsSignal;
+
+    /**
+     * Memory of the FailedPuts signal (if defined).
+     */
+    uint32 *failedPutsSignal;
+
+    /**
+     * Memory of the SentPuts signal (if defined).
+     */
+    uint32 *sentPutsSignal;
+
+    /**
+     * @brief Checks if the value of a signal changed more than its deadband since the last put.
+     * @param[in] n the signal index.
+     * @return true if the signal was never put or if it changed.
+     */
+    bool HasChanged(const uint32 n) const;
+
+    /**
+     * @brief Puts a signal without waiting (PutMode = Batched or Callback).
+     * @param[in] n the signal index.
+     * @return true if the put was issued.
+     */
+    bool PutNonBlocking(const uint32 n);
     
     /**
      * Flags to the signals.
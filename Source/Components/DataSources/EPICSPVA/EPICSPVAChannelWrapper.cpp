@@ -46,7 +46,12 @@ EPICSPVAChannelWrapper::EPICSPVAChannelWrapper() {
     resolvedStructIndexMap = NULL_PTR(uint32 *);
     cachedSignals = NULL_PTR(EPICSPVAFieldWrapperI **);
     structureResolved = false;
-    putFinished = false;
+    putFinished = true;
+    putSucceeded = true;
+    putDirty = false;
+    putCancelling = false;
+    (void) putDoneSem.Create();
+    (void) putMutex.Create(true);
 }
 
 EPICSPVAChannelWrapper::~EPICSPVAChannelWrapper() {
@@ -61,8 +66,12 @@ EPICSPVAChannelWrapper::~EPICSPVAChannelWrapper() {
     if (resolvedStructIndexMap != NULL_PTR(uint32 *)) {
         delete [] resolvedStructIndexMap;
     }
+    putOperation = pvac::Operation();
+    previousPutOperation = pvac::Operation();
     channel = pvac::ClientChannel();
     monitor = pvac::MonitorSync();
+    (void) putDoneSem.Close();
+    (void) putMutex.Close();
 }
 
 bool EPICSPVAChannelWrapper::SetAliasAndField(StructuredDataI &data) {
@@ -210,18 +219,103 @@ bool EPICSPVAChannelWrapper::Setup(DataSourceI &dataSource) {
 }
 
 void EPICSPVAChannelWrapper::putBuild(const epics::pvData::StructureConstPtr& build, pvac::ClientChannel::PutCallback::Args& args) {
-    args.root = putPVStruct;
+    (void) putMutex.Lock();
+    //Send a snapshot so that StartPut can keep on coalescing newer values into putPVStruct while this put is in flight.
+    args.root = epics::pvData::getPVDataCreate()->createPVStructure(std::const_pointer_cast<epics::pvData::PVStructure>(putPVStruct));
     args.tosend.set(0);
-    putFinished = true;
+    putDirty = false;
+    putMutex.UnLock();
 }
 
 void EPICSPVAChannelWrapper::putDone(const pvac::PutEvent& evt) {
-    if (evt.event == 0) {
-        std::cout << evt.event << std::endl;
+    (void) putMutex.Lock();
+    //While WaitPut is cancelling the outstanding put no new put is issued and the putDoneSem is not posted (see WaitPut).
+    if (!putCancelling) {
+        putSucceeded = (evt.event == pvac::PutEvent::Success);
+        if (!putSucceeded) {
+            REPORT_ERROR_STATIC(ErrorManagement::Warning, "Put on channel %s failed [%s]", channelName.Buffer(), evt.message.c_str());
+        }
+        bool reissued = false;
+        if ((putSucceeded) && (putDirty)) {
+            //Newer values were coalesced while this put was outstanding. Send them now.
+            reissued = IssuePut();
+        }
+        if (!reissued) {
+            putDirty = false;
+            putFinished = true;
+            (void) putDoneSem.Post();
+        }
     }
+    putMutex.UnLock();
+}
+
+bool EPICSPVAChannelWrapper::IssuePut() {
+    bool ok = true;
+    try {
+        //Keep the operation that may be completing (i.e. this is being called from its putDone) alive.
+        previousPutOperation = putOperation;
+        putOperation = channel.put(this);
+    }
+    catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
+        REPORT_ERROR_STATIC(ErrorManagement::Warning, "Failed to put on channel %s [%s]", channelName.Buffer(), ignored.what());
+        ok = false;
+    }
+    return ok;
 }
 
 bool EPICSPVAChannelWrapper::Put() {
+    bool ok = StartPut();
+    if (ok) {
+        ok = WaitPut(static_cast<TimeoutType>(1000u));
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::IsPutPending() const {
+    return !putFinished;
+}
+
+bool EPICSPVAChannelWrapper::WaitPut(const TimeoutType &timeout) {
+    bool ok = true;
+    if (!putFinished) {
+        ok = (putDoneSem.Wait(timeout) == ErrorManagement::NoError);
+        if (!ok) {
+            (void) putMutex.Lock();
+            //The put may have completed just after the timeout.
+            bool cancel = !putFinished;
+            //Taken under the lock that putDone holds to re-issue: with putCancelling set putDone can no longer replace the
+            //putOperation, so that the copy is the operation to be cancelled.
+            putCancelling = cancel;
+            pvac::Operation outstandingPutOperation = putOperation;
+            putMutex.UnLock();
+            if (cancel) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Timeout waiting for the put on channel %s", channelName.Buffer());
+                //No more callbacks after cancel returns. Cannot be called with the putMutex locked as it waits for any putDone in progress,
+                //which may be waiting for the putMutex.
+                outstandingPutOperation.cancel();
+            }
+            (void) putMutex.Lock();
+            if (cancel) {
+                putCancelling = false;
+                putDirty = false;
+                putFinished = true;
+                putSucceeded = false;
+            }
+            else {
+                ok = true;
+            }
+            //Drain any Post of the completed or cancelled put, so that it cannot release the next WaitPut.
+            (void) putDoneSem.Reset();
+            putMutex.UnLock();
+        }
+    }
+    if (ok) {
+        ok = putSucceeded;
+    }
+    return ok;
+}
+
+bool EPICSPVAChannelWrapper::StartPut() {
     bool ok = false;
     try {
         if (!channel.valid()) {
@@ -246,22 +340,32 @@ bool EPICSPVAChannelWrapper::Put() {
             }
         }
         if (ok) {
+            (void) putMutex.Lock();
             uint32 n;
             for (n = 0u; n < numberOfSignals; n++) {
                 cachedSignals[n]->Put();
             }
-        }
-        putFinished = false;
-        pvac::Operation op(channel.put(this));
-        uint32 timeout = 10u;
-        while (ok && (!putFinished)) {
-            Sleep::Sec(0.1);
-            timeout--;
-            ok = (timeout > 0u);
+            //Coalesce: if a put is outstanding the newest values are flagged and sent by putDone when it completes.
+            if (putFinished) {
+                ok = (putDoneSem.Reset());
+                if (ok) {
+                    putDirty = false;
+                    putFinished = false;
+                    ok = IssuePut();
+                }
+                if (!ok) {
+                    putFinished = true;
+                }
+            }
+            else {
+                putDirty = true;
+            }
+            putMutex.UnLock();
         }
     }
     catch (epics::pvData::detail::ExceptionMixed<epics::pvData::BaseException> &ignored) {
         REPORT_ERROR_STATIC(ErrorManagement::Information, "Failed to connect to channel %s [s]", channelName.Buffer(), ignored.what());
+        putFinished = true;
         ok = false;
     }
     return ok;
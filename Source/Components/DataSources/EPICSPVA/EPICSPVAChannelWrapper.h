@@ -38,6 +38,8 @@
 #include "DataSourceI.h"
 #include "DjbHashFunction.h"
 #include "EPICSPVAFieldWrapper.h"
+#include "EventSem.h"
+#include "MutexSem.h"
 #include "StreamString.h"
 #include "StructuredDataI.h"
 
@@ -105,10 +107,34 @@ public:
 
     /**
      * @brief Copies from each signal memory (see GetSignalMemory) into the relevant PVA structure fields and commit the changes.
+     * @details Calls StartPut and WaitPut with a timeout of 1 second.
      * @return true if all the signals have been successfully committed into the network.
      */
     bool Put();
 
+    /**
+     * @brief Copies from each signal memory into the relevant PVA structure fields and starts the put operation (without waiting for it to complete).
+     * @details Only one put is outstanding per channel. If the previous put has not completed yet, no new put is started: the values are
+     * copied into the put structure and marked as pending, and putDone starts a new put with the latest values as soon as the outstanding
+     * one completes (i.e. newer values are coalesced, but the last values are always sent).
+     * @return true if the channel is connected and the put was started (or a put is already outstanding).
+     */
+    bool StartPut();
+
+    /**
+     * @brief Waits for the completion of the put started with StartPut.
+     * @details The completion is signalled by putDone (no polling). If the \a timeout expires the put is cancelled.
+     * @param[in] timeout the maximum time to wait.
+     * @return true if the last put completed successfully.
+     */
+    bool WaitPut(const TimeoutType &timeout);
+
+    /**
+     * @brief Checks if a put is outstanding.
+     * @return true if a put was started and did not complete yet (including the put of pending values).
+     */
+    bool IsPutPending() const;
+
     /**
      * @brief Copies from relevant PVA structure fields into each signal memory.
      * @details This method has a fixed timeout of 0.2 second.
@@ -129,7 +155,8 @@ public:
     const char8 * const GetFieldName();
 
     /**
-     * @brief The callback function that is called when the channel.put method is called. Sets the args.root to pvStruct.
+     * @brief The callback function that is called when the channel.put method is called. Sets the args.root to a copy of putPVStruct
+     * (so that StartPut can keep updating putPVStruct while the put is in flight) and clears the pending values flag.
      * @param[in] build see pvac::ClientChannel::PutCallback
      * @param[in,out] args see pvac::ClientChannel::PutCallback
      */
@@ -137,6 +164,8 @@ public:
 
     /**
      * @brief The callback function that is called when the put operation concludes.
+     * @details If newer values were coalesced while the put was outstanding (and the put succeeded) a new put is started with
+     * those values. Otherwise posts the putDoneSem.
      * @param[in] evt see pvac::ClientChannel::PutCallback
      */
     virtual void putDone(const pvac::PutEvent& evt);
@@ -159,6 +188,13 @@ private:
      * @return true if the structure can be fully refreshed with no errors.
      */ 
     bool RefreshStructure(epics::pvData::PVFieldPtr pvField, uint32 &absIndex);
+
+    /**
+     * @brief Starts a new put operation with the values of putPVStruct. The putMutex shall be locked by the caller.
+     * @return true if the put operation was successfully started.
+     */
+    bool IssuePut();
+
     /**
      * The EPICS PVA channel
      */
@@ -215,9 +251,45 @@ private:
     epics::pvData::PVStructure::const_shared_pointer monitorRoot;
 
     /**
-     * Set to true when the put has finished.
+     * The outstanding put operation.
+     */
+    pvac::Operation putOperation;
+
+    /**
+     * The put operation which preceded putOperation. Keeps the operation which is completing alive when a new put is started
+     * from within its putDone callback.
+     */
+    pvac::Operation previousPutOperation;
+
+    /**
+     * Protects the put structure and the put state between StartPut, WaitPut and the put callbacks.
+     */
+    MutexSem putMutex;
+
+    /**
+     * True if the put structure holds values which were not yet taken by a putBuild.
+     */
+    volatile bool putDirty;
+
+    /**
+     * True while WaitPut is cancelling the outstanding put. putDone neither re-issues a put nor posts the putDoneSem.
+     */
+    volatile bool putCancelling;
+
+    /**
+     * Posted by putDone.
+     */
+    EventSem putDoneSem;
+
+    /**
+     * Set to true when the put has finished (false while a put is outstanding).
+     */
+    volatile bool putFinished;
+
+    /**
+     * True if the last put has finished successfully.
      */
-    bool putFinished;
+    volatile bool putSucceeded;
 
     /**
      * Cache the index of the signals.
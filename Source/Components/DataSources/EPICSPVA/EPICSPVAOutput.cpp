@@ -42,6 +42,9 @@ EPICSPVAOutput::EPICSPVAOutput() :
     numberOfBrokerBuffers = 0u;
     numberOfChannels = 0u;
     ignoreBufferOverrun = 1u;
+    putTimeout = 1000u;
+    pipelinePuts = 0u;
+    coalescePuts = 0u;
     channelList = NULL_PTR(EPICSPVAChannelWrapper *);
 }
 
@@ -69,6 +72,19 @@ bool EPICSPVAOutput::Initialise(StructuredDataI & data) {
         if (!data.Read("IgnoreBufferOverrun", ignoreBufferOverrun)) {
             REPORT_ERROR(ErrorManagement::Information, "No IgnoreBufferOverrun defined. Using default = %d", ignoreBufferOverrun);
         }
+        if (!data.Read("PutTimeout", putTimeout)) {
+            REPORT_ERROR(ErrorManagement::Information, "No PutTimeout defined. Using default = %d", putTimeout);
+        }
+        if (!data.Read("PipelinePuts", pipelinePuts)) {
+            REPORT_ERROR(ErrorManagement::Information, "No PipelinePuts defined. Using default = %d", pipelinePuts);
+        }
+        if (!data.Read("CoalescePuts", coalescePuts)) {
+            REPORT_ERROR(ErrorManagement::Information, "No CoalescePuts defined. Using default = %d", coalescePuts);
+        }
+        ok = (putTimeout > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "PutTimeout shall be > 0");
+        }
 
     }
     if (ok) {
@@ -199,8 +215,25 @@ uint32 EPICSPVAOutput::GetCPUMask() const {
 bool EPICSPVAOutput::Synchronise() {
     bool ok = true;
     uint32 n;
-    for (n = 0u; (n < numberOfChannels) && (ok); n++) {
-        ok = channelList[n].Put();
+    TimeoutType timeout = static_cast<TimeoutType>(putTimeout);
+    if ((pipelinePuts == 1u) || (coalescePuts == 1u)) {
+        for (n = 0u; (n < numberOfChannels) && (ok); n++) {
+            ok = channelList[n].StartPut();
+        }
+        if (coalescePuts == 0u) {
+            //Wait for all the started puts, also if one of them failed.
+            for (n = 0u; (n < numberOfChannels); n++) {
+                ok = (channelList[n].WaitPut(timeout)) && (ok);
+            }
+        }
+    }
+    else {
+        for (n = 0u; (n < numberOfChannels) && (ok); n++) {
+            ok = channelList[n].StartPut();
+            if (ok) {
+                ok = channelList[n].WaitPut(timeout);
+            }
+        }
     }
     return ok;
 }
@@ -209,11 +242,30 @@ bool EPICSPVAOutput::IsIgnoringBufferOverrun() const {
     return (ignoreBufferOverrun == 1u);
 }
 
+uint32 EPICSPVAOutput::GetPutTimeout() const {
+    return putTimeout;
+}
+
+bool EPICSPVAOutput::IsPipeliningPuts() const {
+    return (pipelinePuts == 1u);
+}
+
+bool EPICSPVAOutput::IsCoalescingPuts() const {
+    return (coalescePuts == 1u);
+}
+
 void EPICSPVAOutput::Purge(ReferenceContainer &purgeList) {
     if (broker.IsValid()) {
         (void) broker->Flush();
         broker->UnlinkDataSource();
     }
+    if (channelList != NULL_PTR(EPICSPVAChannelWrapper *)) {
+        //Do not destroy the channels with puts still outstanding
+        uint32 n;
+        for (n = 0u; (n < numberOfChannels); n++) {
+            (void) channelList[n].WaitPut(static_cast<TimeoutType>(putTimeout));
+        }
+    }
     DataSourceI::Purge(purgeList);
 }
 
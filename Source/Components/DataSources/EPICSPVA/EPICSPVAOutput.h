@@ -51,6 +51,9 @@ namespace MARTe {
  *
  * Note that strings shall be specified with Type = string (also inside structured types).
  *
+ * The completion of each put is signalled by the EPICS PVA client (see EPICSPVAChannelWrapper::WaitPut), i.e. the
+ * puts are not polled. Each channel has at most one outstanding put.
+ *
  * <pre>
  * +EPICSPVAOutput_1 = {
  *     Class = EPICSPVADataSource::EPICSPVAOutput
@@ -58,6 +61,9 @@ namespace MARTe {
  *     CPUs = 0xff //Optional the affinity of the EmbeddedThread which actually performs the PVA puts.
  *     IgnoreBufferOverrun = 1 //Optional. If true no error will be triggered when the thread that writes into EPICS does not consume the data fast enough.
  *     NumberOfBuffers = 10 //Compulsory. Number of buffers in a circular buffer that asynchronously writes the values. Each buffer is capable of holding a copy of all the DataSourceI signals.
+ *     PutTimeout = 1000 //Optional. Maximum time in milliseconds to wait for the completion of the puts. Default value is 1000. Shall be > 0.
+ *     PipelinePuts = 1 //Optional. If true the puts of all the channels are started before waiting for their completion (i.e. the channels are written concurrently). Default value is 0.
+ *     CoalescePuts = 1 //Optional. If true the completion of the puts is not waited for. A channel with an outstanding put is skipped and its newer values are written once the put completes. Default value is 0.
  *     Signals = {
  *         RecordOut1Value = {//Record name if the Alias field is not set
  *             Alias = "alternative::channel::name"
@@ -153,6 +159,8 @@ EPICSPVAOutput    ();
 
     /**
      * @brief Provides the context to execute all the EPICS calls.
+     * @details Starts the put of each channel and waits for its completion. If PipelinePuts is set, all the puts are started before
+     * waiting. If CoalescePuts is set, the completion is not waited for.
      * @return true if all the all the variables can be successfully set and exec.
      */
     virtual bool Synchronise();
@@ -172,6 +180,24 @@ EPICSPVAOutput    ();
      */
     bool IsIgnoringBufferOverrun() const;
 
+    /**
+     * @brief Gets the maximum time to wait for the completion of the puts.
+     * @return the put timeout in milliseconds.
+     */
+    uint32 GetPutTimeout() const;
+
+    /**
+     * @brief Gets if the puts of all the channels are started before waiting for their completion.
+     * @return true if PipelinePuts is set.
+     */
+    bool IsPipeliningPuts() const;
+
+    /**
+     * @brief Gets if the puts are not waited for (and newer values are coalesced while a put is outstanding).
+     * @return true if CoalescePuts is set.
+     */
+    bool IsCoalescingPuts() const;
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -209,6 +235,21 @@ private:
      */
     uint32 numberOfBrokerBuffers;
 
+    /**
+     * Maximum time in milliseconds to wait for the completion of the puts.
+     */
+    uint32 putTimeout;
+
+    /**
+     * Start the puts of all the channels before waiting for their completion.
+     */
+    uint32 pipelinePuts;
+
+    /**
+     * Do not wait for the completion of the puts.
+     */
+    uint32 coalescePuts;
+
     /**
      * The broker.
      */
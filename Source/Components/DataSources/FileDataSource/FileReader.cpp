@@ -24,6 +24,9 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
@@ -32,6 +35,7 @@
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileReader.h"
+#include "FileReaderMappedInputBroker.h"
 #include "MemoryMapSynchronisedInputBroker.h"
 #include "TypeConversion.h"
 
@@ -45,6 +49,7 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+static const uint64 FILE_READER_DEFAULT_READ_AHEAD = 16777216u;
 
 FileReader::FileReader() :
         DataSourceI(),
@@ -74,6 +79,12 @@ FileReader::FileReader() :
     allData.interalBufferIdx = 0u;
     allData.internalBuffer = NULL_PTR(char8*);
     allData.maxDataFileByteSize = 0u;
+    memoryMap = false;
+    mappedFile = NULL_PTR(void*);
+    mappedFileByteSize = 0u;
+    readAheadByteSize = FILE_READER_DEFAULT_READ_AHEAD;
+    readAheadIdx = 0u;
+    currentRecord = NULL_PTR(const char8*);
 }
 
 /*lint -e{1551} -e{1579} the destructor must guarantee that the memory is freed and the file is flushed and closed.. The brokerAsyncTrigger is freed by the ReferenceT */
@@ -87,9 +98,17 @@ FileReader::~FileReader() {
     if (signalsAnyType != NULL_PTR(AnyType*)) {
         delete[] signalsAnyType;
     }
-    if (allData.internalBuffer != NULL_PTR(char8*)) {
+    if (mappedFile != NULL_PTR(void*)) {
+        if (munmap(mappedFile, static_cast<size_t>(mappedFileByteSize)) != 0) {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to unmap file %s", filename.Buffer());
+        }
+    }
+    else if (allData.internalBuffer != NULL_PTR(char8*)) {
         GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(allData.internalBuffer));
     }
+    else {
+        //NOOP
+    }
     (void) CloseFile();
 }
 
@@ -122,6 +141,9 @@ const char8* FileReader::GetBrokerName(StructuredDataI &data,
         if (interpolate) {
             brokerName = "MemoryMapInterpolatedInputBroker";
         }
+        else if (memoryMap) {
+            brokerName = "FileReaderMappedInputBroker";
+        }
         else {
             brokerName = "MemoryMapSynchronisedInputBroker";
         }
@@ -154,6 +176,16 @@ bool FileReader::GetInputBrokers(ReferenceContainer &inputBrokers,
             interpolatedInputBroker->Reset();
         }
     }
+    else if (memoryMap) {
+        ReferenceT<FileReaderMappedInputBroker> broker(new FileReaderMappedInputBroker(this));
+        ok = broker.IsValid();
+        if (ok) {
+            ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
+        }
+        if (ok) {
+            ok = inputBrokers.Insert(broker);
+        }
+    }
     else {
         ReferenceT<MemoryMapSynchronisedInputBroker> broker("MemoryMapSynchronisedInputBroker");
         ok = broker->Init(InputSignals, *this, functionName, gamMemPtr);
@@ -212,10 +244,11 @@ bool FileReader::Synchronise() {
     bool ok = !fatalFileError;
     if (ok) {
         bool lockAtLast = false;
-        if (preload) {
+        if ((preload) || (memoryMap)) {
             if (allData.interalBufferIdx == allData.dataFileByteSize) {
                 if (eofBehaviour == EOFRewind) { //move to the beginning
                     allData.interalBufferIdx = 0u;
+                    readAheadIdx = 0u;
                 }
                 else if (eofBehaviour == EOFLast) {
                     lockAtLast = true;
@@ -240,9 +273,15 @@ bool FileReader::Synchronise() {
             }
             else {
                 if (!lockAtLast) {
-                    ok = MemoryOperationsHelper::Copy(dataSourceMemory, &(allData.internalBuffer[allData.interalBufferIdx]), numberOfBinaryBytes);
+                    currentRecord = &(allData.internalBuffer[allData.interalBufferIdx]);
+                    //The FileReaderMappedInputBroker copies the signals straight from the currentRecord
+                    if ((!memoryMap) || (interpolate)) {
+                        ok = MemoryOperationsHelper::Copy(dataSourceMemory, currentRecord, numberOfBinaryBytes);
+                    }
                     allData.interalBufferIdx = allData.interalBufferIdx + numberOfBinaryBytes;
-
+                    if (memoryMap) {
+                        ReadAhead();
+                    }
                 }
             }
         }
@@ -373,6 +412,23 @@ bool FileReader::Initialise(StructuredDataI &data) {
                     }
                 }
             }
+            else if (preloadStr == "mmap") {
+                preload = false;
+                memoryMap = true;
+                ok = (fileFormat == FILE_FORMAT_BINARY);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "Preload = mmap is only supported with FileFormat = binary");
+                }
+                if (ok) {
+                    if (!data.Read("ReadAheadByteSize", readAheadByteSize)) {
+                        readAheadByteSize = FILE_READER_DEFAULT_READ_AHEAD;
+                    }
+                    ok = (readAheadByteSize > 0u);
+                    if (!ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "ReadAheadByteSize shall be > 0");
+                    }
+                }
+            }
             else {
                 preload = false;
             }
@@ -585,7 +641,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
     //Allocate memory
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
-        if (preload) { //Get the size of the file and allocate memory
+        if ((preload) || (memoryMap)) { //Get the size of the file and allocate memory (or map it)
             if (fileFormat == FILE_FORMAT_BINARY) {
                 const uint32 SIGNAL_NAME_MAX_SIZE = 32u;
                 uint32 headerSize = static_cast<uint32>(sizeof(uint16));
@@ -626,7 +682,7 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                     allData.dataFileByteSize = countLines * numberOfBinaryBytes;
                 }
             }
-            if (ok) { //check the maximum size is below the expected size
+            if ((ok) && (preload)) { //check the maximum size is below the expected size
                 ok = allData.dataFileByteSize < allData.maxDataFileByteSize;
                 if (!ok) {
                     REPORT_ERROR(ErrorManagement::InitialisationError,
@@ -634,10 +690,19 @@ bool FileReader::SetConfiguredDatabase(StructuredDataI &data) {
                                  allData.dataFileByteSize, allData.maxDataFileByteSize);
                 }
             }
-            if (ok) { //allocate allData buffer
+            if ((ok) && (preload)) { //allocate allData buffer
                 allData.internalBuffer = reinterpret_cast<char8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(
                         static_cast<uint32>(allData.dataFileByteSize)));
             }
+            if ((ok) && (memoryMap)) {
+                ok = (allData.dataFileByteSize > 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The file does not contain any sample");
+                }
+                if (ok) {
+                    ok = MapFile(inputFile.Size() - allData.dataFileByteSize);
+                }
+            }
         }
     }
     //If the type is text prepare the Printf properties in advanced
@@ -992,6 +1057,88 @@ uint64 FileReader::GetInterpolationPeriod() const {
     return interpolationPeriod;
 }
 
+bool FileReader::IsMemoryMapped() const {
+    return memoryMap;
+}
+
+const char8* FileReader::GetCurrentRecord() const {
+    return currentRecord;
+}
+
+bool FileReader::GetSignalRecordOffset(const uint32 signalIdx,
+                                       uint32 &offset) const {
+    bool ok = (offsets != NULL_PTR(uint32*));
+    if (ok) {
+        ok = (signalIdx < GetNumberOfSignals());
+    }
+    if (ok) {
+        /*lint -e{613} offsets cannot be NULL here*/
+        offset = offsets[signalIdx];
+    }
+    return ok;
+}
+
+bool FileReader::MapFile(const uint64 headerSize) {
+    mappedFileByteSize = inputFile.Size();
+    int32 fd = open(filename.Buffer(), O_RDONLY);
+    bool ok = (fd >= 0);
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::OSError, "Failed to open File %s for mapping", filename.Buffer());
+    }
+    if (ok) {
+        void *mapping = mmap(NULL_PTR(void*), static_cast<size_t>(mappedFileByteSize), PROT_READ, MAP_PRIVATE, fd, 0);
+        ok = (mapping != MAP_FAILED);
+        if (ok) {
+            mappedFile = mapping;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::OSError, "Failed to map File %s", filename.Buffer());
+        }
+        //The mapping holds its own reference to the file
+        (void) close(fd);
+    }
+    if (ok) {
+        if (madvise(mappedFile, static_cast<size_t>(mappedFileByteSize), MADV_SEQUENTIAL) != 0) {
+            REPORT_ERROR(ErrorManagement::Warning, "Failed to advise sequential access to File %s", filename.Buffer());
+        }
+        /*lint -e{925} -e{9016} the mapping is only read as a byte array*/
+        allData.internalBuffer = &(reinterpret_cast<char8*>(mappedFile)[headerSize]);
+        allData.interalBufferIdx = 0u;
+        currentRecord = allData.internalBuffer;
+        readAheadIdx = 0u;
+        ReadAhead();
+        REPORT_ERROR(ErrorManagement::Information, "Mapped %d bytes of File %s", mappedFileByteSize, filename.Buffer());
+    }
+    return ok;
+}
+
+void FileReader::ReadAhead() {
+    //Only issue a new request once half of the previously requested window was consumed
+    bool request = (readAheadIdx < allData.dataFileByteSize);
+    if (request) {
+        request = ((allData.interalBufferIdx + (readAheadByteSize / 2u)) >= readAheadIdx);
+    }
+    if (request) {
+        uint64 headerSize = (mappedFileByteSize - allData.dataFileByteSize);
+        uint64 start = (readAheadIdx > allData.interalBufferIdx) ? (readAheadIdx) : (allData.interalBufferIdx);
+        uint64 end = (allData.interalBufferIdx + readAheadByteSize);
+        if (end > allData.dataFileByteSize) {
+            end = allData.dataFileByteSize;
+        }
+        if (end > start) {
+            //madvise requires a page aligned address
+            uint64 pageSize = static_cast<uint64>(sysconf(_SC_PAGESIZE));
+            uint64 alignedStart = (headerSize + start);
+            alignedStart -= (alignedStart % pageSize);
+            uint64 length = ((headerSize + end) - alignedStart);
+            /*lint -e{925} -e{9016} the mapping is only read as a byte array*/
+            char8 *address = &(reinterpret_cast<char8*>(mappedFile)[alignedStart]);
+            (void) madvise(address, static_cast<size_t>(length), MADV_WILLNEED);
+        }
+        readAheadIdx = end;
+    }
+}
+
 CLASS_REGISTER(FileReader, "1.0")
 CLASS_METHOD_REGISTER(FileReader, CloseFile)
 
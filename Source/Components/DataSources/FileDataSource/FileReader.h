@@ -80,8 +80,9 @@ namespace MARTe {
  *     XAxisSignal = "Time" //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. Name of the signal containing the independent variable to generate the interpolation samples.
  *     InterpolationPeriod = 1000 //Compulsory if Interpolate = "yes" and none of the signals interacting with this FileReader has Frequency > 0. InterpolatedXAxisSignal += InterpolationPeriod. It will be read as an uint64.
  *     EOF = "Rewind" //Optional behaviour to have when reaching the end of the file. If not set EOF = "Rewind". Possible options are: "Error", "Rewind" and "Last". If "Rewind" the file will be read from the start; if "Error" an error will be issues when EOF is reached; if "Last" the last read values are sent.
- *     Preload = "yes" //Optional. Default no. If set the file is load in memory when configuring.
- *     MaxFileByteSize = 1000000 //Optional. Default 4 GB. The maximum data file size to be loaded in Bytes.
+ *     Preload = "yes" //Optional. Default no. If "yes" the file is load in memory when configuring. If "mmap" the file is memory mapped (see below).
+ *     MaxFileByteSize = 1000000 //Optional. Default 4 GB. The maximum data file size to be loaded in Bytes. Only relevant if Preload = "yes".
+ *     ReadAheadByteSize = 16777216 //Optional. Default 16 MB. Only relevant if Preload = "mmap". Size of the window which is asynchronously read ahead of the current sample.
  *     //All the signals are automatically added against the information stored in the header of the input file (format described above).
  *     +Messages = { //Optional. If set a message will be fired every time one of the events below occur
  *         Class = ReferenceContainer
@@ -95,6 +96,12 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * If Preload = "mmap" (only supported with FileFormat = "binary") the data is not copied into memory. Instead the file is mapped (read-only) into
+ * the address space, so that the startup time and the resident memory are independent of the file size. The kernel is advised that the
+ * mapping is read sequentially (MADV_SEQUENTIAL) and, as the samples are consumed, the next ReadAheadByteSize bytes are requested (MADV_WILLNEED),
+ * so that the page faults are moved out of the real-time path. If Interpolate = "no" the FileReaderMappedInputBroker is used and the signals are copied
+ * straight from the mapping into the GAM memory (i.e. without the intermediate copy into the DataSource memory).
  */
 class FileReader: public DataSourceI, public MessageI {
 public:CLASS_REGISTER_DECLARATION()
@@ -137,6 +144,7 @@ public:CLASS_REGISTER_DECLARATION()
      * @brief See DataSourceI::GetBrokerName.
      * @details Only InputSignals are supported.
      * @return MemoryMapSynchronisedInputBroker if interpolate = false, MemoryMapInterpolatedInputBroker otherwise.
+     * If Preload = "mmap" and interpolate = false returns FileReaderMappedInputBroker.
      */
     virtual const char8* GetBrokerName(StructuredDataI &data,
                                        const SignalDirection direction);
@@ -144,7 +152,7 @@ public:CLASS_REGISTER_DECLARATION()
     /**
      * @brief See DataSourceI::GetInputBrokers.
      * @details If interpolate == yes adds a MemoryMapInterpolatedInputBroker instance to
-     *  the inputBrokers, otherwise adds a MemoryMapSynchronisedInputBroker instance to the intputBrokers.
+     *  the inputBrokers, otherwise adds a MemoryMapSynchronisedInputBroker (or a FileReaderMappedInputBroker if Preload = "mmap") instance to the intputBrokers.
      * @pre
      *   GetNumberOfFunctions() == 1u
      */
@@ -233,6 +241,29 @@ public:CLASS_REGISTER_DECLARATION()
      */
     uint64 GetInterpolationPeriod() const;
 
+    /**
+     * @brief Returns true if the file is memory mapped (i.e. Preload = "mmap").
+     * @return true if the file is memory mapped.
+     */
+    bool IsMemoryMapped() const;
+
+    /**
+     * @brief Gets the address, inside the file mapping (or the preloaded buffer), of the sample read by the last Synchronise.
+     * @return the address of the current sample (the first sample before the first Synchronise) or NULL if the file is neither preloaded nor memory mapped.
+     */
+    const char8 *GetCurrentRecord() const;
+
+    /**
+     * @brief Gets the byte offset of a signal inside each sample.
+     * @param[in] signalIdx the index of the signal.
+     * @param[out] offset the byte offset of the signal.
+     * @return true if signalIdx is valid.
+     * @pre
+     *   SetConfiguredDatabase
+     */
+    bool GetSignalRecordOffset(const uint32 signalIdx,
+                               uint32 &offset) const;
+
 private:
 
     /**
@@ -396,6 +427,48 @@ private:
 
     preLoadedData allData;
 
+    /**
+     * True if the file is memory mapped. In this case allData.internalBuffer points at the first sample inside the mapping.
+     */
+    bool memoryMap;
+
+    /**
+     * The file mapping.
+     */
+    void *mappedFile;
+
+    /**
+     * The size of the file mapping.
+     */
+    uint64 mappedFileByteSize;
+
+    /**
+     * Number of bytes which are requested ahead of the current sample.
+     */
+    uint64 readAheadByteSize;
+
+    /**
+     * Index (in allData.internalBuffer) up to which the data was already requested to the kernel.
+     */
+    uint64 readAheadIdx;
+
+    /**
+     * The sample read by the last Synchronise.
+     */
+    const char8 *currentRecord;
+
+    /**
+     * @brief Maps the data file into memory.
+     * @param[in] headerSize the size of the binary header.
+     * @return true if the file can be successfully mapped.
+     */
+    bool MapFile(const uint64 headerSize);
+
+    /**
+     * @brief Requests to the kernel the next readAheadByteSize bytes after the current sample.
+     */
+    void ReadAhead();
+
     bool ReadLineCSVFormat();
 
 };
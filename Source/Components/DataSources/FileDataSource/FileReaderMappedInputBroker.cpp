@@ -0,0 +1,158 @@
+/**
+ * @file FileReaderMappedInputBroker.cpp
+ * @brief Source file for class FileReaderMappedInputBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FileReaderMappedInputBroker (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "FileReaderMappedInputBroker.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+FileReaderMappedInputBroker::FileReaderMappedInputBroker() :
+        BrokerI() {
+    fileReader = NULL_PTR(FileReader *);
+    copyTable = NULL_PTR(FileReaderMappedCopyTableEntry *);
+}
+
+FileReaderMappedInputBroker::FileReaderMappedInputBroker(FileReader * const fileReaderIn) :
+        BrokerI() {
+    fileReader = fileReaderIn;
+    copyTable = NULL_PTR(FileReaderMappedCopyTableEntry *);
+}
+
+/*lint -e{1540} the fileReader is freed by the ObjectRegistryDatabase*/
+FileReaderMappedInputBroker::~FileReaderMappedInputBroker() {
+    if (copyTable != NULL_PTR(FileReaderMappedCopyTableEntry *)) {
+        delete[] copyTable;
+    }
+}
+
+bool FileReaderMappedInputBroker::Init(const SignalDirection direction,
+                                       DataSourceI &dataSourceIn,
+                                       const char8 * const functionName,
+                                       void * const gamMemoryAddress) {
+    bool ret = (fileReader != NULL_PTR(FileReader *));
+    if (ret) {
+        ret = fileReader->IsMemoryMapped();
+    }
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The FileReaderMappedInputBroker requires a memory mapped FileReader");
+    }
+    if (ret) {
+        ret = InitFunctionPointers(direction, dataSourceIn, functionName, gamMemoryAddress);
+    }
+    const ClassProperties * properties = GetClassProperties();
+    if (ret) {
+        ret = (properties != NULL);
+    }
+    const char8* brokerClassName = NULL_PTR(const char8*);
+    if (ret) {
+        brokerClassName = properties->GetName();
+        ret = (brokerClassName != NULL);
+    }
+    if (ret) {
+        ret = (numberOfCopies > 0u);
+    }
+    if (ret) {
+        copyTable = new FileReaderMappedCopyTableEntry[numberOfCopies];
+    }
+    uint32 functionIdx = 0u;
+    if (ret) {
+        ret = dataSourceIn.GetFunctionIndex(functionIdx, functionName);
+    }
+    uint32 functionNumberOfSignals = 0u;
+    if (ret) {
+        ret = dataSourceIn.GetFunctionNumberOfSignals(direction, functionIdx, functionNumberOfSignals);
+    }
+    uint32 c = 0u;
+    uint32 n;
+    for (n = 0u; (n < functionNumberOfSignals) && (ret); n++) {
+        if (dataSourceIn.IsSupportedBroker(direction, functionIdx, n, brokerClassName)) {
+            uint32 numberOfByteOffsets = 0u;
+            ret = dataSourceIn.GetFunctionSignalNumberOfByteOffsets(direction, functionIdx, n, numberOfByteOffsets);
+
+            StreamString functionSignalName;
+            if (ret) {
+                ret = dataSourceIn.GetFunctionSignalAlias(direction, functionIdx, n, functionSignalName);
+            }
+            uint32 signalIdx = 0u;
+            if (ret) {
+                ret = dataSourceIn.GetSignalIndex(signalIdx, functionSignalName.Buffer());
+            }
+            uint32 signalOffset = 0u;
+            if (ret) {
+                /*lint -e{613} fileReader cannot be NULL as otherwise ret would be false*/
+                ret = fileReader->GetSignalRecordOffset(signalIdx, signalOffset);
+            }
+            //Take into account different ranges for the same signal
+            uint32 bo;
+            for (bo = 0u; (bo < numberOfByteOffsets) && (ret); bo++) {
+                ret = (c < numberOfCopies);
+                if (ret) {
+                    /*lint -e{613} copyTable cannot be NULL as otherwise ret would be false*/
+                    copyTable[c].copySize = GetCopyByteSize(c);
+                    copyTable[c].gamPointer = GetFunctionPointer(c);
+                    copyTable[c].recordOffset = (signalOffset + GetCopyOffset(c));
+                }
+                c++;
+            }
+        }
+    }
+    return ret;
+}
+
+bool FileReaderMappedInputBroker::Execute() {
+    bool ret = (fileReader != NULL_PTR(FileReader *));
+    if (ret) {
+        /*lint -e{613} fileReader cannot be NULL as otherwise ret would be false*/
+        ret = fileReader->Synchronise();
+    }
+    const char8 *record = NULL_PTR(const char8 *);
+    if (ret) {
+        /*lint -e{613} fileReader cannot be NULL as otherwise ret would be false*/
+        record = fileReader->GetCurrentRecord();
+        ret = (record != NULL_PTR(const char8 *));
+    }
+    uint32 n;
+    for (n = 0u; (n < numberOfCopies) && (ret); n++) {
+        /*lint -e{613} copyTable and record cannot be NULL as otherwise ret would be false*/
+        ret = MemoryOperationsHelper::Copy(copyTable[n].gamPointer, &record[copyTable[n].recordOffset], copyTable[n].copySize);
+    }
+    return ret;
+}
+
+CLASS_REGISTER(FileReaderMappedInputBroker, "1.0")
+
+}
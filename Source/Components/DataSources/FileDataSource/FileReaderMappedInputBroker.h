@@ -0,0 +1,120 @@
+/**
+ * @file FileReaderMappedInputBroker.h
+ * @brief Header file for class FileReaderMappedInputBroker
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FileReaderMappedInputBroker
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef FILEDATASOURCE_FILEREADERMAPPEDINPUTBROKER_H_
+#define FILEDATASOURCE_FILEREADERMAPPEDINPUTBROKER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "BrokerI.h"
+#include "FileReader.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Describes a copy from the current FileReader sample to the GAM memory.
+ */
+struct FileReaderMappedCopyTableEntry {
+    /**
+     * The pointer to the GAM memory.
+     */
+    void *gamPointer;
+
+    /**
+     * The offset of the copy inside each sample.
+     */
+    uint32 recordOffset;
+
+    /**
+     * The size of the copy.
+     */
+    uint32 copySize;
+};
+
+/**
+ * @brief Input broker which copies the signals straight from a memory mapped FileReader (Preload = "mmap") into the GAM memory.
+ * @details On every Execute the FileReader is synchronised (which moves the current sample forward in the file mapping) and the
+ * signals are copied from the current sample, skipping the intermediate copy into the DataSource memory.
+ */
+class FileReaderMappedInputBroker: public BrokerI {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    FileReaderMappedInputBroker();
+
+    /**
+     * @brief Constructor. Sets a pointer to the FileReader.
+     * @param[in] fileReaderIn the memory mapped FileReader.
+     */
+    FileReaderMappedInputBroker(FileReader * const fileReaderIn);
+
+    /**
+     * @brief Destructor. Frees the copy table.
+     */
+    virtual ~FileReaderMappedInputBroker();
+
+    /**
+     * @brief See BrokerI::Init. Computes, for each copy, the offset of the signal inside each sample.
+     * @return true if the FileReader is valid and if all the signal offsets can be computed.
+     */
+    virtual bool Init(const SignalDirection direction,
+                      DataSourceI &dataSourceIn,
+                      const char8 * const functionName,
+                      void * const gamMemoryAddress);
+
+    /**
+     * @brief Synchronises the FileReader and sequentially copies all the signals to the GAM memory from FileReader::GetCurrentRecord().
+     * @return true if the FileReader synchronises and if all copies are successfully performed.
+     */
+    virtual bool Execute();
+
+private:
+    /**
+     * The memory mapped FileReader.
+     */
+    FileReader *fileReader;
+
+    /**
+     * A table with all the elements to be copied.
+     */
+    FileReaderMappedCopyTableEntry *copyTable;
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* FILEDATASOURCE_FILEREADERMAPPEDINPUTBROKER_H_ */
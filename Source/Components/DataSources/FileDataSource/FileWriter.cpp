@@ -24,14 +24,19 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CLASSMETHODREGISTER.h"
 #include "Directory.h"
 #include "FileWriter.h"
+#include "HighResolutionTimer.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -43,10 +48,20 @@
 namespace MARTe {
 static const int32 FILE_FORMAT_BINARY = 1;
 static const int32 FILE_FORMAT_CSV = 2;
+/**
+ * Alignment of the write buffers.
+ */
+static const uint32 FILE_WRITER_BUFFER_ALIGNMENT = 4096u;
+/**
+ * Maximum time, in milliseconds, that the I/O thread waits for a buffer before checking if it was asked to stop.
+ */
+static const uint32 FILE_WRITER_IO_THREAD_TIMEOUT = 100u;
 
 FileWriter::FileWriter() :
         DataSourceI(),
-        MessageI() {
+        EmbeddedServiceMethodBinderI(),
+        MessageI(),
+        writerExecutor(*this) {
     storeOnTrigger = false;
     numberOfPreTriggers = 0u;
     numberOfPostTriggers = 0u;
@@ -63,6 +78,26 @@ FileWriter::FileWriter() :
     refreshContent = 0u;
     fullNotation =0u;
     signalsAnyType = NULL_PTR(AnyType *);
+    headerPositionMarker = 0u;
+    writeBufferByteSize = 0u;
+    writeBufferCapacity = 0u;
+    numberOfWriteBuffers = 2u;
+    syncEveryNBuffers = 0u;
+    writeBuffers = NULL_PTR(char8 **);
+    writeBufferUsedBytes = NULL_PTR(uint32 *);
+    submittedBuffers = 0;
+    completedBuffers = 0;
+    writerError = false;
+    writeBufferHighWaterMark = 0u;
+    numberOfWriteBufferStalls = 0u;
+    numberOfBytesWritten = 0u;
+    writeTicks = 0u;
+    if (!fillMutex.Create(false)) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create FastPollingMutexSem.");
+    }
+    if (!writeSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
     filter = ReferenceT < RegisteredMethodsMessageFilter > (GlobalObjectsDatabase::Instance()->GetStandardHeap());
     filter->SetDestination(this);
     ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
@@ -86,6 +121,24 @@ FileWriter::~FileWriter() {
         delete[] signalsAnyType;
     }
     (void) CloseFile();
+    if (!writeSem.Post()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not post EventSem.");
+    }
+    if (!writerExecutor.Stop()) {
+        if (!writerExecutor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (writeBuffers != NULL_PTR(char8 **)) {
+        uint32 b;
+        for (b = 0u; b < numberOfWriteBuffers; b++) {
+            free(writeBuffers[b]);
+        }
+        delete[] writeBuffers;
+    }
+    if (writeBufferUsedBytes != NULL_PTR(uint32 *)) {
+        delete[] writeBufferUsedBytes;
+    }
 }
 
 bool FileWriter::AllocateMemory() {
@@ -163,7 +216,10 @@ bool FileWriter::Synchronise() {
             (void) outputFile.SetSize(headerPositionMarker);
         }
 
-        if (fileFormat == FILE_FORMAT_BINARY) {
+        if (writeBuffers != NULL_PTR(char8 **)) {
+            ok = BufferRecord();
+        }
+        else if (fileFormat == FILE_FORMAT_BINARY) {
             uint32 writeSize = numberOfBinaryBytes;
             ok = outputFile.Write(dataSourceMemory, writeSize);
             if (ok) {
@@ -335,6 +391,38 @@ bool FileWriter::Initialise(StructuredDataI& data) {
         //    fullNotation = 0u;
         //}
     }
+    if (ok) {
+        if (!data.Read("WriteBufferByteSize", writeBufferByteSize)) {
+            writeBufferByteSize = 0u;
+        }
+        if (writeBufferByteSize > 0u) {
+            ok = (fileFormat == FILE_FORMAT_BINARY);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "WriteBufferByteSize is only supported with FileFormat = binary");
+            }
+            if (ok) {
+                ok = (refreshContent == 0u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "WriteBufferByteSize is not supported with RefreshContent");
+                }
+            }
+            if (ok) {
+                if (!data.Read("NumberOfWriteBuffers", numberOfWriteBuffers)) {
+                    numberOfWriteBuffers = 2u;
+                }
+                ok = (numberOfWriteBuffers > 1u);
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "NumberOfWriteBuffers shall be > 1u");
+                }
+            }
+            if (ok) {
+                if (!data.Read("SyncEveryNBuffers", syncEveryNBuffers)) {
+                    syncEveryNBuffers = 0u;
+                }
+                REPORT_ERROR(ErrorManagement::Information, "Writing in %d buffers of %d bytes", numberOfWriteBuffers, writeBufferByteSize);
+            }
+        }
+    }
 
     if (ok) {
         ok = data.MoveRelative("Signals");
@@ -440,6 +528,43 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
     if (ok) {
         dataSourceMemory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(numberOfBinaryBytes));
     }
+    if ((ok) && (writeBufferByteSize > 0u)) {
+        ok = (writeBufferByteSize >= numberOfBinaryBytes);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "WriteBufferByteSize (%d) shall be >= the size of one record (%d)", writeBufferByteSize, numberOfBinaryBytes);
+        }
+        if (ok) {
+            //Only complete records are stored in each buffer
+            writeBufferCapacity = (writeBufferByteSize / numberOfBinaryBytes) * numberOfBinaryBytes;
+            writeBuffers = new char8*[numberOfWriteBuffers];
+            writeBufferUsedBytes = new uint32[numberOfWriteBuffers];
+            uint32 b;
+            for (b = 0u; b < numberOfWriteBuffers; b++) {
+                writeBuffers[b] = NULL_PTR(char8 *);
+                writeBufferUsedBytes[b] = 0u;
+            }
+            for (b = 0u; (b < numberOfWriteBuffers) && (ok); b++) {
+                void *alignedMemory = NULL_PTR(void *);
+                ok = (posix_memalign(&alignedMemory, FILE_WRITER_BUFFER_ALIGNMENT, writeBufferCapacity) == 0);
+                if (ok) {
+                    writeBuffers[b] = static_cast<char8 *>(alignedMemory);
+                }
+                else {
+                    REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate write buffer %d", b);
+                }
+            }
+        }
+        if (ok) {
+            writerExecutor.SetCPUMask(cpuMask);
+            writerExecutor.SetStackSize(stackSize);
+            if (writerExecutor.GetStatus() == EmbeddedThreadI::OffState) {
+                ok = writerExecutor.Start();
+            }
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::FatalError, "Could not start the I/O thread");
+            }
+        }
+    }
 
     //If the type is text prepare the Printf properties in advanced
     if (fileFormat == FILE_FORMAT_CSV) {
@@ -505,6 +630,15 @@ bool FileWriter::SetConfiguredDatabase(StructuredDataI& data) {
 }
 
 ErrorManagement::ErrorType FileWriter::OpenFile(StreamString filenameIn) {
+    if (writeBuffers != NULL_PTR(char8 **)) {
+        //Data of a previous file shall not be written after the new header
+        (void) FlushWriteBuffers();
+        writerError = false;
+        writeBufferHighWaterMark = 0u;
+        numberOfWriteBufferStalls = 0u;
+        numberOfBytesWritten = 0u;
+        writeTicks = 0u;
+    }
     filename = filenameIn;
     REPORT_ERROR(ErrorManagement::Information, "Going to open file with name %s", filename.Buffer());
     if (!overwrite) {
@@ -636,6 +770,10 @@ ErrorManagement::ErrorType FileWriter::CloseFile() {
     ErrorManagement::ErrorType err = FlushFile();
     if (err.ErrorsCleared()) {
         if (outputFile.IsOpen()) {
+            if (writeBuffers != NULL_PTR(char8 **)) {
+                REPORT_ERROR(ErrorManagement::Information, "Wrote %d bytes at %f MB/s. Write buffers high-water mark: %d of %d. Stalls: %d",
+                             numberOfBytesWritten, (GetWriteBandwidth() / 1e6), writeBufferHighWaterMark, numberOfWriteBuffers, numberOfWriteBufferStalls);
+            }
             err = !outputFile.Close();
         }
         if (err.ErrorsCleared()) {
@@ -665,6 +803,11 @@ ErrorManagement::ErrorType FileWriter::FlushFile() {
             ok = brokerAsyncNoTrigger->Flush();
         }
     }
+    if (ok) {
+        if (writeBuffers != NULL_PTR(char8 **)) {
+            ok = FlushWriteBuffers();
+        }
+    }
     if (ok) {
         if (outputFile.IsOpen()) {
             ok = outputFile.Flush();
@@ -716,6 +859,145 @@ bool FileWriter::IsOverwrite() const {
     return overwrite;
 }
 
+bool FileWriter::BufferRecord() {
+    bool ok = (fillMutex.FastLock() == ErrorManagement::NoError);
+    if (ok) {
+        //Wait for the I/O thread to release a buffer
+        bool stalled = false;
+        uint32 pending = static_cast<uint32>(submittedBuffers) - static_cast<uint32>(completedBuffers);
+        while ((pending >= numberOfWriteBuffers) && (!writerError)) {
+            if (!stalled) {
+                numberOfWriteBufferStalls++;
+                stalled = true;
+            }
+            Sleep::MSec(1u);
+            pending = static_cast<uint32>(submittedBuffers) - static_cast<uint32>(completedBuffers);
+        }
+        ok = !writerError;
+        if (ok) {
+            uint32 idx = static_cast<uint32>(submittedBuffers) % numberOfWriteBuffers;
+            /*lint -e{613} writeBuffers and writeBufferUsedBytes cannot be NULL as BufferRecord is only called if writeBuffers != NULL*/
+            ok = MemoryOperationsHelper::Copy(&writeBuffers[idx][writeBufferUsedBytes[idx]], dataSourceMemory, numberOfBinaryBytes);
+            if (ok) {
+                writeBufferUsedBytes[idx] += numberOfBinaryBytes;
+                if (writeBufferUsedBytes[idx] >= writeBufferCapacity) {
+                    SubmitWriteBuffer();
+                }
+            }
+        }
+        fillMutex.FastUnLock();
+    }
+    return ok;
+}
+
+void FileWriter::SubmitWriteBuffer() {
+    //writeBufferUsedBytes must be visible to the I/O thread before the counter is (Atomic::Increment is a full barrier)
+    Atomic::Increment(&submittedBuffers);
+    uint32 pending = static_cast<uint32>(submittedBuffers) - static_cast<uint32>(completedBuffers);
+    if (pending > writeBufferHighWaterMark) {
+        writeBufferHighWaterMark = pending;
+    }
+    if (!writeSem.Post()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not post EventSem.");
+    }
+}
+
+bool FileWriter::FlushWriteBuffers() {
+    bool ok = (fillMutex.FastLock() == ErrorManagement::NoError);
+    uint32 target = 0u;
+    if (ok) {
+        target = static_cast<uint32>(submittedBuffers);
+        uint32 pending = target - static_cast<uint32>(completedBuffers);
+        //If all the buffers are pending there is no partially filled buffer
+        if (pending < numberOfWriteBuffers) {
+            uint32 idx = target % numberOfWriteBuffers;
+            /*lint -e{613} writeBufferUsedBytes cannot be NULL as FlushWriteBuffers is only called if writeBuffers != NULL*/
+            if (writeBufferUsedBytes[idx] > 0u) {
+                SubmitWriteBuffer();
+                target++;
+            }
+        }
+        fillMutex.FastUnLock();
+    }
+    if (ok) {
+        //Wait for the buffers submitted until now (and not for the ones which may be concurrently submitted)
+        bool running = (writerExecutor.GetStatus() != EmbeddedThreadI::OffState);
+        while ((running) && (static_cast<int32>(static_cast<uint32>(completedBuffers) - target) < 0)) {
+            Sleep::MSec(1u);
+            running = (writerExecutor.GetStatus() != EmbeddedThreadI::OffState);
+        }
+        ok = !writerError;
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType FileWriter::Execute(ExecutionInfo& info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        (void) writeSem.Wait(static_cast<TimeoutType>(FILE_WRITER_IO_THREAD_TIMEOUT));
+        (void) writeSem.Reset();
+        //Buffers submitted after the Reset are either written below or post the semaphore again
+        while (submittedBuffers != completedBuffers) {
+            uint32 idx = static_cast<uint32>(completedBuffers) % numberOfWriteBuffers;
+            if (!writerError) {
+                uint32 writeSize = writeBufferUsedBytes[idx];
+                uint64 startTicks = HighResolutionTimer::Counter();
+                /*lint -e{613} writeBuffers and writeBufferUsedBytes cannot be NULL as the thread is only started after their allocation*/
+                bool ok = outputFile.Write(writeBuffers[idx], writeSize);
+                if (ok) {
+                    ok = (writeSize == writeBufferUsedBytes[idx]);
+                }
+                writeTicks += (HighResolutionTimer::Counter() - startTicks);
+                numberOfBytesWritten += writeSize;
+                if ((ok) && (syncEveryNBuffers > 0u)) {
+                    if (((static_cast<uint32>(completedBuffers) + 1u) % syncEveryNBuffers) == 0u) {
+                        ok = (fdatasync(outputFile.GetWriteHandle()) == 0);
+                    }
+                }
+                if (!ok) {
+                    REPORT_ERROR(ErrorManagement::FatalError, "The I/O thread failed to write into the file");
+                    writerError = true;
+                }
+            }
+            writeBufferUsedBytes[idx] = 0u;
+            Atomic::Increment(&completedBuffers);
+        }
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 FileWriter::GetWriteBufferByteSize() const {
+    return writeBufferByteSize;
+}
+
+uint32 FileWriter::GetNumberOfWriteBuffers() const {
+    return numberOfWriteBuffers;
+}
+
+uint32 FileWriter::GetSyncEveryNBuffers() const {
+    return syncEveryNBuffers;
+}
+
+uint32 FileWriter::GetWriteBufferHighWaterMark() const {
+    return writeBufferHighWaterMark;
+}
+
+uint32 FileWriter::GetNumberOfWriteBufferStalls() const {
+    return numberOfWriteBufferStalls;
+}
+
+uint64 FileWriter::GetNumberOfBytesWritten() const {
+    return numberOfBytesWritten;
+}
+
+float64 FileWriter::GetWriteBandwidth() const {
+    float64 bandwidth = 0.0;
+    if (writeTicks > 0u) {
+        float64 writeTime = static_cast<float64>(writeTicks) * HighResolutionTimer::Period();
+        bandwidth = static_cast<float64>(numberOfBytesWritten) / writeTime;
+    }
+    return bandwidth;
+}
+
 void FileWriter::Purge(ReferenceContainer &purgeList) {
     if (FlushFile() != ErrorManagement::NoError) {
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to Flush the File");
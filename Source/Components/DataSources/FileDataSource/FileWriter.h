@@ -32,12 +32,16 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "File.h"
 #include "MemoryMapAsyncOutputBroker.h"
 #include "MemoryMapAsyncTriggerOutputBroker.h"
 #include "MessageI.h"
 #include "ProcessorType.h"
 #include "RegisteredMethodsMessageFilter.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -60,6 +64,17 @@ namespace MARTe {
  *  by 32 bytes to encode the signal name, followed by 4 bytes which store the number of elements of a given signal.
  *  Following the header the signal samples are consecutively stored in binary format.
  *
+ * In binary format, and if WriteBufferByteSize is set, the records are not written to the file one by one. Instead they are
+ * accumulated into NumberOfWriteBuffers page aligned buffers of (up to) WriteBufferByteSize bytes each. Every time a buffer is full it is handed
+ * to a dedicated I/O thread (with the same CPUMask and StackSize), which writes the whole buffer with a single call, and the filling
+ * continues on the next buffer. The buffers are exchanged through a single-producer/single-consumer ring, where the number of submitted and
+ * of written buffers are monotonic counters, so that no lock is required between the producer and the I/O thread. If all the buffers
+ * are waiting to be written the producer waits for the I/O thread (this is counted as a stall). FlushFile (and thus CloseFile) submits the
+ * partially filled buffer and waits for all the buffers to be written. If SyncEveryNBuffers is set the file data is also committed to the disk
+ * (fdatasync) every SyncEveryNBuffers written buffers.
+ * The high-water mark of the buffers queued to the I/O thread, the number of stalls and the write bandwidth are available with the
+ * GetWriteBufferHighWaterMark, GetNumberOfWriteBufferStalls and GetWriteBandwidth methods and are reported when the file is closed.
+ *
  * This DataSourceI has the functions FlushFile, OpenFile and CloseFile registered as RPCs.
  *
  * Only one and one GAM is allowed to write into this DataSourceI.
@@ -80,6 +95,9 @@ namespace MARTe {
  *     RefreshContent = 0 //Optional. If set, new data will always overwrite old data, keeping always the last snapshot. Also enables header pretty-printing, which is referred as "Full Notation".
  *     NumberOfPreTriggers = 2 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store before the trigger.
  *     NumberOfPostTriggers = 1 //Compulsory iff StoreOnTrigger = 1.  Number of cycles to store after the trigger.
+ *     WriteBufferByteSize = 16777216 //Optional. Only valid if FileFormat = binary and RefreshContent = 0. If > 0 the records are written in blocks of this size by a dedicated I/O thread (see above). Shall be >= the size of one record. Default = 0 (i.e. one write per record).
+ *     NumberOfWriteBuffers = 2 //Optional. Only meaningful if WriteBufferByteSize > 0. Number of buffers of WriteBufferByteSize bytes. Shall be >= 2. Default = 2.
+ *     SyncEveryNBuffers = 4 //Optional. Only meaningful if WriteBufferByteSize > 0. If > 0 the file data is committed to the disk every SyncEveryNBuffers written buffers. Default = 0 (never).
  *
  *     Signals = {
  *         Trigger = { //Compulsory when StoreOnTrigger = 1. Must be set in index 0 of the Signals node. When the value of this signal is 1 data will be stored.
@@ -121,7 +139,7 @@ namespace MARTe {
  *
  * </pre>
  */
-class FileWriter: public DataSourceI, public MessageI {
+class FileWriter: public DataSourceI, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -219,6 +237,8 @@ public:
 
     /**
      * @brief Flushes the file.
+     * @details If WriteBufferByteSize > 0, the partially filled write buffer is handed to the I/O thread and this method waits for all the
+     * buffers to be written.
      * @return true if the file can be successfully flushed.
      */
     ErrorManagement::ErrorType FlushFile();
@@ -296,6 +316,55 @@ public:
      */
     bool IsOverwrite() const;
 
+    /**
+     * @brief Callback of the I/O thread which writes the buffers filled by Synchronise (only if WriteBufferByteSize > 0).
+     * @details Waits (with a timeout) for buffers to be submitted and writes all the submitted buffers, in order, into the file.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the size of each write buffer.
+     * @return the size of each write buffer (0 if the records are written one by one).
+     */
+    uint32 GetWriteBufferByteSize() const;
+
+    /**
+     * @brief Gets the number of write buffers.
+     * @return the number of write buffers.
+     */
+    uint32 GetNumberOfWriteBuffers() const;
+
+    /**
+     * @brief Gets the number of written buffers after which the file data is committed to the disk.
+     * @return the number of written buffers after which the file data is committed to the disk (0 if never).
+     */
+    uint32 GetSyncEveryNBuffers() const;
+
+    /**
+     * @brief Gets the maximum number of buffers which were simultaneously waiting to be written since the file was opened.
+     * @return the maximum number of buffers which were simultaneously waiting to be written.
+     */
+    uint32 GetWriteBufferHighWaterMark() const;
+
+    /**
+     * @brief Gets the number of times that the producer had to wait for a free write buffer since the file was opened.
+     * @return the number of times that the producer had to wait for a free write buffer.
+     */
+    uint32 GetNumberOfWriteBufferStalls() const;
+
+    /**
+     * @brief Gets the number of bytes written by the I/O thread since the file was opened.
+     * @return the number of bytes written by the I/O thread.
+     */
+    uint64 GetNumberOfBytesWritten() const;
+
+    /**
+     * @brief Gets the bandwidth of the I/O thread writes since the file was opened.
+     * @return the number of bytes written by the I/O thread divided by the time spent in the writes (in bytes per second).
+     */
+    float64 GetWriteBandwidth() const;
+
     /**
      * @see DataSourceI::Purge()
      */
@@ -303,6 +372,23 @@ public:
 
 private:
 
+    /**
+     * @brief Copies the record into the write buffer being filled and hands the buffer to the I/O thread when it is full.
+     * @return true if the I/O thread did not fail to write into the file.
+     */
+    bool BufferRecord();
+
+    /**
+     * @brief Hands the buffer being filled to the I/O thread.
+     */
+    void SubmitWriteBuffer();
+
+    /**
+     * @brief Hands the partially filled buffer to the I/O thread and waits for all the submitted buffers to be written.
+     * @return true if the I/O thread did not fail to write into the file.
+     */
+    bool FlushWriteBuffers();
+
     /**
      * True if the data is only to be stored in the output file following a trigger.
      */
@@ -439,6 +525,88 @@ private:
      * The message to send if there is a runtime error.
      */
     ReferenceT<Message> fileRuntimeErrorMsg;
+
+    /**
+     * Size of each write buffer as configured.
+     */
+    uint32 writeBufferByteSize;
+
+    /**
+     * Number of bytes of each write buffer that are used (i.e. an integer number of records).
+     */
+    uint32 writeBufferCapacity;
+
+    /**
+     * Number of write buffers.
+     */
+    uint32 numberOfWriteBuffers;
+
+    /**
+     * Number of written buffers after which the file data is committed to the disk.
+     */
+    uint32 syncEveryNBuffers;
+
+    /**
+     * The page aligned write buffers.
+     */
+    char8 **writeBuffers;
+
+    /**
+     * Number of bytes filled in each write buffer.
+     */
+    uint32 *writeBufferUsedBytes;
+
+    /**
+     * Number of buffers handed to the I/O thread. Only incremented by the producer.
+     * The buffer being filled is writeBuffers[submittedBuffers % numberOfWriteBuffers].
+     */
+    volatile int32 submittedBuffers;
+
+    /**
+     * Number of buffers written by the I/O thread. Only incremented by the I/O thread.
+     * The next buffer to be written is writeBuffers[completedBuffers % numberOfWriteBuffers].
+     */
+    volatile int32 completedBuffers;
+
+    /**
+     * Set by the I/O thread if it fails to write into the file.
+     */
+    volatile bool writerError;
+
+    /**
+     * Protects the buffer being filled against a concurrent FlushFile.
+     */
+    FastPollingMutexSem fillMutex;
+
+    /**
+     * Posted every time that a buffer is handed to the I/O thread.
+     */
+    EventSem writeSem;
+
+    /**
+     * The I/O thread.
+     */
+    SingleThreadService writerExecutor;
+
+    /**
+     * Maximum number of buffers simultaneously waiting to be written.
+     */
+    uint32 writeBufferHighWaterMark;
+
+    /**
+     * Number of times that the producer had to wait for a free write buffer.
+     */
+    uint32 numberOfWriteBufferStalls;
+
+    /**
+     * Number of bytes written by the I/O thread.
+     */
+    uint64 numberOfBytesWritten;
+
+    /**
+     * Number of HighResolutionTimer ticks spent by the I/O thread in the writes.
+     */
+    uint64 writeTicks;
 };
 }
 
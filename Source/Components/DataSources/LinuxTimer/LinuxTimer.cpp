@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "CLASSMETHODREGISTER.h"
 #include "HighResolutionTimeProvider.h"
 #include "LinuxTimer.h"
 #include "MemoryMapSynchronisedInputBroker.h"
@@ -55,6 +56,11 @@ const uint32 LINUX_TIMER_EXEC_MODE_SPAWNED = 2u;
  * @brief Maximum phase of the signal (default)
  */
 const uint32 USEC_IN_SEC = 1000000u;
+
+/**
+ * @brief Default width of the wake-up latency histogram bins in nanoseconds.
+ */
+const uint32 LINUX_TIMER_DEFAULT_HISTOGRAM_BIN_WIDTH = 1000u;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -64,6 +70,7 @@ namespace MARTe {
 LinuxTimer::LinuxTimer() :
         DataSourceI(),
         EmbeddedServiceMethodBinderI(),
+        MessageI(),
         executor(*this) {
     startTimeTicks = 0u;
     sleepTimeTicks[0] = 0u;
@@ -84,10 +91,23 @@ LinuxTimer::LinuxTimer() :
     phase = 0u;
     phaseBackup = phase;
     trigRephase = 0u;
+    histogramNumberOfBins = 0u;
+    histogramBinWidth = LINUX_TIMER_DEFAULT_HISTOGRAM_BIN_WIDTH;
+    latencyHistogram = NULL_PTR(uint32 *);
+    overrunHistogram = NULL_PTR(uint32 *);
+    maxLatency = 0u;
+    nsPerTick = 0.;
+    resetHistogramsRequested = false;
 
     if (!synchSem.Create()) {
         REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
     }
+    filter = ReferenceT<RegisteredMethodsMessageFilter>(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    filter->SetDestination(this);
+    ErrorManagement::ErrorType ret = MessageI::InstallMessageFilter(filter);
+    if (!ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
+    }
 }
 
 /*lint -e{1551} the destructor must guarantee that the Timer SingleThreadService is stopped.*/
@@ -100,6 +120,12 @@ LinuxTimer::~LinuxTimer() {
             REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
         }
     }
+    if (latencyHistogram != NULL_PTR(uint32 *)) {
+        delete[] latencyHistogram;
+    }
+    if (overrunHistogram != NULL_PTR(uint32 *)) {
+        delete[] overrunHistogram;
+    }
 }
 
 bool LinuxTimer::AllocateMemory() {
@@ -203,6 +229,28 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
             }
         }
 
+        if (ok) {
+            if (!data.Read("HistogramNumberOfBins", histogramNumberOfBins)) {
+                histogramNumberOfBins = 0u;
+            }
+            if (!data.Read("HistogramBinWidth", histogramBinWidth)) {
+                histogramBinWidth = LINUX_TIMER_DEFAULT_HISTOGRAM_BIN_WIDTH;
+            }
+            ok = (histogramBinWidth > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "HistogramBinWidth shall be > 0u");
+            }
+            if ((ok) && (histogramNumberOfBins > 0u)) {
+                latencyHistogram = new uint32[histogramNumberOfBins];
+                overrunHistogram = new uint32[histogramNumberOfBins];
+                for (uint32 b = 0u; b < histogramNumberOfBins; b++) {
+                    latencyHistogram[b] = 0u;
+                    overrunHistogram[b] = 0u;
+                }
+                REPORT_ERROR(ErrorManagement::Information, "Histograms enabled with %d bins of %d ns", histogramNumberOfBins, histogramBinWidth);
+            }
+        }
+
         if (ok) {
             ok = (Size() < 2u);
             if (!ok) {
@@ -268,6 +316,7 @@ bool LinuxTimer::Initialise(StructuredDataI &data) {
 
         if (ok) {
             ticksPerUs = (static_cast<float64>(timeProvider->Frequency()) / 1.0e6);
+            nsPerTick = (1.0e9 / static_cast<float64>(timeProvider->Frequency()));
         }
     }
     else {
@@ -282,10 +331,10 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
     uint32 tempNumOfSignals = GetNumberOfSignals();
 
     if (ok) {
-        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 5u);
+        ok = (tempNumOfSignals >= 2u) && (tempNumOfSignals <= 7u);
     }
     if (!ok) {
-        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 5");
+        REPORT_ERROR(ErrorManagement::ParametersError, "Number of signal must be between 2 and 7");
     }
     if (ok) {
         ok = (GetSignalType(0u).numberOfBits == 32u);
@@ -344,6 +393,23 @@ bool LinuxTimer::SetConfiguredDatabase(StructuredDataI &data) {
         }
     }
 
+    for (uint32 h = 5u; (h < tempNumOfSignals) && (ok); h++) {
+        ok = ((GetSignalType(h).type == UnsignedInteger) && (GetSignalType(h).numberOfBits == 32u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The histogram signals must be 32 bit unsigned integers");
+        }
+        uint32 numberOfElements = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfElements(h, numberOfElements);
+        }
+        if (ok) {
+            ok = ((histogramNumberOfBins > 0u) && (numberOfElements == histogramNumberOfBins));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The histogram signals must have HistogramNumberOfBins (%d) > 0 elements", histogramNumberOfBins);
+            }
+        }
+    }
+
     if (ok) {
         ReferenceContainer result;
         ReferenceContainerFilterReferences filter(1, ReferenceContainerFilterMode::PATH, this);
@@ -379,6 +445,12 @@ bool LinuxTimer::GetSignalMemoryBuffer(const uint32 signalIdx,
     else if (signalIdx == 4u) {
         signalAddress = &trigRephase;
     }
+    else if ((signalIdx == 5u) && (latencyHistogram != NULL_PTR(uint32 *))) {
+        signalAddress = &latencyHistogram[0];
+    }
+    else if ((signalIdx == 6u) && (overrunHistogram != NULL_PTR(uint32 *))) {
+        signalAddress = &overrunHistogram[0];
+    }
     else {
         ok = false;
     }
@@ -555,6 +627,9 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
 
     uint64 cycleEndTicks = timeProvider->Counter();
 
+    //The first cycle after a state change or a rephase is not accounted in the histograms
+    bool accountCycle = ((startTimeTicks != 0u) && (trigRephase == 0u));
+
     if (trigRephase > 0u) {
         startTimeTicks = cycleEndTicks;
         float64 seconds0 = static_cast<float64>(static_cast<float64>(cycleEndTicks) * timeProvider->Period());
@@ -579,14 +654,17 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
     //If we lose cycle (i.e. if startTimeTicks < N * cycleEndTicks), rephase to a multiple of the period
     uint32 nCycles = 0u;
 
-    while (startTimeTicks < cycleEndTicks) {
-        startTimeTicks += sleepTimeTicksT;
-        nCycles++;
+    if (startTimeTicks < cycleEndTicks) {
+        //Smallest number of periods which brings startTimeTicks to (or past) cycleEndTicks
+        uint64 lateTicks = (cycleEndTicks - startTimeTicks);
+        uint64 nCycles64 = ((lateTicks + sleepTimeTicksT) - 1u) / sleepTimeTicksT;
+        startTimeTicks += (nCycles64 * sleepTimeTicksT);
+        nCycles = static_cast<uint32>(nCycles64);
     }
 
     startTimeTicks -= sleepTimeTicksT;
 
-    //Sleep until the next period. Cannot be < 0 due to while(startTimeTicks < startTicks) above
+    //Sleep until the next period. Cannot be < 0 due to the catch-up of startTimeTicks above
     uint64 deltaTicks = sleepTimeTicksT + startTimeTicks;
     deltaTicks -= cycleEndTicks;
 
@@ -607,6 +685,11 @@ ErrorManagement::ErrorType LinuxTimer::Execute(ExecutionInfo &info) {
         uint64 microsecs = static_cast<uint64>(seconds) * static_cast<uint64>(USEC_IN_SEC);
         deltaTime = (microsecs - absoluteTime_1);
         absoluteTime_1 = microsecs;
+        if ((accountCycle) && (histogramNumberOfBins > 0u)) {
+            //startTimeTicks is now the deadline of this cycle
+            uint64 latencyTicks = (newCounter > startTimeTicks) ? (newCounter - startTimeTicks) : 0u;
+            UpdateHistograms(latencyTicks, (nCycles > 1u) ? (nCycles - 1u) : 0u);
+        }
     }
 
     if (executionMode == LINUX_TIMER_EXEC_MODE_SPAWNED) {
@@ -635,7 +718,126 @@ void LinuxTimer::Purge(ReferenceContainer &purgeList) {
     ReferenceContainer::Purge(purgeList);
 }
 
+void LinuxTimer::UpdateHistograms(const uint64 latencyTicks,
+                                  const uint32 lostCycles) {
+    /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+    if (resetHistogramsRequested) {
+        for (uint32 b = 0u; b < histogramNumberOfBins; b++) {
+            latencyHistogram[b] = 0u;
+            overrunHistogram[b] = 0u;
+        }
+        maxLatency = 0u;
+        resetHistogramsRequested = false;
+    }
+    float64 latencyNsF = static_cast<float64>(latencyTicks) * nsPerTick;
+    uint64 latencyNs = static_cast<uint64>(latencyNsF);
+    uint64 bin = (latencyNs / static_cast<uint64>(histogramBinWidth));
+    if (bin >= static_cast<uint64>(histogramNumberOfBins)) {
+        bin = static_cast<uint64>(histogramNumberOfBins - 1u);
+    }
+    latencyHistogram[bin]++;
+    if (latencyNs > maxLatency) {
+        maxLatency = latencyNs;
+    }
+    uint32 overrunBin = lostCycles;
+    if (overrunBin >= histogramNumberOfBins) {
+        overrunBin = (histogramNumberOfBins - 1u);
+    }
+    overrunHistogram[overrunBin]++;
+}
+
+ErrorManagement::ErrorType LinuxTimer::ResetHistograms() {
+    ErrorManagement::ErrorType ret((histogramNumberOfBins > 0u));
+    if (ret.ErrorsCleared()) {
+        resetHistogramsRequested = true;
+    }
+    return ret;
+}
+
+ErrorManagement::ErrorType LinuxTimer::ReportHistograms() {
+    ErrorManagement::ErrorType ret((histogramNumberOfBins > 0u));
+    if (ret.ErrorsCleared()) {
+        REPORT_ERROR(ErrorManagement::Information, "Wake-up latency p50 <= %d ns, p99 <= %d ns, p99.99 <= %d ns, max = %d ns", GetLatencyPercentile(50.0),
+                     GetLatencyPercentile(99.0), GetLatencyPercentile(99.99), maxLatency);
+        for (uint32 b = 0u; b < histogramNumberOfBins; b++) {
+            /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+            uint32 latencyCount = latencyHistogram[b];
+            /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+            uint32 overrunCount = overrunHistogram[b];
+            if (latencyCount > 0u) {
+                REPORT_ERROR(ErrorManagement::Information, "Wake-up latency [%d, %d[ ns: %d", (b * histogramBinWidth), ((b + 1u) * histogramBinWidth), latencyCount);
+            }
+            if (overrunCount > 0u) {
+                REPORT_ERROR(ErrorManagement::Information, "Lost periods %d: %d", b, overrunCount);
+            }
+        }
+    }
+    return ret;
+    /*lint -e{1762} function cannot be constant as it is registered as an RPC for CLASS_METHOD_REGISTER*/
+}
+
+uint32 LinuxTimer::GetHistogramNumberOfBins() const {
+    return histogramNumberOfBins;
+}
+
+uint32 LinuxTimer::GetHistogramBinWidth() const {
+    return histogramBinWidth;
+}
+
+uint32 LinuxTimer::GetLatencyHistogramBin(const uint32 binIdx) const {
+    uint32 count = 0u;
+    if (binIdx < histogramNumberOfBins) {
+        /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+        count = latencyHistogram[binIdx];
+    }
+    return count;
+}
+
+uint32 LinuxTimer::GetOverrunHistogramBin(const uint32 binIdx) const {
+    uint32 count = 0u;
+    if (binIdx < histogramNumberOfBins) {
+        /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+        count = overrunHistogram[binIdx];
+    }
+    return count;
+}
+
+uint64 LinuxTimer::GetLatencyPercentile(const float64 percentile) const {
+    uint64 total = 0u;
+    uint32 b;
+    for (b = 0u; b < histogramNumberOfBins; b++) {
+        /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+        total += latencyHistogram[b];
+    }
+    uint64 upperEdge = 0u;
+    if (total > 0u) {
+        float64 thresholdF = (static_cast<float64>(total) * percentile) / 100.0;
+        uint32 lastBin = (histogramNumberOfBins - 1u);
+        bool found = false;
+        uint64 cumulative = 0u;
+        for (b = 0u; (b < lastBin) && (!found); b++) {
+            /*lint -e{613} the histograms cannot be NULL as histogramNumberOfBins > 0*/
+            cumulative += latencyHistogram[b];
+            found = (static_cast<float64>(cumulative) >= thresholdF);
+            if (found) {
+                upperEdge = (static_cast<uint64>(b) + 1u) * static_cast<uint64>(histogramBinWidth);
+            }
+        }
+        //The last bin is unbounded
+        if (!found) {
+            upperEdge = maxLatency;
+        }
+    }
+    return upperEdge;
+}
+
+uint64 LinuxTimer::GetMaxLatency() const {
+    return maxLatency;
+}
+
 CLASS_REGISTER(LinuxTimer, "1.0")
+CLASS_METHOD_REGISTER(LinuxTimer, ResetHistograms)
+CLASS_METHOD_REGISTER(LinuxTimer, ReportHistograms)
 
 }
 
@@ -34,7 +34,9 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "MessageI.h"
 #include "RealTimeApplication.h"
+#include "RegisteredMethodsMessageFilter.h"
 #include "SingleThreadService.h"
 #include "TimeProvider.h"
 
@@ -47,13 +49,14 @@ namespace MARTe {
  * @brief A DataSource which provides a timing source for a MARTe application.
  * @details The LinuxTimer provides a timing generation facility where generators can be conveniently plugged in.
  * The LinuxTimer itself comes with a default provider which is based on internal HighResolutionTimer.
- * The Timer can be configured with two, three, four or five signals and it shall
+ * The Timer can be configured with two, three, four, five, six or seven signals and it shall
  * always have a frequency set in one of the signals.
  *
  * @details The default time provider (if no plugin is defined) is the HighResolutionTimeProvider. It relies on the implementation
  * of HighResolutionTimer which reads from the cpu TSC register and retrieves the Frequency from /proc/cpuinfo in Linux. Note that
  * the implementation is strictly architecture dependent and it might lead to undesired behavior if the system is not properly configured
  * (cpu frequency scaling enabled, different cpu configurations, ecc)
+ * The MonotonicTimeProvider sleeps until absolute deadlines on CLOCK_MONOTONIC and is the recommended provider when phase stability is important.
  *
  * @details The signals are identified by their declaration order in the \a Signals sections. This means that if the user needs
  * the last signal all the previous must be declared in the configuration.
@@ -67,6 +70,8 @@ namespace MARTe {
  *     SleepPercentage = 0 //Only meaningful if SleepNature = Busy. The percentage of time to sleep using the OS sleep.
  *     Phase = 1 //Optional, sets the phase of the timing generation, defaults to 0u
  *     CPUMask = 0x8 //Optional and only relevant if ExecutionMode=IndependentThread
+ *     HistogramNumberOfBins = 64 //Optional. Number of bins of the wake-up latency and cycle overrun histograms. Default = 0 (histograms disabled).
+ *     HistogramBinWidth = 500 //Optional. Width, in nanoseconds, of each bin of the wake-up latency histogram. Shall be > 0. Default = 1000.
  *     +TimeProvider = { //Optional, if omitted defaults to HighResolutionTimeProvider
  *         //Can be any of the implementing types for the TimeProvider interface
            //Please refer to the specific time provider interface for configuration details
@@ -89,7 +94,15 @@ namespace MARTe {
  *         }
  *         TrigRephase = { //Optional, can be omitted
  *             Type = uint8 //Only type supported
- *         }*
+ *         }
+ *         LatencyHistogram = { //Optional, can be omitted. Requires HistogramNumberOfBins > 0
+ *             Type = uint32 //Only type supported
+ *             NumberOfElements = 64 //Shall be equal to HistogramNumberOfBins
+ *         }
+ *         OverrunHistogram = { //Optional, can be omitted. Requires HistogramNumberOfBins > 0
+ *             Type = uint32 //Only type supported
+ *             NumberOfElements = 64 //Shall be equal to HistogramNumberOfBins
+ *         }
  *     }
  * }
  * </pre>
@@ -108,11 +121,19 @@ namespace MARTe {
  *   - AbsoluteTime: uses TimeProvider::Counter and TimeProvider::Period to get an absolute time
  *   - DeltaTime: time difference between two cycles
  *   - TrigRephase: if equal to 1 rephases the time synchronisation when the Execute method is called.
+ *   - LatencyHistogram: number of cycles whose wake-up latency (time between the deadline and the instant where the sleep returned) falls in
+ *     each bin [i * HistogramBinWidth, (i + 1) * HistogramBinWidth[ ns. The last bin also counts all the larger latencies.
+ *   - OverrunHistogram: number of cycles which lost i periods (i.e. the previous cycle overran the deadline by i periods).
+ *     The last bin also counts all the larger overruns.
+ *
+ * @details The histograms are preallocated in Initialise and are only written by the thread calling Execute (so that no lock is required).
+ * The first cycle after each state change and each rephase are not accounted. The histograms can also be reported (together with the
+ * 50th, 99th and 99.99th percentiles and the maximum latency) and reset with the RPC ReportHistograms and ResetHistograms.
  *
  * @details When TrigRephase is equal to 1, the phase changes and it is kept across a state change if the data source is consumed in both current and next state.
  * If the data source is not used in the current state the phase will be reset to the configured one before the next state execution.
  */
-class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI {
+class LinuxTimer: public DataSourceI, public EmbeddedServiceMethodBinderI, public MessageI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -124,7 +145,7 @@ public:
     LinuxTimer ();
 
     /**
-     * @brief Destructor. Stops the EmbeddedThread.
+     * @brief Destructor. Stops the EmbeddedThread and frees the histograms.
      */
     virtual ~LinuxTimer();
 
@@ -241,8 +262,69 @@ public:
     */
     virtual void Purge(ReferenceContainer &purgeList);
 
+    /**
+     * @brief Requests the histograms to be reset.
+     * @details The reset is performed by the thread calling Execute before the next update (so that the histograms keep a single writer).
+     * @return ErrorManagement::NoError if the histograms are enabled.
+     */
+    ErrorManagement::ErrorType ResetHistograms();
+
+    /**
+     * @brief Reports (as Information) the non-empty bins of the histograms, the 50th, 99th and 99.99th latency percentiles and the maximum latency.
+     * @return ErrorManagement::NoError if the histograms are enabled.
+     */
+    ErrorManagement::ErrorType ReportHistograms();
+
+    /**
+     * @brief Gets the number of bins of the histograms.
+     * @return the number of bins of the histograms (0 if disabled).
+     */
+    uint32 GetHistogramNumberOfBins() const;
+
+    /**
+     * @brief Gets the width of each bin of the wake-up latency histogram.
+     * @return the width of each bin of the wake-up latency histogram in nanoseconds.
+     */
+    uint32 GetHistogramBinWidth() const;
+
+    /**
+     * @brief Gets the number of cycles accounted in a given bin of the wake-up latency histogram.
+     * @param[in] binIdx the bin index.
+     * @return the number of cycles accounted in the bin (0 if binIdx is not valid).
+     */
+    uint32 GetLatencyHistogramBin(const uint32 binIdx) const;
+
+    /**
+     * @brief Gets the number of cycles accounted in a given bin of the cycle overrun histogram.
+     * @param[in] binIdx the bin index (i.e. the number of lost periods).
+     * @return the number of cycles accounted in the bin (0 if binIdx is not valid).
+     */
+    uint32 GetOverrunHistogramBin(const uint32 binIdx) const;
+
+    /**
+     * @brief Gets an upper bound of a given percentile of the wake-up latency.
+     * @param[in] percentile the percentile (e.g. 99.99).
+     * @return the upper edge (in nanoseconds) of the bin where the percentile falls, the maximum latency if it falls in the last bin,
+     * or 0 if no cycle was accounted.
+     */
+    uint64 GetLatencyPercentile(const float64 percentile) const;
+
+    /**
+     * @brief Gets the maximum wake-up latency.
+     * @return the maximum wake-up latency in nanoseconds.
+     */
+    uint64 GetMaxLatency() const;
+
 private:
 
+    /**
+     * @brief Accounts one cycle in the histograms.
+     * @param[in] latencyTicks the wake-up latency in ticks.
+     * @param[in] lostCycles the number of lost periods.
+     */
+    void UpdateHistograms(const uint64 latencyTicks,
+                          const uint32 lostCycles);
+
     /**
      * @brief The two supported sleep natures.
      */
@@ -359,6 +441,46 @@ private:
      * @brief Rephase triggering signals.
      */
     uint8 trigRephase;
+
+    /**
+     * @brief Filter to receive the RPC which allows to report and reset the histograms.
+     */
+    ReferenceT<RegisteredMethodsMessageFilter> filter;
+
+    /**
+     * @brief Number of bins of the histograms.
+     */
+    uint32 histogramNumberOfBins;
+
+    /**
+     * @brief Width of each bin of the wake-up latency histogram in nanoseconds.
+     */
+    uint32 histogramBinWidth;
+
+    /**
+     * @brief The wake-up latency histogram.
+     */
+    uint32 *latencyHistogram;
+
+    /**
+     * @brief The cycle overrun histogram.
+     */
+    uint32 *overrunHistogram;
+
+    /**
+     * @brief The maximum wake-up latency in nanoseconds.
+     */
+    uint64 maxLatency;
+
+    /**
+     * @brief Number of nanoseconds in a tick.
+     */
+    float64 nsPerTick;
+
+    /**
+     * @brief Set by ResetHistograms and cleared by the thread calling Execute once the histograms are reset.
+     */
+    volatile bool resetHistogramsRequested;
 };
 }
 
@@ -0,0 +1,164 @@
+/**
+ * @file MonotonicTimeProvider.cpp
+ * @brief Source file for class MonotonicTimeProvider
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MonotonicTimeProvider (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "MonotonicTimeProvider.h"
+#include "StreamString.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Number of nanoseconds in a second.
+ */
+static const uint64 MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC = 1000000000ULL;
+
+/**
+ * @brief Reads the SpinTime, SleepNature and SleepPercentage parameters.
+ */
+static bool MonotonicTimeProviderReadParameters(StructuredDataI &data,
+                                                uint64 &spinTime,
+                                                uint8 &sleepPercentage) {
+    bool ok = true;
+    uint32 spinTimeUs = 0u;
+    if (data.Read("SpinTime", spinTimeUs)) {
+        spinTime = static_cast<uint64>(spinTimeUs) * 1000ULL;
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "SpinTime set to %d us", spinTimeUs);
+    }
+    StreamString sleepNatureStr;
+    if (data.Read("SleepNature", sleepNatureStr)) {
+        if (sleepNatureStr == "Busy") {
+            uint8 sleepPercentageIn = 0u;
+            if (!data.Read("SleepPercentage", sleepPercentageIn)) {
+                sleepPercentageIn = 0u;
+            }
+            if (sleepPercentageIn > 100u) {
+                REPORT_ERROR_STATIC(ErrorManagement::Warning, "Sleep percentage over 100. Auto-adjusting from %d to 100", sleepPercentageIn);
+                sleepPercentageIn = 100u;
+            }
+            sleepPercentage = sleepPercentageIn;
+        }
+        else if (sleepNatureStr == "Default") {
+            sleepPercentage = 100u;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Specified sleep nature [%s] is not valid", sleepNatureStr.Buffer());
+            ok = false;
+        }
+    }
+    return ok;
+}
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+MonotonicTimeProvider::MonotonicTimeProvider() :
+        TimeProvider() {
+    spinTime = 0u;
+    sleepPercentage = 100u;
+}
+
+MonotonicTimeProvider::~MonotonicTimeProvider() {
+}
+
+bool MonotonicTimeProvider::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = MonotonicTimeProviderReadParameters(data, spinTime, sleepPercentage);
+    }
+    return ok;
+}
+
+uint64 MonotonicTimeProvider::Counter() {
+    struct timespec now;
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64 counter = static_cast<uint64>(now.tv_sec) * MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC;
+    counter += static_cast<uint64>(now.tv_nsec);
+    return counter;
+}
+
+float64 MonotonicTimeProvider::Period() {
+    return 1e-9;
+}
+
+uint64 MonotonicTimeProvider::Frequency() {
+    return MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC;
+}
+
+bool MonotonicTimeProvider::Sleep(const uint64 start,
+                                  const uint64 delta) {
+    bool ok = true;
+    uint64 deadline = start + delta;
+    //Block for the allowed percentage of the delta, but never inside the spin window
+    uint64 wakeUp = start + ((delta * static_cast<uint64>(sleepPercentage)) / 100ULL);
+    if ((wakeUp + spinTime) > deadline) {
+        wakeUp = (deadline > spinTime) ? (deadline - spinTime) : 0u;
+    }
+    if (wakeUp > Counter()) {
+        struct timespec wakeUpTs;
+        wakeUpTs.tv_sec = static_cast<time_t>(wakeUp / MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+        wakeUpTs.tv_nsec = static_cast<long>(wakeUp % MONOTONIC_TIME_PROVIDER_NSEC_IN_SEC);
+        int32 err = EINTR;
+        //The deadline is absolute so that an interrupted sleep can be resumed as is
+        while (err == EINTR) {
+            err = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTs, NULL_PTR(struct timespec *));
+        }
+        ok = (err == 0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::OSError, "clock_nanosleep failed with error %d", err);
+        }
+    }
+    while (Counter() < deadline) {
+        ;
+    }
+    return ok;
+}
+
+bool MonotonicTimeProvider::BackwardCompatibilityInit(StructuredDataI &compatibilityData) {
+    return MonotonicTimeProviderReadParameters(compatibilityData, spinTime, sleepPercentage);
+}
+
+uint64 MonotonicTimeProvider::GetSpinTime() const {
+    return spinTime;
+}
+
+uint8 MonotonicTimeProvider::GetSleepPercentage() const {
+    return sleepPercentage;
+}
+
+CLASS_REGISTER(MonotonicTimeProvider, "1.0")
+}
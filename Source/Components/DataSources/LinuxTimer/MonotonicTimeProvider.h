@@ -0,0 +1,150 @@
+/**
+ * @file MonotonicTimeProvider.h
+ * @brief Header file for class MonotonicTimeProvider
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MonotonicTimeProvider
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_
+#define SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProvider.h"
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * @brief Plugin which provides time to the LinuxTimer DataSource from CLOCK_MONOTONIC and sleeps until absolute deadlines.
+ * @details The counter is CLOCK_MONOTONIC in nanoseconds (i.e. Frequency() = 1e9).
+ *
+ * Sleep(start, delta) waits until the absolute deadline start + delta. As the deadline does not depend on the time at which
+ * Sleep is called, a preemption between the computation of the delta and the sleep no longer turns into phase error.
+ * The wait is hybrid: the thread blocks with clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) until SpinTime microseconds before the deadline
+ * and then busy spins on the clock for the final approach.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +Timer = {
+ *     Class = LinuxTimer
+ *     +TimeProvider = {
+ *         Class = MonotonicTimeProvider
+ *         SpinTime = 50 //Optional. Time in microseconds, before the deadline, which is busy spun. Default = 0 (i.e. clock_nanosleep only).
+ *     }
+ *     ...
+ * }
+ * </pre>
+ *
+ * The LinuxTimer SleepNature parameters are also honoured (see BackwardCompatibilityInit): if SleepNature = Busy the thread
+ * only blocks for SleepPercentage (default 0) of the delta and spins for the rest.
+ */
+class MonotonicTimeProvider: public TimeProvider {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor
+     */
+    MonotonicTimeProvider();
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~MonotonicTimeProvider();
+
+    /**
+     * @brief Reads the SpinTime parameter (see class description).
+     * @return true if SpinTime is not specified or is valid.
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Returns CLOCK_MONOTONIC in nanoseconds.
+     * @return CLOCK_MONOTONIC in nanoseconds.
+     */
+    virtual uint64 Counter();
+
+    /**
+     * @brief Returns the period of the counter.
+     * @return 1e-9.
+     */
+    virtual float64 Period();
+
+    /**
+     * @brief Returns the frequency of the counter.
+     * @return 1e9.
+     */
+    virtual uint64 Frequency();
+
+    /**
+     * @brief Sleeps until the absolute deadline start + delta (see class description).
+     * @param[in] start Time marker (in Counter() units) against which the deadline is computed.
+     * @param[in] delta Number of ticks from start to the deadline.
+     * @return true if clock_nanosleep did not fail.
+     */
+    virtual bool Sleep(const uint64 start,
+                       const uint64 delta);
+
+    /**
+     * @brief For full motivation of this method, see interface documentation. Brings the LinuxTimer SleepNature and
+     * SleepPercentage parameters down to the plugin.
+     * @param[in] compatibilityData Data which is injected from the plugin management DataSource
+     * @return True if configuration operation succeeds. False otherwise.
+     */
+    virtual bool BackwardCompatibilityInit(StructuredDataI &compatibilityData);
+
+    /**
+     * @brief Gets the time, before each deadline, which is busy spun.
+     * @return the spin time in nanoseconds.
+     */
+    uint64 GetSpinTime() const;
+
+    /**
+     * @brief Gets the percentage of each delta during which the thread is allowed to block.
+     * @return the percentage of each delta during which the thread is allowed to block.
+     */
+    uint8 GetSleepPercentage() const;
+
+private:
+
+    /**
+     * @brief Time, in nanoseconds, before each deadline which is busy spun.
+     */
+    uint64 spinTime;
+
+    /**
+     * @brief Percentage of each delta during which the thread is allowed to block.
+     */
+    uint8 sleepPercentage;
+};
+}
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_DATASOURCES_LINUXTIMER_MONOTONICTIMEPROVIDER_H_ */
@@ -31,8 +31,12 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "Atomic.h"
 #include "CompilerTypes.h"
+#include "GlobalObjectsDatabase.h"
+#include "HighResolutionTimer.h"
 #include "LoggerBroker.h"
+#include "MemoryOperationsHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -47,9 +51,18 @@ LoggerBroker::LoggerBroker() :
     outputSignals = NULL_PTR(AnyType *);
     cycleCounter = 0u;
     cyclePeriod = 0u;
+    copySizes = NULL_PTR(uint32 *);
+    copyOffsets = NULL_PTR(uint32 *);
+    entries = NULL_PTR(char8 *);
+    entrySize = 0u;
+    numberOfEntries = 0u;
+    numberOfWrittenEntries = 0;
+    numberOfReadEntries = 0;
+    numberOfDroppedEntries = 0;
+    numberOfReportedDroppedEntries = 0u;
 }
 
-/*lint -e{1551} the destructor must guarantee that the signalNames and outputSignals are freed.*/
+/*lint -e{1551} the destructor must guarantee that the signalNames, outputSignals and the queue are freed.*/
 LoggerBroker::~LoggerBroker() {
     if (signalNames != NULL_PTR(StreamString *)) {
         delete[] signalNames;
@@ -57,6 +70,15 @@ LoggerBroker::~LoggerBroker() {
     if (outputSignals != NULL_PTR(AnyType *)) {
         delete[] outputSignals;
     }
+    if (copySizes != NULL_PTR(uint32 *)) {
+        delete[] copySizes;
+    }
+    if (copyOffsets != NULL_PTR(uint32 *)) {
+        delete[] copyOffsets;
+    }
+    if (entries != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(entries));
+    }
 }
 
 bool LoggerBroker::Init(SignalDirection const direction,
@@ -70,6 +92,7 @@ bool LoggerBroker::Init(SignalDirection const direction,
     if (ok) {
         outputSignals = new AnyType[numberOfCopies];
         signalNames = new StreamString[numberOfCopies];
+        copySizes = new uint32[numberOfCopies];
     }
     //Find the function
     uint32 functionIdx = 0u;
@@ -114,6 +137,9 @@ bool LoggerBroker::Init(SignalDirection const direction,
             uint32 size = 0u;
             uint32 endIdx = 0u;
             ok = dataSourceIn.GetFunctionSignalByteOffsetInfo(direction, functionIdx, n, i, startIdx, size);
+            if (copySizes != NULL_PTR(uint32 *)) {
+                copySizes[c] = size;
+            }
             if (ok) {
                 uint32 nOfBytes = static_cast<uint32> (signalDesc.numberOfBits) / 8u;
                 if (nOfBytes > 0u) {
@@ -141,15 +167,66 @@ void LoggerBroker::SetPeriod(const uint32 cyclePeriodIn) {
     cyclePeriod = cyclePeriodIn;
 }
 
+bool LoggerBroker::SetDeferred(const uint32 numberOfEntriesIn) {
+    bool ok = ((entries == NULL_PTR(char8 *)) && (copySizes != NULL_PTR(uint32 *)));
+    if (ok) {
+        ok = (numberOfEntriesIn > 0u);
+    }
+    if (ok) {
+        numberOfEntries = 1u;
+        while (numberOfEntries < numberOfEntriesIn) {
+            numberOfEntries *= 2u;
+        }
+        //Each entry starts with the timestamp. The copies are 8 byte aligned so that they can be printed in place.
+        copyOffsets = new uint32[numberOfCopies];
+        entrySize = static_cast<uint32>(sizeof(uint64));
+        uint32 n;
+        for (n = 0u; n < numberOfCopies; n++) {
+            copyOffsets[n] = entrySize;
+            entrySize += (((copySizes[n] + 7u) / 8u) * 8u);
+        }
+        entries = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(entrySize * numberOfEntries));
+        ok = (entries != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the memory for %d entries of %d bytes", numberOfEntries, entrySize);
+        }
+    }
+    numberOfWrittenEntries = 0;
+    numberOfReadEntries = 0;
+    numberOfDroppedEntries = 0;
+    numberOfReportedDroppedEntries = 0u;
+    return ok;
+}
+
 bool LoggerBroker::Execute() {
 
     cycleCounter++;
     if (cycleCounter >= cyclePeriod) {
 
-        uint32 n;
-        for (n = 0u; n < numberOfCopies; n++) {
-            if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
-                REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+        if (entries != NULL_PTR(char8 *)) {
+            uint32 written = static_cast<uint32>(numberOfWrittenEntries);
+            uint32 read = static_cast<uint32>(numberOfReadEntries);
+            if ((written - read) < numberOfEntries) {
+                char8 *entry = &entries[(written & (numberOfEntries - 1u)) * entrySize];
+                uint64 timestamp = HighResolutionTimer::Counter();
+                (void) MemoryOperationsHelper::Copy(entry, &timestamp, static_cast<uint32>(sizeof(uint64)));
+                uint32 n;
+                for (n = 0u; n < numberOfCopies; n++) {
+                    (void) MemoryOperationsHelper::Copy(&entry[copyOffsets[n]], GetFunctionPointer(n), copySizes[n]);
+                }
+                //The atomic increment is also a full memory barrier, i.e. the entry is complete before being published.
+                Atomic::Increment(&numberOfWrittenEntries);
+            }
+            else {
+                Atomic::Increment(&numberOfDroppedEntries);
+            }
+        }
+        else {
+            uint32 n;
+            for (n = 0u; n < numberOfCopies; n++) {
+                if ((signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
+                    REPORT_ERROR(ErrorManagement::Information, "%s:%!", signalNames[n].Buffer(), outputSignals[n]);
+                }
             }
         }
         cycleCounter = 0u;
@@ -157,6 +234,37 @@ bool LoggerBroker::Execute() {
     return true;
 }
 
+void LoggerBroker::Flush() {
+    if ((entries != NULL_PTR(char8 *)) && (signalNames != NULL_PTR(StreamString *)) && (outputSignals != NULL_PTR(AnyType *))) {
+        uint32 read = static_cast<uint32>(numberOfReadEntries);
+        while (read != static_cast<uint32>(numberOfWrittenEntries)) {
+            char8 *entry = &entries[(read & (numberOfEntries - 1u)) * entrySize];
+            uint64 timestamp = 0u;
+            (void) MemoryOperationsHelper::Copy(&timestamp, entry, static_cast<uint32>(sizeof(uint64)));
+            float64 time = static_cast<float64>(timestamp) * HighResolutionTimer::Period();
+            uint32 n;
+            for (n = 0u; n < numberOfCopies; n++) {
+                AnyType printType(outputSignals[n].GetTypeDescriptor(), 0u, &entry[copyOffsets[n]]);
+                printType.SetNumberOfDimensions(outputSignals[n].GetNumberOfDimensions());
+                printType.SetNumberOfElements(0u, outputSignals[n].GetNumberOfElements(0u));
+                REPORT_ERROR(ErrorManagement::Information, "%s:%! (t = %f)", signalNames[n].Buffer(), printType, time);
+            }
+            //Only now the entry can be reused by Execute.
+            Atomic::Increment(&numberOfReadEntries);
+            read++;
+        }
+        uint32 dropped = GetNumberOfDroppedEntries();
+        if (dropped != numberOfReportedDroppedEntries) {
+            REPORT_ERROR(ErrorManagement::Warning, "%d cycles were not logged because the queue was full", (dropped - numberOfReportedDroppedEntries));
+            numberOfReportedDroppedEntries = dropped;
+        }
+    }
+}
+
+uint32 LoggerBroker::GetNumberOfDroppedEntries() const {
+    return static_cast<uint32>(numberOfDroppedEntries);
+}
+
 CLASS_REGISTER(LoggerBroker, "1.0")
 }
 /*---------------------------------------------------------------------------*/
@@ -42,6 +42,11 @@ namespace MARTe {
  * @brief a BrokerI implementation for the LoggerDataSource.
  * @details The Execute method prints to the REPORT_ERROR stream the value of all
  *  the registered signals, using the AnyType Printf.
+ *
+ * If SetDeferred is called, the Execute method only copies the signal values (together with the
+ *  HighResolutionTimer::Counter() of the copy) into a preallocated single-producer/single-consumer queue.
+ *  The values are printed later (with the time of the copy) when Flush is called from a non real-time thread.
+ *  If the queue is full the cycle is not logged and the number of dropped entries is incremented.
  */
 class LoggerBroker: public BrokerI {
 
@@ -73,14 +78,42 @@ public:
             void *gamMemoryAddress);
 
 
+    /**
+     * @brief Sets the number of cycles that must pass before the signals are logged.
+     * @param[in] cyclePeriodIn the number of cycles.
+     */
     void SetPeriod(const uint32 cyclePeriodIn);
 
+    /**
+     * @brief Allocates the queue where the Execute method copies the signals to be printed by Flush.
+     * @param[in] numberOfEntriesIn the minimum number of cycles that can be queued (rounded up to the next power of two).
+     * @return true if \a numberOfEntriesIn > 0 and the queue was not already allocated.
+     * @pre
+     *   Init()
+     */
+    bool SetDeferred(const uint32 numberOfEntriesIn);
+
     /**
      * @brief For all the signals print their AnyType value in the logger stream.
+     * @details If SetDeferred was called, copies the signals into the queue instead.
      * @return true.
      */
     virtual bool Execute();
 
+    /**
+     * @brief Prints all the queued cycles and reports (once) any cycle that was dropped since the last Flush.
+     * @details Shall only be called from one (non real-time) thread at the time.
+     * @pre
+     *   SetDeferred()
+     */
+    void Flush();
+
+    /**
+     * @brief Gets the number of cycles that were not logged because the queue was full.
+     * @return the number of dropped cycles.
+     */
+    uint32 GetNumberOfDroppedEntries() const;
+
 private:
 
     /**
@@ -102,6 +135,51 @@ private:
      * Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * The size in bytes of each copy.
+     */
+    uint32 *copySizes;
+
+    /**
+     * The offset of each copy inside a queue entry.
+     */
+    uint32 *copyOffsets;
+
+    /**
+     * The queue memory (NULL if the logging is not deferred).
+     */
+    char8 *entries;
+
+    /**
+     * The size of one queue entry (timestamp followed by all the copies).
+     */
+    uint32 entrySize;
+
+    /**
+     * The number of queue entries (power of two).
+     */
+    uint32 numberOfEntries;
+
+    /**
+     * The number of entries written by Execute (wraps at 2^32).
+     */
+    volatile int32 numberOfWrittenEntries;
+
+    /**
+     * The number of entries printed by Flush (wraps at 2^32).
+     */
+    volatile int32 numberOfReadEntries;
+
+    /**
+     * The number of cycles dropped because the queue was full.
+     */
+    volatile int32 numberOfDroppedEntries;
+
+    /**
+     * The value of numberOfDroppedEntries last reported by Flush.
+     */
+    uint32 numberOfReportedDroppedEntries;
 };
 
 }
@@ -30,8 +30,10 @@
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "LoggerBroker.h"
 #include "LoggerDataSource.h"
+#include "Sleep.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -40,11 +42,24 @@
 namespace MARTe {
 
 LoggerDataSource::LoggerDataSource() :
-    DataSourceI() {
+        DataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
     cyclePeriod = 0u;
+    deferred = false;
+    queueSize = 64u;
+    flushPeriod = 10u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
 }
 
+/*lint -e{1551} the destructor must guarantee that the background thread is stopped.*/
 LoggerDataSource::~LoggerDataSource() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
 }
 
 bool LoggerDataSource::Initialise(StructuredDataI & data) {
@@ -54,6 +69,44 @@ bool LoggerDataSource::Initialise(StructuredDataI & data) {
             cyclePeriod = 0u;
         }
     }
+    if (ret) {
+        uint32 deferredU = 0u;
+        if (data.Read("Deferred", deferredU)) {
+            deferred = (deferredU == 1u);
+        }
+        if (deferred) {
+            if (data.Read("QueueSize", queueSize)) {
+                ret = (queueSize > 0u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize shall be > 0");
+                }
+            }
+            if (ret) {
+                if (!data.Read("FlushPeriod", flushPeriod)) {
+                    REPORT_ERROR(ErrorManagement::Information, "No FlushPeriod defined. Using default %d ms.", flushPeriod);
+                }
+            }
+            if (ret) {
+                if (!data.Read("CPUMask", cpuMask)) {
+                    REPORT_ERROR(ErrorManagement::Information, "No CPUMask defined. Using default 0xff.");
+                }
+                if (!data.Read("StackSize", stackSize)) {
+                    REPORT_ERROR(ErrorManagement::Information, "No StackSize defined. Using default thread stack size.");
+                }
+                executor.SetCPUMask(cpuMask);
+                executor.SetStackSize(stackSize);
+            }
+        }
+        else {
+            ret = (!data.Exists("QueueSize"));
+            if (ret) {
+                ret = (!data.Exists("FlushPeriod"));
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize and FlushPeriod can only be set if Deferred = 1");
+            }
+        }
+    }
     return ret;
 }
 
@@ -96,6 +149,14 @@ bool LoggerDataSource::GetOutputBrokers(ReferenceContainer& outputBrokers,
     bool ok = broker->Init(OutputSignals, *this, functionName, gamMemPtr);
     if (ok) {
         broker->SetPeriod(cyclePeriod);
+        if (deferred) {
+            ok = broker->SetDeferred(queueSize);
+            if (ok) {
+                ok = deferredBrokers.Insert(broker);
+            }
+        }
+    }
+    if (ok) {
         ok = outputBrokers.Insert(broker);
     }
     return ok;
@@ -104,7 +165,29 @@ bool LoggerDataSource::GetOutputBrokers(ReferenceContainer& outputBrokers,
 /*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: this DataSourceI implementation is independent of the states being changed.*/
 bool LoggerDataSource::PrepareNextState(const char8 * const currentStateName,
                                         const char8 * const nextStateName) {
-    return true;
+    bool ok = true;
+    if (deferred) {
+        if (executor.GetStatus() == EmbeddedThreadI::OffState) {
+            executor.SetName(GetName());
+            ok = (executor.Start() == ErrorManagement::NoError);
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType LoggerDataSource::Execute(ExecutionInfo& info) {
+    uint32 n;
+    uint32 numberOfBrokers = deferredBrokers.Size();
+    for (n = 0u; n < numberOfBrokers; n++) {
+        ReferenceT<LoggerBroker> broker = deferredBrokers.Get(n);
+        if (broker.IsValid()) {
+            broker->Flush();
+        }
+    }
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        Sleep::MSec(static_cast<int32>(flushPeriod));
+    }
+    return ErrorManagement::NoError;
 }
 
 CLASS_REGISTER(LoggerDataSource, "1.0")
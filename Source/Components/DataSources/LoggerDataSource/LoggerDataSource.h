@@ -32,6 +32,8 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 #include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "SingleThreadService.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -47,11 +49,18 @@ namespace MARTe {
  *     Class = LoggerDataSource
  *     CyclePeriod = 0u //Optional, defaults to 0. Period of cycles must pass before logger produces an output.
  *                      //CyclePeriod = 0u means print every sample received.
+ *     Deferred = 1 //Optional, defaults to 0. If 1 the real-time thread only copies the signals (and a timestamp) into a queue
+ *                  //and the values are printed by a background thread.
+ *     QueueSize = 64 //Optional (only valid if Deferred = 1), defaults to 64. Number of cycles (per GAM) that can be queued. Rounded up to a power of two.
+ *                    //The cycles that do not fit in the queue are dropped (and reported as a warning).
+ *     FlushPeriod = 10 //Optional (only valid if Deferred = 1), defaults to 10. Time in milliseconds between two consecutive flushes of the queues.
+ *     CPUMask = 0x1 //Optional (only valid if Deferred = 1). The affinity of the background thread.
+ *     StackSize = 1000000 //Optional (only valid if Deferred = 1). The stack size of the background thread.
  * }
  *
  * A signal will be added for each GAM signal that writes to this instance of the DataSourceI.
  */
-class LoggerDataSource: public DataSourceI {
+class LoggerDataSource: public DataSourceI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
     /**
@@ -60,11 +69,14 @@ public:
 LoggerDataSource    ();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Stops the background thread (if Deferred = 1).
      */
     virtual ~LoggerDataSource();
 
-
+    /**
+     * @brief Loads and verifies the configuration parameters detailed in the class description.
+     * @return true if all the mandatory parameters are correctly specified and if the specified optional parameters have valid values.
+     */
     virtual bool Initialise(StructuredDataI & data);
 
     /**
@@ -112,6 +124,7 @@ LoggerDataSource    ();
 
     /**
      * @brief Creates a new instance of a LoggerBroker and adds it to \a outputBrokers.
+     * @details If Deferred = 1 the queue of the LoggerBroker is allocated and the broker is flushed by the background thread.
      * @param[out] outputBrokers where the BrokerI instances have to be added to.
      * @param[in] functionName name of the function being queried.
      * @param[in] gamMemPtr the GAM memory where the signals will be written to.
@@ -122,17 +135,58 @@ LoggerDataSource    ();
             void * const gamMemPtr);
 
     /**
-     * @brief NOOP.
-     * @return true.
+     * @brief Starts the background thread (if Deferred = 1 and the thread is not already running).
+     * @return true if the thread could be started.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
 
+    /**
+     * @brief Background thread (if Deferred = 1). Periodically flushes the queues of all the LoggerBroker instances.
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo& info);
+
 protected:
     /**
      * @brief Holds the period of cycles must pass before logger produces an output.
      */
     uint32 cyclePeriod;
+
+    /**
+     * True if the signals are printed by the background thread.
+     */
+    bool deferred;
+
+    /**
+     * The number of cycles that can be queued by each broker.
+     */
+    uint32 queueSize;
+
+    /**
+     * The time in milliseconds between two flushes.
+     */
+    uint32 flushPeriod;
+
+    /**
+     * The brokers to be flushed.
+     */
+    ReferenceContainer deferredBrokers;
+
+    /**
+     * The background thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The affinity of the background thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the background thread.
+     */
+    uint32 stackSize;
 };
 }
 
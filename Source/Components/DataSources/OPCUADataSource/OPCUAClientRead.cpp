@@ -31,6 +31,7 @@
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
 #include "OPCUAClientRead.h"
 
 /*---------------------------------------------------------------------------*/
@@ -49,10 +50,24 @@ OPCUAClientRead::OPCUAClientRead() :
         OPCUAClientI() {
     monitoredNodes = NULL_PTR(UA_NodeId*);
     readValues = NULL_PTR(UA_ReadValueId*);
+    monitoredValues = NULL_PTR(OPCUAClientReadMonitoredValue*);
+    subscriptionId = 0u;
+    numberOfNotifications = 0;
 }
 
 /*lint -e{1579} all pointers have been freed*/
 OPCUAClientRead::~OPCUAClientRead() {
+    if (monitoredValues != NULL_PTR(OPCUAClientReadMonitoredValue*)) {
+        /*lint -e{1551} no exception thrown*/
+        (void) UA_Client_Subscriptions_deleteSingle(opcuaClient, subscriptionId);
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            if (monitoredValues[i].buffers != NULL_PTR(uint8*)) {
+                /*lint -e{1551} no exception thrown*/
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(monitoredValues[i].buffers));
+            }
+        }
+        delete[] monitoredValues;
+    }
     /*lint -e{1551} no exception thrown*/
     bool ok = UnregisterNodes(monitoredNodes);
     if (ok) {
@@ -298,6 +313,119 @@ bool OPCUAClientRead::Read(const TypeDescriptor *const types,
     return ok;
 }
 
+bool OPCUAClientRead::Monitor(const float64 samplingTime,
+                              const uint32 queueSize,
+                              const TypeDescriptor *const types,
+                              const uint32 *const nElements) {
+    bool ok = ((monitoredNodes != NULL_PTR(UA_NodeId*)) && (monitoredValues == NULL_PTR(OPCUAClientReadMonitoredValue*)));
+    if (ok) {
+        monitoredValues = new OPCUAClientReadMonitoredValue[nOfNodes];
+        for (uint32 i = 0u; i < nOfNodes; i++) {
+            uint32 nOfBytes = types[i].numberOfBits;
+            nOfBytes /= 8u;
+            nOfBytes *= nElements[i];
+            monitoredValues[i].size = nOfBytes;
+            monitoredValues[i].backBuffer = 0u;
+            monitoredValues[i].sharedBuffer = 1;
+            monitoredValues[i].frontBuffer = 2u;
+            monitoredValues[i].buffers = reinterpret_cast<uint8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(
+                    nOfBytes * OPCUA_CLIENT_READ_NUMBER_OF_BUFFERS));
+            if (ok) {
+                ok = (monitoredValues[i].buffers != NULL_PTR(uint8*));
+            }
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(monitoredValues[i].buffers, '\0', nOfBytes * OPCUA_CLIENT_READ_NUMBER_OF_BUFFERS);
+            }
+        }
+    }
+    if (ok) {
+        UA_CreateSubscriptionRequest subRequest = UA_CreateSubscriptionRequest_default();
+        subRequest.requestedPublishingInterval = samplingTime;
+        UA_CreateSubscriptionResponse subResponse = UA_Client_Subscriptions_create(opcuaClient, subRequest, this, NULL_PTR(UA_Client_StatusChangeNotificationCallback),
+                                                                                   NULL_PTR(UA_Client_DeleteSubscriptionCallback));
+        ok = (subResponse.responseHeader.serviceResult == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (ok) {
+            subscriptionId = subResponse.subscriptionId;
+        }
+        else {
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CreateSubscription Error - OPC UA Status Code (Part 4 - 7.34): %x",
+                                subResponse.responseHeader.serviceResult);
+        }
+    }
+    for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
+        UA_MonitoredItemCreateRequest itemRequest = UA_MonitoredItemCreateRequest_default(monitoredNodes[i]);
+        itemRequest.requestedParameters.samplingInterval = samplingTime;
+        itemRequest.requestedParameters.queueSize = queueSize;
+        itemRequest.requestedParameters.discardOldest = true;
+        UA_MonitoredItemCreateResult itemResult = UA_Client_MonitoredItems_createDataChange(opcuaClient, subscriptionId, UA_TIMESTAMPSTORETURN_BOTH,
+                                                                                            itemRequest, &monitoredValues[i], &DataChangeNotificationCallback,
+                                                                                            NULL_PTR(UA_Client_DeleteMonitoredItemCallback));
+        ok = (itemResult.statusCode == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "CreateMonitoredItem Error - OPC UA Status Code (Part 4 - 7.34): %x",
+                                itemResult.statusCode);
+        }
+    }
+    return ok;
+}
+
+bool OPCUAClientRead::Iterate(const uint32 timeout) {
+    UA_StatusCode retval = UA_Client_run_iterate(opcuaClient, timeout);
+    bool ok = (retval == 0x00U); /* UA_STATUSCODE_GOOD */
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::CommunicationError, "Client iterate Error - OPC UA Status Code (Part 4 - 7.34): %x", retval);
+    }
+    return ok;
+}
+
+bool OPCUAClientRead::GetLatestValues() {
+    bool ok = ((monitoredValues != NULL_PTR(OPCUAClientReadMonitoredValue*)) && (valueMemories != NULL_PTR(void**)));
+    for (uint32 i = 0u; (i < nOfNodes) && (ok); i++) {
+        if ((monitoredValues[i].sharedBuffer & OPCUA_CLIENT_READ_FRESH_BUFFER) != 0) {
+            int32 previous = Atomic::Exchange(&monitoredValues[i].sharedBuffer, static_cast<int32>(monitoredValues[i].frontBuffer));
+            monitoredValues[i].frontBuffer = static_cast<uint32>(previous & (OPCUA_CLIENT_READ_FRESH_BUFFER - 1));
+            if (valueMemories[i] != NULL_PTR(void*)) {
+                ok = MemoryOperationsHelper::Copy(valueMemories[i], &monitoredValues[i].buffers[monitoredValues[i].frontBuffer * monitoredValues[i].size],
+                                                  monitoredValues[i].size);
+            }
+        }
+    }
+    return ok;
+}
+
+uint32 OPCUAClientRead::GetNumberOfNotifications() const {
+    return static_cast<uint32>(numberOfNotifications);
+}
+
+/*lint -e{715} -e{818} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the signature is imposed by open62541.*/
+void OPCUAClientRead::DataChangeNotificationCallback(UA_Client *client,
+                                                     UA_UInt32 subId,
+                                                     void *subContext,
+                                                     UA_UInt32 monId,
+                                                     void *monContext,
+                                                     UA_DataValue *value) {
+    OPCUAClientReadMonitoredValue *monitoredValue = reinterpret_cast<OPCUAClientReadMonitoredValue*>(monContext);
+    if ((monitoredValue != NULL_PTR(OPCUAClientReadMonitoredValue*)) && (value != NULL_PTR(UA_DataValue*))) {
+        if ((value->hasValue) && (value->value.data != NULL_PTR(void*)) && (value->value.type != NULL_PTR(const UA_DataType*))) {
+            uint32 nOfBytes = value->value.type->memSize;
+            if (!UA_Variant_isScalar(&value->value)) {
+                nOfBytes *= static_cast<uint32>(value->value.arrayLength);
+            }
+            /* Discard notifications that do not match the configured signal (e.g. a different type) */
+            if (nOfBytes >= monitoredValue->size) {
+                uint32 b = monitoredValue->backBuffer;
+                (void) MemoryOperationsHelper::Copy(&monitoredValue->buffers[b * monitoredValue->size], value->value.data, monitoredValue->size);
+                int32 previous = Atomic::Exchange(&monitoredValue->sharedBuffer, (static_cast<int32>(b) | OPCUA_CLIENT_READ_FRESH_BUFFER));
+                monitoredValue->backBuffer = static_cast<uint32>(previous & (OPCUA_CLIENT_READ_FRESH_BUFFER - 1));
+            }
+        }
+    }
+    OPCUAClientRead *self = reinterpret_cast<OPCUAClientRead*>(subContext);
+    if (self != NULL_PTR(OPCUAClientRead*)) {
+        Atomic::Increment(&self->numberOfNotifications);
+    }
+}
+
 bool OPCUAClientRead::RegisterNodes(const UA_NodeId *const monitoredNodes) {
     bool ok = false;
     if (monitoredNodes != NULL_PTR(UA_NodeId*)) {
@@ -31,6 +31,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "Atomic.h"
 #include "OPCUAClientI.h"
 
 /*---------------------------------------------------------------------------*/
@@ -38,6 +39,48 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of buffers used to exchange the monitored values between the client thread and the reader.
+ */
+const uint32 OPCUA_CLIENT_READ_NUMBER_OF_BUFFERS = 3u;
+
+/**
+ * Flag set on OPCUAClientReadMonitoredValue::sharedBuffer when it holds a value that was not yet consumed.
+ */
+const int32 OPCUA_CLIENT_READ_FRESH_BUFFER = 0x100;
+
+/**
+ * @brief Triple buffer holding the latest value notified for a monitored node.
+ * @details The data change callback (client thread) writes the backBuffer and swaps it with the sharedBuffer;
+ * the reader swaps the sharedBuffer with its frontBuffer only when a fresh value is available. Neither side ever blocks.
+ */
+struct OPCUAClientReadMonitoredValue {
+    /**
+     * The OPCUA_CLIENT_READ_NUMBER_OF_BUFFERS contiguous buffers of size bytes each.
+     */
+    uint8 *buffers;
+
+    /**
+     * The size in bytes of each buffer.
+     */
+    uint32 size;
+
+    /**
+     * Buffer being written by the data change callback.
+     */
+    uint32 backBuffer;
+
+    /**
+     * Buffer exchanged between writer and reader (ORed with OPCUA_CLIENT_READ_FRESH_BUFFER when not yet consumed).
+     */
+    volatile int32 sharedBuffer;
+
+    /**
+     * Buffer owned by the reader.
+     */
+    uint32 frontBuffer;
+};
+
 /**
  * @brief Wrapper of a OPCUA Client for reading data to a OPCUA Server.
  * @details This class wraps all the functionalities to read data to a OPCUA Server.
@@ -67,6 +110,43 @@ public:
     bool Read(const TypeDescriptor *const types,
               const uint32 *const nElements);
 
+    /**
+     * @brief Creates an OPCUA Subscription with one data change MonitoredItem for each node.
+     * @details Every notification received while the client is iterated (see Iterate) is copied by the data change callback
+     * into a lock-free triple buffer of the node. Only single nodes (i.e. not ExtensionObjects) are supported.
+     * @param[in] samplingTime the requested publishing and sampling interval in ms.
+     * @param[in] queueSize the size of the server side queue of each MonitoredItem.
+     * @param[in] types the array with all the TypeDescriptor for each node to monitor.
+     * @param[in] nElements the array with all the number of elements for each node to monitor.
+     * @pre SetServiceRequest
+     * @return true if the Subscription and all the MonitoredItems are created correctly.
+     */
+    bool Monitor(const float64 samplingTime,
+                 const uint32 queueSize,
+                 const TypeDescriptor *const types,
+                 const uint32 *const nElements);
+
+    /**
+     * @brief Processes the network traffic of the client, calling the data change callback for any received notification.
+     * @param[in] timeout the maximum time in ms to wait for network events.
+     * @pre Monitor
+     * @return true if UA_Client_run_iterate returns UA_STATUSCODE_GOOD.
+     */
+    bool Iterate(const uint32 timeout);
+
+    /**
+     * @brief Copies the latest notified value of each monitored node to its valueMemory.
+     * @details No network operation is performed. Nodes without a new notification keep their previous value.
+     * @pre Monitor
+     * @return true if the values were copied correctly.
+     */
+    bool GetLatestValues();
+
+    /**
+     * @brief Gets the number of data change notifications received since Monitor. (Testing purposes)
+     */
+    uint32 GetNumberOfNotifications() const;
+
     /**
      * @see OPCUAClientI::SetServiceRequest
      */
@@ -105,6 +185,17 @@ private:
      */
     bool UnregisterNodes(const UA_NodeId *const monitoredNodes);
 
+    /**
+     * @brief open62541 data change callback. Copies the notified value to the back buffer of the OPCUAClientReadMonitoredValue
+     * passed as monContext and makes it available to the reader.
+     */
+    static void DataChangeNotificationCallback(UA_Client *client,
+                                               UA_UInt32 subId,
+                                               void *subContext,
+                                               UA_UInt32 monId,
+                                               void *monContext,
+                                               UA_DataValue *value);
+
     /**
      * The array that stores all the open62541 NodeIDs of the monitored nodes.
      */
@@ -120,6 +211,21 @@ private:
      */
     UA_ReadValueId *readValues;
 
+    /**
+     * The triple buffers of each monitored node (only if Monitor was called).
+     */
+    OPCUAClientReadMonitoredValue *monitoredValues;
+
+    /**
+     * The identifier of the OPCUA Subscription (only valid if monitoredValues is not NULL).
+     */
+    UA_UInt32 subscriptionId;
+
+    /**
+     * Number of data change notifications received.
+     */
+    volatile int32 numberOfNotifications;
+
 };
 
 }
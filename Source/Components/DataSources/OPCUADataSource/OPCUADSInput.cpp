@@ -61,6 +61,7 @@ OPCUADSInput::OPCUADSInput() :
     readMode = "";
     sync = "";
     samplingTime = 0.0;
+    queueSize = 1u;
     nElements = NULL_PTR(uint32*);
     tempNElements = NULL_PTR(uint32*);
     entryArrayElements = NULL_PTR(uint32*);
@@ -140,7 +141,7 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
-        if (sync == "no") {
+        if ((sync == "no") || (readMode == "Monitor")) {
             if (ok) {
                 ok = data.Read("CpuMask", cpuMask);
                 if (!ok) {
@@ -164,6 +165,15 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 ok = true;
             }
         }
+        if (ok) {
+            if (!data.Read("QueueSize", queueSize)) {
+                queueSize = 1u;
+            }
+            ok = (queueSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "QueueSize shall be > 0");
+            }
+        }
         if (ok) {
             ok = data.MoveRelative("Signals");
             if (!ok) {
@@ -208,7 +218,11 @@ bool OPCUADSInput::Initialise(StructuredDataI &data) {
                 }
                 if (ok) {
                     ok = signalsDatabase.Read("ExtensionObject", extensionObject[i]);
-                    if ((extensionObject[i] == "yes") && ok) {
+                    if ((extensionObject[i] == "yes") && (readMode == "Monitor") && ok) {
+                        REPORT_ERROR(ErrorManagement::ParametersError, "ExtensionObject is not supported with ReadMode = \"Monitor\"");
+                        ok = false;
+                    }
+                    else if ((extensionObject[i] == "yes") && ok) {
                         structuredTypeNames = new StreamString[nOfSignals];
                         ok = signalsDatabase.Read("Type", structuredTypeNames[i]);
                         if (!ok) {
@@ -403,6 +417,12 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
                     else {
                         REPORT_ERROR(ErrorManagement::ParametersError, "SetServiceRequest Failed.");
                     }
+                    if ((readMode == "Monitor") && ok) {
+                        ok = masterClient->Monitor(samplingTime, queueSize, types, nElements);
+                        if (!ok) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Cannot create the OPCUA Subscription.");
+                        }
+                    }
                 }
                 else {
                     ok = masterClient->SetServiceRequest(tempNamespaceIndexes, tempPaths, nOfSignals);
@@ -430,7 +450,8 @@ bool OPCUADSInput::SetConfiguredDatabase(StructuredDataI &data) {
             }
         }
     }
-    if ((sync == "no") && ok) {
+    /* In Monitor mode the client thread is always needed to receive the notifications */
+    if (((sync == "no") || (readMode == "Monitor")) && ok) {
         executor.SetCPUMask(cpuMask);
         executor.SetStackSize(stackSize);
         executor.SetName(GetName());
@@ -507,7 +528,17 @@ ErrorManagement::ErrorType OPCUADSInput::Execute(ExecutionInfo &info) {
                 }
             }
             else if (readMode == "Monitor") {
-                err = ErrorManagement::UnsupportedFeature;
+                uint32 timeout = static_cast<uint32>(samplingTime);
+                if (timeout == 0u) {
+                    timeout = 1u;
+                }
+                ok = masterClient->Iterate(timeout);
+                if ((sync == "no") && ok) {
+                    ok = masterClient->GetLatestValues();
+                }
+                if (!ok) {
+                    err = ErrorManagement::CommunicationError;
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode defines an unsupported service.");
@@ -525,7 +556,8 @@ bool OPCUADSInput::Synchronise() {
                 ok = masterClient->Read(types, nElements);
             }
             else if (readMode == "Monitor") {
-                ok = false;
+                /* The notifications are received by the client thread. Only the latest values are copied here. */
+                ok = masterClient->GetLatestValues();
             }
             else {
                 REPORT_ERROR(ErrorManagement::ParametersError, "ReadMode defines an unsupported service.");
@@ -638,6 +670,10 @@ OPCUAClientRead* OPCUADSInput::GetOPCUAClient() {
     return masterClient;
 }
 
+uint32 OPCUADSInput::GetQueueSize() const {
+    return queueSize;
+}
+
 CLASS_REGISTER(OPCUADSInput, "1.0");
 
 }
@@ -50,6 +50,12 @@ namespace MARTe {
  * @details This DataSource allows to read Node Variables from an OPCUA Server. Data is read
  * from an OPCUA Address Space in the context of a thread or in the context of Synchronise method.
  * This class uses the OPC UA RegisteredRead Service and the OPC UA Monitored Item Service.
+ *
+ * With ReadMode = "Monitor" an OPCUA Subscription with one data change MonitoredItem per node is created during the configuration.
+ * A SingleThreadService (always started in this mode) processes the client network traffic and stores every notification in a
+ * lock-free buffer of the node. The values are then copied in the context of Synchronise (if Synchronise = "yes") or of the
+ * client thread itself (if Synchronise = "no"), so that no network operation is ever performed in the real-time thread.
+ * ExtensionObjects are not supported in this mode.
  * You must assign the actual name of the Node you want to read as signal name.
  * Since it uses the TranslateBrowsePathToNodeId service, you must indicate the relative browse path of the Address Space
  * starting from the OPCUA Object of interest inside the "Objects" folder.
@@ -63,10 +69,11 @@ namespace MARTe {
  *     Class = OPCUADataSource::OPCUADSInput
  *     Address = "opc.tcp://192.168.130.20:4840" //The OPCUA Server Address
  *     ReadMode = "Read" //"Read" uses OPCUA Read Service, "Monitor" uses OPCUA MonitoredItem Service. (Optional) Default = "Read"
- *     SamplingTime = 1 //ms. Only if ReadMode is "Monitor"
+ *     SamplingTime = 1 //ms. Only if ReadMode is "Monitor". Requested publishing and sampling interval of the Subscription. Default = 250
+ *     QueueSize = 1 //(Optional) Only if ReadMode is "Monitor". Size of the server side queue of each MonitoredItem. Shall be > 0. Default = 1
  *     Synchronise = "yes" //"yes" uses the Synchronise method (and thus is executed in the context of the real-time thread, "no" to enable a decoupled SingleThreadService Execute method). Default = "no"
- *     CpuMask = 0xffu //(Optional) Only if Synchronise option is "no". Default = 0xffu
- *     StackSize = 10000000 //(Optional) Only if Synchronise option is "no". Default = THREADS_DEFAULT_STACKSIZE
+ *     CpuMask = 0xffu //(Optional) Only if Synchronise option is "no" or ReadMode is "Monitor". Default = 0xffu
+ *     StackSize = 10000000 //(Optional) Only if Synchronise option is "no" or ReadMode is "Monitor". Default = THREADS_DEFAULT_STACKSIZE
  *     Signals = {
  *         Node1 = {
  *             Type = uint32
@@ -170,16 +177,17 @@ public:
                                   const char8 *const nextStateName);
 
     /**
-     * @brief Provides the context to create the OPCUA Subscription and Monitored Item request or the Read service request.
-     * @return ErrorManagement::NoError if the OPCUA Subscription, the OPCUA Monitored Item request,
-     * OPCUA Monitored Item create data change service are successfully created and the client is running with no error, or
+     * @brief Provides the context to iterate the client receiving the Monitored Item notifications or to call the Read service.
+     * @details In Monitor mode, if the Synchronise option is "no", the latest notified values are also copied to the signals memory.
+     * @return ErrorManagement::NoError if the client is running with no error, or
      * the OPCUA Read Service has been executed correctly.
      * @see EmbeddedServiceMethodBinderI::Execute
      */
     virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
 
     /**
-     * @details Provides the context to create the OPCUA Subscription and Monitored Item request or the Read service request.
+     * @details Provides the context to call the Read service request or, in Monitor mode, to copy the latest notified values
+     * (no network operation is performed in this case).
      * @return true if all the services are executed correctly.
      * @see DataSourceI::Synchronise
      */
@@ -195,6 +203,11 @@ public:
      */
     OPCUAClientRead * GetOPCUAClient();
 
+    /**
+     * @brief Gets the size of the server side queue of each MonitoredItem
+     */
+    uint32 GetQueueSize() const;
+
 
 private:
 
@@ -275,6 +288,11 @@ private:
      */
     float64 samplingTime;
 
+    /**
+     * Holds the value of the configuration parameter QueueSize
+     */
+    uint32 queueSize;
+
     /**
      * The array that stores all the browse paths for each
      * node to read
@@ -0,0 +1,467 @@
+/**
+ * @file OPCUADSServer.cpp
+ * @brief Source file for class OPCUADSServer
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUADSServer (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "OPCUADSServer.h"
+#include "Sleep.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+/*-e909 and -e9133 redefines bool. -e578 symbol ovveride in CLASS_REGISTER*/
+/*lint -save -e909 -e9133 -e578*/
+namespace MARTe {
+
+OPCUADSServer::OPCUADSServer() :
+        DataSourceI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
+    opcuaServer = NULL_PTR(UA_Server*);
+    serverStarted = false;
+    memory = NULL_PTR(uint8*);
+    offsets = NULL_PTR(uint32*);
+    signals = NULL_PTR(OPCUADSServerSignal*);
+    port = 4840u;
+    samplingInterval = 100.0;
+    publishingInterval = 100.0;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+}
+
+/*lint -e{1551} must stop the SingleThreadService and free the memory in the destructor.*/
+OPCUADSServer::~OPCUADSServer() {
+    (void) executor.Stop();
+    if (opcuaServer != NULL_PTR(UA_Server*)) {
+        if (serverStarted) {
+            (void) UA_Server_run_shutdown(opcuaServer);
+            serverStarted = false;
+        }
+        UA_Server_delete(opcuaServer);
+    }
+    if (signals != NULL_PTR(OPCUADSServerSignal*)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            if (signals[i].buffers != NULL_PTR(uint8*)) {
+                GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(signals[i].buffers));
+            }
+        }
+        delete[] signals;
+    }
+    if (offsets != NULL_PTR(uint32*)) {
+        delete[] offsets;
+    }
+    if (memory != NULL_PTR(uint8*)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void*&>(memory));
+    }
+}
+
+bool OPCUADSServer::Initialise(StructuredDataI &data) {
+    bool ok = DataSourceI::Initialise(data);
+    if (ok) {
+        if (!data.Read("Port", port)) {
+            REPORT_ERROR(ErrorManagement::Information, "No Port number defined. It will be 4840.");
+            port = 4840u;
+        }
+        if (!data.Read("SamplingInterval", samplingInterval)) {
+            REPORT_ERROR(ErrorManagement::Information, "SamplingInterval not set. Using default value: 100ms");
+            samplingInterval = 100.0;
+        }
+        ok = (samplingInterval > 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "SamplingInterval shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("PublishingInterval", publishingInterval)) {
+            REPORT_ERROR(ErrorManagement::Information, "PublishingInterval not set. Using default value: 100ms");
+            publishingInterval = 100.0;
+        }
+        ok = (publishingInterval > 0.0);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "PublishingInterval shall be > 0");
+        }
+    }
+    if (ok) {
+        if (!data.Read("CpuMask", cpuMask)) {
+            REPORT_ERROR(ErrorManagement::Information, "CpuMask not set. Using default.");
+        }
+        if (!data.Read("StackSize", stackSize)) {
+            REPORT_ERROR(ErrorManagement::Information, "StackSize not set. Using default.");
+        }
+    }
+    return ok;
+}
+
+bool OPCUADSServer::SetConfiguredDatabase(StructuredDataI &data) {
+    bool ok = DataSourceI::SetConfiguredDatabase(data);
+    uint32 nOfSignals = GetNumberOfSignals();
+    if (ok) {
+        ok = (nOfSignals > 0u);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "At least one signal shall be defined");
+        }
+    }
+    if (ok) {
+        signals = new OPCUADSServerSignal[nOfSignals];
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            signals[i].buffers = NULL_PTR(uint8*);
+            signals[i].numberOfReads = 0;
+        }
+    }
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        StreamString signalName;
+        ok = GetSignalName(i, signalName);
+        uint8 nOfDimensions = 0u;
+        if (ok) {
+            ok = GetSignalNumberOfDimensions(i, nOfDimensions);
+        }
+        if (ok) {
+            ok = (nOfDimensions <= 1u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s has Number Of Dimensions = %d. Multidimensional arrays not supported yet.",
+                             signalName.Buffer(), nOfDimensions);
+            }
+        }
+        if (ok) {
+            signals[i].type = GetOPCUAType(GetSignalType(i));
+            ok = (signals[i].type != NULL_PTR(const UA_DataType*));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Signal %s has an unsupported type", signalName.Buffer());
+            }
+        }
+        if (ok) {
+            ok = GetSignalNumberOfElements(i, signals[i].numberOfElements);
+        }
+        if (ok) {
+            ok = GetSignalByteSize(i, signals[i].size);
+        }
+        if (ok) {
+            signals[i].backBuffer = 0u;
+            signals[i].sharedBuffer = 1;
+            signals[i].frontBuffer = 2u;
+            for (uint32 b = 0u; b < OPCUA_DS_SERVER_NUMBER_OF_BUFFERS; b++) {
+                signals[i].timestamps[b] = 0;
+            }
+            uint32 buffersSize = (signals[i].size * OPCUA_DS_SERVER_NUMBER_OF_BUFFERS);
+            signals[i].buffers = reinterpret_cast<uint8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(buffersSize));
+            ok = (signals[i].buffers != NULL_PTR(uint8*));
+            if (ok) {
+                ok = MemoryOperationsHelper::Set(signals[i].buffers, '\0', buffersSize);
+            }
+        }
+    }
+    if (ok) {
+        /*lint -e{118} no argument needed*/
+        opcuaServer = UA_Server_new();
+        UA_ServerConfig *config = UA_Server_getConfig(opcuaServer);
+        /*lint -e{526} -e{628} -e{1055} -e{746} function defined in open62541*/
+        ok = (UA_ServerConfig_setMinimal(config, port, NULL_PTR(const UA_ByteString*)) == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (ok) {
+            config->samplingIntervalLimits.min = samplingInterval;
+            config->publishingIntervalLimits.min = publishingInterval;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Cannot configure the OPCUA Server");
+        }
+    }
+    if (ok) {
+        /* One Object, named after the DataSource, holds all the Variables */
+        UA_ObjectAttributes objectAttributes = UA_ObjectAttributes_default;
+        objectAttributes.displayName = UA_LOCALIZEDTEXT(const_cast<char8*>("en-US"), const_cast<char8*>(GetName()));
+        /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
+        UA_StatusCode code = UA_Server_addObjectNode(opcuaServer, UA_NODEID_STRING(1u, const_cast<char8*>(GetName())), UA_NODEID_NUMERIC(0u, 85u), /* UA_NS0ID_OBJECTSFOLDER */
+                                                     UA_NODEID_NUMERIC(0u, 35u), /* UA_NS0ID_ORGANIZES */
+                                                     UA_QUALIFIEDNAME(1u, const_cast<char8*>(GetName())), UA_NODEID_NUMERIC(0u, 58u), /* UA_NS0ID_BASEOBJECTTYPE */
+                                                     objectAttributes, NULL_PTR(void*), NULL_PTR(UA_NodeId*));
+        ok = (code == 0x00U); /* UA_STATUSCODE_GOOD */
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Cannot add the OPCUA Object %s - OPC UA Status Code (Part 4 - 7.34): %x", GetName(), code);
+        }
+    }
+    for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+        StreamString signalName;
+        ok = GetSignalName(i, signalName);
+        StreamString nodeIdName;
+        if (ok) {
+            ok = nodeIdName.Printf("%s.%s", GetName(), signalName.Buffer());
+        }
+        if (ok) {
+            UA_VariableAttributes attributes = UA_VariableAttributes_default;
+            attributes.displayName = UA_LOCALIZEDTEXT(const_cast<char8*>("en-US"), const_cast<char8*>(signalName.Buffer()));
+            attributes.dataType = signals[i].type->typeId;
+            attributes.accessLevel = 0x1u; /* UA_ACCESSLEVELMASK_READ */
+            attributes.minimumSamplingInterval = samplingInterval;
+            UA_UInt32 arrayDimensions = signals[i].numberOfElements;
+            if (signals[i].numberOfElements > 1u) {
+                attributes.valueRank = 1; /* UA_VALUERANK_ONE_DIMENSION */
+                attributes.arrayDimensionsSize = 1u;
+                attributes.arrayDimensions = &arrayDimensions;
+            }
+            else {
+                attributes.valueRank = -1; /* UA_VALUERANK_SCALAR */
+            }
+            /* Read-only: no write callback */
+            UA_DataSource dataSource;
+            (void) MemoryOperationsHelper::Set(&dataSource, '\0', static_cast<uint32>(sizeof(UA_DataSource)));
+            dataSource.read = &ReadSignal;
+            /*lint -e{1055} -e{64} -e{746} UA_QUALIFIEDNAME is declared in the open62541 library.*/
+            UA_StatusCode code = UA_Server_addDataSourceVariableNode(opcuaServer, UA_NODEID_STRING(1u, const_cast<char8*>(nodeIdName.Buffer())),
+                                                                     UA_NODEID_STRING(1u, const_cast<char8*>(GetName())), UA_NODEID_NUMERIC(0u, 47u), /* UA_NS0ID_HASCOMPONENT */
+                                                                     UA_QUALIFIEDNAME(1u, const_cast<char8*>(signalName.Buffer())), UA_NODEID_NUMERIC(0u, 63u), /* UA_NS0ID_BASEDATAVARIABLETYPE */
+                                                                     attributes, dataSource, &signals[i], NULL_PTR(UA_NodeId*));
+            ok = (code == 0x00U); /* UA_STATUSCODE_GOOD */
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "Cannot add the OPCUA Variable %s - OPC UA Status Code (Part 4 - 7.34): %x", nodeIdName.Buffer(), code);
+            }
+        }
+    }
+    if (ok) {
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+    }
+    if (!ok) {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Error during configuration.");
+    }
+    return ok;
+}
+
+bool OPCUADSServer::AllocateMemory() {
+    uint32 nOfSignals = GetNumberOfSignals();
+    bool ok = (memory == NULL_PTR(uint8*));
+    uint32 memorySize = 0u;
+    if (ok) {
+        offsets = new uint32[nOfSignals];
+        for (uint32 i = 0u; (i < nOfSignals) && (ok); i++) {
+            offsets[i] = memorySize;
+            uint32 signalByteSize = 0u;
+            ok = GetSignalByteSize(i, signalByteSize);
+            memorySize += signalByteSize;
+        }
+    }
+    if (ok) {
+        memory = reinterpret_cast<uint8*>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize));
+        ok = (memory != NULL_PTR(uint8*));
+    }
+    if (ok) {
+        ok = MemoryOperationsHelper::Set(memory, '\0', memorySize);
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The signalAddress is independent of the bufferIdx.*/
+bool OPCUADSServer::GetSignalMemoryBuffer(const uint32 signalIdx,
+                                          const uint32 bufferIdx,
+                                          void *&signalAddress) {
+    bool ok = ((memory != NULL_PTR(uint8*)) && (offsets != NULL_PTR(uint32*)) && (signalIdx < GetNumberOfSignals()));
+    if (ok) {
+        signalAddress = reinterpret_cast<void*>(&memory[offsets[signalIdx]]);
+    }
+    return ok;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: The brokerName only depends on the direction */
+const char8* OPCUADSServer::GetBrokerName(StructuredDataI &data,
+                                          const SignalDirection direction) {
+    const char8 *brokerName = "";
+    if (direction == OutputSignals) {
+        brokerName = "MemoryMapSynchronisedOutputBroker";
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::ParametersError, "Only OutputSignals are supported.");
+    }
+    return brokerName;
+}
+
+/*lint -e{715}  [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: NOOP at StateChange, independently of the function parameters.*/
+bool OPCUADSServer::PrepareNextState(const char8 *const currentStateName,
+                                     const char8 *const nextStateName) {
+    return true;
+}
+
+bool OPCUADSServer::Synchronise() {
+    bool ok = ((memory != NULL_PTR(uint8*)) && (offsets != NULL_PTR(uint32*)) && (signals != NULL_PTR(OPCUADSServerSignal*)));
+    if (ok) {
+        UA_DateTime now = UA_DateTime_now();
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            uint32 b = signals[i].backBuffer;
+            (void) MemoryOperationsHelper::Copy(&signals[i].buffers[b * signals[i].size], &memory[offsets[i]], signals[i].size);
+            signals[i].timestamps[b] = now;
+            int32 previous = Atomic::Exchange(&signals[i].sharedBuffer, (static_cast<int32>(b) | OPCUA_DS_SERVER_FRESH_BUFFER));
+            signals[i].backBuffer = static_cast<uint32>(previous & (OPCUA_DS_SERVER_FRESH_BUFFER - 1));
+        }
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType OPCUADSServer::Execute(ExecutionInfo &info) {
+    ErrorManagement::ErrorType err = ErrorManagement::NoError;
+    if (opcuaServer != NULL_PTR(UA_Server*)) {
+        if (info.GetStage() == ExecutionInfo::StartupStage) {
+            if (!serverStarted) {
+                serverStarted = (UA_Server_run_startup(opcuaServer) == 0x00U); /* UA_STATUSCODE_GOOD */
+                if (!serverStarted) {
+                    REPORT_ERROR(ErrorManagement::CommunicationError, "Cannot start the OPCUA Server on port %d", port);
+                    /* Do not retry immediately */
+                    Sleep::MSec(1000);
+                    err = ErrorManagement::CommunicationError;
+                }
+            }
+        }
+        else if (info.GetStage() == ExecutionInfo::MainStage) {
+            if (serverStarted) {
+                /* Waits at most for the next scheduled server event (e.g. a Subscription publish) */
+                (void) UA_Server_run_iterate(opcuaServer, true);
+            }
+            else {
+                err = ErrorManagement::CommunicationError;
+            }
+        }
+        else {
+            if (serverStarted) {
+                (void) UA_Server_run_shutdown(opcuaServer);
+                serverStarted = false;
+            }
+        }
+    }
+    return err;
+}
+
+/*lint -e{715} -e{818} [MISRA C++ Rule 0-1-11], [MISRA C++ Rule 0-1-12]. Justification: the signature is imposed by open62541.*/
+UA_StatusCode OPCUADSServer::ReadSignal(UA_Server *server,
+                                        const UA_NodeId *sessionId,
+                                        void *sessionContext,
+                                        const UA_NodeId *nodeId,
+                                        void *nodeContext,
+                                        UA_Boolean includeSourceTimeStamp,
+                                        const UA_NumericRange *range,
+                                        UA_DataValue *value) {
+    UA_StatusCode code = 0x80000000U; /* UA_STATUSCODE_BAD */
+    OPCUADSServerSignal *signal = reinterpret_cast<OPCUADSServerSignal*>(nodeContext);
+    if ((signal != NULL_PTR(OPCUADSServerSignal*)) && (value != NULL_PTR(UA_DataValue*))) {
+        if ((signal->sharedBuffer & OPCUA_DS_SERVER_FRESH_BUFFER) != 0) {
+            int32 previous = Atomic::Exchange(&signal->sharedBuffer, static_cast<int32>(signal->frontBuffer));
+            signal->frontBuffer = static_cast<uint32>(previous & (OPCUA_DS_SERVER_FRESH_BUFFER - 1));
+        }
+        uint8 *data = &signal->buffers[signal->frontBuffer * signal->size];
+        if (signal->numberOfElements > 1u) {
+            code = UA_Variant_setArrayCopy(&value->value, data, static_cast<osulong>(signal->numberOfElements), signal->type);
+        }
+        else {
+            code = UA_Variant_setScalarCopy(&value->value, data, signal->type);
+        }
+        if (code == 0x00U) { /* UA_STATUSCODE_GOOD */
+            value->hasValue = true;
+            if (includeSourceTimeStamp) {
+                value->hasSourceTimestamp = true;
+                value->sourceTimestamp = signal->timestamps[signal->frontBuffer];
+            }
+        }
+        Atomic::Increment(&signal->numberOfReads);
+    }
+    return code;
+}
+
+const UA_DataType* OPCUADSServer::GetOPCUAType(const TypeDescriptor &td) {
+    const UA_DataType *type = NULL_PTR(const UA_DataType*);
+    if (td == UnsignedInteger8Bit) {
+        type = &UA_TYPES[UA_TYPES_BYTE];
+    }
+    else if (td == UnsignedInteger16Bit) {
+        type = &UA_TYPES[UA_TYPES_UINT16];
+    }
+    else if (td == UnsignedInteger32Bit) {
+        type = &UA_TYPES[UA_TYPES_UINT32];
+    }
+    else if (td == UnsignedInteger64Bit) {
+        type = &UA_TYPES[UA_TYPES_UINT64];
+    }
+    else if (td == SignedInteger8Bit) {
+        type = &UA_TYPES[UA_TYPES_SBYTE];
+    }
+    else if (td == SignedInteger16Bit) {
+        type = &UA_TYPES[UA_TYPES_INT16];
+    }
+    else if (td == SignedInteger32Bit) {
+        type = &UA_TYPES[UA_TYPES_INT32];
+    }
+    else if (td == SignedInteger64Bit) {
+        type = &UA_TYPES[UA_TYPES_INT64];
+    }
+    else if (td == Float32Bit) {
+        type = &UA_TYPES[UA_TYPES_FLOAT];
+    }
+    else if (td == Float64Bit) {
+        type = &UA_TYPES[UA_TYPES_DOUBLE];
+    }
+    else {
+        type = NULL_PTR(const UA_DataType*);
+    }
+    return type;
+}
+
+uint16 OPCUADSServer::GetPort() const {
+    return port;
+}
+
+float64 OPCUADSServer::GetSamplingInterval() const {
+    return samplingInterval;
+}
+
+float64 OPCUADSServer::GetPublishingInterval() const {
+    return publishingInterval;
+}
+
+uint32 OPCUADSServer::GetNumberOfReads() const {
+    uint32 numberOfReads = 0u;
+    if (signals != NULL_PTR(OPCUADSServerSignal*)) {
+        uint32 nOfSignals = GetNumberOfSignals();
+        for (uint32 i = 0u; i < nOfSignals; i++) {
+            numberOfReads += static_cast<uint32>(signals[i].numberOfReads);
+        }
+    }
+    return numberOfReads;
+}
+
+CLASS_REGISTER(OPCUADSServer, "1.0");
+
+}
+/*lint -restore*/
+
@@ -0,0 +1,317 @@
+/**
+ * @file OPCUADSServer.h
+ * @brief Header file for class OPCUADSServer
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUADSServer
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVER_H_
+#define SOURCE_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+/*lint -u__cplusplus This is required as otherwise lint will get confused after including this header file.*/
+#include "open62541.h"
+/*lint -D__cplusplus*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "DataSourceI.h"
+#include "EmbeddedServiceMethodBinderI.h"
+#include "SingleThreadService.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+namespace MARTe {
+
+/**
+ * Number of buffers used to exchange each signal between the real-time thread and the server thread.
+ */
+const uint32 OPCUA_DS_SERVER_NUMBER_OF_BUFFERS = 3u;
+
+/**
+ * Flag set on OPCUADSServerSignal::sharedBuffer when it holds a value that was not yet served.
+ */
+const int32 OPCUA_DS_SERVER_FRESH_BUFFER = 0x100;
+
+/**
+ * @brief Lock-free snapshot of one signal published as an OPCUA Variable.
+ * @details Synchronise (real-time thread) writes the backBuffer and swaps it with the sharedBuffer;
+ * the read callback (server thread) swaps the sharedBuffer with its frontBuffer only when a fresh value is available.
+ */
+struct OPCUADSServerSignal {
+    /**
+     * The OPCUA_DS_SERVER_NUMBER_OF_BUFFERS contiguous buffers of size bytes each.
+     */
+    uint8 *buffers;
+
+    /**
+     * The source timestamp of each buffer.
+     */
+    UA_DateTime timestamps[OPCUA_DS_SERVER_NUMBER_OF_BUFFERS];
+
+    /**
+     * The size in bytes of each buffer.
+     */
+    uint32 size;
+
+    /**
+     * The number of elements of the signal.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * The open62541 type of the signal.
+     */
+    const UA_DataType *type;
+
+    /**
+     * Buffer being written by Synchronise.
+     */
+    uint32 backBuffer;
+
+    /**
+     * Buffer exchanged between Synchronise and the read callback (ORed with OPCUA_DS_SERVER_FRESH_BUFFER when not yet served).
+     */
+    volatile int32 sharedBuffer;
+
+    /**
+     * Buffer owned by the read callback.
+     */
+    uint32 frontBuffer;
+
+    /**
+     * Number of reads served by the read callback.
+     */
+    volatile int32 numberOfReads;
+};
+
+/**
+ * @brief Output DataSource which publishes the real-time signals as Variables of an OPCUA Server hosted by the DataSource.
+ * @details Each signal is mapped to a read-only OPCUA Variable (NodeId = ns=1;s=DataSourceName.SignalName) inside
+ * an OPCUA Object named after the DataSource, which is created in the "Objects" folder.
+ *
+ * The Variables are backed by an open62541 UA_DataSource: in the real-time thread Synchronise only copies each signal
+ * into a lock-free triple buffer, while the read callback, executed by the server thread (a SingleThreadService iterating the server),
+ * serves the latest snapshot to any number of clients and subscriptions. No lock is ever taken by the real-time thread.
+ *
+ * It supports int8/16/32/64, uint8/16/32/64, float32/64 scalars and one dimensional arrays. Strings and structures are not supported.
+ *
+ * The configuration syntax is (names are only given as an example):
+ * <pre>
+ * +OPCUAServer = {
+ *     Class = OPCUADataSource::OPCUADSServer
+ *     Port = 4841 //(Optional) The port where the server listens. Default = 4840
+ *     SamplingInterval = 10 //(Optional) ms. Minimum sampling interval of the Variables and of the MonitoredItems. Shall be > 0. Default = 100
+ *     PublishingInterval = 10 //(Optional) ms. Minimum publishing interval of the Subscriptions. Shall be > 0. Default = 100
+ *     CpuMask = 0x2 //(Optional) CPU affinity of the server thread. Default = 0xff
+ *     StackSize = 10000000 //(Optional) Stack size of the server thread. Default = THREADS_DEFAULT_STACKSIZE
+ *     Signals = {
+ *         Temperature = {
+ *             Type = float64
+ *         }
+ *         Currents = {
+ *             Type = float32
+ *             NumberOfElements = 8
+ *         }
+ *     }
+ * }
+ * </pre>
+ */
+class OPCUADSServer: public DataSourceI, public EmbeddedServiceMethodBinderI {
+public:
+
+    CLASS_REGISTER_DECLARATION()
+
+    /**
+     * @brief Default constructor. NOOP.
+     */
+    OPCUADSServer();
+
+    /**
+     * @brief Default destructor. Stops the server thread and frees all the memory.
+     */
+    virtual ~OPCUADSServer();
+
+    /**
+     * @brief Loads and verifies all the configuration parameters detailed in the class description.
+     * @return true if all the specified optional parameters have valid values.
+     * @see DataSourceI::Initialise
+     */
+    virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Verifies the signals, allocates their triple buffers, creates the OPCUA Server with one Variable per signal and starts the server thread.
+     * @return true if all the signals have a supported type and number of dimensions <= 1, all the nodes are created
+     * and the server thread is started.
+     * @see DataSourceI::SetConfiguredDatabase
+     */
+    virtual bool SetConfiguredDatabase(StructuredDataI &data);
+
+    /**
+     * @brief Allocates the memory of the signals.
+     * @return true if the memory is successfully allocated.
+     */
+    virtual bool AllocateMemory();
+
+    /**
+     * @see DataSourceI::GetSignalMemoryBuffer
+     */
+    virtual bool GetSignalMemoryBuffer(const uint32 signalIdx,
+                                       const uint32 bufferIdx,
+                                       void *&signalAddress);
+
+    /**
+     * @see DataSourceI::GetBrokerName
+     * @return MemoryMapSynchronisedOutputBroker for OutputSignals, empty string otherwise.
+     */
+    virtual const char8* GetBrokerName(StructuredDataI &data,
+                                       const SignalDirection direction);
+
+    /**
+     * @see DataSourceI::PrepareNextState
+     * @return true
+     */
+    virtual bool PrepareNextState(const char8 *const currentStateName,
+                                  const char8 *const nextStateName);
+
+    /**
+     * @brief Copies each signal into its triple buffer and makes it available to the server thread.
+     * @return true
+     */
+    virtual bool Synchronise();
+
+    /**
+     * @brief Starts (StartupStage), iterates (MainStage) and shuts down (termination stages) the OPCUA Server.
+     * @return ErrorManagement::NoError if the server is running with no error.
+     * @see EmbeddedServiceMethodBinderI::Execute
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the port where the server listens.
+     */
+    uint16 GetPort() const;
+
+    /**
+     * @brief Gets the minimum sampling interval in ms.
+     */
+    float64 GetSamplingInterval() const;
+
+    /**
+     * @brief Gets the minimum publishing interval in ms.
+     */
+    float64 GetPublishingInterval() const;
+
+    /**
+     * @brief Gets the number of times any of the Variables was read by the server. (Testing purposes)
+     */
+    uint32 GetNumberOfReads() const;
+
+private:
+
+    /**
+     * @brief Gets the open62541 type which matches a MARTe type.
+     * @param[in] td the MARTe type.
+     * @return the open62541 type or NULL if the type is not supported.
+     */
+    static const UA_DataType* GetOPCUAType(const TypeDescriptor &td);
+
+    /**
+     * @brief open62541 UA_DataSource read callback. Serves the latest snapshot of the OPCUADSServerSignal passed as nodeContext.
+     */
+    static UA_StatusCode ReadSignal(UA_Server *server,
+                                    const UA_NodeId *sessionId,
+                                    void *sessionContext,
+                                    const UA_NodeId *nodeId,
+                                    void *nodeContext,
+                                    UA_Boolean includeSourceTimeStamp,
+                                    const UA_NumericRange *range,
+                                    UA_DataValue *value);
+
+    /**
+     * The server thread.
+     */
+    SingleThreadService executor;
+
+    /**
+     * open62541 server.
+     */
+    UA_Server *opcuaServer;
+
+    /**
+     * True if UA_Server_run_startup was successfully called.
+     */
+    bool serverStarted;
+
+    /**
+     * The signals memory.
+     */
+    uint8 *memory;
+
+    /**
+     * The offset of each signal in the memory.
+     */
+    uint32 *offsets;
+
+    /**
+     * The snapshot of each signal.
+     */
+    OPCUADSServerSignal *signals;
+
+    /**
+     * The port where the server listens.
+     */
+    uint16 port;
+
+    /**
+     * The minimum sampling interval in ms.
+     */
+    float64 samplingInterval;
+
+    /**
+     * The minimum publishing interval in ms.
+     */
+    float64 publishingInterval;
+
+    /**
+     * CPU affinity of the server thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the server thread.
+     */
+    uint32 stackSize;
+
+};
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVER_H_ */
+
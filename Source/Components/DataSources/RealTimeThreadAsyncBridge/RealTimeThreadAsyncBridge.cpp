@@ -38,6 +38,13 @@
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maximum number of attempts of a reader in LockFreeMode. A reader only retries if the writer
+ * has published (at least) one full round of buffers while the reader was validating the last published buffer.
+ */
+const MARTe::uint32 LOCK_FREE_MAX_READ_ATTEMPTS = 16u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -62,6 +69,13 @@ RealTimeThreadAsyncBridge::RealTimeThreadAsyncBridge() :
         REPORT_ERROR(ErrorManagement::FatalError, "Failed to install message filters");
     }
     blockingMode = 0u;
+    lockFreeMode = 0u;
+    sequenceCounters = NULL_PTR(volatile int32 *);
+    latestBuffer = NULL_PTR(volatile uint32 *);
+    readRetries = 0;
+    writeOverruns = 0;
+    readRetriesSignalIdx = 0u;
+    writeOverrunsSignalIdx = 0u;
 }
 
 RealTimeThreadAsyncBridge::~RealTimeThreadAsyncBridge() {
@@ -81,6 +95,14 @@ RealTimeThreadAsyncBridge::~RealTimeThreadAsyncBridge() {
         delete[] whatIsNewestGlobCounter;
         whatIsNewestGlobCounter = NULL_PTR(uint32 *);
     }
+    if (sequenceCounters != NULL_PTR(volatile int32 *)) {
+        delete[] sequenceCounters;
+        sequenceCounters = NULL_PTR(volatile int32 *);
+    }
+    if (latestBuffer != NULL_PTR(volatile uint32 *)) {
+        delete[] latestBuffer;
+        latestBuffer = NULL_PTR(volatile uint32 *);
+    }
 }
 
 bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
@@ -99,6 +121,26 @@ bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
             numberOfBuffers = 1u;
         }
 
+        if (!data.Read("LockFreeMode", lockFreeMode)) {
+            lockFreeMode = 0u;
+        }
+        if ((lockFreeMode > 0u) && (ret)) {
+            ret = (blockingMode == 0u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "LockFreeMode and BlockingMode cannot be both set");
+            }
+            if (ret) {
+                ret = (numberOfBuffers >= 2u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "LockFreeMode requires NumberOfBuffers >= 2");
+                }
+            }
+            if (ret) {
+                //the extra buffer where the writer writes when all the others are being read
+                numberOfBuffers++;
+            }
+        }
+
         if (numberOfBuffers == 1u) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "NumberOfBuffers==1, use blocking mode");
         }
@@ -116,7 +158,23 @@ bool RealTimeThreadAsyncBridge::Initialise(StructuredDataI &data) {
 bool RealTimeThreadAsyncBridge::PrepareNextState(const char8 * const currentStateName,
                                                   const char8 * const nextStateName) {
 
-    return true;
+    bool ret = true;
+    if (lockFreeMode > 0u) {
+        //the diagnostic signals are only written by this DataSource
+        for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+            if ((i == readRetriesSignalIdx) || (i == writeOverrunsSignalIdx)) {
+                uint32 numberOfProducers = 0u;
+                if (!GetSignalNumberOfProducers(i, nextStateName, numberOfProducers)) {
+                    numberOfProducers = 0u;
+                }
+                ret = (numberOfProducers == 0u);
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The ReadRetries and WriteOverruns signals cannot be written");
+                }
+            }
+        }
+    }
+    return ret;
 }
 
 bool RealTimeThreadAsyncBridge::Synchronise() {
@@ -191,6 +249,19 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
                 ret = (whatIsNewestGlobCounter != NULL_PTR(uint32 *));
             }
         }
+        if ((ret) && (lockFreeMode > 0u)) {
+            if (sequenceCounters == NULL_PTR(volatile int32 *)) {
+                uint32 index = (numberOfSignals * numberOfBuffers);
+                sequenceCounters = new volatile int32[index];
+                ret = (sequenceCounters != NULL_PTR(volatile int32 *));
+            }
+            if (ret) {
+                if (latestBuffer == NULL_PTR(volatile uint32 *)) {
+                    latestBuffer = new volatile uint32[numberOfSignals];
+                    ret = (latestBuffer != NULL_PTR(volatile uint32 *));
+                }
+            }
+        }
         if (ret) {
             uint32 numberOfElements = (numberOfSignals * numberOfBuffers);
             for (uint32 i = 0u; i < numberOfElements; i++) {
@@ -200,11 +271,43 @@ bool RealTimeThreadAsyncBridge::SetConfiguredDatabase(StructuredDataI & data) {
                 if (i < numberOfSignals) {
                     whatIsNewestGlobCounter[i] = 0u;
                 }
+                if (lockFreeMode > 0u) {
+                    sequenceCounters[i] = 0;
+                    if (i < numberOfSignals) {
+                        latestBuffer[i] = 0u;
+                    }
+                }
             }
         }
 
     }
 
+    if ((ret) && (lockFreeMode > 0u)) {
+        readRetries = 0;
+        writeOverruns = 0;
+        if (!GetSignalIndex(readRetriesSignalIdx, "ReadRetries")) {
+            readRetriesSignalIdx = numberOfSignals;
+        }
+        if (!GetSignalIndex(writeOverrunsSignalIdx, "WriteOverruns")) {
+            writeOverrunsSignalIdx = numberOfSignals;
+        }
+        for (uint32 i = 0u; (i < numberOfSignals) && (ret); i++) {
+            if ((i == readRetriesSignalIdx) || (i == writeOverrunsSignalIdx)) {
+                ret = (GetSignalType(i) == UnsignedInteger32Bit);
+                if (ret) {
+                    uint32 numberOfElements = 0u;
+                    ret = GetSignalNumberOfElements(i, numberOfElements);
+                    if (ret) {
+                        ret = (numberOfElements == 1u);
+                    }
+                }
+                if (!ret) {
+                    REPORT_ERROR(ErrorManagement::InitialisationError, "The ReadRetries and WriteOverruns signals shall be uint32 with one element");
+                }
+            }
+        }
+    }
+
     return ret;
 
 }
@@ -224,6 +327,39 @@ bool RealTimeThreadAsyncBridge::GetInputOffset(const uint32 signalIdx,
             ok = true;
         }
     }
+    else if (lockFreeMode != 0u) {
+        uint32 firstIndex = (signalIdx * numberOfBuffers);
+        bool isCounter = ((signalIdx == readRetriesSignalIdx) || (signalIdx == writeOverrunsSignalIdx));
+        if (isCounter) {
+            //the counters are refreshed on buffer 0 (the only one ever published for these signals) at each read
+            int32 counter = (signalIdx == readRetriesSignalIdx) ? (readRetries) : (writeOverruns);
+            uint32 *counterMemory = reinterpret_cast<uint32 *>(&memory[signalOffsets[signalIdx]]);
+            *counterMemory = static_cast<uint32>(counter);
+            Atomic::Increment(&spinlocksRead[firstIndex]);
+            offset = 0u;
+            ok = true;
+        }
+        for (uint32 k = 0u; (k < LOCK_FREE_MAX_READ_ATTEMPTS) && (!ok); k++) {
+            uint32 bufferIdx = latestBuffer[signalIdx];
+            uint32 index = firstIndex + bufferIdx;
+            int32 sequence = sequenceCounters[index];
+            //odd => the writer is writing on this buffer
+            if ((sequence & 1) == 0) {
+                //register as reader and check that the writer did not get the buffer in the meanwhile
+                Atomic::Increment(&spinlocksRead[index]);
+                if (sequenceCounters[index] == sequence) {
+                    offset = (signalSize[signalIdx] * bufferIdx);
+                    ok = true;
+                }
+                else {
+                    Atomic::Decrement(&spinlocksRead[index]);
+                }
+            }
+            if (!ok) {
+                Atomic::Increment(&readRetries);
+            }
+        }
+    }
     else {
         //possibly give a chance to all buffers
         for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
@@ -273,6 +409,37 @@ bool RealTimeThreadAsyncBridge::GetOutputOffset(const uint32 signalIdx,
             offset = 0u;
         }
     }
+    else if (lockFreeMode != 0u) {
+        uint32 firstIndex = (signalIdx * numberOfBuffers);
+        //the last buffer is never published
+        uint32 numberOfPublishedBuffers = (numberOfBuffers - 1u);
+        uint32 newestBuffer = latestBuffer[signalIdx];
+        uint32 bufferIdx = numberOfPublishedBuffers;
+        for (uint32 h = 1u; (h < numberOfPublishedBuffers) && (!ok); h++) {
+            uint32 candidate = ((newestBuffer + h) % numberOfPublishedBuffers);
+            uint32 index = firstIndex + candidate;
+            if (spinlocksRead[index] == 0) {
+                //mark as being written and check that no reader registered in the meanwhile
+                Atomic::Increment(&sequenceCounters[index]);
+                if (spinlocksRead[index] == 0) {
+                    bufferIdx = candidate;
+                    ok = true;
+                }
+                else {
+                    Atomic::Increment(&sequenceCounters[index]);
+                }
+            }
+        }
+        if (!ok) {
+            Atomic::Increment(&writeOverruns);
+            ok = true;
+        }
+        offset = (signalSize[signalIdx] * bufferIdx);
+        //needed in case of ranges. Only this writer can modify the newest buffer
+        uint32 destOffset = signalOffsets[signalIdx] + offset;
+        uint32 srcOffset = signalOffsets[signalIdx] + (signalSize[signalIdx] * newestBuffer);
+        (void) MemoryOperationsHelper::Copy(&memory[destOffset], &memory[srcOffset], signalSize[signalIdx]);
+    }
     else {
 
         for (uint32 k = 0u; (k < numberOfBuffers) && (!ok); k++) {
@@ -343,39 +510,48 @@ bool RealTimeThreadAsyncBridge::TerminateOutputCopy(const uint32 signalIdx,
     uint32 buffNumber = (offset / signalSize[signalIdx]);
 
     uint32 index = (signalIdx * numberOfBuffers) + buffNumber;
-    whatIsNewestGlobCounter[signalIdx]++;
-    whatIsNewestCounter[index] = whatIsNewestGlobCounter[signalIdx];
+    if (lockFreeMode != 0u) {
+        //the extra buffer is never published
+        if (buffNumber < (numberOfBuffers - 1u)) {
+            Atomic::Increment(&sequenceCounters[index]);
+            latestBuffer[signalIdx] = buffNumber;
+        }
+    }
+    else {
+        whatIsNewestGlobCounter[signalIdx]++;
+        whatIsNewestCounter[index] = whatIsNewestGlobCounter[signalIdx];
 
-    //overflow... subtract the smaller one
-    if (whatIsNewestGlobCounter[signalIdx] == 0u) {
+        //overflow... subtract the smaller one
+        if (whatIsNewestGlobCounter[signalIdx] == 0u) {
 
-        uint32 min = 0xFFFFFFFFu;
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            if (h != buffNumber) {
-                uint32 index1 = (signalIdx * numberOfBuffers) + h;
-                if (whatIsNewestCounter[index1] < min) {
-                    min = whatIsNewestCounter[index1];
+            uint32 min = 0xFFFFFFFFu;
+            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
+                if (h != buffNumber) {
+                    uint32 index1 = (signalIdx * numberOfBuffers) + h;
+                    if (whatIsNewestCounter[index1] < min) {
+                        min = whatIsNewestCounter[index1];
+                    }
                 }
-            }
 
-        }
+            }
 
-        for (uint32 h = 0u; (h < numberOfBuffers); h++) {
-            uint32 index1 = (signalIdx * numberOfBuffers) + h;
-            if (h != buffNumber) {
-                bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
-                if (blocked) {
-                    whatIsNewestCounter[index1] -= min;
-                    spinlocksWrite[index1].FastUnLock();
+            for (uint32 h = 0u; (h < numberOfBuffers); h++) {
+                uint32 index1 = (signalIdx * numberOfBuffers) + h;
+                if (h != buffNumber) {
+                    bool blocked = spinlocksWrite[index1].FastLock(resetTimeout);
+                    if (blocked) {
+                        whatIsNewestCounter[index1] -= min;
+                        spinlocksWrite[index1].FastUnLock();
+                    }
                 }
             }
-        }
 
-        whatIsNewestGlobCounter[signalIdx] -= min;
-        whatIsNewestCounter[index] -= min;
+            whatIsNewestGlobCounter[signalIdx] -= min;
+            whatIsNewestCounter[index] -= min;
 
+        }
+        spinlocksWrite[index].FastUnLock();
     }
-    spinlocksWrite[index].FastUnLock();
 
     return true;
 }
@@ -424,11 +600,26 @@ ErrorManagement::ErrorType RealTimeThreadAsyncBridge::ResetSignalValue() {
             whatIsNewestCounter[index] = 0u;
         }
         whatIsNewestGlobCounter[i]=0u;
+        if (lockFreeMode != 0u) {
+            latestBuffer[i] = 0u;
+        }
+    }
+    if (lockFreeMode != 0u) {
+        readRetries = 0;
+        writeOverruns = 0;
     }
     err = !ret;
     return err;
 }
 
+uint32 RealTimeThreadAsyncBridge::GetReadRetries() const {
+    return static_cast<uint32>(readRetries);
+}
+
+uint32 RealTimeThreadAsyncBridge::GetWriteOverruns() const {
+    return static_cast<uint32>(writeOverruns);
+}
+
 CLASS_REGISTER(RealTimeThreadAsyncBridge, "1.0")
 CLASS_METHOD_REGISTER(RealTimeThreadAsyncBridge, ResetSignalValue)
 }
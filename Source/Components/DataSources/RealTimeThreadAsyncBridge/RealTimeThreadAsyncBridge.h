@@ -50,6 +50,13 @@ namespace MARTe {
  * function returns false. The same happens if there is no buffer available for the reader (impossible if more than one buffer has been declared),
  * in this case the GetInputOffset returns false.
  *
+ * If LockFreeMode is set, the writer never blocks nor fails. Each buffer of each signal has a sequence counter which is odd while the
+ * buffer is being written and the index of the last published buffer is kept for each signal. The reader registers itself on the last
+ * published buffer and validates that its sequence counter did not change (otherwise it retries on the new last published buffer). The writer
+ * takes the next buffer (different from the last published one) without readers, marking it as being written before checking again for readers.
+ * When all the buffers are being read, the writer writes on an extra (never published) buffer and the value is lost. The number of read retries
+ * and of write overruns are counted and can be read by declaring the uint32 signals ReadRetries and WriteOverruns (which cannot be written by any GAM).
+ *
  * The RPC method ResetSignalValue allows to reset all the signal values.
  *
   * <pre>
@@ -58,6 +65,7 @@ namespace MARTe {
  *    NumberOfBuffers = 3 //Optional but < 64. Default = 1. Each buffer contains a copy of each signal.
  *    HeapName = "Default" //Optional. Default = GlobalObjectsDatabase::Instance()->GetStandardHeap();
  *    BlockingMode = 0 //Optional. Default = 0. NumberOfBuffers will be set to 1 and a spinlock mutex is used for synchronization on the shared signals
+ *    LockFreeMode = 0 //Optional. Default = 0. If 1 the writer never blocks (see above). Requires NumberOfBuffers >= 2 and cannot be used together with BlockingMode.
  *    ResetMSecTimeout = 1 //Optional. Default = TTInfiniteWait. The TerminateOutputCopy function can block when the counter used to newest written buffer overflows and needs to be reset.
  *                                                               If the reader should wait for this counter to be properly reset then the ResetMSecTimeout should
  *                                                               be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
@@ -69,6 +77,12 @@ namespace MARTe {
  *            +NumberOfDimensions = 0|1|2
  *            +NumberOfElements = NUMBER>0
  *       }
+ *       ReadRetries = { //Optional. Only in LockFreeMode. Number of times that a reader had to retry because the buffer was being written.
+ *            Type = uint32
+ *       }
+ *       WriteOverruns = { //Optional. Only in LockFreeMode. Number of writes that were lost because all the buffers were being read.
+ *            Type = uint32
+ *       }
  *    }
  * }
  * </pre>
@@ -97,12 +111,15 @@ RealTimeThreadAsyncBridge    ();
      *   be increased to a large number. If instead the reader does not mind to get oldest buffer (instead of the newest) while this reset operation
      *    is being performed, the ResetMSecTimeout should be set to 0.
      *   This overflow will occur every 2**32-1 writes, which at e.g. 1 kHz frequency, will occur every ~49 days).
+     *   LockFreeMode = 0|1 (if 1, NumberOfBuffers shall be >= 2 and BlockingMode shall not be set. One extra buffer is allocated
+     *   for the writes that cannot be published).
      */
     virtual bool Initialise(StructuredDataI &data);
 
     /**
      * @brief Allocates the memory for the state variables.
      * @details Checks that the signals have not defined the "Samples" field, because this data source does not support samples.
+     * In LockFreeMode also checks that the ReadRetries and WriteOverruns signals (if declared) are uint32 with one element.
      * @return true if for each signal "Samples" is not defined and if the memory is allocated with no errors for the state variables.
      * It returns false otherwse.
      */
@@ -119,7 +136,7 @@ RealTimeThreadAsyncBridge    ();
      * @details In the case where signals are written more than one time by the writer GAM and/or signals with more than one range defined,
      * the TerminateOutputCopy function will not unlock the buffer until all the write operations have been completed. In this function
      * the \a writeOp variable is set as the sum of the write operations for each signal.
-     * @return true.
+     * @return false if in LockFreeMode the ReadRetries or the WriteOverruns signals are written by any GAM in the next state.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
             const char8 * const nextStateName);
@@ -128,6 +145,8 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::GetInputOffset
      * @details Checks the last written available buffer and returns its offset. The atomic variable \a spinlocksRead, denoting the number
      * of readers on that buffer is incremented. The writer can not write on that buffer if this atomic variable is greater than zero.
+     * In LockFreeMode the reader is registered on the last published buffer and the sequence counter of the buffer is checked to be
+     * unchanged (and even), otherwise \a readRetries is incremented and the read is retried.
      * @return false if no buffer is available. This happens only if only one buffer is defined and the writer is writing on it.
      */
     virtual bool GetInputOffset(const uint32 signalIdx,
@@ -137,7 +156,9 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::GetOutputOffset
      * @details Checks the oldest written available buffer and returns its offset. the semaphore \a spinlocksWrite, is locked
      * on that buffer. The readers can not read on that buffer while the semaphore is locked.
-     * @return false if no buffer is available because the readers are using all of them.
+     * In LockFreeMode the next buffer without readers (excluding the last published) is marked as being written and its offset is returned.
+     * If all the buffers are being read \a writeOverruns is incremented and the offset of the extra buffer is returned.
+     * @return false if no buffer is available because the readers are using all of them (never in LockFreeMode).
      */
     virtual bool GetOutputOffset(const uint32 signalIdx,
             const uint32 numberOfSamples, uint32 &offset);
@@ -153,7 +174,7 @@ RealTimeThreadAsyncBridge    ();
      * @see DataSourceI::TerminateOutputCopy
      * @details If all the write operations for the signal \a signalIdx have been terminated, it increments the
      * \a whatIsNewestCounter setting the buffer as the last written. The spinlocksWrite variable is unlocked for the
-     * buffer that have just been written.
+     * buffer that have just been written. In LockFreeMode the buffer (if not the extra one) is marked as stable and published.
      */
     virtual bool TerminateOutputCopy(const uint32 signalIdx,
             const uint32 offset, const uint32 numberOfSamples);
@@ -169,6 +190,18 @@ RealTimeThreadAsyncBridge    ();
      */
     ErrorManagement::ErrorType ResetSignalValue();
 
+    /**
+     * @brief Gets the number of read retries in LockFreeMode.
+     * @return the number of times that a reader had to retry because the buffer was being written.
+     */
+    uint32 GetReadRetries() const;
+
+    /**
+     * @brief Gets the number of write overruns in LockFreeMode.
+     * @return the number of writes that were lost because all the buffers were being read.
+     */
+    uint32 GetWriteOverruns() const;
+
 protected:
 
     /**
@@ -201,6 +234,41 @@ protected:
      * TODO
      */
     uint8 blockingMode;
+
+    /**
+     * If set the writer never blocks (see class description).
+     */
+    uint8 lockFreeMode;
+
+    /**
+     * The sequence counter of each buffer in LockFreeMode (odd while the buffer is being written).
+     */
+    volatile int32 *sequenceCounters;
+
+    /**
+     * The last published buffer of each signal in LockFreeMode.
+     */
+    volatile uint32 *latestBuffer;
+
+    /**
+     * The number of read retries in LockFreeMode.
+     */
+    volatile int32 readRetries;
+
+    /**
+     * The number of write overruns in LockFreeMode.
+     */
+    volatile int32 writeOverruns;
+
+    /**
+     * The index of the ReadRetries signal (numberOfSignals if not declared).
+     */
+    uint32 readRetriesSignalIdx;
+
+    /**
+     * The index of the WriteOverruns signal (numberOfSignals if not declared).
+     */
+    uint32 writeOverrunsSignalIdx;
 };
 
 }
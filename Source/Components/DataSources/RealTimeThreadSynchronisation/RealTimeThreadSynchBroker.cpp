@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "CompilerTypes.h"
+#include "HighResolutionTimer.h"
 #include "RealTimeThreadSynchBroker.h"
 
 /*---------------------------------------------------------------------------*/
@@ -55,6 +56,11 @@ RealTimeThreadSynchBroker::RealTimeThreadSynchBroker() :
     dataSource = NULL_PTR(DataSourceI *);
     waitForNext = 0u;
     mux.Create();
+    ring = NULL_PTR(RealTimeThreadSynchRing *);
+    busyPoll = 0u;
+    nextSample = 0u;
+    wakeSample = 0u;
+    sleeping = 0;
 }
 
 /*lint -e{1551} -e{1740} must free the allocated memory in the destructor and close the semaphore. The dataSourceMemory,
@@ -175,6 +181,82 @@ bool RealTimeThreadSynchBroker::AddSample() {
     return ok;
 }
 
+void RealTimeThreadSynchBroker::SetRing(RealTimeThreadSynchRing * const ringIn,
+                                        const uint8 busyPollIn) {
+    ring = ringIn;
+    busyPoll = busyPollIn;
+    nextSample = 0u;
+    if (ring != NULL_PTR(RealTimeThreadSynchRing *)) {
+        nextSample = ring->GetNumberOfWrittenSamples();
+    }
+}
+
+uint32 RealTimeThreadSynchBroker::GetNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+/*lint -e{613} ring != NULL as otherwise the method is not called.*/
+bool RealTimeThreadSynchBroker::WaitForRing(const uint32 endSample) {
+    bool ok = true;
+    if (busyPoll == 1u) {
+        uint64 startTicks = HighResolutionTimer::Counter();
+        uint64 timeoutTicks = timeout.HighResolutionTimerTicks();
+        bool infinite = (timeout == TTInfiniteWait);
+        while ((ok) && (static_cast<int32>(ring->GetNumberOfWrittenSamples() - endSample) < 0)) {
+            if (!infinite) {
+                ok = ((HighResolutionTimer::Counter() - startTicks) < timeoutTicks);
+            }
+        }
+    }
+    else {
+        while ((ok) && (static_cast<int32>(ring->GetNumberOfWrittenSamples() - endSample) < 0)) {
+            ok = synchSem.Reset();
+            wakeSample = endSample;
+            //The producer reads sleeping after publishing the sample (the atomic operations are full barriers), so either it
+            //sees that the broker is sleeping or the broker sees the sample.
+            Atomic::Increment(&sleeping);
+            if (static_cast<int32>(ring->GetNumberOfWrittenSamples() - endSample) < 0) {
+                if (ok) {
+                    ok = (synchSem.Wait(timeout) == ErrorManagement::NoError);
+                }
+            }
+            Atomic::Decrement(&sleeping);
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} ring != NULL as otherwise the method is not called.*/
+bool RealTimeThreadSynchBroker::CopyFromRing() {
+    bool ok = true;
+    uint32 k;
+    for (k = 0u; (k < numberOfSamples) && (ok); k++) {
+        uint32 sample = (nextSample + k);
+        int32 sequence = 0;
+        const char8 *data = NULL_PTR(const char8 *);
+        ok = ring->BeginRead(sample, sequence, data);
+        if (ok) {
+            uint32 s;
+            for (s = 0u; s < numberOfDataSourceSignals; s++) {
+                /*lint -e{613} All the memory must have been successfully allocated.*/
+                if (signalMemory[s] != NULL_PTR(char8 *)) {
+                    void *destination = &signalMemory[s][k * signalSize[s]];
+                    const void *source = &data[dataSourceMemoryOffsets[s]];
+                    (void) MemoryOperationsHelper::Copy(destination, source, signalSize[s]);
+                }
+            }
+            ok = ring->EndRead(sample, sequence);
+        }
+    }
+    return ok;
+}
+
+/*lint -e{613} ring != NULL as otherwise the method is not called.*/
+void RealTimeThreadSynchBroker::SkipToLatestBatch() {
+    uint32 written = ring->GetNumberOfWrittenSamples();
+    nextSample = (((written / numberOfSamples) * numberOfSamples) - numberOfSamples);
+}
+
 const char8 * const RealTimeThreadSynchBroker::GetGAMName() {
     return gamName.Buffer();
 }
@@ -182,8 +264,33 @@ const char8 * const RealTimeThreadSynchBroker::GetGAMName() {
 bool RealTimeThreadSynchBroker::Execute() {
     bool ok = true;
    
+    if (ring != NULL_PTR(RealTimeThreadSynchRing *)) {
+        uint32 written = ring->GetNumberOfWrittenSamples();
+        if (waitForNext == 1u) {
+            //Wait for the end of the batch being written
+            nextSample = ((written / numberOfSamples) * numberOfSamples);
+        }
+        else {
+            //Lapped by the producer => the oldest samples of the batch were already overwritten
+            if ((written - nextSample) > ring->GetNumberOfSlots()) {
+                SkipToLatestBatch();
+            }
+        }
+        ok = WaitForRing(nextSample + numberOfSamples);
+        if (ok) {
+            ok = CopyFromRing();
+            if (!ok) {
+                //Overwritten while copying. The latest batch is far from the slots being written.
+                SkipToLatestBatch();
+                ok = CopyFromRing();
+            }
+        }
+        if (ok) {
+            nextSample += numberOfSamples;
+        }
+    }
     //First Reset 
-    if (waitForNext == 1u) {
+    else if (waitForNext == 1u) {
         if(mux.FastLock() == ErrorManagement::NoError) {
             ok = synchSem.Reset();
         }
@@ -34,6 +34,7 @@
 #include "DataSourceI.h"
 #include "EventSem.h"
 #include "MemoryMapInputBroker.h"
+#include "RealTimeThreadSynchRing.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -44,6 +45,10 @@ namespace MARTe {
  * @brief Input broker for the RealTimeThreadSynchronisation DataSourceI.
  * @details A MemoryMapInputBroker which will store in memory the required number of samples copies of the DataSourceI memory.
  * It will lock in Execute until the required number of samples are added by calling the AddSample method.
+ *
+ * If a RealTimeThreadSynchRing is set (see SetRing), AddSample is not used: the producer writes each sample only once into the shared ring and
+ * the broker copies its batch of samples from the ring in Execute. The broker keeps its own read cursor and only sleeps (and is only woken up by
+ * the producer, see Notify) if its batch is not yet available, or busy polls the ring if requested.
  */
 class RealTimeThreadSynchBroker : public MemoryMapInputBroker {
 public:
@@ -89,6 +94,28 @@ public:
      */
     bool AddSample();
 
+    /**
+     * @brief Reads the samples from a RealTimeThreadSynchRing (instead of AddSample).
+     * @param[in] ringIn the ring where the producer writes the samples.
+     * @param[in] busyPollIn if 1 the broker polls the ring instead of sleeping on the semaphore.
+     */
+    void SetRing(RealTimeThreadSynchRing * const ringIn,
+                 const uint8 busyPollIn);
+
+    /**
+     * @brief Wakes up the broker if it is sleeping and the samples it is waiting for are available.
+     * @details Called by the producer after writing a sample into the ring. The semaphore is only posted
+     * if the broker is sleeping, so that the producer does not pay the cost of a post for every sample.
+     * @param[in] numberOfWrittenSamples the number of samples written into the ring.
+     */
+    inline void Notify(const uint32 numberOfWrittenSamples);
+
+    /**
+     * @brief Gets the number of samples read by the GAM associated to this broker.
+     * @return the number of samples.
+     */
+    uint32 GetNumberOfSamples() const;
+
     /**
      * @brief Gets the name of the GAM interacting with the DataSourceI that uses this broker instance.
      * @return the name of the GAM interacting with the DataSourceI that uses this broker instance.
@@ -98,11 +125,30 @@ public:
     /**
      * @brief Locks until the expected number of samples is written into this broker instance (see AddSample) and then copies the samples
      * using the MemoryMapInputBroker::Execute().
+     * @details If a ring is set, the next batch of samples is read from the ring. If the broker was lapped by the producer the
+     * latest complete batch is read instead. If WaitForNext is set, the broker waits for the end of the batch being written.
      * @return true if MemoryMapInputBroker::Execute().
      */
     virtual bool Execute();
 
 private:
+    /**
+     * @brief Waits until the sample \a endSample - 1 is written into the ring.
+     * @return false if the timeout expires.
+     */
+    bool WaitForRing(const uint32 endSample);
+
+    /**
+     * @brief Copies the batch of samples starting at \a nextSample from the ring.
+     * @return false if the samples were overwritten by the producer while being copied.
+     */
+    bool CopyFromRing();
+
+    /**
+     * @brief Sets \a nextSample to the first sample of the latest complete batch.
+     */
+    void SkipToLatestBatch();
+
     /**
      * Number of signals in the DataSourceI (not all will necessarily be writing to this broker instance).
      */
@@ -167,6 +213,31 @@ private:
      * Protect the event sem
      */
     FastPollingMutexSem mux;
+
+    /**
+     * The ring where the samples are read from (NULL if the samples are added with AddSample).
+     */
+    RealTimeThreadSynchRing *ring;
+
+    /**
+     * If 1 => poll the ring instead of sleeping.
+     */
+    uint8 busyPoll;
+
+    /**
+     * The first sample of the next batch to be read from the ring.
+     */
+    uint32 nextSample;
+
+    /**
+     * The sample count that completes the batch the broker is sleeping on.
+     */
+    volatile uint32 wakeSample;
+
+    /**
+     * > 0 while the broker is sleeping on the semaphore.
+     */
+    volatile int32 sleeping;
 };
 }
 
@@ -174,6 +245,18 @@ private:
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+void RealTimeThreadSynchBroker::Notify(const uint32 numberOfWrittenSamples) {
+    if (sleeping > 0) {
+        //The difference is interpreted as signed so that the comparison remains valid after the counters wrap.
+        if (static_cast<int32>(numberOfWrittenSamples - wakeSample) >= 0) {
+            (void) synchSem.Post();
+        }
+    }
+}
+
+}
 
 #endif /* REALTIMETHREADSYNCHBROKER_H_ */
 	
@@ -0,0 +1,123 @@
+/**
+ * @file RealTimeThreadSynchRing.cpp
+ * @brief Source file for class RealTimeThreadSynchRing
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeThreadSynchRing (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "RealTimeThreadSynchRing.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+RealTimeThreadSynchRing::RealTimeThreadSynchRing() {
+    memory = NULL_PTR(char8 *);
+    slots = NULL_PTR(char8 *);
+    sampleSize = 0u;
+    slotSize = 0u;
+    numberOfSlots = 0u;
+    numberOfWrittenSamples = 0;
+}
+
+/*lint -e{1551} must free the allocated memory in the destructor. The slots point inside the memory.*/
+RealTimeThreadSynchRing::~RealTimeThreadSynchRing() {
+    if (memory != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(memory));
+    }
+    slots = NULL_PTR(char8 *);
+}
+
+bool RealTimeThreadSynchRing::Initialise(const uint32 sampleSizeIn,
+                                         const uint32 numberOfSlotsIn) {
+    bool ok = (memory == NULL_PTR(char8 *));
+    if (ok) {
+        ok = ((sampleSizeIn > 0u) && (numberOfSlotsIn > 0u));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The sample size and the number of slots shall be > 0");
+        }
+    }
+    if (ok) {
+        sampleSize = sampleSizeIn;
+        numberOfSlots = 1u;
+        while (numberOfSlots < numberOfSlotsIn) {
+            numberOfSlots *= 2u;
+        }
+        uint32 lines = ((sampleSize + (REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE - 1u)) / REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE);
+        slotSize = ((lines + 1u) * REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE);
+        uint32 memorySize = ((slotSize * numberOfSlots) + REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE);
+        memory = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(memorySize));
+        ok = (memory != NULL_PTR(char8 *));
+        if (ok) {
+            ok = MemoryOperationsHelper::Set(memory, '\0', memorySize);
+        }
+    }
+    if (ok) {
+        /*lint -e{923} -e{9091} the address is only used to compute the alignment*/
+        uintp misalignment = (reinterpret_cast<uintp>(memory) % REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE);
+        uint32 alignOffset = 0u;
+        if (misalignment != 0u) {
+            alignOffset = (REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE - static_cast<uint32>(misalignment));
+        }
+        slots = &memory[alignOffset];
+        //No slot holds a valid sample before it is written for the first time.
+        uint32 s;
+        for (s = 0u; s < numberOfSlots; s++) {
+            /*lint -e{927} -e{826} the slot starts with its header*/
+            RealTimeThreadSynchRingSlotHeader *header = reinterpret_cast<RealTimeThreadSynchRingSlotHeader *>(&slots[s * slotSize]);
+            header->sample = (s + 1u);
+        }
+        numberOfWrittenSamples = 0;
+    }
+    return ok;
+}
+
+uint32 RealTimeThreadSynchRing::GetNumberOfSlots() const {
+    return numberOfSlots;
+}
+
+void RealTimeThreadSynchRing::Write(const char8 * const source) {
+    uint32 sample = static_cast<uint32>(numberOfWrittenSamples);
+    RealTimeThreadSynchRingSlotHeader *header = GetSlotHeader(sample);
+    //Odd => the consumers will discard the slot. The atomic increments are also full memory barriers.
+    Atomic::Increment(&header->sequence);
+    /*lint -e{927} the data follows the header cache line*/
+    char8 *data = &(reinterpret_cast<char8 *>(header))[REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE];
+    (void) MemoryOperationsHelper::Copy(data, source, sampleSize);
+    header->sample = sample;
+    Atomic::Increment(&header->sequence);
+    Atomic::Increment(&numberOfWrittenSamples);
+}
+
+}
@@ -0,0 +1,212 @@
+/**
+ * @file RealTimeThreadSynchRing.h
+ * @brief Header file for class RealTimeThreadSynchRing
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeThreadSynchRing
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMETHREADSYNCHRING_H_
+#define REALTIMETHREADSYNCHRING_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "Atomic.h"
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * The size of the cache line. Each slot header is aligned to (and fills) one cache line so that the
+ * producer updating a header does not invalidate the data being read by the consumers on the neighbouring slots.
+ */
+static const uint32 REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE = 64u;
+
+/**
+ * @brief The header of each slot of the RealTimeThreadSynchRing.
+ */
+struct RealTimeThreadSynchRingSlotHeader {
+    /**
+     * Odd while the producer is writing the slot.
+     */
+    volatile int32 sequence;
+
+    /**
+     * The (wrapping) index of the sample stored in the slot.
+     */
+    volatile uint32 sample;
+};
+
+/**
+ * @brief Single-producer/multiple-consumer ring of samples used by the RealTimeThreadSynchronisation.
+ * @details Each slot holds one sample of all the signals of the DataSourceI. The producer never waits: it always writes
+ * on the slot of the oldest sample, marking it as being written (odd sequence) during the copy.
+ * The consumers keep their own read cursor and validate with BeginRead/EndRead that the slot was not
+ * overwritten while they were copying it (in which case the sample was lost because the consumer was too slow).
+ *
+ * The number of slots is a power of two so that the slot of a sample can be computed with a mask also after
+ * the 32 bit sample counter wraps.
+ */
+class RealTimeThreadSynchRing {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    RealTimeThreadSynchRing();
+
+    /**
+     * @brief Destructor. Frees the slots memory.
+     */
+    ~RealTimeThreadSynchRing();
+
+    /**
+     * @brief Allocates the slots.
+     * @param[in] sampleSizeIn the size in bytes of one sample of all the signals.
+     * @param[in] numberOfSlotsIn the minimum number of slots (rounded up to the next power of two).
+     * @return true if the parameters are > 0 and the memory could be allocated.
+     */
+    bool Initialise(const uint32 sampleSizeIn,
+                    const uint32 numberOfSlotsIn);
+
+    /**
+     * @brief Gets the number of slots.
+     * @return the number of slots.
+     */
+    uint32 GetNumberOfSlots() const;
+
+    /**
+     * @brief Copies one sample into the slot of the oldest sample and publishes it.
+     * @param[in] source the sample to be written (with size sampleSize).
+     * @pre
+     *   Initialise()
+     */
+    void Write(const char8 * const source);
+
+    /**
+     * @brief Gets the number of samples written since Initialise (wraps at 2^32).
+     * @return the number of samples written.
+     */
+    inline uint32 GetNumberOfWrittenSamples() const;
+
+    /**
+     * @brief Starts reading a sample.
+     * @param[in] sample the index of the sample to read.
+     * @param[out] sequence the sequence of the slot to be given to EndRead.
+     * @param[out] data the sample memory.
+     * @return false if the slot is being written or no longer holds \a sample.
+     */
+    inline bool BeginRead(const uint32 sample,
+                          int32 &sequence,
+                          const char8 *&data) const;
+
+    /**
+     * @brief Checks that a sample read after BeginRead was not overwritten during the copy.
+     * @param[in] sample the index of the sample read.
+     * @param[in] sequence the sequence returned by BeginRead.
+     * @return true if the copy is valid.
+     */
+    inline bool EndRead(const uint32 sample,
+                        const int32 sequence) const;
+
+private:
+
+    /**
+     * @brief Gets the header of the slot of a given sample.
+     */
+    inline RealTimeThreadSynchRingSlotHeader *GetSlotHeader(const uint32 sample) const;
+
+    /**
+     * The memory as allocated (not aligned).
+     */
+    char8 *memory;
+
+    /**
+     * The slots (aligned to REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE).
+     */
+    char8 *slots;
+
+    /**
+     * The size of one sample.
+     */
+    uint32 sampleSize;
+
+    /**
+     * The size of one slot (header line + sample rounded up to a cache line).
+     */
+    uint32 slotSize;
+
+    /**
+     * The number of slots (power of two).
+     */
+    uint32 numberOfSlots;
+
+    /**
+     * Number of samples written (the index of the next sample to be written).
+     */
+    volatile int32 numberOfWrittenSamples;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+uint32 RealTimeThreadSynchRing::GetNumberOfWrittenSamples() const {
+    return static_cast<uint32>(numberOfWrittenSamples);
+}
+
+RealTimeThreadSynchRingSlotHeader *RealTimeThreadSynchRing::GetSlotHeader(const uint32 sample) const {
+    uint32 slotIdx = (sample & (numberOfSlots - 1u));
+    /*lint -e{927} -e{826} the slot starts with its header*/
+    return reinterpret_cast<RealTimeThreadSynchRingSlotHeader *>(&slots[slotIdx * slotSize]);
+}
+
+bool RealTimeThreadSynchRing::BeginRead(const uint32 sample,
+                                        int32 &sequence,
+                                        const char8 *&data) const {
+    RealTimeThreadSynchRingSlotHeader *header = GetSlotHeader(sample);
+    sequence = header->sequence;
+    bool ok = ((sequence & 1) == 0);
+    if (ok) {
+        ok = (header->sample == sample);
+    }
+    if (ok) {
+        /*lint -e{927} the data follows the header cache line*/
+        data = &(reinterpret_cast<const char8 *>(header))[REAL_TIME_THREAD_SYNCH_RING_CACHE_LINE];
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRing::EndRead(const uint32 sample,
+                                      const int32 sequence) const {
+    const RealTimeThreadSynchRingSlotHeader *header = GetSlotHeader(sample);
+    return (header->sequence == sequence);
+}
+
+}
+
+#endif /* REALTIMETHREADSYNCHRING_H_ */
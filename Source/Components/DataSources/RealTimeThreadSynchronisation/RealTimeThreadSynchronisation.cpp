@@ -51,6 +51,9 @@ RealTimeThreadSynchronisation::RealTimeThreadSynchronisation() :
     synchInputBrokers = NULL_PTR(RealTimeThreadSynchBroker **);
     currentInitBrokerIndex = -1;
     waitForNext = 0u;
+    ringBuffer = 0u;
+    ringBufferSize = 0u;
+    busyPoll = 0u;
 }
 
 /*lint -e{1551} must free the allocated memory in the destructor. */
@@ -170,6 +173,21 @@ bool RealTimeThreadSynchronisation::Initialise(StructuredDataI & data) {
     if (!data.Read("WaitForNext", waitForNext)) {
         waitForNext = 0u;
     }
+    if (!data.Read("RingBuffer", ringBuffer)) {
+        ringBuffer = 0u;
+    }
+    if (!data.Read("RingBufferSize", ringBufferSize)) {
+        ringBufferSize = 0u;
+    }
+    if (!data.Read("BusyPoll", busyPoll)) {
+        busyPoll = 0u;
+    }
+    if ((ok) && (ringBuffer == 0u)) {
+        ok = ((ringBufferSize == 0u) && (busyPoll == 0u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "RingBufferSize and BusyPoll can only be set with RingBuffer = 1");
+        }
+    }
     return ok;
 }
 
@@ -261,6 +279,33 @@ bool RealTimeThreadSynchronisation::SetConfiguredDatabase(StructuredDataI & data
             ok = synchInputBrokers[n]->AllocateMemory(memory, memoryOffsets);
         }
     }
+    //Create the ring shared by the synchInputBrokers
+    if ((ok) && (ringBuffer == 1u) && (memorySize > 0u)) {
+        uint32 maxNumberOfSamples = 1u;
+        if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
+            for (n = 0u; n < numberOfSyncGAMs; n++) {
+                uint32 brokerSamples = synchInputBrokers[n]->GetNumberOfSamples();
+                if (brokerSamples > maxNumberOfSamples) {
+                    maxNumberOfSamples = brokerSamples;
+                }
+            }
+        }
+        if (ringBufferSize == 0u) {
+            ringBufferSize = (4u * maxNumberOfSamples);
+        }
+        ok = (ringBufferSize >= (2u * maxNumberOfSamples));
+        if (!ok) {
+            REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "The RingBufferSize shall be at least %d (twice the number of samples read by any GAM)", (2u * maxNumberOfSamples));
+        }
+        if (ok) {
+            ok = ring.Initialise(memorySize, ringBufferSize);
+        }
+        if ((ok) && (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **))) {
+            for (n = 0u; n < numberOfSyncGAMs; n++) {
+                synchInputBrokers[n]->SetRing(&ring, busyPoll);
+            }
+        }
+    }
     return ok;
 }
 
@@ -271,7 +316,16 @@ TimeoutType RealTimeThreadSynchronisation::GetSynchroniseTimeout() const {
 bool RealTimeThreadSynchronisation::Synchronise() {
     bool ok = true;
     uint32 u;
-    if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
+    if ((ringBuffer == 1u) && (ring.GetNumberOfSlots() > 0u)) {
+        ring.Write(memory);
+        if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
+            uint32 numberOfWrittenSamples = ring.GetNumberOfWrittenSamples();
+            for (u = 0u; u < numberOfSyncGAMs; u++) {
+                synchInputBrokers[u]->Notify(numberOfWrittenSamples);
+            }
+        }
+    }
+    else if (synchInputBrokers != NULL_PTR(RealTimeThreadSynchBroker **)) {
         for (u = 0u; (u < numberOfSyncGAMs) && (ok); u++) {
             ok = synchInputBrokers[u]->AddSample();
         }
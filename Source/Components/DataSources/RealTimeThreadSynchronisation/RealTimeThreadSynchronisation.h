@@ -34,6 +34,7 @@
 #include "DataSourceI.h"
 #include "EventSem.h"
 #include "RealTimeThreadSynchBroker.h"
+#include "RealTimeThreadSynchRing.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -56,6 +57,13 @@ namespace MARTe {
  * useful if cycles were lost and the thread should wait for the next synchronisation cycle. The default behaviour (WaitForNext=0) is to 
  * first wait and then reset the semaphore and, as a consequence, if the semaphore had already been posted, it will not wait.
  *
+ * If the parameter RingBuffer is set to 1, the producer writes each sample only once into a ring of samples shared by all the readers
+ * (instead of copying it into the memory of each reader and posting a semaphore for each reader). The producer never waits. Each reader keeps
+ * its own position in the ring and reads the batches of samples in order (if a reader is so late that the producer has overwritten its next
+ * batch, it jumps to the latest complete batch). A reader only sleeps if its batch is not yet available and the producer only posts the
+ * semaphore of a reader that is sleeping and whose batch is complete. If BusyPoll is set to 1 the readers poll the ring instead of sleeping
+ * (to be used by readers running on a dedicated core).
+ *
  * The configuration syntax is (names are only given as an example):
  * <pre>
  * +Functions = {"
@@ -142,6 +150,10 @@ namespace MARTe {
  *     Timeout = 1000 //Timeout in ms to wait for the thread to cycle.
  *                    //If this parameter is not set it will wait forever to be triggered and might lock a state change.
  *                    //Default is 1000
+ *     RingBuffer = 0 //Optional. Default = 0. If 1 the samples are shared with the readers using a ring of samples.
+ *     RingBufferSize = 16 //Optional. Only with RingBuffer = 1. Number of samples in the ring (rounded up to a power of two).
+ *                         //Shall be at least twice the number of samples of any reader. Default is four times the largest number of samples.
+ *     BusyPoll = 0 //Optional. Only with RingBuffer = 1. If 1 the readers poll the ring instead of sleeping.
  *   }
  * }
  * </pre>
@@ -214,8 +226,8 @@ RealTimeThreadSynchronisation    ();
             const char8 * const nextStateName);
 
     /**
-     * @brief Calls DataSourceI::Initialise.
-     * @return see DataSourceI::Initialise.
+     * @brief Calls DataSourceI::Initialise and reads the Timeout, WaitForNext, RingBuffer, RingBufferSize and BusyPoll parameters.
+     * @return see DataSourceI::Initialise and false if RingBufferSize or BusyPoll are set without RingBuffer.
      */
     virtual bool Initialise(StructuredDataI & data);
 
@@ -227,12 +239,14 @@ RealTimeThreadSynchronisation    ();
      * - The number of written samples is exactly one.
      * - The number of read samples is constant for all the signals of any given GAM (but may different between GAMs).
      * - If there is a GAM reading from this DataSourceI, then there must be a GAM writing into this DataSourceI.
+     * - With RingBuffer = 1 the RingBufferSize is at least twice the number of samples read by any GAM.
      * @return true if all the parameters are valid and the conditions above are met.
      */
     virtual bool SetConfiguredDatabase(StructuredDataI & data);
 
     /**
      * @brief Calls RealTimeThreadSynchBroker::AddSample on all the brokers.
+     * @details With RingBuffer = 1 writes the sample into the ring and calls RealTimeThreadSynchBroker::Notify on all the brokers.
      * @return true if all the AddSample calls return true.
      */
     virtual bool Synchronise();
@@ -288,6 +302,26 @@ private:
      * If 1 => first reset and then wait at the synchronisation point.
      */
     uint8 waitForNext;
+
+    /**
+     * If 1 => the samples are shared with the readers using the ring.
+     */
+    uint8 ringBuffer;
+
+    /**
+     * Number of samples in the ring (0 => computed from the number of samples of the readers).
+     */
+    uint32 ringBufferSize;
+
+    /**
+     * If 1 => the readers poll the ring instead of sleeping.
+     */
+    uint8 busyPoll;
+
+    /**
+     * The ring of samples shared with the readers.
+     */
+    RealTimeThreadSynchRing ring;
 };
 }
 
@@ -35,7 +35,6 @@
 
 #include "AdvancedErrorManagement.h"
 #include "BrokerI.h"
-#include "Endianity.h"
 #include "ErrorInformation.h"
 #include "ErrorManagement.h"
 #include "GAM.h"
@@ -323,6 +322,19 @@ bool SDNPublisher::AllocateMemory() {
             }
         }
     }
+    if (ok) {
+        if (networkByteOrder) {
+            // Compile the payload layout into runs of same-width elements
+            signalIndex = 0u;
+            if (sdnHeaderAsSignal) {
+                signalIndex = 1u;
+            }
+            //lint -e{613} payloadNumberOfElements, payloadAddresses and payloadNumberOfBits cannot be NULL in this portion of the code
+            for (; (signalIndex < nOfSignals); signalIndex++) {
+                swapPlan.AddSegment(payloadAddresses[signalIndex], payloadNumberOfBits[signalIndex], payloadNumberOfElements[signalIndex]);
+            }
+        }
+    }
     if (ok) {
         if (sdnHeaderAsSignal) {
             /*lint -e{613} header cannot be NULL in this portion of the code as otherwise ok would be false.*/
@@ -558,31 +570,7 @@ bool SDNPublisher::Synchronise() {
     if (ok) {
         if (networkByteOrder) {
             // Convert payload to network byte order
-            uint32 signalIndex = 0u;
-            if (sdnHeaderAsSignal) {
-                signalIndex = 1u;
-            }
-            //lint -e{613} payloadNumberOfElements, payloadAddresses and payloadNumberOfBits should not be NULL as otherwise Synchronise would not be called
-            for (; (signalIndex < nOfSignals); signalIndex++) {
-                if (payloadNumberOfBits[signalIndex] == 16u) {
-                    uint32 elementIndex;
-                    for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                        Endianity::ToBigEndian(reinterpret_cast<uint16 *>(payloadAddresses[signalIndex])[elementIndex]);
-                    }
-                }
-                if (payloadNumberOfBits[signalIndex] == 32u) {
-                    uint32 elementIndex;
-                    for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                        Endianity::ToBigEndian(reinterpret_cast<uint32 *>(payloadAddresses[signalIndex])[elementIndex]);
-                    }
-                }
-                if (payloadNumberOfBits[signalIndex] == 64u) {
-                    uint32 elementIndex;
-                    for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                        Endianity::ToBigEndian(reinterpret_cast<uint64 *>(payloadAddresses[signalIndex])[elementIndex]);
-                    }
-                }
-            }
+            swapPlan.Swap();
         }
     }
     if (ok) {
@@ -40,6 +40,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "DataSourceI.h"
+#include "SDNSwapPlan.h"
 
 #include "sdn-api.h" /* SDN core library - API definition (sdn::core) */
 /*Cannot include "sdn-header.h" otherwise lint gets lost in secondary includes.*/
@@ -99,7 +100,7 @@ namespace MARTe {
  *     Address = address:port // Optional - Explicit destination address
  * \b ifdef FEATURE_10840
  *     SourcePort = port // Optional - Explicit source-side port to bind to
- *     NetworkByteOrder = 1 // Optional - Enforce On-the-wire network byte ordering
+ *     NetworkByteOrder = 1 // Optional - Enforce On-the-wire network byte ordering. If 0 (default) the payload is sent in host byte order, which is flagged in the topic header so that subscribers skip any conversion
  * \b endif
  *     Signals = {
  *         Header = { //Optional. If present (i.e. if there is a signal named header) the sent packet header will be copied into this field (note that it can be later decomposed by GAMs using Ranges). It shall be the first signal.
@@ -330,6 +331,11 @@ private:
      */
     void **payloadAddresses;
 
+    /**
+     * The payload layout compiled into runs of same-width elements (only used if networkByteOrder)
+     */
+    SDNSwapPlan swapPlan;
+
     /**
      * Read the SDN header as a signal?
     */
@@ -371,6 +371,14 @@ bool SDNSubscriber::AllocateMemory() {
                 payloadAddresses[signalIndex] = topic->GetTypeDefinition()->GetAttributeReference(signalIndex);
             }
         }
+        // Compile the payload layout into runs of same-width elements (used if the payload is received in network byte order)
+        signalIndex = 0u;
+        if (sdnHeaderAsSignal) {
+            signalIndex = 1u;
+        }
+        for (; (signalIndex < nOfSignals) && (ok); signalIndex++) {
+            swapPlan.AddSegment(payloadAddresses[signalIndex], payloadNumberOfBits[signalIndex], payloadNumberOfElements[signalIndex]);
+        }
     }
 
     if (!ok) {
@@ -676,7 +684,6 @@ ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
         else {
             if (!subscriber->IsPayloadOrdered()) {
                 // Convert payload from network byte order
-                uint32 signalIndex = 0u;
                 if (sdnHeaderAsSignal) {
                     sdn::Header_t *header = static_cast<sdn::Header_t *>(payloadAddresses[0u]);
                     Endianity::FromBigEndian(header->header_size);
@@ -687,28 +694,8 @@ ErrorManagement::ErrorType SDNSubscriber::Execute(ExecutionInfo& info) {
                     Endianity::FromBigEndian(header->topic_size);
                     Endianity::FromBigEndian(header->topic_uid);
                     Endianity::FromBigEndian(header->topic_version);
-                    signalIndex = 1u;
-                }
-                for (; (signalIndex < nOfSignals); signalIndex++) {
-                    if (payloadNumberOfBits[signalIndex] == 16u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint16 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
-                    if (payloadNumberOfBits[signalIndex] == 32u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint32 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
-                    if (payloadNumberOfBits[signalIndex] == 64u) {
-                        uint32 elementIndex;
-                        for (elementIndex = 0u; (elementIndex < payloadNumberOfElements[signalIndex]); elementIndex++) {
-                            Endianity::FromBigEndian(reinterpret_cast<uint64 *>(payloadAddresses[signalIndex])[elementIndex]);
-                        }
-                    }
                 }
+                swapPlan.Swap();
             }
         }
 #endif
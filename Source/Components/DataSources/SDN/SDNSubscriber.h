@@ -47,6 +47,7 @@
 #include "DataSourceI.h"
 #include "EmbeddedServiceMethodBinderI.h"
 #include "EventSem.h"
+#include "SDNSwapPlan.h"
 #include "SingleThreadService.h"
 
 /*Cannot include "sdn-header.h" otherwise lint gets lost in secondary includes.*/
@@ -358,6 +359,11 @@ private:
      */
     void **payloadAddresses;
 
+    /**
+     * The payload layout compiled into runs of same-width elements (used if the payload is not received in host byte order)
+     */
+    SDNSwapPlan swapPlan;
+
     /**
      * Read the SDN header as a signal?
     */
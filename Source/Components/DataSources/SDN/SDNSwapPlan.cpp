@@ -0,0 +1,179 @@
+/**
+ * @file SDNSwapPlan.cpp
+ * @brief Source file for class SDNSwapPlan
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This source file contains the definition of all the methods for
+ * the class SDNSwapPlan (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Endianity.h"
+#include "SDNSwapPlan.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace {
+
+/**
+ * @brief Swaps the bytes of numberOfElements 16 bit elements.
+ */
+void SDNSwapRun16(MARTe::uint16 * const data,
+                  const MARTe::uint32 numberOfElements) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        const uint16 x = data[i];
+        data[i] = static_cast<uint16>((x >> 8u) | (x << 8u));
+    }
+}
+
+/**
+ * @brief Swaps the bytes of numberOfElements 32 bit elements.
+ */
+void SDNSwapRun32(MARTe::uint32 * const data,
+                  const MARTe::uint32 numberOfElements) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        const uint32 x = data[i];
+        data[i] = ((x >> 24u) | ((x >> 8u) & 0x0000FF00u) | ((x << 8u) & 0x00FF0000u) | (x << 24u));
+    }
+}
+
+/**
+ * @brief Swaps the bytes of numberOfElements 64 bit elements.
+ */
+void SDNSwapRun64(MARTe::uint64 * const data,
+                  const MARTe::uint32 numberOfElements) {
+    using namespace MARTe;
+    uint32 i;
+    for (i = 0u; i < numberOfElements; i++) {
+        uint64 x = data[i];
+        x = ((x >> 32u) | (x << 32u));
+        x = (((x & 0xFFFF0000FFFF0000ULL) >> 16u) | ((x & 0x0000FFFF0000FFFFULL) << 16u));
+        x = (((x & 0xFF00FF00FF00FF00ULL) >> 8u) | ((x & 0x00FF00FF00FF00FFULL) << 8u));
+        data[i] = x;
+    }
+}
+
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+SDNSwapPlan::SDNSwapPlan() {
+    runs = NULL_PTR(SDNSwapRun *);
+    numberOfRuns = 0u;
+    uint16 probe = 0x0102u;
+    Endianity::ToBigEndian(probe);
+    hostIsBigEndian = (probe == 0x0102u);
+}
+
+SDNSwapPlan::~SDNSwapPlan() {
+    if (runs != NULL_PTR(SDNSwapRun *)) {
+        delete[] runs;
+    }
+}
+
+void SDNSwapPlan::AddSegment(void * const address,
+                             const uint16 numberOfBits,
+                             const uint32 numberOfElements) {
+    bool add = (!hostIsBigEndian);
+    if (add) {
+        add = (((numberOfBits == 16u) || (numberOfBits == 32u) || (numberOfBits == 64u)) && (numberOfElements > 0u));
+    }
+    if (add) {
+        bool merged = false;
+        if (numberOfRuns > 0u) {
+            /*lint -e{613} runs cannot be NULL as numberOfRuns > 0*/
+            SDNSwapRun &last = runs[numberOfRuns - 1u];
+            if (last.numberOfBits == numberOfBits) {
+                uint32 lastSize = last.numberOfElements * (static_cast<uint32>(numberOfBits) / 8u);
+                /*lint -e{9016} -e{927} pointer arithmetic required to check that the segments are contiguous*/
+                const char8 * const lastEnd = &(reinterpret_cast<char8 *>(last.address)[lastSize]);
+                merged = (lastEnd == reinterpret_cast<char8 *>(address));
+                if (merged) {
+                    last.numberOfElements += numberOfElements;
+                }
+            }
+        }
+        if (!merged) {
+            uint32 numberOfRunsP1 = (numberOfRuns + 1u);
+            SDNSwapRun *newRuns = new SDNSwapRun[numberOfRunsP1];
+            uint32 r;
+            for (r = 0u; r < numberOfRuns; r++) {
+                /*lint -e{613} runs cannot be NULL as numberOfRuns > 0*/
+                newRuns[r] = runs[r];
+            }
+            if (runs != NULL_PTR(SDNSwapRun *)) {
+                delete[] runs;
+            }
+            runs = newRuns;
+            runs[numberOfRuns].address = address;
+            runs[numberOfRuns].numberOfBits = numberOfBits;
+            runs[numberOfRuns].numberOfElements = numberOfElements;
+            numberOfRuns = numberOfRunsP1;
+        }
+    }
+}
+
+void SDNSwapPlan::Swap() const {
+    uint32 r;
+    for (r = 0u; r < numberOfRuns; r++) {
+        /*lint -e{613} runs cannot be NULL as numberOfRuns > 0*/
+        const SDNSwapRun &run = runs[r];
+        /*lint -e{925} the address was given with elements of numberOfBits width*/
+        if (run.numberOfBits == 16u) {
+            SDNSwapRun16(reinterpret_cast<uint16 *>(run.address), run.numberOfElements);
+        }
+        else if (run.numberOfBits == 32u) {
+            SDNSwapRun32(reinterpret_cast<uint32 *>(run.address), run.numberOfElements);
+        }
+        else {
+            SDNSwapRun64(reinterpret_cast<uint64 *>(run.address), run.numberOfElements);
+        }
+    }
+}
+
+uint32 SDNSwapPlan::GetNumberOfRuns() const {
+    return numberOfRuns;
+}
+
+uint32 SDNSwapPlan::GetNumberOfElements() const {
+    uint32 numberOfElements = 0u;
+    uint32 r;
+    for (r = 0u; r < numberOfRuns; r++) {
+        /*lint -e{613} runs cannot be NULL as numberOfRuns > 0*/
+        numberOfElements += runs[r].numberOfElements;
+    }
+    return numberOfElements;
+}
+
+}
+/* namespace MARTe */
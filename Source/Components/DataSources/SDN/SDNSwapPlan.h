@@ -0,0 +1,138 @@
+/**
+ * @file SDNSwapPlan.h
+ * @brief Header file for class SDNSwapPlan
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class SDNSwapPlan
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SDNSWAPPLAN_H_
+#define SDNSWAPPLAN_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "CompilerTypes.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief A contiguous run of elements with the same width.
+ */
+struct SDNSwapRun {
+    /**
+     * Address of the first element.
+     */
+    void *address;
+
+    /**
+     * Number of elements in the run.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Width of each element in bits (16, 32 or 64).
+     */
+    uint16 numberOfBits;
+};
+
+/**
+ * @brief Precompiled byte-order conversion of an SDN payload.
+ * @details The payload layout is described once (typically in AllocateMemory) with AddSegment, one call for each signal.
+ * Adjacent segments with the same element width are merged into a single run, so that Swap converts the whole payload with one
+ * tight loop per run instead of branching on the type of every signal. The loops are written with plain shifts and masks which the compiler
+ * recognises as byte swaps and vectorises.
+ *
+ * The conversion is between the host order and the network (big endian) order. As such it is its own inverse and it is
+ * used both to convert to (SDNPublisher) and from (SDNSubscriber) the network order. On big endian hosts no run is ever added and Swap is a NOOP.
+ */
+class SDNSwapPlan {
+public:
+    /**
+     * @brief Constructor. Detects the host byte order. The plan is created empty.
+     */
+    SDNSwapPlan();
+
+    /**
+     * @brief Destructor. Frees the runs.
+     */
+    ~SDNSwapPlan();
+
+    /**
+     * @brief Adds a segment of the payload to the plan.
+     * @details Segments with elements of 8 bits (or of an unsupported width) or with no elements do not require any conversion and are ignored.
+     * The segment is merged with the last run if it has the same width and starts where the last run ends.
+     * @param[in] address the address of the first element of the segment.
+     * @param[in] numberOfBits the width of each element.
+     * @param[in] numberOfElements the number of elements in the segment.
+     */
+    void AddSegment(void * const address,
+                    const uint16 numberOfBits,
+                    const uint32 numberOfElements);
+
+    /**
+     * @brief Converts, in place, all the runs between the host and the network byte order.
+     */
+    void Swap() const;
+
+    /**
+     * @brief Gets the number of runs in the plan.
+     * @return the number of runs in the plan.
+     */
+    uint32 GetNumberOfRuns() const;
+
+    /**
+     * @brief Gets the total number of elements converted by Swap.
+     * @return the total number of elements converted by Swap.
+     */
+    uint32 GetNumberOfElements() const;
+
+private:
+
+    /**
+     * The runs.
+     */
+    SDNSwapRun *runs;
+
+    /**
+     * The number of runs.
+     */
+    uint32 numberOfRuns;
+
+    /**
+     * True if the host is big endian (i.e. no conversion is required).
+     */
+    bool hostIsBigEndian;
+};
+
+}
+/* namespace MARTe */
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SDNSWAPPLAN_H_ */
+
@@ -45,19 +45,29 @@ namespace MARTe {
 
 CRCGAM::CRCGAM() :
         GAM() {
-    inputData = NULL_PTR(uint8 *);
-    outputData = NULL_PTR(void *);
+    inputData = NULL_PTR(uint8 **);
+    outputData = NULL_PTR(void **);
+    inputSize = NULL_PTR(uint32 *);
+    numberOfCRCs = 0u;
     crcHelper = NULL_PTR(CRCHelper *);
     polynomial = 0x0u;
     initialCRCValue = 0x0u;
     isReflected = 0u;
-    inputSize = 0u;
 }
 
 CRCGAM::~CRCGAM() {
-    inputData = NULL_PTR(uint8 *);
-    outputData = NULL_PTR(void *);
-    crcHelper = NULL_PTR(CRCHelper *);
+    if (inputData != NULL_PTR(uint8 **)) {
+        delete[] inputData;
+    }
+    if (outputData != NULL_PTR(void **)) {
+        delete[] outputData;
+    }
+    if (inputSize != NULL_PTR(uint32 *)) {
+        delete[] inputSize;
+    }
+    if (crcHelper != NULL_PTR(CRCHelper *)) {
+        delete crcHelper;
+    }
 }
 
 bool CRCGAM::Initialise(StructuredDataI &data) {
@@ -99,19 +109,30 @@ bool CRCGAM::Setup() {
         REPORT_ERROR(ErrorManagement::InitialisationError, "CRCGAM must have at least 1 input signal.");
         ok = false;
     }
-    //The number of Output signals must be equal to 1.
+    //The number of Output signals must be equal to 1 or to the number of input signals.
     if (ok) {
         uint32 nOutputSignals;
         nOutputSignals = GetNumberOfOutputSignals();
-        if (nOutputSignals != 1u) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "nOutputSignals must be one. The current values is %u", nOutputSignals);
+        if ((nOutputSignals != 1u) && (nOutputSignals != nInputSignals)) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "nOutputSignals must be one or equal to the number of input signals (%u). The current values is %u", nInputSignals, nOutputSignals);
             ok = false;
         }
+        else {
+            numberOfCRCs = nOutputSignals;
+            inputData = new uint8 *[numberOfCRCs];
+            outputData = new void *[numberOfCRCs];
+            inputSize = new uint32[numberOfCRCs];
+            for (uint32 n = 0u; n < numberOfCRCs; n++) {
+                inputData[n] = NULL_PTR(uint8 *);
+                outputData[n] = NULL_PTR(void *);
+                inputSize[n] = 0u;
+            }
+        }
     }
     //The inputSize must be taken from InputSignals
     if (ok) {
         uint32 n;
-        for (n = 0u; (n < GetNumberOfInputSignals()) && (ok); n++) {
+        for (n = 0u; (n < nInputSignals) && (ok); n++) {
             uint32 inByteSize = 0u;
             uint32 inSamples = 1u;
             ok = GetSignalByteSize(InputSignals, n, inByteSize);
@@ -123,7 +144,13 @@ bool CRCGAM::Setup() {
             }
             if (ok) {
                 inByteSize *= inSamples;
-                inputSize += inByteSize;
+                //With one CRC the input signals are concatenated, otherwise there is one CRC per input signal
+                if (numberOfCRCs == 1u) {
+                    inputSize[0u] += inByteSize;
+                }
+                else {
+                    inputSize[n] = inByteSize;
+                }
             }
             else {
                 REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting Signal number of samples from InputSignals.");
@@ -135,21 +162,12 @@ bool CRCGAM::Setup() {
         outputSignalType = GetSignalType(OutputSignals, 0u);
         if (outputSignalType == UnsignedInteger8Bit) {
             crcHelper = new CRCHelperT<uint8>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint8*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger16Bit) {
             crcHelper = new CRCHelperT<uint16>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint16*>(GetOutputSignalMemory(0u));
         }
         else if (outputSignalType == UnsignedInteger32Bit) {
             crcHelper = new CRCHelperT<uint32>();
-            crcHelper->ComputeTable(&polynomial);
-            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
-            outputData = reinterpret_cast<uint32*>(GetOutputSignalMemory(0u));
         }
         else {
             const char8 * const outputSignalTypeStr = TypeDescriptor::GetTypeNameFromTypeDescriptor(outputSignalType);
@@ -158,9 +176,31 @@ bool CRCGAM::Setup() {
                          outputSignalTypeStr);
             ok = false;
         }
+        if (ok) {
+            crcHelper->ComputeTable(&polynomial);
+            REPORT_ERROR(ErrorManagement::Information, "Table computed!");
+        }
     }
+    //All the outputs must have the same type
     if (ok) {
-        inputData = reinterpret_cast<uint8*>(GetInputSignalsMemory());
+        for (uint32 n = 1u; (n < numberOfCRCs) && (ok); n++) {
+            ok = (GetSignalType(OutputSignals, n) == outputSignalType);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "All the output signals must have the same type.");
+            }
+        }
+    }
+    if (ok) {
+        if (numberOfCRCs == 1u) {
+            inputData[0u] = reinterpret_cast<uint8*>(GetInputSignalsMemory());
+            outputData[0u] = GetOutputSignalMemory(0u);
+        }
+        else {
+            for (uint32 n = 0u; n < numberOfCRCs; n++) {
+                inputData[n] = reinterpret_cast<uint8*>(GetInputSignalMemory(n));
+                outputData[n] = GetOutputSignalMemory(n);
+            }
+        }
     }
     if (!ok) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error during GAM Setup.");
@@ -176,7 +216,9 @@ bool CRCGAM::Execute() {
     }
 
     if (crcHelper != NULL_PTR(CRCHelper *)) {
-        crcHelper->Compute(inputData, static_cast<int32>(inputSize), &initialCRCValue, inv, outputData);
+        for (uint32 n = 0u; n < numberOfCRCs; n++) {
+            crcHelper->Compute(inputData[n], static_cast<int32>(inputSize[n]), &initialCRCValue, inv, outputData[n]);
+        }
     }
 
     return true;
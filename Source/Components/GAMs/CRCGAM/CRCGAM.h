@@ -52,7 +52,11 @@ namespace MARTe {
  * - The initial CRC value.
  * - The Inverted option: 1 is you want the CRC checksum reflected, 0 otherwise.
  *
- * The number of OutputSignals must be equal to 1.
+ * The number of OutputSignals must be equal to 1 or to the number of InputSignals. With one OutputSignal the CRC is computed over
+ * the memory of all the InputSignals (concatenated). Otherwise, one CRC is computed for each InputSignal and written in the
+ * corresponding OutputSignal (all the OutputSignals must have the same type).
+ *
+ * The CRC is computed with the slicing-by-8 algorithm (see CRCHelperT), which processes eight bytes per iteration.
  *
  * The configuration syntax is (names and signal quantities are only given as an example):
  * <pre>
@@ -101,27 +105,37 @@ CRCGAM    ();
      * @details Retrieves byte size of input signals, computes the table from the polynomial and checks that the rules below are met.
      * @return true if all the preconditions are met.
      * @pre
-     *     GetNumberOfOutputSignals() == 1 &&
-     *     GetSignalType(OutputSignals, 0u) == uint8 or uint16 or uint32
+     *     (GetNumberOfOutputSignals() == 1 || GetNumberOfOutputSignals() == GetNumberOfInputSignals()) &&
+     *     GetSignalType(OutputSignals, *) == uint8 or uint16 or uint32
      */
     virtual bool Setup();
 
     /**
-     * @brief Computes the CRC checksum from the stored data.
+     * @brief Computes the CRC checksum(s) from the stored data.
      */
     virtual bool Execute();
 
 private:
 
     /**
-     * Memory of the CRCGAM input signals.
+     * Memory of the input data of each CRC.
      */
-    uint8 * inputData;
+    uint8 ** inputData;
 
     /**
      * Memory of the CRCGAM output signals.
      */
-    void * outputData;
+    void ** outputData;
+
+    /**
+     * Byte size of the input data of each CRC.
+     */
+    uint32 * inputSize;
+
+    /**
+     * Number of CRCs computed (1 or the number of input signals).
+     */
+    uint32 numberOfCRCs;
 
     /**
      * The CRCHelper for type independent CRC computation.
@@ -138,11 +152,6 @@ private:
      */
     uint32 initialCRCValue;
 
-    /**
-     * Byte size of InputSignals.
-     */
-    uint32 inputSize;
-
     /**
      * TypeDescriptor for the out signal type.
      */
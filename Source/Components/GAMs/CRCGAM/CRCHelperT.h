@@ -41,6 +41,11 @@
 namespace MARTe {
 /**
  * @brief Helper class to compute the CRC using different templates.
+ * @details The (non-inverted) CRC is computed with the slicing-by-8 algorithm: ComputeTable() precomputes eight
+ * lookup tables (table k gives the contribution of a byte followed by k zero bytes) so that eight input bytes are
+ * processed with eight independent lookups per iteration, instead of eight dependent lookups. The remaining bytes
+ * (size % 8) are processed one byte at a time with the first table.
+ * The inverted computation (see CRCHelper::Compute) is delegated to the MARTe CRC class.
  */
 template <typename T>
 class CRCHelperT : public CRCHelper {
@@ -54,7 +59,7 @@ public:
 
     /**
      * @see CRCHelper::ComputeTable
-     * @details A cast to the declared output type is performed.
+     * @details A cast to the declared output type is performed. Computes the eight slicing tables.
      */
     virtual void ComputeTable(void * const pol);
 
@@ -70,6 +75,11 @@ private:
      * CRC template class.
      */
     CRC<T> crc;
+
+    /**
+     * The slicing-by-8 lookup tables. tables[0] is the standard byte-at-a-time table.
+     */
+    T tables[8u][256u];
 };
 }
 
@@ -81,12 +91,71 @@ namespace MARTe {
 /*lint -esym(9107, MARTe::CRCHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
 template<typename T>
 void CRCHelperT<T>::ComputeTable(void * const pol) {
-    crc.ComputeTable(*static_cast<T*>(pol));
+    T polynomial = *static_cast<T*>(pol);
+    crc.ComputeTable(polynomial);
+
+    const uint32 nBits = static_cast<uint32>(sizeof(T)) * 8u;
+    const uint32 topBit = (1u << (nBits - 1u));
+    for (uint32 i = 0u; i < 256u; i++) {
+        uint32 remainder = (i << (nBits - 8u));
+        for (uint32 bit = 0u; bit < 8u; bit++) {
+            if ((remainder & topBit) != 0u) {
+                remainder = ((remainder << 1u) ^ static_cast<uint32>(polynomial));
+            }
+            else {
+                remainder = (remainder << 1u);
+            }
+        }
+        tables[0u][i] = static_cast<T>(remainder);
+    }
+    for (uint32 k = 1u; k < 8u; k++) {
+        for (uint32 i = 0u; i < 256u; i++) {
+            uint32 previous = static_cast<uint32>(tables[k - 1u][i]);
+            uint32 index = ((previous >> (nBits - 8u)) & 0xFFu);
+            //For nBits = 8 all the previous bits are shifted out
+            uint32 shifted = ((nBits > 8u) ? (previous << 8u) : 0u);
+            tables[k][i] = static_cast<T>(shifted ^ static_cast<uint32>(tables[0u][index]));
+        }
+    }
 }
 
 template<typename T>
 void CRCHelperT<T>::Compute(const uint8 * const data, int32 const size, void * const initCRC, bool const inputInverted, void * const retVal) {
-    T crcValue = crc.Compute(data, size, *static_cast<T*>(initCRC), inputInverted);
+    T crcValue = *static_cast<T*>(initCRC);
+    if (inputInverted) {
+        crcValue = crc.Compute(data, size, crcValue, inputInverted);
+    }
+    else {
+        const uint32 nBits = static_cast<uint32>(sizeof(T)) * 8u;
+        uint32 crcBits = static_cast<uint32>(crcValue);
+        uint32 n = 0u;
+        uint32 nBytes = 0u;
+        if (size > 0) {
+            nBytes = static_cast<uint32>(size);
+        }
+        while ((n + 8u) <= nBytes) {
+            //The CRC register is aligned with the first (most significant first) bytes of the block
+            uint32 aligned = (crcBits << (32u - nBits));
+            uint32 b0 = (static_cast<uint32>(data[n]) ^ (aligned >> 24u));
+            uint32 b1 = (static_cast<uint32>(data[n + 1u]) ^ ((aligned >> 16u) & 0xFFu));
+            uint32 b2 = (static_cast<uint32>(data[n + 2u]) ^ ((aligned >> 8u) & 0xFFu));
+            uint32 b3 = (static_cast<uint32>(data[n + 3u]) ^ (aligned & 0xFFu));
+            crcBits = static_cast<uint32>(tables[7u][b0]) ^ static_cast<uint32>(tables[6u][b1]) ^ static_cast<uint32>(tables[5u][b2])
+                    ^ static_cast<uint32>(tables[4u][b3]) ^ static_cast<uint32>(tables[3u][data[n + 4u]]) ^ static_cast<uint32>(tables[2u][data[n + 5u]])
+                    ^ static_cast<uint32>(tables[1u][data[n + 6u]]) ^ static_cast<uint32>(tables[0u][data[n + 7u]]);
+            n += 8u;
+        }
+        while (n < nBytes) {
+            uint32 index = ((static_cast<uint32>(data[n]) ^ (crcBits >> (nBits - 8u))) & 0xFFu);
+            uint32 shifted = ((nBits > 8u) ? (crcBits << 8u) : 0u);
+            crcBits = (static_cast<uint32>(tables[0u][index]) ^ shifted);
+            if (nBits < 32u) {
+                crcBits &= ((1u << nBits) - 1u);
+            }
+            n++;
+        }
+        crcValue = static_cast<T>(crcBits);
+    }
     if (retVal != NULL_PTR(void *)) {
         *static_cast<T*>(retVal) = crcValue;
     }
@@ -95,4 +164,3 @@ void CRCHelperT<T>::Compute(const uint8 * const data, int32 const size, void * c
 }
 
 #endif /* SOURCE_COMPONENTS_GAMS_CRCGAM_CRCHELPERT_H_ */
-
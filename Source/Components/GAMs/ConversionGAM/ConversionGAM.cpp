@@ -497,9 +497,13 @@ bool ConversionGAM::Setup() {
                     ret = cdb.MoveRelative(signalName.Buffer());
 
                     if (ret) {
-                        if (conversionHelpers[idx]->LoadGain(cdb)) {
-                            REPORT_ERROR(ErrorManagement::ParametersError, "Gain set for conversion %d", idx);
+                        //Selects the kernel for this (input, output, gain, offset, saturation, rounding) combination.
+                        ret = conversionHelpers[idx]->LoadParameters(cdb);
+                        if (!ret) {
+                            REPORT_ERROR(ErrorManagement::ParametersError, "Invalid conversion parameters for signal %s", signalName.Buffer());
                         }
+                    }
+                    if (ret) {
                         ret = cdb.MoveToAncestor(1u);
                     }
                 }
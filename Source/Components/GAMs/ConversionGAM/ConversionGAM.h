@@ -41,10 +41,17 @@ namespace MARTe {
 /**
  * @brief GAM which allows to convert between different signal types.
  *
- * @details This GAM converts and copies the input signals to the output signals. A gain can
- * also be specified so that outputSignal[i] = gain[i] * inputSignal[i], where i is the input signal index (see GetNumberOfInputSignals()).
+ * @details This GAM converts and copies the input signals to the output signals. A gain and an offset can
+ * also be specified so that outputSignal[i] = gain[i] * inputSignal[i] + offset[i], where i is the input signal index (see GetNumberOfInputSignals()).
  * If the signal is an array (or has more than one sample), this operation is applied to each element/sample.
  *
+ * When converting from a floating point to an integer type, the output can optionally be saturated to the range of the output type (Saturate = 1)
+ * and rounded to the nearest integer (Rounding = Nearest, the default being Truncate). In this case the gain and the offset are applied
+ * in the floating point precision of the input, before the rounding and the saturation.
+ *
+ * The conversion kernel of each signal is selected in Setup for its (input type, output type, gain, offset, saturation, rounding) combination,
+ * so that Execute does not take any per-element decision (see ConversionHelperT).
+ *
  * The number of input and output signals shall be the same, i.e. GetNumberOfInputSignals() == GetNumberOfOutputSignals().
  *
  * For each input signal, the number of elements multiplied by the number of samples shall be the
@@ -66,6 +73,10 @@ namespace MARTe {
  *             DataSource = "Drv2"
  *             Type = int16
  *         }
+ *         Signal3 = {
+ *             DataSource = "Drv2"
+ *             Type = float32
+ *         }
  *     }
  *     OutputSignals = {
  *         Signal1 = {
@@ -73,11 +84,19 @@ namespace MARTe {
  *             Type = float32
  *             Elements = 200
  *             Gain = 3
+ *             Offset = -1.5//Optional
  *         }
  *         Signal2 = {
  *             DataSource = "LCD"
  *             Type = int32
  *         }
+ *         Signal3 = {
+ *             DataSource = "LCD"
+ *             Type = int16
+ *             Gain = 100//Optional
+ *             Saturate = 1//Optional. Only from floating point to integer.
+ *             Rounding = Nearest//Optional. Truncate or Nearest. Only from floating point to integer.
+ *         }
  *     }
  * }
  * </pre>
@@ -111,7 +130,7 @@ ConversionGAM    ();
 
     /**
      * @brief see GAM::Initialise.
-     * @details Stores the GAM configuration in order to read the Gain of each OutputSignal
+     * @details Stores the GAM configuration in order to read the Gain, Offset, Saturate and Rounding of each OutputSignal
      */
     virtual bool Initialise(StructuredDataI & data);
 
@@ -59,6 +59,7 @@ public:
     /**
      * @brief To be specialised by ConversionHelperT, for all the supported data types.
      * @details Converts all the signal elements and samples from the input type to the output type (set in the ConversionHelperT template).
+     * The kernel used for the conversion is selected by LoadGain/LoadParameters, so that no decision is taken for each element.
      */
     virtual void Convert() = 0;
 
@@ -69,6 +70,13 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data) = 0;
 
+    /**
+     * @brief Reads the Gain, Offset, Saturate and Rounding parameters and selects the conversion kernel.
+     * @param data where to read the parameters from.
+     * @return true if the parameters are valid for the input and output types (see ConversionHelperT::LoadParameters).
+     */
+    virtual bool LoadParameters(StructuredDataI &data) = 0;
+
     /**
      * @brief Gets a pointer to input signal memory.
      * @return a pointer to input signal memory.
@@ -21,6 +21,7 @@
  * definitions for inline methods which need to be visible to the compiler.
  */
 
+
 #ifndef CONVERSIONHELPERT_H_
 #define CONVERSIONHELPERT_H_
 
@@ -31,8 +32,11 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "StreamString.h"
 #include "StructuredDataI.h"
 #include "ConversionHelper.h"
+#include "TypeCharacteristics.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -40,6 +44,10 @@
 namespace MARTe {
 /**
  * @brief Support class for the ConversionGAM. One instance for each input signal is to be allocated.
+ * @details The conversion kernel is selected once, when the parameters are loaded, for the combination of
+ * (input type, output type, gain?, offset?, saturation?, rounding?). Each kernel is a single branch-free loop over all the
+ * elements and samples of the signal (which are contiguous in memory), so that the compiler is able to vectorise the common
+ * integer to floating point conversions (e.g. int16/int32 ADC counts to float32/float64 engineering units).
  */
 /*lint -esym(9107, MARTe::ConversionHelperT*) [MISRA C++ Rule 3-1-1]. Justification: Required for template implementation.
  * No code is actually being generated and the header files can be included in multiple unit files.*/
@@ -67,7 +75,62 @@ public:
      */
     virtual bool LoadGain(StructuredDataI &data);
 
+    /**
+     * @see ConversionHelper::LoadParameters.
+     * @details Reads the following (optional) parameters:
+     *  - Gain: the gain (of type outputType) that multiplies the input signal.
+     *  - Offset: the offset (of type outputType) that is added after the gain.
+     *  - Saturate: if 1, the values outside of the range of the outputType are clamped to the minimum/maximum of the outputType (NaN is converted to 0).
+     *  - Rounding: Truncate (default) or Nearest (rounds half away from zero).
+     *
+     * Saturate and Rounding are only allowed when converting from a floating point to an integer type. In that case the Gain and the Offset are
+     * applied in the input type precision, before the rounding and the saturation, i.e. output = saturate(round(Gain * input + Offset)).
+     * Otherwise output = Gain * static_cast<outputType>(input) + Offset.
+     * @return false if Saturate or Rounding are set for a conversion which is not from floating point to integer, or if Rounding is not valid.
+     */
+    virtual bool LoadParameters(StructuredDataI &data);
+
 private:
+    /**
+     * The signature of the conversion kernels.
+     */
+    typedef void (ConversionHelperT<inputType, outputType>::*ConversionKernel)(const inputType * const src,
+                                                                               outputType * const dest,
+                                                                               const uint32 size) const;
+
+    /**
+     * @brief Selects the kernel for the loaded parameters.
+     */
+    void SelectKernel();
+
+    /**
+     * @brief Selects the floating point to integer kernel with the given gain and offset options.
+     */
+    template<bool hasGain, bool hasOffset>
+    ConversionKernel GetFloatToIntegerKernel() const;
+
+    /**
+     * @brief Converts dest[i] = gain * static_cast<outputType>(src[i]) + offset (the gain and the offset only if hasGain and hasOffset).
+     */
+    template<bool hasGain, bool hasOffset>
+    void ScaleKernel(const inputType * const src,
+                     outputType * const dest,
+                     const uint32 size) const;
+
+    /**
+     * @brief Converts dest[i] = saturate(round(gain * src[i] + offset)) computed in the inputType (floating point) precision.
+     */
+    template<bool hasGain, bool hasOffset, bool saturate, bool roundNearest>
+    void FloatToIntegerKernel(const inputType * const src,
+                              outputType * const dest,
+                              const uint32 size) const;
+
+    /**
+     * @brief Returns true if the type T is a floating point type.
+     */
+    template<typename T>
+    static inline bool IsFloat();
+
     /**
      * True if the Gain parameter was defined.
      */
@@ -77,6 +140,31 @@ private:
      * The gain that is used to scale the input signal.
      */
     outputType gain;
+
+    /**
+     * True if the Offset parameter was defined.
+     */
+    bool offsetDefined;
+
+    /**
+     * The offset that is added to the (scaled) input signal.
+     */
+    outputType offset;
+
+    /**
+     * True if the output is to be saturated to the range of the outputType.
+     */
+    bool saturate;
+
+    /**
+     * True if the output is to be rounded to the nearest integer (instead of truncated).
+     */
+    bool roundNearest;
+
+    /**
+     * The kernel selected for the loaded parameters.
+     */
+    ConversionKernel kernel;
     /*lint -e{1712} This class does not have a default constructor because
      * the inputMemory and the outputMemory must be defined on construction and both remain constant
      * during the object's lifetime*/
@@ -94,6 +182,12 @@ ConversionHelperT<inputType, outputType>::ConversionHelperT(
     gainDefined = false;
     /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the gain will depend on the outputType.*/
     gain = static_cast<outputType>(0);
+    offsetDefined = false;
+    /*lint -e{9117} [MISRA C++ Rule 5-0-4]. Justification: the type of the offset will depend on the outputType.*/
+    offset = static_cast<outputType>(0);
+    saturate = false;
+    roundNearest = false;
+    SelectKernel();
 }
 
 template<typename inputType, typename outputType>
@@ -101,37 +195,223 @@ ConversionHelperT<inputType, outputType>::~ConversionHelperT() {
 
 }
 
+template<typename inputType, typename outputType>
+template<typename T>
+bool ConversionHelperT<inputType, outputType>::IsFloat() {
+    /*lint -e{9117} -e{747} [MISRA C++ Rule 5-0-4]. Justification: the truncation is what identifies the integer types.*/
+    return (static_cast<T>(0.5) != static_cast<T>(0));
+}
+
 template<typename inputType, typename outputType>
 bool ConversionHelperT<inputType, outputType>::LoadGain(StructuredDataI &data) {
     gainDefined = data.Read("Gain", gain);
+    SelectKernel();
     return gainDefined;
 }
 
 template<typename inputType, typename outputType>
-void ConversionHelperT<inputType, outputType>::Convert() {
-    uint32 s;
-    uint32 n;
-    uint32 idx;
-    outputType *dest = reinterpret_cast<outputType *>(outputMemory);
-    const inputType *src = reinterpret_cast<const inputType *>(inputMemory);
-    if ((dest != NULL) && (src != NULL)) {
-        for (s = 0u; s < numberOfSamples; s++) {
-            for (n = 0u; n < numberOfElements; n++) {
-                idx = s * numberOfElements;
-                idx += n;
-                if (gainDefined) {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = gain * static_cast<outputType>(src[idx]);
+bool ConversionHelperT<inputType, outputType>::LoadParameters(StructuredDataI &data) {
+    gainDefined = data.Read("Gain", gain);
+    offsetDefined = data.Read("Offset", offset);
+    uint32 saturateIn = 0u;
+    if (!data.Read("Saturate", saturateIn)) {
+        saturateIn = 0u;
+    }
+    saturate = (saturateIn == 1u);
+    StreamString rounding;
+    if (!data.Read("Rounding", rounding)) {
+        rounding = "Truncate";
+    }
+    bool ok = true;
+    if (rounding == "Nearest") {
+        roundNearest = true;
+    }
+    else if (rounding == "Truncate") {
+        roundNearest = false;
+    }
+    else {
+        REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Unsupported Rounding %s. Shall be Truncate or Nearest", rounding.Buffer());
+        ok = false;
+    }
+    if (ok) {
+        if ((saturate) || (roundNearest)) {
+            ok = ((IsFloat<inputType>()) && (!IsFloat<outputType>()));
+            if (!ok) {
+                REPORT_ERROR_STATIC(ErrorManagement::ParametersError, "Saturate and Rounding = Nearest are only supported from floating point to integer types");
+            }
+        }
+    }
+    SelectKernel();
+    return ok;
+}
+
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::SelectKernel() {
+    if ((saturate) || (roundNearest)) {
+        if (gainDefined) {
+            if (offsetDefined) {
+                kernel = GetFloatToIntegerKernel<true, true>();
+            }
+            else {
+                kernel = GetFloatToIntegerKernel<true, false>();
+            }
+        }
+        else {
+            if (offsetDefined) {
+                kernel = GetFloatToIntegerKernel<false, true>();
+            }
+            else {
+                kernel = GetFloatToIntegerKernel<false, false>();
+            }
+        }
+    }
+    else {
+        if (gainDefined) {
+            if (offsetDefined) {
+                kernel = &ConversionHelperT<inputType, outputType>::template ScaleKernel<true, true>;
+            }
+            else {
+                kernel = &ConversionHelperT<inputType, outputType>::template ScaleKernel<true, false>;
+            }
+        }
+        else {
+            if (offsetDefined) {
+                kernel = &ConversionHelperT<inputType, outputType>::template ScaleKernel<false, true>;
+            }
+            else {
+                kernel = &ConversionHelperT<inputType, outputType>::template ScaleKernel<false, false>;
+            }
+        }
+    }
+}
+
+template<typename inputType, typename outputType>
+template<bool hasGain, bool hasOffset>
+typename ConversionHelperT<inputType, outputType>::ConversionKernel ConversionHelperT<inputType, outputType>::GetFloatToIntegerKernel() const {
+    ConversionKernel ret;
+    if (saturate) {
+        if (roundNearest) {
+            ret = &ConversionHelperT<inputType, outputType>::template FloatToIntegerKernel<hasGain, hasOffset, true, true>;
+        }
+        else {
+            ret = &ConversionHelperT<inputType, outputType>::template FloatToIntegerKernel<hasGain, hasOffset, true, false>;
+        }
+    }
+    else {
+        ret = &ConversionHelperT<inputType, outputType>::template FloatToIntegerKernel<hasGain, hasOffset, false, true>;
+    }
+    return ret;
+}
+
+template<typename inputType, typename outputType>
+template<bool hasGain, bool hasOffset>
+void ConversionHelperT<inputType, outputType>::ScaleKernel(const inputType * const src,
+                                                           outputType * const dest,
+                                                           const uint32 size) const {
+    //Local copies so that the compiler does not have to assume that dest aliases the parameters.
+    const outputType g = gain;
+    const outputType o = offset;
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
+        outputType value = static_cast<outputType>(src[i]);
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (hasGain) {
+            /*lint -e{734} Loss of precision is responsibility of the conversion requested by the user.*/
+            value = g * value;
+        }
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (hasOffset) {
+            /*lint -e{734} Loss of precision is responsibility of the conversion requested by the user.*/
+            value = value + o;
+        }
+        dest[i] = value;
+    }
+}
+
+template<typename inputType, typename outputType>
+template<bool hasGain, bool hasOffset, bool saturateOutput, bool roundOutput>
+void ConversionHelperT<inputType, outputType>::FloatToIntegerKernel(const inputType * const src,
+                                                                    outputType * const dest,
+                                                                    const uint32 size) const {
+    /*lint -e{9117} -e{747} the gain and the offset are applied in the (floating point) input precision.*/
+    const inputType g = static_cast<inputType>(gain);
+    /*lint -e{9117} -e{747} the gain and the offset are applied in the (floating point) input precision.*/
+    const inputType o = static_cast<inputType>(offset);
+    /*lint -e{9117} -e{747} the limits are compared in the (floating point) input precision.*/
+    const inputType maxValue = static_cast<inputType>(TypeCharacteristics<outputType>::MaxValue());
+    /*lint -e{9117} -e{747} the limits are compared in the (floating point) input precision.*/
+    const inputType minValue = static_cast<inputType>(TypeCharacteristics<outputType>::MinValue());
+    /*lint -e{9117} -e{747} half is only used by the floating point kernels.*/
+    const inputType half = static_cast<inputType>(0.5);
+    //From 2^23 (float32) or 2^52 (float64) all the representable values are integers.
+    /*lint -e{9117} -e{747} the limit is only used by the floating point kernels.*/
+    const inputType integerLimit = static_cast<inputType>((sizeof(inputType) == sizeof(float32)) ? 8388608.0 : 4503599627370496.0);
+    uint32 i;
+    for (i = 0u; i < size; i++) {
+        inputType value = src[i];
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (hasGain) {
+            value = g * value;
+        }
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (hasOffset) {
+            value = value + o;
+        }
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (roundOutput) {
+            //Round half away from zero in the input precision. Adding +/-0.5 before truncating is not exact (e.g. 0.49999997F + 0.5F == 1.0F).
+            //The truncation and the remainder below are exact. NaN fails both comparisons and is left unchanged.
+            if ((value < integerLimit) && (value > -integerLimit)) {
+                /*lint -e{9117} -e{747} |value| < integerLimit, so it is representable as int64 and the truncation is exact.*/
+                inputType truncated = static_cast<inputType>(static_cast<int64>(value));
+                inputType remainder = value - truncated;
+                if (remainder >= half) {
+                    truncated += static_cast<inputType>(1);
+                }
+                else if (remainder <= -half) {
+                    truncated -= static_cast<inputType>(1);
                 }
                 else {
-                    /*lint -e{734} -e{571} Loss of precision is responsibility of the conversion requested by the user.*/
-                    dest[idx] = static_cast<outputType>(src[idx]);
+                    //NOOP
                 }
+                value = truncated;
+            }
+        }
+        /*lint -e{506} -e{774} constant value boolean is resolved at compile time for each kernel.*/
+        if (saturateOutput) {
+            //The maximum of the integer type may not be representable (e.g. 2^31 - 1 in float32 is 2^31), hence the >=.
+            if (value >= maxValue) {
+                dest[i] = TypeCharacteristics<outputType>::MaxValue();
             }
+            else if (value <= minValue) {
+                dest[i] = TypeCharacteristics<outputType>::MinValue();
+            }
+            /*lint -e{777} NaN is the only value that is not equal to itself.*/
+            else if (value != value) {
+                dest[i] = static_cast<outputType>(0);
+            }
+            else {
+                /*lint -e{734} -e{571} -e{9117} the value is in the outputType range.*/
+                dest[i] = static_cast<outputType>(value);
+            }
+        }
+        else {
+            /*lint -e{734} -e{571} -e{9117} Loss of precision is responsibility of the conversion requested by the user.*/
+            dest[i] = static_cast<outputType>(value);
         }
     }
 }
 
+template<typename inputType, typename outputType>
+void ConversionHelperT<inputType, outputType>::Convert() {
+    outputType *dest = reinterpret_cast<outputType *>(outputMemory);
+    const inputType *src = reinterpret_cast<const inputType *>(inputMemory);
+    if ((dest != NULL) && (src != NULL)) {
+        //The samples of all the elements are contiguous in memory.
+        (this->*kernel)(src, dest, numberOfSamples * numberOfElements);
+    }
 }
-#endif /* CONVERSIONHELPERT_H_ */
 
+}
+#endif /* CONVERSIONHELPERT_H_ */
@@ -30,9 +30,8 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
-#include "CLASSMETHODREGISTER.h"
-#include "RegisteredMethodsMessageFilter.h"
 #include "FFTGAM.h"
+#include "FFTHelperT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -45,248 +44,203 @@
 namespace MARTe {
 
 FFTGAM::FFTGAM() :
-        GAM(), MessageI() {
-
-    signalType = InvalidType;
+        GAM() {
+    fft = NULL_PTR(FFTHelper *);
+    size = 0u;
+    numberOfOutputElements = 0u;
+    complexInput = false;
+    magnitudePhase = false;
+    inputReal = NULL_PTR(void *);
+    inputImaginary = NULL_PTR(void *);
+    output0 = NULL_PTR(void *);
+    output1 = NULL_PTR(void *);
 }
 
 FFTGAM::~FFTGAM() {
-    // currently redundant code
-    if (signalType == Float32Bit) {
-
+    if (fft != NULL_PTR(FFTHelper *)) {
+        delete fft;
     }
-
+    inputReal = NULL_PTR(void *);
+    inputImaginary = NULL_PTR(void *);
+    output0 = NULL_PTR(void *);
+    output1 = NULL_PTR(void *);
 }
 
-bool FFTGAM::Setup() {
-
-    // check there is at least one input signal and one output signal
-    bool ret = ((GetNumberOfInputSignals() != 0u) && (GetNumberOfOutputSignals() != 0u));
-
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "(GetNumberOfInputSignals() == 0u) || (GetNumberOfOutputSignals() == 0u)");
-    }
-
-    // check that the input and output signal types match
+bool FFTGAM::Initialise(StructuredDataI &data) {
+    bool ret = GAM::Initialise(data);
     if (ret) {
-        ret = (GetSignalType(InputSignals, 0u) == GetSignalType(OutputSignals, 0u));
+        StreamString outputFormat;
+        if (data.Read("OutputFormat", outputFormat)) {
+            if (outputFormat == "MagnitudePhase") {
+                magnitudePhase = true;
+            }
+            else if (outputFormat == "Complex") {
+                magnitudePhase = false;
+            }
+            else {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "OutputFormat shall be either Complex or MagnitudePhase");
+                ret = false;
+            }
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::Information, "OutputFormat not set. Using Complex");
+        }
     }
+    return ret;
+}
 
+bool FFTGAM::Setup() {
+    uint32 numberOfInputSignals = GetNumberOfInputSignals();
+    uint32 numberOfOutputSignals = GetNumberOfOutputSignals();
+    bool ret = ((numberOfInputSignals == 1u) || (numberOfInputSignals == 2u));
     if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(InputSignals, 0u) != GetSignalType(OutputSignals, 0u)");
-    }
-
-    // get input signal type
-    if (ret) {
-      signalType = GetSignalType(InputSignals, 0u);
-    }
-
-    // check that input signal no. of dimensions = 0
-    uint32 signalNumberOfDimensions = 0u;
-
-    if (ret) {
-        ret = GetSignalNumberOfDimensions(InputSignals, 0u, signalNumberOfDimensions);
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The number of input signals shall be 1 (real input) or 2 (complex input)");
     }
-
     if (ret) {
-        ret = (signalNumberOfDimensions == 0u);
-    }  
-
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(InputSignals, 0u) != 0u");
+        complexInput = (numberOfInputSignals == 2u);
+        if (magnitudePhase) {
+            ret = ((numberOfOutputSignals == 1u) || (numberOfOutputSignals == 2u));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be 1 (magnitude) or 2 (magnitude and phase)");
+            }
+        }
+        else {
+            ret = (numberOfOutputSignals == 2u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of output signals shall be 2 (real and imaginary parts)");
+            }
+        }
     }
-
-    // check that input signal no. of elements = 1
-    uint32 signalNumberOfElements = 0u;
-
+    TypeDescriptor signalType = InvalidType;
     if (ret) {
-        ret = GetSignalNumberOfElements(InputSignals, 0u, signalNumberOfElements);
+        signalType = GetSignalType(InputSignals, 0u);
+        ret = ((signalType == Float32Bit) || (signalType == Float64Bit));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The signal type shall be float32 or float64");
+        }
     }
-
-    if (ret) {
-        ret = (signalNumberOfElements == 1u);
-    }  
-
-    if (!ret) {
-        REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) != 1u");
+    for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
+        ret = (GetSignalType(InputSignals, i) == signalType);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the input signal %u differs from the type of the first input signal", i);
+        }
+        uint32 numberOfElements = 0u;
+        if (ret) {
+            ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+        }
+        if (ret) {
+            if (i == 0u) {
+                size = numberOfElements;
+                ret = (size > 0u);
+            }
+            else {
+                ret = (numberOfElements == size);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "All the input signals shall have the same number (> 0) of elements");
+            }
+        }
+        uint32 numberOfSamples = 0u;
+        if (ret) {
+            ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
+        }
+        if (ret) {
+            ret = (numberOfSamples == 1u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of samples of the input signal %u shall be 1", i);
+            }
+        }
     }
-
-    // loop through output signals
-    uint32 signalIndex;
-
-    for (signalIndex = 0u; (signalIndex < GetNumberOfOutputSignals()) && (ret); signalIndex++) {
-
-        // check the output signal has a valid type
-        ret = (signalType == GetSignalType(OutputSignals, signalIndex));
-
-		if (!ret) {
-			REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalType(OutputSignals, %u) != signalType", signalIndex);
-		}
-
-		if (ret) {
-			ret = GetSignalNumberOfDimensions(OutputSignals, signalIndex, signalNumberOfDimensions);
-		}
-
-		if (ret) {
-				ret = (signalNumberOfDimensions == 0u);
-		}  
-
-		if (!ret) {
-			REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfDimensions(OutputSignals, %u) != 0u", signalIndex);
-		}
-
-		if (ret) {
-				ret = GetSignalNumberOfElements(OutputSignals, signalIndex, signalNumberOfElements);
-		}
-
-		if (ret) {
-			ret = (signalNumberOfElements == 1u);
-		}  
-
-		if (!ret) {
-			REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(OutputSignals, %u) != 1u", signalIndex);
-		}
-
+    for (uint32 i = 0u; (i < numberOfOutputSignals) && (ret); i++) {
+        ret = (GetSignalType(OutputSignals, i) == signalType);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The type of the output signal %u differs from the type of the input signals", i);
+        }
+        uint32 numberOfElements = 0u;
+        if (ret) {
+            ret = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        }
+        if (ret) {
+            if (i == 0u) {
+                numberOfOutputElements = numberOfElements;
+                ret = (numberOfOutputElements == size);
+                if ((!ret) && (!complexInput)) {
+                    ret = (numberOfOutputElements == ((size / 2u) + 1u));
+                }
+            }
+            else {
+                ret = (numberOfElements == numberOfOutputElements);
+            }
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError,
+                             "All the output signals shall have N elements (or N/2+1 elements with a real input) where N = %u", size);
+            }
+        }
+        uint32 numberOfSamples = 0u;
+        if (ret) {
+            ret = GetSignalNumberOfSamples(OutputSignals, i, numberOfSamples);
+        }
+        if (ret) {
+            ret = (numberOfSamples == 1u);
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of samples of the output signal %u shall be 1", i);
+            }
+        }
     }
-
-    // instantiate the CircularStaticList
-    // TODO - parameterise the buffer size (1024, maybe insist on powers of 2 for now)
-    buffer = new CircularStaticList<uint32>(8);
-
-
-    // Install message filter
-    ReferenceT<RegisteredMethodsMessageFilter> registeredMethodsMessageFilter("RegisteredMethodsMessageFilter");
-
     if (ret) {
-        ret = registeredMethodsMessageFilter.IsValid();
+        if (fft != NULL_PTR(FFTHelper *)) {
+            delete fft;
+        }
+        if (signalType == Float32Bit) {
+            fft = new FFTHelperT<float32>();
+        }
+        else {
+            fft = new FFTHelperT<float64>();
+        }
+        ret = fft->Initialise(size, complexInput);
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not plan the FFT for %u points", size);
+        }
     }
-
     if (ret) {
-        registeredMethodsMessageFilter->SetDestination(this);
-        ret = InstallMessageFilter(registeredMethodsMessageFilter);
+        inputReal = GetInputSignalMemory(0u);
+        if (complexInput) {
+            inputImaginary = GetInputSignalMemory(1u);
+        }
+        output0 = GetOutputSignalMemory(0u);
+        if (numberOfOutputSignals > 1u) {
+            output1 = GetOutputSignalMemory(1u);
+        }
     }
-
     return ret;
 }
 
 bool FFTGAM::Execute() {
-
-    bool ret = this->FFTGAM::ExecuteT<uint32>();
-    // this->FFTGAM::ExecuteT<uint32>();
-
-    return ret;
-}
-
-template <class Type> bool FFTGAM::ExecuteT() {
-
-    CircularStaticList<Type> * ref = NULL_PTR(CircularStaticList<Type> *);
-    Type input = (Type) 0;
-    Type output = (Type) 0;
-
-    bool ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
-
-    if (ret) {
-        ret = (buffer != NULL_PTR(void *));
+    if (magnitudePhase) {
+        fft->MagnitudePhase(inputReal, inputImaginary, output0, output1, numberOfOutputElements);
     }
-
-    if (ret) {
-        ref = static_cast<CircularStaticList<Type> *>(buffer);
-        ret = ref->PushData(input);
-    }
-
-    if (ret) {
-        // ref->GetLast(output);
-        ref->Peek(1u, output);
-        ret = MemoryOperationsHelper::Copy(GetOutputSignalMemory(0u), &output, sizeof(Type));
+    else {
+        fft->Complex(inputReal, inputImaginary, output0, output1, numberOfOutputElements);
     }
-
-    return ret;
-
+    return true;
 }
 
-ErrorManagement::ErrorType FFTGAM::SetOutput(ReferenceContainer& message) {
-
-    ErrorManagement::ErrorType ret = ErrorManagement::NoError;
-
-    // Assume one ReferenceT<StructuredDataI> contained in the message
-
-    bool ok = (message.Size() == 1u);
-    ReferenceT<StructuredDataI> data = message.Get(0u);
-
-    if (ok) {
-        ok = data.IsValid();
-    }
-
-    if (!ok) {
-        ret = ErrorManagement::ParametersError;
-        REPORT_ERROR(ret, "Message does not contain a ReferenceT<StructuredDataI>");
-    }
-
-    StreamString signalName;
-    uint32 signalIndex = 0u;
-
-    if (ok) {
-        if (data->Read("SignalName", signalName)) {
-            ok = GetSignalIndex(OutputSignals, signalIndex, signalName.Buffer());
-        }
-        else {
-            ok = data->Read("SignalIndex", signalIndex);
-        }
-    }
-
-    if (ok) {
-        ok = (signalIndex < GetNumberOfOutputSignals());
-    }
-
-    if (!ok) {
-        ret = ErrorManagement::ParametersError;
-        REPORT_ERROR(ret, "No valid signal name or index provided");
-    }
-
-    TypeDescriptor signalType = InvalidType;
-
-    if (ok) {
-        signalType = GetSignalType(OutputSignals, signalIndex);
-        ok = (signalType != InvalidType);
-    }
-
-    if (ok) {
-
-        // Signal index and type are tested and valid ... go ahead with AnyType instantiation
-
-        // Use the default value type to query the signal properties (dimensions, ...)
-        /*lint -e{534}  [MISRA C++ Rule 0-1-7], [MISRA C++ Rule 0-3-2]. Justification: SignalIndex is tested valid prio to this part of the code.*/
-        MoveToSignalIndex(OutputSignals, signalIndex);
-        AnyType signalDefType = configuredDatabase.GetType("Default");
-        AnyType signalNewValue(signalType, 0u, GetOutputSignalMemory(signalIndex));
-
-        uint8 signalNumberOfDimensions = signalDefType.GetNumberOfDimensions();
-        signalNewValue.SetNumberOfDimensions(signalNumberOfDimensions);
-
-        uint32 dimensionIndex;
-
-        for (dimensionIndex = 0u; dimensionIndex < signalNumberOfDimensions; dimensionIndex++) {
-            uint32 dimensionNumberOfElements = signalDefType.GetNumberOfElements(static_cast<uint32>(dimensionIndex));
-            signalNewValue.SetNumberOfElements(static_cast<uint32>(dimensionIndex), dimensionNumberOfElements);
-        }
+uint32 FFTGAM::GetSize() const {
+    return size;
+}
 
-        if (data->Read("SignalValue", signalNewValue)) {
-            REPORT_ERROR(ErrorManagement::Information, "Signal '%!' new value '%!'", signalName.Buffer(), signalNewValue);
-        }
-        else {
-            ret = ErrorManagement::ParametersError;
-            REPORT_ERROR(ret, "Failed to read and apply new signal value");
-        }
+bool FFTGAM::IsComplexInput() const {
+    return complexInput;
+}
 
-    }
+bool FFTGAM::IsMagnitudePhase() const {
+    return magnitudePhase;
+}
 
-    return ret;
+uint32 FFTGAM::GetNumberOfOutputElements() const {
+    return numberOfOutputElements;
 }
 
 CLASS_REGISTER(FFTGAM, "1.0")
 
-/*lint -e{1023} Justification: Macro provided by the Core.*/
-CLASS_METHOD_REGISTER(FFTGAM, SetOutput)
-
 } /* namespace MARTe */
-
@@ -33,8 +33,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "GAM.h"
-#include "MessageI.h"
-#include "CircularStaticList.h"
+#include "FFTHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Class declaration                               */
@@ -43,111 +42,171 @@
 namespace MARTe {
 
 /**
- * @brief GAM which provides constant output signals. 
- * @details This GAM provides constant output signals, the value of which is defined through configuration, and
- * may be asynchronously altered using MARTe messages sent e.g. from a StateMachine.
+ * @brief GAM which computes the discrete Fourier transform of its input signal.
+ * @details The GAM computes, on every cycle, the (non-normalised) forward transform
+ * X[k] = sum_n x[n] * exp(-2*pi*i*k*n/N) of an N elements input signal, where N can be any value.
+ *
+ * The transform is planned in Setup() (twiddle factors, bit-reversal permutation and, for non powers of two,
+ * the Bluestein chirp filter) so that Execute() performs no memory allocation. See FFTHelperT for the details
+ * of the algorithms.
+ *
+ * The input is either real (one input signal) or complex (two input signals, the real and the imaginary parts).
+ * The output is either the complex spectrum (two output signals, the real and the imaginary parts) or its
+ * magnitude and phase (one or two output signals, the magnitude and, optionally, the phase in radians).
+ *
+ * The output signals must have either N elements (full spectrum) or, if the input is real, N/2+1 elements
+ * (one-sided spectrum, the remaining elements being the complex conjugate of these ones).
+ *
+ * All the signals must have the same type, which shall be either float32 or float64, and one sample.
  *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
- * +Constants = {
- *     Class = ConstantGAM
- *     OutputSignals = {
- *         Signal1 = {
+ * +FFT = {
+ *     Class = FFTGAM
+ *     OutputFormat = MagnitudePhase //Optional. Complex (default) or MagnitudePhase.
+ *     InputSignals = {
+ *         Real = {
  *             DataSource = "DDB"
- *             Type = uint32
- *             Default = 0
+ *             Type = float32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 4096
  *         }
- *         Signal2 = {
+ *         Imaginary = { //Optional. If not set the input is real.
  *             DataSource = "DDB"
- *             Type = int32
- *             Default = 100
+ *             Type = float32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 4096
  *         }
- *         Signal3 = {
+ *     }
+ *     OutputSignals = {
+ *         Magnitude = { //Real part if OutputFormat = Complex.
  *             DataSource = "DDB"
- *             Type = int8
+ *             Type = float32
  *             NumberOfDimensions = 1
- *             NumberOfElements = 8
- *             Default = {1 2 3 4 5 6 7 8}
+ *             NumberOfElements = 4096 //or 2049 if the input is real.
+ *         }
+ *         Phase = { //Imaginary part if OutputFormat = Complex. Optional if OutputFormat = MagnitudePhase.
+ *             DataSource = "DDB"
+ *             Type = float32
+ *             NumberOfDimensions = 1
+ *             NumberOfElements = 4096
  *         }
- *     }
- * }
- * </pre>
- *
- * The GAM registers a messageable 'SetOutput' method which allows to update signals through messages:
- *
- * <pre>
- * +Message = {
- *     Class = Message
- *     Destination = "Functions.FFTs"
- *     Function = "SetOutput"
- *     +Parameters = {
- *         Class = ConfigurationDatabase
- *         SignalName = "Signal1" // The name of the signal to modify, or
- *         SignalIndex = 0 // Alternatively, the index of the signal.
- *         SignalValue = 10
  *     }
  * }
  * </pre>
  */
-class FFTGAM: public GAM, public MessageI {
+class FFTGAM: public GAM {
 public:
     CLASS_REGISTER_DECLARATION()
 
     /**
      * @brief Constructor. NOOP.
+     * @post
+     *   GetSize() == 0 &&
+     *   IsComplexInput() == false &&
+     *   IsMagnitudePhase() == false
      */
     FFTGAM();
 
     /**
-     * @brief Destructor. NOOP.
+     * @brief Destructor. Frees the FFT plan.
      */
     virtual ~FFTGAM();
 
-    // the buffer upon which the FFT transformation will be performed
-    //
-    // MARTe::CircularStaticList< Type >::CircularStaticList( 	( 	const uint32  	bufferSize	) 	)
-    // MARTe::CircularStaticList<uint32>::CircularStaticList() buffer;
-    // CircularStaticList buffer;
-    void * buffer;
-
+    /**
+     * @brief Reads the OutputFormat parameter.
+     * @param[in] data the GAM configuration.
+     * @return true if OutputFormat is not set or is one of Complex or MagnitudePhase.
+     */
+    virtual bool Initialise(StructuredDataI &data);
 
     /**
-     * @brief Initialises the output signal memory with default values provided through configuration.
-     * @return true if the pre-conditions are met.
+     * @brief Verifies the signals and plans the transform.
+     * @return true if the signals are configured as described in the class description and the plan memory
+     * could be allocated.
      * @pre
-     *   SetConfiguredDatabase() && GetNumberOfInputSignals() == 0 &&
-     *   for each signal i: The default value provided corresponds to the expected type and dimensionality.
+     *   Initialise()
      */
     virtual bool Setup();
 
     /**
-     * @brief Execute method. NOOP.
+     * @brief Computes the transform of the input signal(s) into the output signal(s).
      * @return true.
+     * @pre
+     *   Setup()
      */
     virtual bool Execute();
 
-    template <typename Type> bool ExecuteT();
+    /**
+     * @brief Gets the number of points of the transform.
+     * @return the number of points of the transform.
+     */
+    uint32 GetSize() const;
 
     /**
-     * @brief SetOutput method.
-     * @details The method is registered as a messageable function. It assumes the ReferenceContainer
-     * includes a reference to a StructuredDataI instance which contains a valid 'SignalName' attribute, 
-     * or alternatively, a valid 'SignalIndex' from which the output signal can be identified. 
-     * The 'SignalValue' attribute must match the expected type and dimensionality of the output signal.
-     * @return ErrorManagement::NoError if the pre-conditions are met, ErrorManagement::ParametersError
-     * otherwise.
-     * @pre
-     *   'SignalIndex' < GetNumberOfOutputSignals() &&
-     *   The 'SignalValue' provided corresponds to the expected type and dimensionality.
+     * @brief Queries if the input is complex.
+     * @return true if the input is complex (i.e. two input signals).
+     */
+    bool IsComplexInput() const;
+
+    /**
+     * @brief Queries if the output is in magnitude/phase format.
+     * @return true if OutputFormat = MagnitudePhase.
      */
-    ErrorManagement::ErrorType SetOutput(ReferenceContainer& message);
+    bool IsMagnitudePhase() const;
+
+    /**
+     * @brief Gets the number of elements of the output signals.
+     * @return the number of elements of the output signals.
+     */
+    uint32 GetNumberOfOutputElements() const;
 
 private:
     /**
-     * @brief The common signal type attribute.
+     * The planned FFT engine.
+     */
+    FFTHelper *fft;
+
+    /**
+     * The number of points of the transform.
+     */
+    uint32 size;
+
+    /**
+     * The number of elements of the output signals.
+     */
+    uint32 numberOfOutputElements;
+
+    /**
+     * True if the input is complex.
+     */
+    bool complexInput;
+
+    /**
+     * True if OutputFormat = MagnitudePhase.
+     */
+    bool magnitudePhase;
+
+    /**
+     * The real part of the input.
+     */
+    void *inputReal;
+
+    /**
+     * The imaginary part of the input (NULL if the input is real).
+     */
+    void *inputImaginary;
+
+    /**
+     * The real part (or the magnitude) of the output.
+     */
+    void *output0;
+
+    /**
+     * The imaginary part (or the phase) of the output. NULL if the phase is not requested.
      */
-    TypeDescriptor signalType;
+    void *output1;
 
 };
 
@@ -0,0 +1,106 @@
+/**
+ * @file FFTHelper.h
+ * @brief Header file for class FFTHelper
+ * @date 18/10/2026
+ * @author Bertrand Bauvir
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FFTHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPER_H_
+#define SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Helper class to compute the discrete Fourier transform.
+ * @details The transform is planned once (see Initialise()) and can then be executed any number of
+ * times without any memory allocation.
+ */
+class FFTHelper {
+public:
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~FFTHelper() {
+
+    }
+
+    /**
+     * @brief To be specialised by FFTHelperT for all the supported types.
+     * @details Allocates the working memory and precomputes the twiddle factors and the bit-reversal permutation.
+     * @param[in] sizeIn the number of points of the transform (any value > 0).
+     * @param[in] complexInputIn if false the input is real and the imaginary part is ignored.
+     * @return true if the memory could be allocated and sizeIn > 0.
+     */
+    virtual bool Initialise(const uint32 sizeIn,
+                            const bool complexInputIn) = 0;
+
+    /**
+     * @brief To be specialised by FFTHelperT for all the supported types.
+     * @details Computes the (non-normalised) forward transform X[k] = sum_n x[n] exp(-2*pi*i*k*n/N).
+     * @param[in] inputReal the real part of the N input points.
+     * @param[in] inputImaginary the imaginary part of the N input points. Ignored if the input is real.
+     * @param[out] outputReal the real part of the first \a numberOfOutputs spectrum points.
+     * @param[out] outputImaginary the imaginary part of the first \a numberOfOutputs spectrum points.
+     * @param[in] numberOfOutputs the number of spectrum points to write (<= N).
+     * @pre
+     *   Initialise()
+     */
+    virtual void Complex(const void * const inputReal,
+                         const void * const inputImaginary,
+                         void * const outputReal,
+                         void * const outputImaginary,
+                         const uint32 numberOfOutputs) = 0;
+
+    /**
+     * @brief To be specialised by FFTHelperT for all the supported types.
+     * @details Computes the forward transform (see Complex()) and writes its magnitude and phase (in radians).
+     * @param[in] inputReal the real part of the N input points.
+     * @param[in] inputImaginary the imaginary part of the N input points. Ignored if the input is real.
+     * @param[out] magnitude the magnitude of the first \a numberOfOutputs spectrum points.
+     * @param[out] phase the phase of the first \a numberOfOutputs spectrum points. Not computed if NULL.
+     * @param[in] numberOfOutputs the number of spectrum points to write (<= N).
+     * @pre
+     *   Initialise()
+     */
+    virtual void MagnitudePhase(const void * const inputReal,
+                                const void * const inputImaginary,
+                                void * const magnitude,
+                                void * const phase,
+                                const uint32 numberOfOutputs) = 0;
+
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPER_H_ */
@@ -0,0 +1,613 @@
+/**
+ * @file FFTHelperT.h
+ * @brief Header file for class FFTHelperT
+ * @date 18/10/2026
+ * @author Bertrand Bauvir
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FFTHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPERT_H_
+#define SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FFTHelper.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Planned FFT engine for float32 and float64 signals of any length.
+ * @details The transform is computed with the following strategy, decided once in Initialise():
+ *  - real inputs of even length N are packed into a complex transform of N/2 points, whose result
+ *  is then split into the N points spectrum;
+ *  - complex transforms with a power of two number of points are computed with an in-place radix-4
+ *  decimation in time algorithm (preceded by one radix-2 stage when log2(N) is odd);
+ *  - complex transforms with any other number of points are computed with the Bluestein (chirp-z)
+ *  algorithm, i.e. as a circular convolution evaluated with power of two transforms.
+ *
+ * All the twiddle factors, the bit-reversal permutation and the Bluestein filter spectrum are
+ * precomputed in Initialise(). No memory is allocated afterwards.
+ */
+template<typename T>
+class FFTHelperT: public FFTHelper {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FFTHelperT();
+
+    /**
+     * @brief Destructor. Frees the plan memory.
+     */
+    virtual ~FFTHelperT();
+
+    /**
+     * @see FFTHelper::Initialise
+     */
+    virtual bool Initialise(const uint32 sizeIn,
+                            const bool complexInputIn);
+
+    /**
+     * @see FFTHelper::Complex
+     * @details A cast to the declared type is performed.
+     */
+    virtual void Complex(const void * const inputReal,
+                         const void * const inputImaginary,
+                         void * const outputReal,
+                         void * const outputImaginary,
+                         const uint32 numberOfOutputs);
+
+    /**
+     * @see FFTHelper::MagnitudePhase
+     * @details A cast to the declared type is performed.
+     */
+    virtual void MagnitudePhase(const void * const inputReal,
+                                const void * const inputImaginary,
+                                void * const magnitude,
+                                void * const phase,
+                                const uint32 numberOfOutputs);
+
+    /**
+     * @brief Gets the number of points of the transform.
+     * @return the number of points of the transform.
+     */
+    uint32 GetSize() const;
+
+    /**
+     * @brief Gets the number of points of the power of two kernel used to compute the transform.
+     * @return the number of points of the power of two kernel.
+     */
+    uint32 GetRadixSize() const;
+
+    /**
+     * @brief Queries if the Bluestein algorithm is used.
+     * @return true if the Bluestein algorithm is used.
+     */
+    bool IsBluestein() const;
+
+    /**
+     * @brief Queries if a real input is packed into a complex transform of half the size.
+     * @return true if the real input is packed.
+     */
+    bool IsRealPacked() const;
+
+private:
+
+    /**
+     * @brief Computes the full spectrum into spectrumReal and spectrumImaginary.
+     */
+    void Transform(const T * const inputReal,
+                   const T * const inputImaginary);
+
+    /**
+     * @brief Computes in-place the complex transform of coreSize points.
+     */
+    void CoreTransform(T * const re,
+                       T * const im);
+
+    /**
+     * @brief Computes in-place the complex forward transform of radixSize points.
+     */
+    void RadixTransform(T * const re,
+                        T * const im);
+
+    /**
+     * @brief Frees all the plan memory.
+     */
+    void Free();
+
+    /**
+     * The number of points of the transform.
+     */
+    uint32 size;
+
+    /**
+     * True if the input has an imaginary part.
+     */
+    bool complexInput;
+
+    /**
+     * True if a real input is packed in a complex transform of size/2 points.
+     */
+    bool realPacked;
+
+    /**
+     * True if the core transform is computed with the Bluestein algorithm.
+     */
+    bool bluestein;
+
+    /**
+     * The number of points of the core complex transform (size or size/2).
+     */
+    uint32 coreSize;
+
+    /**
+     * The number of points of the power of two kernel.
+     */
+    uint32 radixSize;
+
+    /**
+     * log2(radixSize).
+     */
+    uint32 radixLog2;
+
+    /**
+     * The bit-reversal permutation of the power of two kernel.
+     */
+    uint32 *bitReverse;
+
+    /**
+     * exp(-2*pi*i*k/radixSize) for k < radixSize/2.
+     */
+    T *twiddleReal;
+
+    /**
+     * @see twiddleReal
+     */
+    T *twiddleImaginary;
+
+    /**
+     * exp(-i*pi*n^2/coreSize) for n < coreSize (Bluestein only).
+     */
+    T *chirpReal;
+
+    /**
+     * @see chirpReal
+     */
+    T *chirpImaginary;
+
+    /**
+     * The transform of the conjugated chirp, scaled by 1/radixSize (Bluestein only).
+     */
+    T *filterReal;
+
+    /**
+     * @see filterReal
+     */
+    T *filterImaginary;
+
+    /**
+     * Bluestein convolution memory (radixSize points).
+     */
+    T *convolutionReal;
+
+    /**
+     * @see convolutionReal
+     */
+    T *convolutionImaginary;
+
+    /**
+     * exp(-2*pi*i*k/size) for k <= coreSize (real packed only).
+     */
+    T *splitReal;
+
+    /**
+     * @see splitReal
+     */
+    T *splitImaginary;
+
+    /**
+     * The core transform memory (coreSize points).
+     */
+    T *workReal;
+
+    /**
+     * @see workReal
+     */
+    T *workImaginary;
+
+    /**
+     * The computed spectrum (size points).
+     */
+    T *spectrumReal;
+
+    /**
+     * @see spectrumReal
+     */
+    T *spectrumImaginary;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/*lint -esym(9107, MARTe::FFTHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+FFTHelperT<T>::FFTHelperT() :
+        FFTHelper() {
+    size = 0u;
+    complexInput = false;
+    realPacked = false;
+    bluestein = false;
+    coreSize = 0u;
+    radixSize = 0u;
+    radixLog2 = 0u;
+    bitReverse = NULL_PTR(uint32 *);
+    twiddleReal = NULL_PTR(T *);
+    twiddleImaginary = NULL_PTR(T *);
+    chirpReal = NULL_PTR(T *);
+    chirpImaginary = NULL_PTR(T *);
+    filterReal = NULL_PTR(T *);
+    filterImaginary = NULL_PTR(T *);
+    convolutionReal = NULL_PTR(T *);
+    convolutionImaginary = NULL_PTR(T *);
+    splitReal = NULL_PTR(T *);
+    splitImaginary = NULL_PTR(T *);
+    workReal = NULL_PTR(T *);
+    workImaginary = NULL_PTR(T *);
+    spectrumReal = NULL_PTR(T *);
+    spectrumImaginary = NULL_PTR(T *);
+}
+
+template<typename T>
+FFTHelperT<T>::~FFTHelperT() {
+    Free();
+}
+
+template<typename T>
+void FFTHelperT<T>::Free() {
+    if (bitReverse != NULL_PTR(uint32 *)) {
+        delete[] bitReverse;
+        bitReverse = NULL_PTR(uint32 *);
+    }
+    T ** const buffers[] = { &twiddleReal, &twiddleImaginary, &chirpReal, &chirpImaginary, &filterReal, &filterImaginary, &convolutionReal,
+            &convolutionImaginary, &splitReal, &splitImaginary, &workReal, &workImaginary, &spectrumReal, &spectrumImaginary };
+    const uint32 numberOfBuffers = static_cast<uint32>(sizeof(buffers) / sizeof(buffers[0]));
+    for (uint32 i = 0u; i < numberOfBuffers; i++) {
+        if (*buffers[i] != NULL_PTR(T *)) {
+            delete[] *buffers[i];
+            *buffers[i] = NULL_PTR(T *);
+        }
+    }
+}
+
+template<typename T>
+bool FFTHelperT<T>::Initialise(const uint32 sizeIn,
+                               const bool complexInputIn) {
+    Free();
+    size = sizeIn;
+    complexInput = complexInputIn;
+    bool ret = (size > 0u);
+    if (ret) {
+        realPacked = ((!complexInput) && ((size % 2u) == 0u));
+        coreSize = (realPacked) ? (size / 2u) : (size);
+        bluestein = ((coreSize & (coreSize - 1u)) != 0u);
+        uint32 minRadixSize = (bluestein) ? ((2u * coreSize) - 1u) : (coreSize);
+        radixSize = 1u;
+        radixLog2 = 0u;
+        while (radixSize < minRadixSize) {
+            radixSize <<= 1u;
+            radixLog2++;
+        }
+        uint32 twiddleSize = (radixSize > 1u) ? (radixSize / 2u) : (1u);
+        bitReverse = new uint32[radixSize];
+        twiddleReal = new T[twiddleSize];
+        twiddleImaginary = new T[twiddleSize];
+        workReal = new T[coreSize];
+        workImaginary = new T[coreSize];
+        spectrumReal = new T[size];
+        spectrumImaginary = new T[size];
+        ret = ((bitReverse != NULL_PTR(uint32 *)) && (twiddleReal != NULL_PTR(T *)) && (twiddleImaginary != NULL_PTR(T *))
+                && (workReal != NULL_PTR(T *)) && (workImaginary != NULL_PTR(T *)) && (spectrumReal != NULL_PTR(T *))
+                && (spectrumImaginary != NULL_PTR(T *)));
+        if (ret) {
+            for (uint32 i = 0u; i < radixSize; i++) {
+                uint32 reversed = 0u;
+                for (uint32 b = 0u; b < radixLog2; b++) {
+                    reversed |= (((i >> b) & 1u) << ((radixLog2 - 1u) - b));
+                }
+                bitReverse[i] = reversed;
+            }
+            for (uint32 k = 0u; k < twiddleSize; k++) {
+                float64 angle = (-2.0 * M_PI * static_cast<float64>(k)) / static_cast<float64>(radixSize);
+                twiddleReal[k] = static_cast<T>(cos(angle));
+                twiddleImaginary[k] = static_cast<T>(sin(angle));
+            }
+        }
+    }
+    if ((ret) && (realPacked)) {
+        splitReal = new T[coreSize + 1u];
+        splitImaginary = new T[coreSize + 1u];
+        ret = ((splitReal != NULL_PTR(T *)) && (splitImaginary != NULL_PTR(T *)));
+        if (ret) {
+            for (uint32 k = 0u; k <= coreSize; k++) {
+                float64 angle = (-2.0 * M_PI * static_cast<float64>(k)) / static_cast<float64>(size);
+                splitReal[k] = static_cast<T>(cos(angle));
+                splitImaginary[k] = static_cast<T>(sin(angle));
+            }
+        }
+    }
+    if ((ret) && (bluestein)) {
+        chirpReal = new T[coreSize];
+        chirpImaginary = new T[coreSize];
+        filterReal = new T[radixSize];
+        filterImaginary = new T[radixSize];
+        convolutionReal = new T[radixSize];
+        convolutionImaginary = new T[radixSize];
+        ret = ((chirpReal != NULL_PTR(T *)) && (chirpImaginary != NULL_PTR(T *)) && (filterReal != NULL_PTR(T *))
+                && (filterImaginary != NULL_PTR(T *)) && (convolutionReal != NULL_PTR(T *)) && (convolutionImaginary != NULL_PTR(T *)));
+        if (ret) {
+            for (uint32 n = 0u; n < radixSize; n++) {
+                filterReal[n] = static_cast<T>(0);
+                filterImaginary[n] = static_cast<T>(0);
+            }
+            //n^2 is reduced modulo 2*coreSize so that the angle keeps its precision for large transforms
+            uint64 period = 2ull * static_cast<uint64>(coreSize);
+            for (uint32 n = 0u; n < coreSize; n++) {
+                uint64 nSquare = (static_cast<uint64>(n) * static_cast<uint64>(n)) % period;
+                float64 angle = (-M_PI * static_cast<float64>(nSquare)) / static_cast<float64>(coreSize);
+                chirpReal[n] = static_cast<T>(cos(angle));
+                chirpImaginary[n] = static_cast<T>(sin(angle));
+                filterReal[n] = static_cast<T>(cos(angle));
+                filterImaginary[n] = static_cast<T>(-sin(angle));
+                if (n > 0u) {
+                    filterReal[radixSize - n] = filterReal[n];
+                    filterImaginary[radixSize - n] = filterImaginary[n];
+                }
+            }
+            RadixTransform(filterReal, filterImaginary);
+            T scale = static_cast<T>(1.0 / static_cast<float64>(radixSize));
+            for (uint32 n = 0u; n < radixSize; n++) {
+                filterReal[n] *= scale;
+                filterImaginary[n] *= scale;
+            }
+        }
+    }
+    if (!ret) {
+        Free();
+    }
+    return ret;
+}
+
+template<typename T>
+void FFTHelperT<T>::RadixTransform(T * const re,
+                                   T * const im) {
+    for (uint32 i = 0u; i < radixSize; i++) {
+        uint32 j = bitReverse[i];
+        if (i < j) {
+            T tmp = re[i];
+            re[i] = re[j];
+            re[j] = tmp;
+            tmp = im[i];
+            im[i] = im[j];
+            im[j] = tmp;
+        }
+    }
+    uint32 m = 4u;
+    if ((radixLog2 % 2u) == 1u) {
+        //One radix-2 stage so that the remaining number of stages is even
+        for (uint32 i = 0u; i < radixSize; i += 2u) {
+            T r0 = re[i];
+            T i0 = im[i];
+            re[i] = r0 + re[i + 1u];
+            im[i] = i0 + im[i + 1u];
+            re[i + 1u] = r0 - re[i + 1u];
+            im[i + 1u] = i0 - im[i + 1u];
+        }
+        m = 8u;
+    }
+    //Radix-4 stages: each butterfly merges two radix-2 stages (blocks of m/4 -> m/2 -> m)
+    while (m <= radixSize) {
+        uint32 quarter = (m / 4u);
+        uint32 stride = (radixSize / m);
+        for (uint32 s = 0u; s < radixSize; s += m) {
+            for (uint32 k = 0u; k < quarter; k++) {
+                uint32 i0 = (s + k);
+                uint32 i1 = (i0 + quarter);
+                uint32 i2 = (i1 + quarter);
+                uint32 i3 = (i2 + quarter);
+                T w1r = twiddleReal[k * stride];
+                T w1i = twiddleImaginary[k * stride];
+                T w2r = twiddleReal[2u * k * stride];
+                T w2i = twiddleImaginary[2u * k * stride];
+                //First stage (size m/2): twiddle exp(-2*pi*i*2k/m) on x1 and x3
+                T t1r = (w2r * re[i1]) - (w2i * im[i1]);
+                T t1i = (w2r * im[i1]) + (w2i * re[i1]);
+                T t3r = (w2r * re[i3]) - (w2i * im[i3]);
+                T t3i = (w2r * im[i3]) + (w2i * re[i3]);
+                T a0r = re[i0] + t1r;
+                T a0i = im[i0] + t1i;
+                T a1r = re[i0] - t1r;
+                T a1i = im[i0] - t1i;
+                T a2r = re[i2] + t3r;
+                T a2i = im[i2] + t3i;
+                T a3r = re[i2] - t3r;
+                T a3i = im[i2] - t3i;
+                //Second stage (size m): twiddle exp(-2*pi*i*k/m) on a2 and -i*exp(-2*pi*i*k/m) on a3
+                T u2r = (w1r * a2r) - (w1i * a2i);
+                T u2i = (w1r * a2i) + (w1i * a2r);
+                T u3r = (w1r * a3i) + (w1i * a3r);
+                T u3i = -((w1r * a3r) - (w1i * a3i));
+                re[i0] = a0r + u2r;
+                im[i0] = a0i + u2i;
+                re[i2] = a0r - u2r;
+                im[i2] = a0i - u2i;
+                re[i1] = a1r + u3r;
+                im[i1] = a1i + u3i;
+                re[i3] = a1r - u3r;
+                im[i3] = a1i - u3i;
+            }
+        }
+        m <<= 2u;
+    }
+}
+
+template<typename T>
+void FFTHelperT<T>::CoreTransform(T * const re,
+                                  T * const im) {
+    if (!bluestein) {
+        RadixTransform(re, im);
+    }
+    else {
+        //a[n] = x[n] * chirp[n], zero padded to radixSize
+        for (uint32 n = 0u; n < coreSize; n++) {
+            convolutionReal[n] = (re[n] * chirpReal[n]) - (im[n] * chirpImaginary[n]);
+            convolutionImaginary[n] = (re[n] * chirpImaginary[n]) + (im[n] * chirpReal[n]);
+        }
+        for (uint32 n = coreSize; n < radixSize; n++) {
+            convolutionReal[n] = static_cast<T>(0);
+            convolutionImaginary[n] = static_cast<T>(0);
+        }
+        RadixTransform(convolutionReal, convolutionImaginary);
+        //Multiply by the filter and conjugate, so that the forward kernel computes the inverse transform
+        for (uint32 n = 0u; n < radixSize; n++) {
+            T r = (convolutionReal[n] * filterReal[n]) - (convolutionImaginary[n] * filterImaginary[n]);
+            T i = (convolutionReal[n] * filterImaginary[n]) + (convolutionImaginary[n] * filterReal[n]);
+            convolutionReal[n] = r;
+            convolutionImaginary[n] = -i;
+        }
+        RadixTransform(convolutionReal, convolutionImaginary);
+        //X[k] = chirp[k] * conj(convolution[k])
+        for (uint32 k = 0u; k < coreSize; k++) {
+            T r = convolutionReal[k];
+            T i = -convolutionImaginary[k];
+            re[k] = (r * chirpReal[k]) - (i * chirpImaginary[k]);
+            im[k] = (r * chirpImaginary[k]) + (i * chirpReal[k]);
+        }
+    }
+}
+
+template<typename T>
+void FFTHelperT<T>::Transform(const T * const inputReal,
+                              const T * const inputImaginary) {
+    if (realPacked) {
+        //z[n] = x[2n] + i*x[2n+1]
+        for (uint32 n = 0u; n < coreSize; n++) {
+            workReal[n] = inputReal[2u * n];
+            workImaginary[n] = inputReal[(2u * n) + 1u];
+        }
+        CoreTransform(workReal, workImaginary);
+        //X[k] = E[k] + exp(-2*pi*i*k/N) * O[k] with E[k] = (Z[k] + conj(Z[N/2-k]))/2 and O[k] = -i*(Z[k] - conj(Z[N/2-k]))/2
+        const T half = static_cast<T>(0.5);
+        for (uint32 k = 0u; k <= coreSize; k++) {
+            uint32 kk = (k < coreSize) ? (k) : (0u);
+            uint32 kc = (k > 0u) ? (coreSize - k) : (0u);
+            T zr = workReal[kk];
+            T zi = workImaginary[kk];
+            T cr = workReal[kc];
+            T ci = -workImaginary[kc];
+            T er = half * (zr + cr);
+            T ei = half * (zi + ci);
+            T or_ = half * (zi - ci);
+            T oi = -half * (zr - cr);
+            T xr = er + ((splitReal[k] * or_) - (splitImaginary[k] * oi));
+            T xi = ei + ((splitReal[k] * oi) + (splitImaginary[k] * or_));
+            spectrumReal[k] = xr;
+            spectrumImaginary[k] = xi;
+            if ((k > 0u) && (k < coreSize)) {
+                spectrumReal[size - k] = xr;
+                spectrumImaginary[size - k] = -xi;
+            }
+        }
+    }
+    else {
+        for (uint32 n = 0u; n < size; n++) {
+            spectrumReal[n] = inputReal[n];
+            spectrumImaginary[n] = (complexInput) ? (inputImaginary[n]) : (static_cast<T>(0));
+        }
+        CoreTransform(spectrumReal, spectrumImaginary);
+    }
+}
+
+template<typename T>
+void FFTHelperT<T>::Complex(const void * const inputReal,
+                            const void * const inputImaginary,
+                            void * const outputReal,
+                            void * const outputImaginary,
+                            const uint32 numberOfOutputs) {
+    Transform(static_cast<const T *>(inputReal), static_cast<const T *>(inputImaginary));
+    uint32 copySize = static_cast<uint32>(numberOfOutputs * sizeof(T));
+    /*lint -e{534} the copy can only fail if the pointers are NULL*/
+    MemoryOperationsHelper::Copy(outputReal, spectrumReal, copySize);
+    /*lint -e{534} the copy can only fail if the pointers are NULL*/
+    MemoryOperationsHelper::Copy(outputImaginary, spectrumImaginary, copySize);
+}
+
+template<typename T>
+void FFTHelperT<T>::MagnitudePhase(const void * const inputReal,
+                                   const void * const inputImaginary,
+                                   void * const magnitude,
+                                   void * const phase,
+                                   const uint32 numberOfOutputs) {
+    Transform(static_cast<const T *>(inputReal), static_cast<const T *>(inputImaginary));
+    T * const magnitudeT = static_cast<T *>(magnitude);
+    for (uint32 k = 0u; k < numberOfOutputs; k++) {
+        magnitudeT[k] = static_cast<T>(sqrt((spectrumReal[k] * spectrumReal[k]) + (spectrumImaginary[k] * spectrumImaginary[k])));
+    }
+    if (phase != NULL_PTR(void *)) {
+        T * const phaseT = static_cast<T *>(phase);
+        for (uint32 k = 0u; k < numberOfOutputs; k++) {
+            phaseT[k] = static_cast<T>(atan2(spectrumImaginary[k], spectrumReal[k]));
+        }
+    }
+}
+
+template<typename T>
+uint32 FFTHelperT<T>::GetSize() const {
+    return size;
+}
+
+template<typename T>
+uint32 FFTHelperT<T>::GetRadixSize() const {
+    return radixSize;
+}
+
+template<typename T>
+bool FFTHelperT<T>::IsBluestein() const {
+    return bluestein;
+}
+
+template<typename T>
+bool FFTHelperT<T>::IsRealPacked() const {
+    return realPacked;
+}
+
+}
+
+#endif /* SOURCE_COMPONENTS_GAMS_FFTGAM_FFTHELPERT_H_ */
@@ -32,6 +32,7 @@
 /*---------------------------------------------------------------------------*/
 #include "AdvancedErrorManagement.h"
 #include "FilterGAM.h"
+#include "FilterHelperT.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -44,74 +45,110 @@
 namespace MARTe {
 FilterGAM::FilterGAM() :
         GAM() {
-    num = NULL_PTR(float32 *);
-    den = NULL_PTR(float32 *);
+    num = NULL_PTR(float64 *);
+    den = NULL_PTR(float64 *);
     numberOfNumCoeff = 0u;
     numberOfDenCoeff = 0u;
+    sos = NULL_PTR(float64 *);
+    numberOfSections = 0u;
+    sosGain = 1.0;
     staticGain = 0.0F;
     numberOfSamples = 0u;
-    lastInputs = NULL_PTR(float32 **);
-    lastOutputs = NULL_PTR(float32 **);
-    output = NULL_PTR(float32 **);
-    input = NULL_PTR(float32 **);
+    filter = NULL_PTR(FilterHelper *);
     numberOfSignals = 0u;
     gainInfinite = false;
     resetInEachState = true;
 }
 
 FilterGAM::~FilterGAM() {
-    if (num != NULL_PTR(float32 *)) {
+    if (num != NULL_PTR(float64 *)) {
         delete[] num;
     }
-    if (den != NULL_PTR(float32 *)) {
+    if (den != NULL_PTR(float64 *)) {
         delete[] den;
     }
-    if (lastInputs != NULL_PTR(float32 **)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (lastInputs[i] != NULL_PTR(float32 *)) {
-                delete[] lastInputs[i];
+    if (sos != NULL_PTR(float64 *)) {
+        delete[] sos;
+    }
+    if (filter != NULL_PTR(FilterHelper *)) {
+        delete filter;
+    }
+}
+
+bool FilterGAM::Initialise(StructuredDataI& data) {
+    bool errorDetected = false;
+    bool ok = GAM::Initialise(data);
+    AnyType sosMatrix = data.GetType("SOS");
+    bool useSOS = (sosMatrix.GetDataPointer() != NULL);
+    if ((ok) && (useSOS)) {
+        ok = ((sosMatrix.GetNumberOfDimensions() == 2u) && (sosMatrix.GetNumberOfElements(0u) == 6u));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "SOS must be a matrix with 6 columns {b0 b1 b2 a0 a1 a2}");
+            errorDetected = true;
+        }
+        if (ok) {
+            numberOfSections = sosMatrix.GetNumberOfElements(1u);
+            ok = (numberOfSections > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The number of second order sections must be > 0");
+                errorDetected = true;
             }
         }
-        delete[] lastInputs;
-    }
-    if (lastOutputs != NULL_PTR(float32 **)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (lastOutputs[i] != NULL_PTR(float32 *)) {
-                delete[] lastOutputs[i];
+        if (ok) {
+            ok = ((data.GetType("Num").GetDataPointer() == NULL) && (data.GetType("Den").GetDataPointer() == NULL));
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Num and Den cannot be specified together with SOS");
+                errorDetected = true;
             }
         }
-        delete[] lastOutputs;
-    }
-    if (input != NULL_PTR(float32 **)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (input[i] != NULL_PTR(float32 *)) {
-                input[i] = NULL_PTR(float32 *);
+        if (ok) {
+            sos = new float64[6u * numberOfSections];
+            Matrix<float64> sosMatrixValues(sos, numberOfSections, 6u);
+            ok = data.Read("SOS", sosMatrixValues);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading SOS");
+                errorDetected = true;
             }
         }
-        delete [] input;
-    }
-    if (output != NULL_PTR(float32 **)) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            if (output[i] != NULL_PTR(float32 *)) {
-                output[i] = NULL_PTR(float32 *);
+        if (ok) {
+            if (!data.Read("Gain", sosGain)) {
+                sosGain = 1.0;
+            }
+            ok = CheckNormalisation();
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The second order sections must be normalised (a0 = 1) before being introduced into the GAM");
+                errorDetected = true;
+            }
+        }
+        if (ok) {
+            float64 gain = sosGain;
+            for (uint32 s = 0u; (s < numberOfSections) && (!gainInfinite); s++) {
+                //if due to MISRA rules however it is not necessary. At his line the initialization of sos is guaranteed b the ok = true...
+                if (sos != NULL_PTR(float64 *)) {
+                    float64 sumNumerator = (sos[6u * s] + sos[(6u * s) + 1u]) + sos[(6u * s) + 2u];
+                    float64 sumDenominator = (sos[(6u * s) + 3u] + sos[(6u * s) + 4u]) + sos[(6u * s) + 5u];
+                    if (!IsEqual(sumDenominator, 0.0)) {
+                        gain *= (sumNumerator / sumDenominator);
+                    }
+                    else {
+                        gainInfinite = true;
+                    }
+                }
+            }
+            if (!gainInfinite) {
+                staticGain = static_cast<float32>(gain);
             }
         }
-        delete [] output;
     }
-}
-
-bool FilterGAM::Initialise(StructuredDataI& data) {
     AnyType functionsArray = data.GetType("Num");
-    bool errorDetected = false;
-    bool ok = GAM::Initialise(data);
-    if (ok) {
+    if ((ok) && (!useSOS)) {
         ok = (functionsArray.GetDataPointer() != NULL);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the numerator");
             errorDetected = true;
         }
     }
-    if (ok) {
+    if ((ok) && (!useSOS)) {
         numberOfNumCoeff = functionsArray.GetNumberOfElements(0u);
         ok = (numberOfNumCoeff > 0u);
     }
@@ -120,9 +157,9 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfNumCoeff must be > 0");
         errorDetected = true;
     }
-    if (ok) {
-        num = new float32[numberOfNumCoeff];
-        Vector<float32> numVector(num, numberOfNumCoeff);
+    if ((ok) && (!useSOS)) {
+        num = new float64[numberOfNumCoeff];
+        Vector<float64> numVector(num, numberOfNumCoeff);
         ok = (data.Read("Num", numVector));
         if ((!ok) && (!errorDetected)) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading numerator");
@@ -130,14 +167,14 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
         }
     }
     AnyType functionsArray1 = data.GetType("Den");
-    if (ok) {
+    if ((ok) && (!useSOS)) {
         ok = (functionsArray1.GetDataPointer() != NULL);
     }
     if ((!ok) && (!errorDetected)) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "Error getting pointer to the denominator");
         errorDetected = true;
     }
-    if (ok) {
+    if ((ok) && (!useSOS)) {
         numberOfDenCoeff = functionsArray1.GetNumberOfElements(0u);
         ok = (numberOfDenCoeff > 0u);
     }
@@ -146,9 +183,9 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "numberOfDenCoeff must be > 0");
         errorDetected = true;
     }
-    if (ok) {
-        den = new float32[numberOfDenCoeff];
-        Vector<float32> denVector(den, numberOfDenCoeff);
+    if ((ok) && (!useSOS)) {
+        den = new float64[numberOfDenCoeff];
+        Vector<float64> denVector(den, numberOfDenCoeff);
         ok = data.Read("Den", denVector);
         if (!ok) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading denominator");
@@ -162,24 +199,24 @@ bool FilterGAM::Initialise(StructuredDataI& data) {
             }
         }
     }
-    if (ok) {
-        float32 sumNumerator = 0.0F;
+    if ((ok) && (!useSOS)) {
+        float64 sumNumerator = 0.0;
         for (uint32 i = 0u; i < numberOfNumCoeff; i++) {
             //if due to MISRA rules however it is not necessary. At his line the initialization of num is guaranteed b the ok = true...
-            if (num != NULL_PTR(float32 *)) {
+            if (num != NULL_PTR(float64 *)) {
                 sumNumerator += num[i];
             }
         }
-        float32 sumDenominator = 0.0F;
+        float64 sumDenominator = 0.0;
         for (uint32 i = 0u; i < numberOfDenCoeff; i++) {
             //if due to MISRA rules however it is not necessary. At his line the initialization of den is guaranteed b the ok = true...
-            if (den != NULL_PTR(float32 *)) {
+            if (den != NULL_PTR(float64 *)) {
                 sumDenominator += den[i];
             }
         }
-        if (!IsEqual(sumDenominator, 0.0F)) {
+        if (!IsEqual(sumDenominator, 0.0)) {
             //lint -e{414} sumDenominator cannot be 0.
-            staticGain = sumNumerator / sumDenominator;
+            staticGain = static_cast<float32>(sumNumerator / sumDenominator);
         }
         else {
             gainInfinite = true;
@@ -226,27 +263,9 @@ bool FilterGAM::Setup() {
             errorDetected = true;
         }
     }
-    //initialise lastInputs & lastOutputs
+    TypeDescriptor signalType = InvalidType;
     if (!errorDetected) {
-        lastInputs = new float32 *[numberOfSignals];
-        lastOutputs = new float32*[numberOfSignals];
-        //if due to MISRA rules
-        if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-            for (uint32 m = 0u; (m < numberOfSignals) && (!errorDetected); m++) {
-                uint32 auxToTrickMISRA = numberOfNumCoeff - 1u;
-                uint32 aux2ToTrickMISRA = numberOfDenCoeff - 1u;
-                lastInputs[m] = new float32[auxToTrickMISRA];
-                lastOutputs[m] = new float32[aux2ToTrickMISRA];
-                if ((lastInputs[m] != NULL_PTR(float32 *)) && (lastOutputs[m] != NULL_PTR(float32 *))) {
-                    for (uint32 i = 0u; i < (numberOfDenCoeff - 1u); i++) {
-                        lastOutputs[m][i] = 0.0F;
-                    }
-                    for (uint32 i = 0u; i < (numberOfNumCoeff - 1u); i++) {
-                        lastInputs[m][i] = 0.0F;
-                    }
-                }
-            }
-        }
+        signalType = GetSignalType(InputSignals, 0u);
     }
 
     uint32 *numberOfSamplesInput = NULL_PTR(uint32 *);
@@ -291,14 +310,17 @@ bool FilterGAM::Setup() {
                     REPORT_ERROR(ErrorManagement::ParametersError, "numberOfSamplesOutput must be 1 ");
                     errorDetected = true;
                 }
-                ok = (GetSignalType(InputSignals, i) == Float32Bit);
+                ok = ((signalType == Float32Bit) || (signalType == Float64Bit));
+                if (ok) {
+                    ok = (GetSignalType(InputSignals, i) == signalType);
+                }
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be) ", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 or float64 as the first input signal)", auxIndex);
                     errorDetected = true;
                 }
-                ok = (GetSignalType(OutputSignals, i) == Float32Bit);
+                ok = (GetSignalType(OutputSignals, i) == signalType);
                 if ((!ok) && (!errorDetected)) {
-                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the input signal %u failed (not float32 as it should be)", auxIndex);
+                    REPORT_ERROR(ErrorManagement::ParametersError, "GetSignalType for the output signal %u failed (not the same type as the input signals)", auxIndex);
                     errorDetected = true;
                 }
             }
@@ -411,13 +433,26 @@ bool FilterGAM::Setup() {
         }
     }
     if (!errorDetected) {
-        input = new float32 *[numberOfSignals];
-        output = new float32 *[numberOfSignals];
-        if ((input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **))) {
-            for (uint32 i = 0u; i < numberOfSignals; i++) {
-                input[i] = static_cast<float32 *>(GetInputSignalMemory(i));
-                output[i] = static_cast<float32 *>(GetOutputSignalMemory(i));
-            }
+        if (signalType == Float64Bit) {
+            filter = new FilterHelperT<float64>();
+        }
+        else {
+            filter = new FilterHelperT<float32>();
+        }
+        if (sos != NULL_PTR(float64 *)) {
+            ok = filter->InitialiseCascade(sos, numberOfSections, sosGain, numberOfSignals, numberOfSamples);
+        }
+        else {
+            ok = filter->InitialiseDirectForm(num, numberOfNumCoeff, den, numberOfDenCoeff, numberOfSignals, numberOfSamples);
+        }
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "Could not allocate the filter state");
+            errorDetected = true;
+        }
+    }
+    if (!errorDetected) {
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            filter->SetSignalMemory(i, GetInputSignalMemory(i), GetOutputSignalMemory(i));
         }
     }
     //Free pointers MISRA rules
@@ -437,48 +472,9 @@ bool FilterGAM::Setup() {
 }
 
 bool FilterGAM::Execute() {
-    uint32 n = 0u;
-    float32 accumulator;
     //if due to MISRA rules...
-    if ((input != NULL_PTR(float32 **)) && (output != NULL_PTR(float32 **)) && (lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **)) && (num != NULL_PTR(float32 *))
-            && (den != NULL_PTR(float32 *))) {
-        for (uint32 i = 0u; i < numberOfSignals; i++) {
-            //if de to MISRA rules
-            if ((input[i] != NULL_PTR(float32 *)) && (output[i] != NULL_PTR(float32 *)) && (lastInputs[i] != NULL_PTR(float32 *)) && (lastOutputs[i] != NULL_PTR(float32 *))) {
-                n = 0u;
-                while (n < numberOfSamples) {
-                    accumulator = 0.0F;
-                    //sum inputs
-                    for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
-                        if (n >= k) {
-                            accumulator += input[i][n - k] * num[k];
-                        }
-                        else {
-                            accumulator += (lastInputs[i][(k - n) - 1u]) * num[k];
-                        }
-                    }
-                    //Sum outputs
-                    for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
-                        if (n >= k) {
-                            accumulator -= output[i][n - k] * den[k];
-                        }
-                        else {
-                            accumulator -= lastOutputs[i][(k - n) - 1u] * den[k];
-                        }
-                    }
-                    output[i][n] = accumulator;
-                    n++;
-                }
-
-                //update the last values
-                for (uint32 k = 0u; k < (numberOfNumCoeff - 1u); k++) {
-                    lastInputs[i][k] = input[i][(numberOfSamples - k) - 1u];
-                }
-                for (uint32 k = 0u; k < (numberOfDenCoeff - 1u); k++) {
-                    lastOutputs[i][k] = output[i][(numberOfSamples - k) - 1u];
-                }
-            }
-        }
+    if (filter != NULL_PTR(FilterHelper *)) {
+        filter->Execute();
     }
     return true;
 }
@@ -489,44 +485,22 @@ bool FilterGAM::GetResetInEachState() const {
 bool FilterGAM::PrepareNextState(const char8 * const currentStateName, const char8 * const nextStateName) {
     bool ret = true;
     if (resetInEachState) {
-        if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-            for (uint32 i = 0u; i < numberOfSignals; i++) {
-                if (lastInputs[i] != NULL_PTR(float32 *)) {
-                    for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                        lastInputs[i][n] = 0.0F;
-                    }
-                }
-                if (lastOutputs[i] != NULL_PTR(float32 *)) {
-                    for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                        lastOutputs[i][n] = 0.0F;
-                    }
-                }
-            }
+        if (filter != NULL_PTR(FilterHelper *)) {
+            filter->Reset();
         }
         else {
-            REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
+            REPORT_ERROR(ErrorManagement::ParametersError, "The filter state is not allocated");
             ret = false;
         }
     }
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            if ((lastInputs != NULL_PTR(float32 **)) && (lastOutputs != NULL_PTR(float32 **))) {
-                for (uint32 i = 0u; i < numberOfSignals; i++) {
-                    if (lastInputs[i] != NULL_PTR(float32 *)) {
-                        for (uint32 n = 0u; n < (numberOfNumCoeff - 1u); n++) {
-                            lastInputs[i][n] = 0.0F;
-                        }
-                    }
-                    if (lastOutputs[i] != NULL_PTR(float32 *)) {
-                        for (uint32 n = 0u; n < (numberOfDenCoeff - 1u); n++) {
-                            lastOutputs[i][n] = 0.0F;
-                        }
-                    }
-                }
+            if (filter != NULL_PTR(FilterHelper *)) {
+                filter->Reset();
             }
             else {
-                REPORT_ERROR(ErrorManagement::ParametersError, "lastInputs or lastOutputs = NULL ");
+                REPORT_ERROR(ErrorManagement::ParametersError, "The filter state is not allocated");
                 ret = false;
             }
         }
@@ -543,11 +517,15 @@ uint32 FilterGAM::GetNumberOfDenCoeff() const {
     return numberOfDenCoeff;
 }
 
+uint32 FilterGAM::GetNumberOfSections() const {
+    return numberOfSections;
+}
+
 bool FilterGAM::GetNumCoeff(float32 * const coeff) const {
     bool ret = false;
-    if (num != NULL_PTR(float32 *)) {
+    if (num != NULL_PTR(float64 *)) {
         for (uint32 i = 0U; i < numberOfNumCoeff; i++) {
-            coeff[i] = num[i];
+            coeff[i] = static_cast<float32>(num[i]);
         }
         ret = true;
     }
@@ -556,9 +534,9 @@ bool FilterGAM::GetNumCoeff(float32 * const coeff) const {
 
 bool FilterGAM::GetDenCoeff(float32 * const coeff) const {
     bool ret = false;
-    if (den != NULL_PTR(float32 *)) {
+    if (den != NULL_PTR(float64 *)) {
         for (uint32 i = 0u; i < numberOfDenCoeff; i++) {
-            coeff[i] = den[i];
+            coeff[i] = static_cast<float32>(den[i]);
         }
         ret = true;
     }
@@ -567,8 +545,17 @@ bool FilterGAM::GetDenCoeff(float32 * const coeff) const {
 
 bool FilterGAM::CheckNormalisation() const {
     bool ret = false;
-    if (den != NULL_PTR(float32 *)) {
-        ret = (IsEqual(static_cast<float32>(1.0), den[0]));
+    if (den != NULL_PTR(float64 *)) {
+        ret = (IsEqual(1.0, den[0]));
+    }
+    else if (sos != NULL_PTR(float64 *)) {
+        ret = true;
+        for (uint32 s = 0u; (s < numberOfSections) && (ret); s++) {
+            ret = (IsEqual(1.0, sos[(6u * s) + 3u]));
+        }
+    }
+    else {
+        ret = false;
     }
     return ret;
 }
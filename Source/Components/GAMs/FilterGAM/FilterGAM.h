@@ -32,6 +32,7 @@
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
 
+#include "FilterHelper.h"
 #include "GAM.h"
 #include "StructuredDataI.h"
 /*---------------------------------------------------------------------------*/
@@ -40,9 +41,11 @@
 
 namespace MARTe {
 /**
- * @brief GAM which allows to implement FIR & IIR filter with float32 type.
+ * @brief GAM which allows to implement FIR & IIR filter with float32 or float64 type.
  * @details The GAM configured coefficients of the filter must have
  * the numerator (num) and denominator (den) defined and normalised. If a FIR filter is implemented the Den = 1;
+ * Alternatively, high order IIR filters (which are numerically unstable in the direct form) can be configured as a cascade of
+ * second order sections (see SOS below).
  *
  * The filter returns the solution to the following linear,
  * time-invariant difference equation:
@@ -62,7 +65,11 @@ namespace MARTe {
  * \f$
  *
  * The GAM supports multiple input signals (and output signal) only if the characteristics of the input arrays are the same
- * (i.e. The input signals have the same number of elements, the same number of samples and the same type). Currently, the only type supported is float32.
+ * (i.e. The input signals have the same number of elements, the same number of samples and the same type). The supported types are float32 and float64
+ * (the coefficients are converted to the signal type).
+ *
+ * All the signals are filtered together by a FilterHelperT, which stores the filter state channel-interleaved so that the innermost loop
+ * processes several signals per SIMD instruction. Thus, filtering many signals with a single FilterGAM is much cheaper than using one FilterGAM per signal.
  *
  * The inputs and outputs must be arrays (could be arrays of 1 elements).
  *
@@ -70,7 +77,16 @@ namespace MARTe {
  *
  * Moreover the function offers the method StaticGain() in order to make available the real gain of the filter (after converting into float32).
  *
- * @pre The filter must be normalised (den[0] = 1).
+ * When the SOS (second order sections) matrix is specified, Num and Den shall not be specified and the filter is
+ *
+ * \f$
+ * H(z)=Gain*\prod_{s} \frac{b0_s+b1_s*z^{-1}+b2_s*z^{-2}}{1+a1_s*z^{-1}+a2_s*z^{-2}}
+ * \f$
+ *
+ * where each row of the SOS matrix is {b0 b1 b2 a0 a1 a2} (i.e. the same layout as the MATLAB sos matrix) with a0 = 1. Each section is computed in the
+ * transposed direct form II.
+ *
+ * @pre The filter must be normalised (den[0] = 1 or a0 = 1 for all the sections).
  * @pre The size of the numerator and the denominator must be at least 1;
  * @post The output is the input filtered.
  *
@@ -82,10 +98,12 @@ namespace MARTe {
  *     Num = {0.5 0.5} //Compulsory. Filter numerator coefficient.
  *     Den = {1} //Compulsory. Filter denominator coefficient.
  *     ResetInEachState //Optional. If true the filter will be reset on each state change. Otherwise it will be reset only if the filter was not used in the previous state.
+ *     //SOS = {{0.2 0.4 0.2 1 -0.3 0.1} {1 2 1 1 -0.6 0.4}} //Alternative to Num and Den. One row {b0 b1 b2 a0 a1 a2} per second order section.
+ *     //Gain = 0.5 //Optional, only with SOS. Gain applied to the input of the first section. Default 1.
  *     InputSignals = {
  *         InputSignal1 = { //Filter will be applied to each signal. The number of input and output signals must be the same.
  *             DataSource = "DDB1"
- *             Type = float32 //Only supported type.
+ *             Type = float32 //float32 or float64. All the signals must have the same type.
  *         }
  *         InputSignal2 = {
  *             DataSource = "DDB1"
@@ -126,15 +144,14 @@ public:
 
     /**
      * @brief Free the allocated memory
-     * @details If num, den, lastInputs and/or lastOutputs are not NULL
+     * @details If num, den, sos and/or filter are not NULL
      * the associated memory is freed.
      */
     virtual ~FilterGAM();
 
     /**
      * @brief Initialise the GAM from a configuration file.
-     * @details Allocates memory for the numerator and denominator coefficients and load their values.
-     * Allocates memory for the last input and output values (final state)
+     * @details Allocates memory for the numerator and denominator coefficients (or for the second order sections) and load their values.
      * Checks that the coefficients are normalised.
      * @param[in] data the GAM configuration.
      * @return true on succeed
@@ -163,7 +180,7 @@ public:
     /**
      * @brief Setup the inputs and the outputs of the GAM. Additionally, it verifies the correctness and consistency of the parameters.
      * @details Checks that the input and output pointers are correctly obtained and the number of input and
-     * output parameters are equal and non zero.
+     * output parameters are equal and non zero. Creates the FilterHelperT for the signal type, which allocates the filter state.
      * @return true if all the parameters are specified as described in the class description.
      * @pre
      *   Initialise()
@@ -171,10 +188,7 @@ public:
      * @post
      *   GetNumberOfSamples() = numberOfSamples &&
      *   GetNumberOfSignals() = numberOfSignals &&
-     *   input != NULL &&
-     *   output != NULL &&
-     *   lastInputs != NULL &&
-     *   lastOutputs != NULL
+     *   filter != NULL
      */
     virtual bool Setup();
 
@@ -188,7 +202,7 @@ public:
      *
      * where N is the number of denominator coefficients, M is the number of numerator
      * coefficients, X is the input vector of the filter and Y is the output vector of the
-     * filter
+     * filter (or the equivalent cascade of second order sections).
      *
      * @return true
      * @pre
@@ -204,18 +218,15 @@ public:
     bool GetResetInEachState () const;
 
     /**
-     * @brief Resets the lastInputs and lastOutputs if necessary.
+     * @brief Resets the filter state (last inputs and outputs) if necessary.
      * @details The behaviour of this function can be configured in order to reset the filter every time
      * it is called or when in the previous state the Execute() has not be called not called (and thus the filter has not be applied on such state).
      * @return true if preconditions are met.
      * @pre
-     *   lastInputs != NULL &&
-     *   lastOutput != NULL  &&
+     *   Setup()
      *
      * @post
-     *   lastInputs[m][n] = 0 &&
-     *   lastOutput[m][n] = 0
-     * where m denote the signal index and the n one of the last state of the signal m.
+     *   the last inputs and outputs of all the signals are 0.
      */
     virtual bool PrepareNextState(const char8 * const currentStateName,
                                   const char8 * const nextStateName);
@@ -252,7 +263,7 @@ public:
 
     /**
      * @brief Checks that the coefficients are normalised.
-     * @details Checks that den[0] = 1.
+     * @details Checks that den[0] = 1 (or that a0 = 1 for all the second order sections).
      * @return true if the coefficients are normalised.
      * @pre
      *   Initialise()
@@ -261,7 +272,7 @@ public:
 
     /**
      * @brief Gets the filter static gain value.
-     * @details staticGain= SUM(num)/SUM(den). If the gain is infinite the static gain is 0 and the variable isInfinite is set true
+     * @details staticGain= SUM(num)/SUM(den) (or Gain * PROD(SUM(b)/SUM(a)) for the second order sections). If the gain is infinite the static gain is 0 and the variable isInfinite is set true
      * @param[in] isInfinite indicates if the gain is infinite.
      * @return the staticGain.
      */
@@ -281,16 +292,22 @@ public:
      */
     uint32 GetNumberOfSignals() const;
 
+    /**
+     * @brief Gets the number of second order sections.
+     * @return the number of second order sections (0 if the filter is configured with Num and Den).
+     */
+    uint32 GetNumberOfSections() const;
+
 private:
     /**
      * Pointer to the numerator coefficients.
      */
-    float32 *num;
+    float64 *num;
 
     /**
      * Pointer to the denominator coefficients
      */
-    float32 *den;
+    float64 *den;
 
     /**
      * Holds the number of numerator coefficients
@@ -303,29 +320,29 @@ private:
     uint32 numberOfDenCoeff;
 
     /**
-     * Array of pointer to the last input values
+     * Pointer to the second order sections (6 coefficients per section)
      */
-    float32 **lastInputs;
+    float64 *sos;
 
     /**
-     * Array of pointers to the last output values
+     * Holds the number of second order sections
      */
-    float32 **lastOutputs;
+    uint32 numberOfSections;
 
     /**
-     * Holds the the static gain of the filter computed from its coefficients
+     * Gain applied to the input of the first second order section
      */
-    float32 staticGain;
+    float64 sosGain;
 
     /**
-     * Array of pointers to the input buffers
+     * Holds the the static gain of the filter computed from its coefficients
      */
-    float32 **input;
+    float32 staticGain;
 
     /**
-     * Array of pointers to the output buffers
+     * The filter engine for the type of the signals
      */
-    float32 **output;
+    FilterHelper *filter;
 
     /**
      * Number of values of each array. All arrays have the same numberOfSamples
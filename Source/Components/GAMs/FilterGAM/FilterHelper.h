@@ -0,0 +1,123 @@
+/**
+ * @file FilterHelper.h
+ * @brief Header file for class FilterHelper
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterHelper
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPER_H_
+#define SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPER_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "GeneralDefinitions.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/**
+ * @brief Support class for the FilterGAM. One instance filters all the signals of the GAM.
+ * @details The coefficients are always given in float64 and converted to the type of the signals
+ * (set in the FilterHelperT template).
+ */
+class FilterHelper {
+public:
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~FilterHelper() {
+
+    }
+
+    /**
+     * @brief To be specialised by FilterHelperT for all the supported types.
+     * @details Configures a direct form filter y[n] = sum_k num[k]*x[n-k] - sum_k den[k]*y[n-k] and allocates its state.
+     * @param[in] numIn the numerator coefficients.
+     * @param[in] numberOfNumCoeffIn the number of numerator coefficients (> 0).
+     * @param[in] denIn the (normalised) denominator coefficients.
+     * @param[in] numberOfDenCoeffIn the number of denominator coefficients (> 0).
+     * @param[in] numberOfSignalsIn the number of signals to be filtered.
+     * @param[in] numberOfSamplesIn the number of samples of each signal.
+     * @return true if the state memory could be allocated.
+     */
+    virtual bool InitialiseDirectForm(const float64 * const numIn,
+                                      const uint32 numberOfNumCoeffIn,
+                                      const float64 * const denIn,
+                                      const uint32 numberOfDenCoeffIn,
+                                      const uint32 numberOfSignalsIn,
+                                      const uint32 numberOfSamplesIn) = 0;
+
+    /**
+     * @brief To be specialised by FilterHelperT for all the supported types.
+     * @details Configures a cascade of second order sections (biquads) and allocates its state.
+     * @param[in] sosIn the sections, 6 coefficients per section {b0 b1 b2 1 a1 a2}.
+     * @param[in] numberOfSectionsIn the number of sections (> 0).
+     * @param[in] gainIn the gain applied to the input of the first section.
+     * @param[in] numberOfSignalsIn the number of signals to be filtered.
+     * @param[in] numberOfSamplesIn the number of samples of each signal.
+     * @return true if the state memory could be allocated.
+     */
+    virtual bool InitialiseCascade(const float64 * const sosIn,
+                                   const uint32 numberOfSectionsIn,
+                                   const float64 gainIn,
+                                   const uint32 numberOfSignalsIn,
+                                   const uint32 numberOfSamplesIn) = 0;
+
+    /**
+     * @brief To be specialised by FilterHelperT for all the supported types.
+     * @details Sets the memory of a given signal.
+     * @param[in] signalIdx the signal index.
+     * @param[in] inputIn the input signal memory.
+     * @param[in] outputIn the output signal memory.
+     * @pre
+     *   InitialiseDirectForm() || InitialiseCascade()
+     */
+    virtual void SetSignalMemory(const uint32 signalIdx,
+                                 const void * const inputIn,
+                                 void * const outputIn) = 0;
+
+    /**
+     * @brief To be specialised by FilterHelperT for all the supported types.
+     * @details Sets the filter state (the past inputs and outputs) to zero.
+     */
+    virtual void Reset() = 0;
+
+    /**
+     * @brief To be specialised by FilterHelperT for all the supported types.
+     * @details Filters all the samples of all the signals.
+     * @pre
+     *   SetSignalMemory() called for all the signals.
+     */
+    virtual void Execute() = 0;
+
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPER_H_ */
@@ -0,0 +1,478 @@
+/**
+ * @file FilterHelperT.h
+ * @brief Header file for class FilterHelperT
+ * @date 18/10/2026
+ * @author Llorenc Capella
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FilterHelperT
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPERT_H_
+#define SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPERT_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FilterHelper.h"
+#include "MemoryOperationsHelper.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+/**
+ * @brief Multi-channel filter engine for a given signal type.
+ * @details The state of all the signals is stored channel-interleaved (i.e. the value of the signal c at time n
+ * is stored at [n * numberOfSignals + c]), so that the innermost loop of the filter iterates over the signals
+ * with unit stride, no branches and independent accumulators, which allows the compiler to process several
+ * signals per SIMD instruction.
+ *
+ * In the direct form the past inputs (outputs) are kept, followed by the inputs (outputs) of the current cycle, in a
+ * single contiguous history of (numberOfNumCoeff - 1 + numberOfSamples) rows, so that x[n-k] is always
+ * history[n - k + numberOfNumCoeff - 1] and no test on n >= k is required. At the end of the cycle the last
+ * (numberOfNumCoeff - 1) rows are moved to the beginning of the history.
+ *
+ * In the cascade form each second order section is computed in the transposed direct form II:
+ * y = b0*x + z1; z1 = b1*x - a1*y + z2; z2 = b2*x - a2*y.
+ */
+template<typename T>
+class FilterHelperT: public FilterHelper {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FilterHelperT();
+
+    /**
+     * @brief Destructor. Frees the coefficients and the state memory.
+     */
+    virtual ~FilterHelperT();
+
+    /**
+     * @see FilterHelper::InitialiseDirectForm
+     */
+    virtual bool InitialiseDirectForm(const float64 * const numIn,
+                                      const uint32 numberOfNumCoeffIn,
+                                      const float64 * const denIn,
+                                      const uint32 numberOfDenCoeffIn,
+                                      const uint32 numberOfSignalsIn,
+                                      const uint32 numberOfSamplesIn);
+
+    /**
+     * @see FilterHelper::InitialiseCascade
+     */
+    virtual bool InitialiseCascade(const float64 * const sosIn,
+                                   const uint32 numberOfSectionsIn,
+                                   const float64 gainIn,
+                                   const uint32 numberOfSignalsIn,
+                                   const uint32 numberOfSamplesIn);
+
+    /**
+     * @see FilterHelper::SetSignalMemory
+     * @details A cast to the declared type is performed.
+     */
+    virtual void SetSignalMemory(const uint32 signalIdx,
+                                 const void * const inputIn,
+                                 void * const outputIn);
+
+    /**
+     * @see FilterHelper::Reset
+     */
+    virtual void Reset();
+
+    /**
+     * @see FilterHelper::Execute
+     */
+    virtual void Execute();
+
+private:
+
+    /**
+     * @brief Allocates the signal pointers.
+     */
+    bool AllocateSignals(const uint32 numberOfSignalsIn,
+                         const uint32 numberOfSamplesIn);
+
+    /**
+     * @brief Executes the direct form filter.
+     */
+    void ExecuteDirectForm();
+
+    /**
+     * @brief Executes the cascade of second order sections.
+     */
+    void ExecuteCascade();
+
+    /**
+     * @brief Frees all the memory.
+     */
+    void Free();
+
+    /**
+     * True if the filter is a cascade of second order sections.
+     */
+    bool cascade;
+
+    /**
+     * The number of signals.
+     */
+    uint32 numberOfSignals;
+
+    /**
+     * The number of samples of each signal.
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * The numerator coefficients.
+     */
+    T *num;
+
+    /**
+     * The denominator coefficients.
+     */
+    T *den;
+
+    /**
+     * The number of numerator coefficients.
+     */
+    uint32 numberOfNumCoeff;
+
+    /**
+     * The number of denominator coefficients.
+     */
+    uint32 numberOfDenCoeff;
+
+    /**
+     * Past and current inputs, (numberOfNumCoeff - 1 + numberOfSamples) rows of numberOfSignals values.
+     */
+    T *inputHistory;
+
+    /**
+     * Past and current outputs, (numberOfDenCoeff - 1 + numberOfSamples) rows of numberOfSignals values.
+     */
+    T *outputHistory;
+
+    /**
+     * The number of second order sections.
+     */
+    uint32 numberOfSections;
+
+    /**
+     * The section coefficients {b0 b1 b2 a1 a2} for each section.
+     */
+    T *sections;
+
+    /**
+     * The gain applied to the input of the first section.
+     */
+    T gain;
+
+    /**
+     * The two states of each section, 2 * numberOfSections rows of numberOfSignals values.
+     */
+    T *sectionState;
+
+    /**
+     * The value of all the signals at the current sample (cascade form).
+     */
+    T *sample;
+
+    /**
+     * The input signals memory.
+     */
+    const T **inputs;
+
+    /**
+     * The output signals memory.
+     */
+    T **outputs;
+};
+}
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+/*lint -esym(9107, MARTe::FilterHelperT*) [MISRA C++ Rule 3-1-1] required for template implementation*/
+template<typename T>
+FilterHelperT<T>::FilterHelperT() :
+        FilterHelper() {
+    cascade = false;
+    numberOfSignals = 0u;
+    numberOfSamples = 0u;
+    num = NULL_PTR(T *);
+    den = NULL_PTR(T *);
+    numberOfNumCoeff = 0u;
+    numberOfDenCoeff = 0u;
+    inputHistory = NULL_PTR(T *);
+    outputHistory = NULL_PTR(T *);
+    numberOfSections = 0u;
+    sections = NULL_PTR(T *);
+    gain = static_cast<T>(1);
+    sectionState = NULL_PTR(T *);
+    sample = NULL_PTR(T *);
+    inputs = NULL_PTR(const T **);
+    outputs = NULL_PTR(T **);
+}
+
+template<typename T>
+FilterHelperT<T>::~FilterHelperT() {
+    Free();
+}
+
+template<typename T>
+void FilterHelperT<T>::Free() {
+    T ** const buffers[] = { &num, &den, &inputHistory, &outputHistory, &sections, &sectionState, &sample };
+    const uint32 numberOfBuffers = static_cast<uint32>(sizeof(buffers) / sizeof(buffers[0]));
+    for (uint32 i = 0u; i < numberOfBuffers; i++) {
+        if (*buffers[i] != NULL_PTR(T *)) {
+            delete[] *buffers[i];
+            *buffers[i] = NULL_PTR(T *);
+        }
+    }
+    if (inputs != NULL_PTR(const T **)) {
+        delete[] inputs;
+        inputs = NULL_PTR(const T **);
+    }
+    if (outputs != NULL_PTR(T **)) {
+        delete[] outputs;
+        outputs = NULL_PTR(T **);
+    }
+}
+
+template<typename T>
+bool FilterHelperT<T>::AllocateSignals(const uint32 numberOfSignalsIn,
+                                       const uint32 numberOfSamplesIn) {
+    Free();
+    numberOfSignals = numberOfSignalsIn;
+    numberOfSamples = numberOfSamplesIn;
+    bool ret = ((numberOfSignals > 0u) && (numberOfSamples > 0u));
+    if (ret) {
+        inputs = new const T*[numberOfSignals];
+        outputs = new T*[numberOfSignals];
+        ret = ((inputs != NULL_PTR(const T **)) && (outputs != NULL_PTR(T **)));
+    }
+    if (ret) {
+        for (uint32 c = 0u; c < numberOfSignals; c++) {
+            inputs[c] = NULL_PTR(const T *);
+            outputs[c] = NULL_PTR(T *);
+        }
+    }
+    return ret;
+}
+
+template<typename T>
+bool FilterHelperT<T>::InitialiseDirectForm(const float64 * const numIn,
+                                            const uint32 numberOfNumCoeffIn,
+                                            const float64 * const denIn,
+                                            const uint32 numberOfDenCoeffIn,
+                                            const uint32 numberOfSignalsIn,
+                                            const uint32 numberOfSamplesIn) {
+    bool ret = AllocateSignals(numberOfSignalsIn, numberOfSamplesIn);
+    cascade = false;
+    numberOfNumCoeff = numberOfNumCoeffIn;
+    numberOfDenCoeff = numberOfDenCoeffIn;
+    if (ret) {
+        ret = ((numberOfNumCoeff > 0u) && (numberOfDenCoeff > 0u));
+    }
+    if (ret) {
+        num = new T[numberOfNumCoeff];
+        den = new T[numberOfDenCoeff];
+        inputHistory = new T[((numberOfNumCoeff - 1u) + numberOfSamples) * numberOfSignals];
+        outputHistory = new T[((numberOfDenCoeff - 1u) + numberOfSamples) * numberOfSignals];
+        ret = ((num != NULL_PTR(T *)) && (den != NULL_PTR(T *)) && (inputHistory != NULL_PTR(T *)) && (outputHistory != NULL_PTR(T *)));
+    }
+    if (ret) {
+        for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+            num[k] = static_cast<T>(numIn[k]);
+        }
+        for (uint32 k = 0u; k < numberOfDenCoeff; k++) {
+            den[k] = static_cast<T>(denIn[k]);
+        }
+        Reset();
+    }
+    return ret;
+}
+
+template<typename T>
+bool FilterHelperT<T>::InitialiseCascade(const float64 * const sosIn,
+                                         const uint32 numberOfSectionsIn,
+                                         const float64 gainIn,
+                                         const uint32 numberOfSignalsIn,
+                                         const uint32 numberOfSamplesIn) {
+    bool ret = AllocateSignals(numberOfSignalsIn, numberOfSamplesIn);
+    cascade = true;
+    numberOfSections = numberOfSectionsIn;
+    gain = static_cast<T>(gainIn);
+    if (ret) {
+        ret = (numberOfSections > 0u);
+    }
+    if (ret) {
+        sections = new T[5u * numberOfSections];
+        sectionState = new T[2u * numberOfSections * numberOfSignals];
+        sample = new T[numberOfSignals];
+        ret = ((sections != NULL_PTR(T *)) && (sectionState != NULL_PTR(T *)) && (sample != NULL_PTR(T *)));
+    }
+    if (ret) {
+        for (uint32 s = 0u; s < numberOfSections; s++) {
+            const float64 * const sosRow = &sosIn[6u * s];
+            T * const section = &sections[5u * s];
+            section[0] = static_cast<T>(sosRow[0]);
+            section[1] = static_cast<T>(sosRow[1]);
+            section[2] = static_cast<T>(sosRow[2]);
+            section[3] = static_cast<T>(sosRow[4]);
+            section[4] = static_cast<T>(sosRow[5]);
+        }
+        Reset();
+    }
+    return ret;
+}
+
+template<typename T>
+void FilterHelperT<T>::SetSignalMemory(const uint32 signalIdx,
+                                       const void * const inputIn,
+                                       void * const outputIn) {
+    if (signalIdx < numberOfSignals) {
+        inputs[signalIdx] = static_cast<const T *>(inputIn);
+        outputs[signalIdx] = static_cast<T *>(outputIn);
+    }
+}
+
+template<typename T>
+void FilterHelperT<T>::Reset() {
+    if (cascade) {
+        if (sectionState != NULL_PTR(T *)) {
+            uint32 stateSize = (2u * numberOfSections * numberOfSignals);
+            for (uint32 i = 0u; i < stateSize; i++) {
+                sectionState[i] = static_cast<T>(0);
+            }
+        }
+    }
+    else {
+        if (inputHistory != NULL_PTR(T *)) {
+            uint32 historySize = (((numberOfNumCoeff - 1u) + numberOfSamples) * numberOfSignals);
+            for (uint32 i = 0u; i < historySize; i++) {
+                inputHistory[i] = static_cast<T>(0);
+            }
+        }
+        if (outputHistory != NULL_PTR(T *)) {
+            uint32 historySize = (((numberOfDenCoeff - 1u) + numberOfSamples) * numberOfSignals);
+            for (uint32 i = 0u; i < historySize; i++) {
+                outputHistory[i] = static_cast<T>(0);
+            }
+        }
+    }
+}
+
+template<typename T>
+void FilterHelperT<T>::Execute() {
+    if (cascade) {
+        ExecuteCascade();
+    }
+    else {
+        ExecuteDirectForm();
+    }
+}
+
+template<typename T>
+void FilterHelperT<T>::ExecuteDirectForm() {
+    const uint32 inputDelay = (numberOfNumCoeff - 1u);
+    const uint32 outputDelay = (numberOfDenCoeff - 1u);
+    //Interleave the current inputs after the past ones
+    for (uint32 c = 0u; c < numberOfSignals; c++) {
+        const T * const in = inputs[c];
+        for (uint32 n = 0u; n < numberOfSamples; n++) {
+            inputHistory[((inputDelay + n) * numberOfSignals) + c] = in[n];
+        }
+    }
+    for (uint32 n = 0u; n < numberOfSamples; n++) {
+        T * const y = &outputHistory[(outputDelay + n) * numberOfSignals];
+        for (uint32 c = 0u; c < numberOfSignals; c++) {
+            y[c] = static_cast<T>(0);
+        }
+        for (uint32 k = 0u; k < numberOfNumCoeff; k++) {
+            const T b = num[k];
+            const T * const x = &inputHistory[((inputDelay + n) - k) * numberOfSignals];
+            for (uint32 c = 0u; c < numberOfSignals; c++) {
+                y[c] += x[c] * b;
+            }
+        }
+        for (uint32 k = 1u; k < numberOfDenCoeff; k++) {
+            const T a = den[k];
+            const T * const yPast = &outputHistory[((outputDelay + n) - k) * numberOfSignals];
+            for (uint32 c = 0u; c < numberOfSignals; c++) {
+                y[c] -= yPast[c] * a;
+            }
+        }
+    }
+    //De-interleave the outputs
+    for (uint32 c = 0u; c < numberOfSignals; c++) {
+        T * const out = outputs[c];
+        for (uint32 n = 0u; n < numberOfSamples; n++) {
+            out[n] = outputHistory[((outputDelay + n) * numberOfSignals) + c];
+        }
+    }
+    //Keep the last values for the next cycle
+    if (inputDelay > 0u) {
+        /*lint -e{534} the source and destination are valid by construction*/
+        MemoryOperationsHelper::Move(inputHistory, &inputHistory[numberOfSamples * numberOfSignals],
+                                     static_cast<uint32>(inputDelay * numberOfSignals * sizeof(T)));
+    }
+    if (outputDelay > 0u) {
+        /*lint -e{534} the source and destination are valid by construction*/
+        MemoryOperationsHelper::Move(outputHistory, &outputHistory[numberOfSamples * numberOfSignals],
+                                     static_cast<uint32>(outputDelay * numberOfSignals * sizeof(T)));
+    }
+}
+
+template<typename T>
+void FilterHelperT<T>::ExecuteCascade() {
+    for (uint32 n = 0u; n < numberOfSamples; n++) {
+        for (uint32 c = 0u; c < numberOfSignals; c++) {
+            sample[c] = inputs[c][n] * gain;
+        }
+        for (uint32 s = 0u; s < numberOfSections; s++) {
+            const T b0 = sections[5u * s];
+            const T b1 = sections[(5u * s) + 1u];
+            const T b2 = sections[(5u * s) + 2u];
+            const T a1 = sections[(5u * s) + 3u];
+            const T a2 = sections[(5u * s) + 4u];
+            T * const z1 = &sectionState[(2u * s) * numberOfSignals];
+            T * const z2 = &sectionState[((2u * s) + 1u) * numberOfSignals];
+            for (uint32 c = 0u; c < numberOfSignals; c++) {
+                const T x = sample[c];
+                const T y = (b0 * x) + z1[c];
+                z1[c] = ((b1 * x) - (a1 * y)) + z2[c];
+                z2[c] = (b2 * x) - (a2 * y);
+                sample[c] = y;
+            }
+        }
+        for (uint32 c = 0u; c < numberOfSignals; c++) {
+            outputs[c][n] = sample[c];
+        }
+    }
+}
+
+}
+
+#endif /* SOURCE_COMPONENTS_GAMS_FILTERGAM_FILTERHELPERT_H_ */
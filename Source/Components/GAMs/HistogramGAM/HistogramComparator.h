@@ -84,6 +84,27 @@ public:
      */
     virtual uint32 InRange(const void * const mem)=0;
 
+    /**
+     * @brief Sets non-uniform bin edges, replacing the range given by SetMin(), SetMax() and SetNumberOfBins().
+     * @details The number of bins is set to (\a nEdges + 1): bin 0 counts the values below edges[0], bin i (0 < i < nEdges)
+     * the values in [edges[i-1], edges[i]) and the last bin the values >= edges[nEdges-1].
+     * @param[in] edges the array of \a nEdges edges (of the comparator type) in strictly increasing order.
+     * @param[in] nEdges the number of edges (>= 2).
+     * @return true if the edges are valid.
+     */
+    virtual bool SetEdges(const void * const edges,
+                          const uint32 nEdges)=0;
+
+    /**
+     * @brief Increments, for each of the \a nValues values hold in \a mem, the bin of \a histogram where the value belongs.
+     * @param[in] mem holds the \a nValues occurrence values.
+     * @param[in] nValues the number of values.
+     * @param[in,out] histogram the array of GetNumberOfBins() counters.
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 nValues,
+                            uint32 * const histogram)=0;
+
 };
 
 }
@@ -39,7 +39,11 @@ namespace MARTe {
 /*lint -esym(9107, MARTe::HistogramComparator*) the definition must be in the header because it is a template*/
 
 /**
- * @brief Template version of Comparator
+ * @brief Computes to which bin of the histogram belongs an occurrence of type T.
+ * @details The bin edges are precomputed in a table when the range or the number of bins change.
+ * With uniform bins, the bin is computed directly multiplying by the reciprocal of the bin width and is
+ * then corrected (at most by one bin, due to rounding) against the edge table, so that the cost is independent
+ * of the number of bins. With non-uniform edges (see SetEdges) the bin is found by binary search on the edge table.
  */
 template<typename T>
 class HistogramComparatorT: public HistogramComparator {
@@ -80,8 +84,33 @@ public:
      */
     virtual uint32 InRange(const void * const mem);
 
+    /**
+     * @see HistogramComparator::SetEdges()
+     */
+    virtual bool SetEdges(const void * const edgesIn,
+                          const uint32 nEdges);
+
+    /**
+     * @see HistogramComparator::Accumulate()
+     */
+    virtual void Accumulate(const void * const mem,
+                            const uint32 nValues,
+                            uint32 * const histogram);
+
 private:
 
+    /**
+     * @brief Recomputes the uniform edge table from minLim, maxLim and nBins.
+     */
+    void ComputeUniformEdges();
+
+    /**
+     * @brief Returns the bin of \a value.
+     * @param[in] value the occurrence value.
+     * @return the bin index in [0, nBins - 1].
+     */
+    inline uint32 GetBin(const T value) const;
+
     /**
      * The upper bound
      */
@@ -97,11 +126,27 @@ private:
      */
     T delta;
 
+    /**
+     * The reciprocal of delta (0 if delta is 0)
+     */
+    float64 invDelta;
+
     /**
      * The number of bins
      */
     uint32 nBins;
+
+    /**
+     * The (nBins - 1) edges. edges[0] = minLim and edges[nBins - 2] = maxLim.
+     */
+    T *edges;
+
+    /**
+     * True if the edges were set with SetEdges.
+     */
+    bool customEdges;
 };
+
 }
 
 /*---------------------------------------------------------------------------*/
@@ -117,71 +162,163 @@ HistogramComparatorT<T>::HistogramComparatorT() :
     minLim = static_cast<T>(0);
     nBins = 3u;
     delta = static_cast<T>(0);
-
+    invDelta = 0.0;
+    edges = NULL_PTR(T *);
+    customEdges = false;
 }
 
 template<typename T>
 HistogramComparatorT<T>::~HistogramComparatorT() {
-
+    if (edges != NULL_PTR(T *)) {
+        delete[] edges;
+    }
 }
 
 template<typename T>
 void HistogramComparatorT<T>::SetMin(const void * const min) {
     minLim = *reinterpret_cast<T*>(const_cast<void *>(min));
+    customEdges = false;
+    ComputeUniformEdges();
 }
 
 template<typename T>
 void HistogramComparatorT<T>::SetMax(const void* const max) {
     maxLim = *reinterpret_cast<T*>(const_cast<void *>(max));
+    customEdges = false;
+    ComputeUniformEdges();
 }
 
 template<typename T>
 void HistogramComparatorT<T>::SetNumberOfBins(const uint32 nBinsIn) {
     nBins = nBinsIn;
+    customEdges = false;
+    ComputeUniformEdges();
+}
+
+template<typename T>
+void HistogramComparatorT<T>::ComputeUniformEdges() {
+    delta = static_cast<T>(0);
+    invDelta = 0.0;
+    if (edges != NULL_PTR(T *)) {
+        delete[] edges;
+        edges = NULL_PTR(T *);
+    }
     if (nBins > 2u) {
         T range = (maxLim - minLim);
         uint32 nBinsTemp = (nBins - 2u);
         /*lint -e{737} -e{9117} -e{9125} -e{573} -e{9115} Loss of precision is responsibility of the conversion requested by the user.*/
         delta = static_cast<T>(range / nBinsTemp);
+        if (delta > static_cast<T>(0)) {
+            invDelta = (1.0 / static_cast<float64>(delta));
+        }
+        edges = new T[nBins - 1u];
+        for (uint32 i = 0u; i < nBinsTemp; i++) {
+            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
+            edges[i] = (minLim + static_cast<T>(i * delta));
+        }
+        edges[nBinsTemp] = maxLim;
     }
 }
 
+template<typename T>
+bool HistogramComparatorT<T>::SetEdges(const void * const edgesIn,
+                                       const uint32 nEdges) {
+    const T* newEdges = reinterpret_cast<T*>(const_cast<void *>(edgesIn));
+    bool ret = (nEdges > 1u);
+    for (uint32 i = 1u; (i < nEdges) && (ret); i++) {
+        ret = (newEdges[i - 1u] < newEdges[i]);
+    }
+    if (ret) {
+        if (edges != NULL_PTR(T *)) {
+            delete[] edges;
+        }
+        nBins = (nEdges + 1u);
+        edges = new T[nEdges];
+        for (uint32 i = 0u; i < nEdges; i++) {
+            edges[i] = newEdges[i];
+        }
+        minLim = edges[0];
+        maxLim = edges[nEdges - 1u];
+        delta = static_cast<T>(0);
+        invDelta = 0.0;
+        customEdges = true;
+    }
+    return ret;
+}
+
 template<typename T>
 uint32 HistogramComparatorT<T>::GetNumberOfBins() {
     return nBins;
 }
 
-
 template<typename T>
-uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
-
-    const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
-
+uint32 HistogramComparatorT<T>::GetBin(const T value) const {
     uint32 ret = 0u;
-    if (*toCompare < minLim) {
+    uint32 lastEdge = (nBins - 2u);
+    //The negated comparison sends the NaN to the bin 0
+    if (!(value >= edges[0])) {
         ret = 0u;
     }
-    else if (*toCompare >= maxLim) {
+    else if (value >= edges[lastEdge]) {
         ret = (nBins - 1u);
     }
+    else if ((!customEdges) && (invDelta > 0.0)) {
+        //edges[0] <= value < edges[lastEdge] => the index is in [0, lastEdge - 1]
+        /*lint -e{9122} -e{9114} -e{9115} conversion to the bin index after checking that the value is in range.*/
+        uint32 idx = static_cast<uint32>((static_cast<float64>(value) - static_cast<float64>(minLim)) * invDelta);
+        if (idx >= lastEdge) {
+            idx = (lastEdge - 1u);
+        }
+        //Correct the rounding of the multiplication against the exact edges
+        while ((idx > 0u) && (value < edges[idx])) {
+            idx--;
+        }
+        while (((idx + 1u) < lastEdge) && (value >= edges[idx + 1u])) {
+            idx++;
+        }
+        ret = (idx + 1u);
+    }
     else {
-        //do the division with a
-        for (uint32 i = 0u; (i < (nBins - 2u)); i++) {
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T minRange = (minLim + static_cast<T>(i * delta));
-            /*lint -e{737} -e{9117} -e{9125} -e{9119} -e{9114} -e{9115} -e{776} Loss of precision is responsibility of the conversion requested by the user.*/
-            T maxRange = (minLim + static_cast<T>((i + 1u) * delta));
-            /*lint -e{737} -e{9117} -e{9125} Loss of precision is responsibility of the conversion requested by the user.*/
-            if (((*toCompare) >= (minRange)) && ((*toCompare) < maxRange)) {
-                ret = (i + 1u);
-                break;
+        //Binary search of the last edge <= value. Invariant: edges[low] <= value < edges[high]
+        uint32 low = 0u;
+        uint32 high = lastEdge;
+        while ((high - low) > 1u) {
+            uint32 mid = (low + ((high - low) / 2u));
+            if (value >= edges[mid]) {
+                low = mid;
+            }
+            else {
+                high = mid;
             }
         }
+        ret = (low + 1u);
     }
+    return ret;
+}
 
+template<typename T>
+uint32 HistogramComparatorT<T>::InRange(const void* const mem) {
+    const T* toCompare = reinterpret_cast<T*>(const_cast<void *>(mem));
+    uint32 ret = 0u;
+    if (edges != NULL_PTR(T *)) {
+        ret = GetBin(*toCompare);
+    }
     return ret;
 }
 
+template<typename T>
+void HistogramComparatorT<T>::Accumulate(const void * const mem,
+                                         const uint32 nValues,
+                                         uint32 * const histogram) {
+    const T* values = reinterpret_cast<T*>(const_cast<void *>(mem));
+    if (edges != NULL_PTR(T *)) {
+        for (uint32 i = 0u; i < nValues; i++) {
+            histogram[GetBin(values[i])]++;
+        }
+    }
+}
+
 }
+
 #endif /* COMPARATORT_H_ */
 
@@ -186,6 +186,7 @@ namespace MARTe {
 HistogramGAM::HistogramGAM() :
         GAM() {
     comps = NULL_PTR(HistogramComparator **);
+    numberOfValues = NULL_PTR(uint32 *);
 
     beginCycle = 0u;
     cycleCounter = 0u;
@@ -203,6 +204,10 @@ HistogramGAM::~HistogramGAM() {
         delete[] comps;
         comps = NULL_PTR(HistogramComparator **);
     }
+    if (numberOfValues != NULL_PTR(uint32 *)) {
+        delete[] numberOfValues;
+        numberOfValues = NULL_PTR(uint32 *);
+    }
 }
 
 bool HistogramGAM::Initialise(StructuredDataI &data) {
@@ -226,31 +231,32 @@ bool HistogramGAM::Setup() {
     //check that number of input and output signals are equal
     bool ret = (numberOfInputSignals == numberOfOutputSignals);
 
+    bool *customEdges = NULL_PTR(bool *);
     if (ret) {
         comps = new HistogramComparator *[numberOfInputSignals];
+        numberOfValues = new uint32[numberOfInputSignals];
+        customEdges = new bool[numberOfInputSignals];
 
         for (uint32 i = 0u; (i < numberOfInputSignals); i++) {
             /*lint -e{613} the NULL pointer is checked before*/
             comps[i] = NULL_PTR(HistogramComparator *);
+            numberOfValues[i] = 0u;
+            customEdges[i] = false;
         }
-        //check that the number of dimensions of the input signals is one
+        //all the elements of all the samples of the input signals are accumulated in each cycle
         /*lint -e{850} the variable i does not change in the loop */
         for (uint32 i = 0u; (i < numberOfInputSignals) && (ret); i++) {
             uint32 numberOfElements;
             ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
-            if (ret) {
-                ret = (numberOfElements == 1u);
-                if (!ret) {
-                    REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfElements=1", i);
-                }
-            }
             if (ret) {
                 uint32 numberOfSamples;
                 ret = GetSignalNumberOfSamples(InputSignals, i, numberOfSamples);
                 if (ret) {
-                    ret = (numberOfSamples == 1u);
+                    /*lint -e{613} the NULL pointer is checked before*/
+                    numberOfValues[i] = (numberOfElements * numberOfSamples);
+                    ret = (numberOfValues[i] > 0u);
                     if (!ret) {
-                        REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have NumberOfSamples=1", i);
+                        REPORT_ERROR(ErrorManagement::FatalError, "The input signal %d must have at least one element", i);
                     }
                 }
             }
@@ -269,7 +275,32 @@ bool HistogramGAM::Setup() {
                     if (ret) {
                         ret = signalsDatabase.MoveToChild(i);
                     }
-                    if (ret) {
+                    AnyType edgesArray = signalsDatabase.GetType("Edges");
+                    /*lint -e{613} the NULL pointer is checked before*/
+                    customEdges[i] = (edgesArray.GetDataPointer() != NULL_PTR(void *));
+                    if ((ret) && (customEdges[i])) {
+                        uint32 tsize = static_cast<uint32>(td.numberOfBits);
+                        tsize /= 8u;
+                        uint32 nEdges = edgesArray.GetNumberOfElements(0u);
+                        uint8* ptr = new uint8[tsize * nEdges];
+                        AnyType converted(td, 0u, ptr);
+                        converted.SetNumberOfDimensions(1u);
+                        converted.SetNumberOfElements(0u, nEdges);
+
+                        ret = signalsDatabase.Read("Edges", converted);
+                        if (ret) {
+                            /*lint -e{613} the NULL pointer is checked before*/
+                            ret = comps[i]->SetEdges(ptr, nEdges);
+                            if (!ret) {
+                                REPORT_ERROR(ErrorManagement::InitialisationError, "The Edges of input signal %d must be at least two and strictly increasing", i);
+                            }
+                        }
+                        else {
+                            REPORT_ERROR(ErrorManagement::InitialisationError, "Could not read the Edges of input signal %d", i);
+                        }
+                        delete[] ptr;
+                    }
+                    else if (ret) {
                         uint32 tsize = static_cast<uint32>(td.numberOfBits);
                         tsize /= 8u;
                         uint8* ptr = new uint8[tsize];
@@ -295,6 +326,9 @@ bool HistogramGAM::Setup() {
                         }
                         delete[] ptr;
                     }
+                    else {
+                        //NOOP
+                    }
 
                 }
             }
@@ -311,6 +345,14 @@ bool HistogramGAM::Setup() {
                 if (!ret) {
                     REPORT_ERROR(ErrorManagement::FatalError, "The output signal %d must have at least NumberOfElements=3", i);
                 }
+                /*lint -e{613} the NULL pointer is checked before*/
+                else if (customEdges[i]) {
+                    /*lint -e{613} the NULL pointer is checked before*/
+                    ret = (comps[i]->GetNumberOfBins() == numberOfElements);
+                    if (!ret) {
+                        REPORT_ERROR(ErrorManagement::FatalError, "The output signal %d must have NumberOfElements=%d (number of Edges + 1)", i, comps[i]->GetNumberOfBins());
+                    }
+                }
                 else {
                     /*lint -e{613} the NULL pointer is checked before*/
                     comps[i]->SetNumberOfBins(numberOfElements);
@@ -329,6 +371,9 @@ bool HistogramGAM::Setup() {
     else {
         REPORT_ERROR(ErrorManagement::FatalError, "The number of input signals and output signals must be the same");
     }
+    if (customEdges != NULL_PTR(bool *)) {
+        delete[] customEdges;
+    }
 
     return ret;
 
@@ -359,8 +404,7 @@ bool HistogramGAM::Execute() {
         for (uint32 i = 0u; i < numberOfInputSignals; i++) {
             uint32 *outputSignal = reinterpret_cast<uint32 *>(GetOutputSignalMemory(i));
             /*lint -e{613} the NULL pointer is checked before*/
-            uint32 index = comps[i]->InRange(GetInputSignalMemory(i));
-            outputSignal[index]++;
+            comps[i]->Accumulate(GetInputSignalMemory(i), numberOfValues[i], outputSignal);
         }
     }
     else {
@@ -46,7 +46,10 @@ namespace MARTe {
  * @details For each input signal the following parameters can be defined:\n
  *   MinLim = [the minimum value of the signal]\n
  *   MaxLim = [the maximum value of the signal]\n
- * All the signals in input must be scalar and the number of samples per cycle must be one.\n
+ * or, for non-uniform bins:\n
+ *   Edges = [the strictly increasing bin edges]\n
+ * The input signals can be arrays and can have more than one sample per cycle: all the elements of all the samples are
+ * accumulated in the histogram in each cycle.\n
  * Each output signal represents the histogram of the relative input signal, so the number of input and output
  * signals must coincide. The output signal must be an array of at least three elements and the number of elements
  * is the desired number of bins of the histogram. The algorithm divides the signal range (maxLim - minLim)
@@ -77,6 +80,12 @@ namespace MARTe {
  *   bin 9: (90 <= x < 100)\n
  *   bin 10: (x >= 100)\n
  *
+ * When the Edges are defined (instead of MinLim and MaxLim), the number of elements of the output signal must be the number
+ * of edges + 1. The bin 0 counts the values below Edges[0], the bin i the values in [Edges[i-1], Edges[i]) and the last bin
+ * the values >= Edges[last].\n
+ *
+ * The bin of each value is computed in constant time for uniform bins and by binary search on the edges otherwise.\n
+ *
  * The output signals type must be uint32.\n
  * The user can also define the GAM parameter \a BeginCycleNumber that enables the histogram
  * to start counting only after the specified number of MARTe cycles has passed. Default for this parameter is zero.
@@ -104,6 +113,12 @@ namespace MARTe {
  *             MinLim = 10.5
  *             MaxLim = 20.5
  *         }
+ *         Signal3 = {
+ *             DataSource = "Drv1"
+ *             Type = int16
+ *             Samples = 2000 //All the samples are accumulated in each cycle
+ *             Edges = {-1000 -100 -10 0 10 100 1000} //Optional. Non-uniform bins. Replaces MinLim and MaxLim.
+ *         }
  *     }
  *     OutputSignals = {
  *         Histogram1 = {
@@ -116,6 +131,11 @@ namespace MARTe {
  *             Type = uint32
  *             NumberOfElements = 120
  *         }
+ *         Histogram3 = {
+ *             DataSource = "DDB"
+ *             Type = uint32
+ *             NumberOfElements = 8 //Number of Edges + 1
+ *         }
  *     }
  * }
  * </pre>
@@ -145,9 +165,9 @@ public:
      * @see GAM::Setup()
      * @details Checks that:\n
      *   (NumberOfInputSignals==NumberOfOutputSignals)\n
-     *   (NumberOfElements == 1) for each input signal\n
-     *   (NumberOfSamples == 1) for each input signal\n
+     *   (MinLim and MaxLim) or (Edges strictly increasing) defined for each input signal\n
      *   (NumberOfElements >= 3) for each output signal\n
+     *   (NumberOfElements == number of Edges + 1) for each output signal of an input signal with Edges\n
      *   (Type == uint32) for each output signal\n
      *  @return true if the conditions above are met.
      */
@@ -156,7 +176,7 @@ public:
     /**
      * @see GAM::Excute()
      * @details Executes the histogram algorithm counting and dividing the occurrences of the signals
-     * among the defined number of bins.
+     * (all the elements of all the samples) among the defined number of bins.
      * @return true
      */
     virtual bool Execute();
@@ -177,6 +197,13 @@ protected:
      */
     HistogramComparator **comps;
 
+    /**
+     * The number of values (elements * samples)
+     * of each input signal to be accumulated
+     * in each cycle.
+     */
+    uint32 *numberOfValues;
+
     /**
      * Holds how many cycles to skip before starting
      * the histogram algorithm
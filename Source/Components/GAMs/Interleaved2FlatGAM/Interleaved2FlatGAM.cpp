@@ -34,6 +34,69 @@
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
 
+namespace {
+
+/**
+ * Number of samples of each transpose block. All the channels of a block are copied before moving to the next block,
+ * so that the (interleaved) packets of the block are read from cache.
+ */
+const MARTe::uint32 TRANSPOSE_BLOCK_SIZE = 64u;
+
+/**
+ * @brief Executes a strided operation of the copy plan moving each element as a T.
+ * @details All the offsets and strides of the operation are multiple of sizeof(T) (checked in the Setup).
+ */
+template<typename T>
+void StridedCopy(const MARTe::Interleaved2FlatGAMCopyOperation &operation,
+                 const MARTe::uint8 * const source,
+                 MARTe::uint8 * const destination) {
+    using namespace MARTe;
+    const uint32 wordSize = static_cast<uint32>(sizeof(T));
+    const T *src = reinterpret_cast<const T *>(&source[operation.sourceOffset]);
+    T *dst = reinterpret_cast<T *>(&destination[operation.destinationOffset]);
+    const uint32 srcStride = (operation.sourceStride / wordSize);
+    const uint32 dstStride = (operation.destinationStride / wordSize);
+    const uint32 srcChannelStride = (operation.sourceChannelStride / wordSize);
+    const uint32 dstChannelStride = (operation.destinationChannelStride / wordSize);
+    for (uint32 k0 = 0u; k0 < operation.numberOfElements; k0 += TRANSPOSE_BLOCK_SIZE) {
+        uint32 k1 = (k0 + TRANSPOSE_BLOCK_SIZE);
+        if (k1 > operation.numberOfElements) {
+            k1 = operation.numberOfElements;
+        }
+        for (uint32 c = 0u; c < operation.numberOfChannels; c++) {
+            const T *srcChannel = &src[(c * srcChannelStride) + (k0 * srcStride)];
+            T *dstChannel = &dst[(c * dstChannelStride) + (k0 * dstStride)];
+            for (uint32 k = k0; k < k1; k++) {
+                *dstChannel = *srcChannel;
+                srcChannel = &srcChannel[srcStride];
+                dstChannel = &dstChannel[dstStride];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Executes a strided operation of the copy plan whose elements cannot be moved as a single integer.
+ */
+void StridedCopyBytes(const MARTe::Interleaved2FlatGAMCopyOperation &operation,
+                      const MARTe::uint8 * const source,
+                      MARTe::uint8 * const destination) {
+    using namespace MARTe;
+    for (uint32 c = 0u; c < operation.numberOfChannels; c++) {
+        const uint8 *src = &source[operation.sourceOffset + (c * operation.sourceChannelStride)];
+        uint8 *dst = &destination[operation.destinationOffset + (c * operation.destinationChannelStride)];
+        for (uint32 k = 0u; k < operation.numberOfElements; k++) {
+            for (uint32 b = 0u; b < operation.elementSize; b++) {
+                dst[b] = src[b];
+            }
+            src = &src[operation.sourceStride];
+            dst = &dst[operation.destinationStride];
+        }
+    }
+}
+
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -51,6 +114,8 @@ Interleaved2FlatGAM::Interleaved2FlatGAM() :
     numberOfOutputPacketChunks = NULL_PTR(uint32 *);
     packetOutputChunkSize = NULL_PTR(uint32 *);
     totalSignalsByteSize = 0u;
+    copyPlan = NULL_PTR(Interleaved2FlatGAMCopyOperation *);
+    numberOfCopyOperations = 0u;
 }
 
 Interleaved2FlatGAM::~Interleaved2FlatGAM() {
@@ -86,6 +151,10 @@ Interleaved2FlatGAM::~Interleaved2FlatGAM() {
         delete[] packetOutputChunkSize;
     }
 
+    if (copyPlan != NULL_PTR(Interleaved2FlatGAMCopyOperation *)) {
+        delete[] copyPlan;
+    }
+
 }
 
 /*lint -e{613} null pointer checked.*/
@@ -329,90 +398,224 @@ bool Interleaved2FlatGAM::Setup() {
 
     }
 
+    if (ret) {
+        ret = CompileCopyPlan();
+    }
+
     return ret;
 }
 
 /*lint -e{613} null pointer checked.*/
-bool Interleaved2FlatGAM::Execute() {
-    bool ret = MemoryOperationsHelper::Copy(GetOutputSignalsMemory(), GetInputSignalsMemory(), totalSignalsByteSize);
-    uint32 cnt = 0u;
-    uint32 offset = 0u;
-    for (uint32 n = 0u; (n < numberOfInputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = reinterpret_cast<uint8 *>(GetInputSignalMemory(n));
-
-        uint8 *originDest = &(reinterpret_cast<uint8 *>(GetOutputSignalsMemory()))[offset];
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfInputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *dest = originDest;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * inputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *source = &originSource[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfInputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetInputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                dest = &dest[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfInputSamples[n] - k) * chunkSize);
-                dest = &dest[index];
-                //get the next chunk in source
-                source = &source[chunkSize];
+bool Interleaved2FlatGAM::CompileCopyPlan() {
+    uint32 maxNumberOfOperations = (numberOfInputSignals + numberOfOutputSignals);
+    for (uint32 i = 0u; i < numberOfInputSignals; i++) {
+        maxNumberOfOperations += numberOfInputPacketChunks[i];
+    }
+    for (uint32 j = 0u; j < numberOfOutputSignals; j++) {
+        maxNumberOfOperations += numberOfOutputPacketChunks[j];
+    }
+    copyPlan = new Interleaved2FlatGAMCopyOperation[maxNumberOfOperations];
+    bool ret = (copyPlan != NULL_PTR(Interleaved2FlatGAMCopyOperation *));
+    numberOfCopyOperations = 0u;
+
+    //walk the input and output signals together, one interval between two consecutive signal boundaries at a time, and add the
+    //operations by increasing offset so that adjacent blocks can be merged
+    uint32 i = 0u;
+    uint32 inputOffset = 0u;
+    uint32 inputCnt = 0u;
+    uint32 j = 0u;
+    uint32 outputOffset = 0u;
+    uint32 outputCnt = 0u;
+    uint32 position = 0u;
+    while ((i < numberOfInputSignals) && (j < numberOfOutputSignals) && (ret)) {
+        uint32 inputEnd = (inputOffset + (inputByteSize[i] * numberOfInputSamples[i]));
+        uint32 outputEnd = (outputOffset + (outputByteSize[j] * numberOfOutputSamples[j]));
+        uint32 end = (inputEnd < outputEnd) ? (inputEnd) : (outputEnd);
+        if (numberOfInputPacketChunks[i] > 0u) {
+            //the input signal may span over several output signals: add it only once
+            if (position == inputOffset) {
+                AddPacketCopyOperations(inputOffset, &packetInputChunkSize[inputCnt], numberOfInputPacketChunks[i], numberOfInputSamples[i],
+                                        inputByteSize[i], true);
+            }
+        }
+        else if (numberOfOutputPacketChunks[j] > 0u) {
+            //the output signal may span over several input signals: add it only once
+            if (position == outputOffset) {
+                AddPacketCopyOperations(outputOffset, &packetOutputChunkSize[outputCnt], numberOfOutputPacketChunks[j], numberOfOutputSamples[j],
+                                        outputByteSize[j], false);
             }
         }
-        offset += (inputByteSize[n] * numberOfInputSamples[n]);
-        cnt += numberOfInputPacketChunks[n];
+        else if (end > position) {
+            Interleaved2FlatGAMCopyOperation operation;
+            operation.sourceOffset = position;
+            operation.destinationOffset = position;
+            operation.elementSize = (end - position);
+            operation.numberOfElements = 1u;
+            operation.sourceStride = operation.elementSize;
+            operation.destinationStride = operation.elementSize;
+            operation.numberOfChannels = 1u;
+            operation.sourceChannelStride = 0u;
+            operation.destinationChannelStride = 0u;
+            operation.wordSize = 0u;
+            AddCopyOperation(operation);
+        }
+        else {
+            //empty interval
+        }
+        position = end;
+        if (inputEnd == end) {
+            inputOffset = inputEnd;
+            inputCnt += numberOfInputPacketChunks[i];
+            i++;
+        }
+        if (outputEnd == end) {
+            outputOffset = outputEnd;
+            outputCnt += numberOfOutputPacketChunks[j];
+            j++;
+        }
+    }
+
+    //choose the word used to move the elements of each strided operation
+    for (uint32 n = 0u; (n < numberOfCopyOperations) && (ret); n++) {
+        Interleaved2FlatGAMCopyOperation &operation = copyPlan[n];
+        uint32 size = operation.elementSize;
+        bool canUseWord = ((size == 1u) || (size == 2u) || (size == 4u) || (size == 8u));
+        if (canUseWord) {
+            uint32 bits = (operation.sourceOffset | operation.destinationOffset);
+            bits |= (operation.sourceStride | operation.destinationStride);
+            bits |= (operation.sourceChannelStride | operation.destinationChannelStride);
+            canUseWord = ((bits % size) == 0u);
+        }
+        operation.wordSize = (canUseWord) ? (size) : (0u);
+    }
+    return ret;
+}
 
+/*lint -e{613} null pointer checked.*/
+void Interleaved2FlatGAM::AddPacketCopyOperations(const uint32 offset,
+                                                  const uint32 * const chunkSizes,
+                                                  const uint32 numberOfChunks,
+                                                  const uint32 numberOfSamples,
+                                                  const uint32 packetSize,
+                                                  const bool toFlat) {
+    uint32 packetOffset = 0u;
+    uint32 flatOffset = 0u;
+    for (uint32 i = 0u; i < numberOfChunks; i++) {
+        uint32 chunkSize = chunkSizes[i];
+        Interleaved2FlatGAMCopyOperation operation;
+        operation.elementSize = chunkSize;
+        operation.numberOfElements = numberOfSamples;
+        operation.numberOfChannels = 1u;
+        operation.sourceChannelStride = 0u;
+        operation.destinationChannelStride = 0u;
+        operation.wordSize = 0u;
+        if (toFlat) {
+            operation.sourceOffset = (offset + packetOffset);
+            operation.destinationOffset = (offset + flatOffset);
+            operation.sourceStride = packetSize;
+            operation.destinationStride = chunkSize;
+        }
+        else {
+            operation.sourceOffset = (offset + flatOffset);
+            operation.destinationOffset = (offset + packetOffset);
+            operation.sourceStride = chunkSize;
+            operation.destinationStride = packetSize;
+        }
+        AddCopyOperation(operation);
+        packetOffset += chunkSize;
+        flatOffset += (chunkSize * numberOfSamples);
     }
+}
 
-    cnt = 0u;
-    offset = 0u;
-    for (uint32 n = 0u; (n < numberOfOutputSignals); n++) {
-        //do the split of the signals
-        uint8 *originSource = &(reinterpret_cast<uint8 *>(GetInputSignalsMemory()))[offset];
-
-        uint8 *originDest = reinterpret_cast<uint8 *>(GetOutputSignalMemory(n));
-
-        //this should be the number of samples
-        /*lint -e{613} null pointer checked before.*/
-        for (uint32 k = 0u; k < numberOfOutputSamples[n]; k++) {
-            //return to the gam pointet
-            uint8 *source = originSource;
-            //go to the k-th packet in the data source
-            /*lint -e{613} null pointer checked before.*/
-            uint32 index = (k * outputByteSize[n]);
-            /*lint -e{613} null pointer checked before.*/
-            uint8 *dest = &originDest[index];
-            /*lint -e{613} null pointer checked before.*/
-            for (uint32 i = 0u; i < numberOfOutputPacketChunks[n]; i++) {
-                //get the chunk size
-                index = (cnt + i);
-                /*lint -e{613} null pointer checked before.*/
-                uint32 chunkSize = packetOutputChunkSize[index];
-                //put the k-th element
-                index = (k * chunkSize);
-                source = &source[index];
-                (void) MemoryOperationsHelper::Copy(dest, source, chunkSize);
-                //skip the N-k other samples to go to the next chunk mem
-                index = ((numberOfOutputSamples[n] - k) * chunkSize);
-                source = &source[index];
-                //get the next chunk in source
-                dest = &dest[chunkSize];
+/*lint -e{613} null pointer checked.*/
+void Interleaved2FlatGAM::AddCopyOperation(Interleaved2FlatGAMCopyOperation operation) {
+    //a strided copy of adjacent elements (e.g. a packet with only one member) is a contiguous block
+    bool sameStrides = ((operation.sourceStride == operation.elementSize) && (operation.destinationStride == operation.elementSize));
+    if ((operation.numberOfChannels == 1u) && (sameStrides)) {
+        operation.elementSize *= operation.numberOfElements;
+        operation.numberOfElements = 1u;
+        operation.sourceStride = operation.elementSize;
+        operation.destinationStride = operation.elementSize;
+    }
+    bool isContiguous = ((operation.numberOfElements == 1u) && (operation.numberOfChannels == 1u));
+    bool merged = false;
+    if (numberOfCopyOperations > 0u) {
+        Interleaved2FlatGAMCopyOperation &last = copyPlan[numberOfCopyOperations - 1u];
+        bool lastIsContiguous = ((last.numberOfElements == 1u) && (last.numberOfChannels == 1u));
+        if (isContiguous && lastIsContiguous) {
+            merged = ((last.sourceOffset + last.elementSize) == operation.sourceOffset);
+            merged = (merged && ((last.destinationOffset + last.elementSize) == operation.destinationOffset));
+            if (merged) {
+                last.elementSize += operation.elementSize;
+                last.sourceStride = last.elementSize;
+                last.destinationStride = last.elementSize;
+            }
+        }
+        else if ((!isContiguous) && (!lastIsContiguous)) {
+            //packet members with the same size become one more channel of the same transpose
+            merged = (last.elementSize == operation.elementSize);
+            merged = (merged && (last.numberOfElements == operation.numberOfElements));
+            merged = (merged && (last.sourceStride == operation.sourceStride));
+            merged = (merged && (last.destinationStride == operation.destinationStride));
+            merged = (merged && (operation.sourceOffset > last.sourceOffset) && (operation.destinationOffset > last.destinationOffset));
+            if (merged) {
+                uint32 sourceDistance = (operation.sourceOffset - last.sourceOffset);
+                uint32 destinationDistance = (operation.destinationOffset - last.destinationOffset);
+                if (last.numberOfChannels == 1u) {
+                    last.sourceChannelStride = sourceDistance;
+                    last.destinationChannelStride = destinationDistance;
+                }
+                else {
+                    merged = (sourceDistance == (last.numberOfChannels * last.sourceChannelStride));
+                    merged = (merged && (destinationDistance == (last.numberOfChannels * last.destinationChannelStride)));
+                }
             }
+            if (merged) {
+                last.numberOfChannels++;
+            }
+        }
+        else {
+            //different kind of operations
         }
-        offset += (outputByteSize[n] * numberOfOutputSamples[n]);
-        cnt += numberOfOutputPacketChunks[n];
+    }
+    if (!merged) {
+        copyPlan[numberOfCopyOperations] = operation;
+        numberOfCopyOperations++;
+    }
+}
 
+/*lint -e{613} null pointer checked.*/
+bool Interleaved2FlatGAM::Execute() {
+    bool ret = true;
+    const uint8 *source = reinterpret_cast<const uint8 *>(GetInputSignalsMemory());
+    uint8 *destination = reinterpret_cast<uint8 *>(GetOutputSignalsMemory());
+    //the signals memory is allocated in the heap, but do not assume it
+    bool aligned = (((reinterpret_cast<uintp>(source) | reinterpret_cast<uintp>(destination)) % 8u) == 0u);
+    for (uint32 n = 0u; (n < numberOfCopyOperations) && (ret); n++) {
+        const Interleaved2FlatGAMCopyOperation &operation = copyPlan[n];
+        if ((operation.numberOfElements == 1u) && (operation.numberOfChannels == 1u)) {
+            ret = MemoryOperationsHelper::Copy(&destination[operation.destinationOffset], &source[operation.sourceOffset], operation.elementSize);
+        }
+        else {
+            uint32 wordSize = (aligned) ? (operation.wordSize) : (0u);
+            switch (wordSize) {
+            case 1u:
+                StridedCopy<uint8>(operation, source, destination);
+                break;
+            case 2u:
+                StridedCopy<uint16>(operation, source, destination);
+                break;
+            case 4u:
+                StridedCopy<uint32>(operation, source, destination);
+                break;
+            case 8u:
+                StridedCopy<uint64>(operation, source, destination);
+                break;
+            default:
+                StridedCopyBytes(operation, source, destination);
+                break;
+            }
+        }
     }
 
     return ret;
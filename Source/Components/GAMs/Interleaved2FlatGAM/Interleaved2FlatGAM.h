@@ -38,6 +38,65 @@
 
 namespace MARTe {
 
+/**
+ * @brief One entry of the copy plan compiled by the Interleaved2FlatGAM::Setup.
+ * @details Copies numberOfChannels x numberOfElements elements of elementSize bytes. The element k of the channel c is read at
+ * sourceOffset + c * sourceChannelStride + k * sourceStride and written at destinationOffset + c * destinationChannelStride + k * destinationStride.
+ * All the offsets are in bytes and relative to the beginning of the GAM input (source) and output (destination) signals memory.
+ * A contiguous block of elementSize bytes has numberOfElements = numberOfChannels = 1.
+ */
+struct Interleaved2FlatGAMCopyOperation {
+    /**
+     * Offset of the first element in the input signals memory.
+     */
+    uint32 sourceOffset;
+
+    /**
+     * Offset of the first element in the output signals memory.
+     */
+    uint32 destinationOffset;
+
+    /**
+     * Size of each element in bytes.
+     */
+    uint32 elementSize;
+
+    /**
+     * Number of elements of each channel.
+     */
+    uint32 numberOfElements;
+
+    /**
+     * Distance in bytes between two consecutive elements of the same channel in the input signals memory.
+     */
+    uint32 sourceStride;
+
+    /**
+     * Distance in bytes between two consecutive elements of the same channel in the output signals memory.
+     */
+    uint32 destinationStride;
+
+    /**
+     * Number of channels (i.e. packet members with the same size) copied by this operation.
+     */
+    uint32 numberOfChannels;
+
+    /**
+     * Distance in bytes between the first element of two consecutive channels in the input signals memory.
+     */
+    uint32 sourceChannelStride;
+
+    /**
+     * Distance in bytes between the first element of two consecutive channels in the output signals memory.
+     */
+    uint32 destinationChannelStride;
+
+    /**
+     * Size of the machine word used to move the elements (1, 2, 4 or 8 bytes) or 0 if the elements have to be moved byte by byte.
+     */
+    uint32 wordSize;
+};
+
 /**
  * @brief GAM which allows to translate an interleaved memory region into a flat memory area (and vice-versa).
  * @details Some data-sources are expected to produce signals which are interleaved, i.e. which are in the form:
@@ -240,6 +299,13 @@ namespace MARTe {
  *     }
  * }
  * </pre>
+ *
+ * The translation is compiled in the Setup into a plan of copy operations (see Interleaved2FlatGAMCopyOperation), so that the Execute
+ * reads and writes each byte exactly once:
+ *  - consecutive contiguous blocks (e.g. signals without PacketMemberSizes) are merged into a single copy;
+ *  - consecutive packet members with the same size are merged into a single transpose, which is executed in blocks of samples so that
+ *  the packets being read stay in cache while all the channels are written;
+ *  - members with 1, 2, 4 or 8 bytes are moved with the corresponding integer type (other sizes are moved byte by byte).
  */
 class Interleaved2FlatGAM: public GAM {
 public:
@@ -267,6 +333,7 @@ Interleaved2FlatGAM    ();
 
     /**
      * @brief Translates from interleaved to flat memory (or vice-versa).
+     * @details Executes the copy plan compiled in the Setup.
      * @return true.
      */
     virtual bool Execute();
@@ -316,6 +383,46 @@ protected:
      */
     uint32 totalSignalsByteSize;
 
+    /**
+     * The copy plan executed by the Execute.
+     */
+    Interleaved2FlatGAMCopyOperation *copyPlan;
+
+    /**
+     * Number of operations in the copyPlan.
+     */
+    uint32 numberOfCopyOperations;
+
+private:
+
+    /**
+     * @brief Compiles the copyPlan from the signal sizes and from the packet configuration.
+     * @return true if the copyPlan could be allocated.
+     */
+    bool CompileCopyPlan();
+
+    /**
+     * @brief Adds to the copyPlan the operations which (de)interleave one signal.
+     * @param[in] offset the offset of the signal in the GAM signals memory (the same for input and output).
+     * @param[in] chunkSizes the PacketMemberSizes of the signal.
+     * @param[in] numberOfChunks the number of PacketMemberSizes.
+     * @param[in] numberOfSamples the number of packets.
+     * @param[in] packetSize the sum of the PacketMemberSizes.
+     * @param[in] toFlat true if the interleaved signal is the input signal.
+     */
+    void AddPacketCopyOperations(const uint32 offset,
+                                 const uint32 * const chunkSizes,
+                                 const uint32 numberOfChunks,
+                                 const uint32 numberOfSamples,
+                                 const uint32 packetSize,
+                                 const bool toFlat);
+
+    /**
+     * @brief Adds an operation to the copyPlan, merging it with the last one when possible.
+     * @param[in] operation the operation to add.
+     */
+    void AddCopyOperation(Interleaved2FlatGAMCopyOperation operation);
+
 };
 
 }
@@ -49,20 +49,21 @@ namespace MARTe {
 
 PIDGAM::PIDGAM() :
         GAM() {
-    kp = 0.0;
-    proportional = 0.0;
-    ki = 0.0;
-    kid = 0.0;
-    integral = 0.0;
-    kd = 0.0;
-    kdd = 0.0;
-    derivative = 0.0;
+    kp = NULL_PTR(float64 *);
+    kid = NULL_PTR(float64 *);
+    kdd = NULL_PTR(float64 *);
+    ktd = NULL_PTR(float64 *);
+    maxOutput = NULL_PTR(float64 *);
+    minOutput = NULL_PTR(float64 *);
+    maxOutputDelta = NULL_PTR(float64 *);
+    numberOfParameters = 0u;
     sampleTime = 0.0;
-    maxOutput = MAX_FLOAT64;
-    minOutput = -MAX_FLOAT64;
-    enableIntegral = true;
-    lastInput = 0.0;
-    lastIntegral = 0.0;
+    backCalculation = false;
+    rateLimit = false;
+    enableIntegral = NULL_PTR(bool *);
+    lastInput = NULL_PTR(float64 *);
+    lastIntegral = NULL_PTR(float64 *);
+    lastOutput = NULL_PTR(float64 *);
     enableSubstraction = false;
     reference = NULL_PTR(float64 *);
     sizeInputOutput = 0u;
@@ -83,25 +84,160 @@ PIDGAM::PIDGAM() :
 }
 
 PIDGAM::~PIDGAM() {
+    if (kp != NULL_PTR(float64 *)) {
+        delete[] kp;
+    }
+    if (kid != NULL_PTR(float64 *)) {
+        delete[] kid;
+    }
+    if (kdd != NULL_PTR(float64 *)) {
+        delete[] kdd;
+    }
+    if (ktd != NULL_PTR(float64 *)) {
+        delete[] ktd;
+    }
+    if (maxOutput != NULL_PTR(float64 *)) {
+        delete[] maxOutput;
+    }
+    if (minOutput != NULL_PTR(float64 *)) {
+        delete[] minOutput;
+    }
+    if (maxOutputDelta != NULL_PTR(float64 *)) {
+        delete[] maxOutputDelta;
+    }
+    if (enableIntegral != NULL_PTR(bool *)) {
+        delete[] enableIntegral;
+    }
+    if (lastInput != NULL_PTR(float64 *)) {
+        delete[] lastInput;
+    }
+    if (lastIntegral != NULL_PTR(float64 *)) {
+        delete[] lastIntegral;
+    }
+    if (lastOutput != NULL_PTR(float64 *)) {
+        delete[] lastOutput;
+    }
     reference = NULL_PTR(float64 *);
     measurement = NULL_PTR(float64 *);
     output = NULL_PTR(float64 *);
 }
 
+bool PIDGAM::ReadParameter(StructuredDataI &data,
+                           const char8 * const name,
+                           const float64 defaultValue,
+                           float64 *&values,
+                           uint32 &numberOfValues,
+                           bool &found) {
+    bool ok = true;
+    AnyType parameter = data.GetType(name);
+    found = (parameter.GetDataPointer() != NULL_PTR(void *));
+    numberOfValues = 1u;
+    if (found) {
+        if (parameter.GetNumberOfDimensions() > 0u) {
+            numberOfValues = parameter.GetNumberOfElements(0u);
+            ok = (numberOfValues > 0u);
+        }
+    }
+    if (ok) {
+        values = new float64[numberOfValues];
+        if (!found) {
+            values[0] = defaultValue;
+        }
+        else if (parameter.GetNumberOfDimensions() == 0u) {
+            ok = data.Read(name, values[0]);
+        }
+        else {
+            Vector<float64> valuesVector(values, numberOfValues);
+            ok = data.Read(name, valuesVector);
+        }
+    }
+    if (!ok) {
+        REPORT_ERROR_STATIC(ErrorManagement::InitialisationError, "Error reading %s", name);
+    }
+    return ok;
+}
+
+bool PIDGAM::ExpandParameter(float64 *&values,
+                             const uint32 numberOfValuesIn,
+                             const uint32 numberOfValuesOut) {
+    bool ok = ((numberOfValuesIn == 1u) || (numberOfValuesIn == numberOfValuesOut));
+    if ((ok) && (numberOfValuesIn != numberOfValuesOut)) {
+        float64 *expanded = new float64[numberOfValuesOut];
+        uint32 i;
+        for (i = 0u; i < numberOfValuesOut; i++) {
+            expanded[i] = values[0];
+        }
+        delete[] values;
+        values = expanded;
+    }
+    return ok;
+}
+
 bool PIDGAM::Initialise(StructuredDataI &data) {
     bool ok = GAM::Initialise(data);
+    uint32 numberOfKp = 0u;
+    uint32 numberOfKi = 0u;
+    uint32 numberOfKd = 0u;
+    uint32 numberOfMaxOutput = 0u;
+    uint32 numberOfMinOutput = 0u;
+    uint32 numberOfTrackingGains = 0u;
+    uint32 numberOfMaxOutputRates = 0u;
+    bool found = false;
     if (ok) {
-        ok = data.Read("Kp", kp);
-        bool aux;
-        aux = data.Read("Ki", ki);
-        ok = (ok || aux);
-        aux = data.Read("Kd", kd);
-        ok = (ok || aux);
+        bool foundKp;
+        bool foundKi;
+        bool foundKd;
+        //The integral and derivative coefficients are converted to the discrete domain once the sampleTime is known.
+        ok = ReadParameter(data, "Kp", 0.0, kp, numberOfKp, foundKp);
+        if (ok) {
+            ok = ReadParameter(data, "Ki", 0.0, kid, numberOfKi, foundKi);
+        }
+        if (ok) {
+            ok = ReadParameter(data, "Kd", 0.0, kdd, numberOfKd, foundKd);
+        }
+        if (ok) {
+            ok = (foundKp || foundKi || foundKd);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
+            }
+        }
+    }
+    if (ok) {
+        ok = ReadParameter(data, "MaxOutput", MAX_FLOAT64, maxOutput, numberOfMaxOutput, found);
+    }
+    if (ok) {
+        ok = ReadParameter(data, "MinOutput", -MAX_FLOAT64, minOutput, numberOfMinOutput, found);
+    }
+    if (ok) {
+        ok = ReadParameter(data, "TrackingGain", 0.0, ktd, numberOfTrackingGains, backCalculation);
+    }
+    if (ok) {
+        ok = ReadParameter(data, "MaxOutputRate", MAX_FLOAT64, maxOutputDelta, numberOfMaxOutputRates, rateLimit);
+    }
+    if (ok) {
+        numberOfParameters = numberOfKp;
+        const uint32 numberOfValues[] = { numberOfKi, numberOfKd, numberOfMaxOutput, numberOfMinOutput, numberOfTrackingGains, numberOfMaxOutputRates };
+        uint32 n;
+        for (n = 0u; n < (sizeof(numberOfValues) / sizeof(uint32)); n++) {
+            if (numberOfValues[n] > numberOfParameters) {
+                numberOfParameters = numberOfValues[n];
+            }
+        }
+        ok = ExpandParameter(kp, numberOfKp, numberOfParameters);
+        ok = (ExpandParameter(kid, numberOfKi, numberOfParameters) && ok);
+        ok = (ExpandParameter(kdd, numberOfKd, numberOfParameters) && ok);
+        ok = (ExpandParameter(maxOutput, numberOfMaxOutput, numberOfParameters) && ok);
+        ok = (ExpandParameter(minOutput, numberOfMinOutput, numberOfParameters) && ok);
+        ok = (ExpandParameter(ktd, numberOfTrackingGains, numberOfParameters) && ok);
+        ok = (ExpandParameter(maxOutputDelta, numberOfMaxOutputRates, numberOfParameters) && ok);
         if (!ok) {
-            REPORT_ERROR(ErrorManagement::InitialisationError, "kp, ki and kd missing. At least one parameter must be initialised");
+            REPORT_ERROR(ErrorManagement::InitialisationError, "All the parameter arrays must have the same number of elements (%u)", numberOfParameters);
         }
+    }
+    uint32 c;
+    for (c = 0u; (c < numberOfParameters) && (ok); c++) {
         //lint -e{9007} No side effect on the function IsEqual.
-        if (IsEqual(kp, 0.0) && IsEqual(ki, 0.0) && IsEqual(kd, 0.0)) {
+        if (IsEqual(kp[c], 0.0) && IsEqual(kid[c], 0.0) && IsEqual(kdd[c], 0.0)) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "kp = ki = kd = 0.");
             ok = false;
         }
@@ -118,31 +254,31 @@ bool PIDGAM::Initialise(StructuredDataI &data) {
             ok = false;
         }
     }
-    if (ok) {
-        kid = ki * sampleTime;
-        kdd = kd / sampleTime;
-    }
-    if (ok) {
-        ok = data.Read("MaxOutput", maxOutput);
-        if (!ok) {
-            maxOutput = MAX_FLOAT64;
-        }
-        ok = data.Read("MinOutput", minOutput);
-        if (!ok) {
-            minOutput = -MAX_FLOAT64;
-        }
-        ok = true;
-        if (maxOutput < minOutput) {
+    for (c = 0u; (c < numberOfParameters) && (ok); c++) {
+        if (maxOutput[c] < minOutput[c]) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput < minOutput. maxOutput must be larger than minOutput");
             ok = false;
         }
-        if (IsEqual(maxOutput, minOutput)) {
+        else if (IsEqual(maxOutput[c], minOutput[c])) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "maxOutput = minOutput. maxOutput must be larger than minOutput");
             ok = false;
         }
+        else if (maxOutputDelta[c] <= 0.0) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "MaxOutputRate must be positive");
+            ok = false;
+        }
+        else {
+            kid[c] *= sampleTime;
+            kdd[c] /= sampleTime;
+            ktd[c] *= sampleTime;
+            if (rateLimit) {
+                maxOutputDelta[c] *= sampleTime;
+            }
+        }
     }
     return ok;
 }
+
 bool PIDGAM::Setup() {
     bool ok = true;
     nOfInputSignals = GetNumberOfInputSignals();
@@ -173,8 +309,8 @@ bool PIDGAM::Setup() {
             REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements returned an error for numberOfInputElementsReference");
         }
         if (ok) {
-            if (numberOfInputElementsReference != 1u) {
-                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be one. The crrent value is %u",
+            if (numberOfInputElementsReference == 0u) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "The numberOfInputElementsReference value must be positive. The crrent value is %u",
                              numberOfInputElementsReference);
                 ok = false;
             }
@@ -315,59 +451,93 @@ bool PIDGAM::Setup() {
         }
         output = static_cast<float64 *>(GetOutputSignalMemory(0u));
     }
+    if (ok) {
+        sizeInputOutput = numberOfInputElementsReference;
+        ok = ExpandParameter(kp, numberOfParameters, sizeInputOutput);
+        if (ok) {
+            ok = ExpandParameter(kid, numberOfParameters, sizeInputOutput);
+            ok = (ExpandParameter(kdd, numberOfParameters, sizeInputOutput) && ok);
+            ok = (ExpandParameter(maxOutput, numberOfParameters, sizeInputOutput) && ok);
+            ok = (ExpandParameter(minOutput, numberOfParameters, sizeInputOutput) && ok);
+            ok = (ExpandParameter(ktd, numberOfParameters, sizeInputOutput) && ok);
+            ok = (ExpandParameter(maxOutputDelta, numberOfParameters, sizeInputOutput) && ok);
+            numberOfParameters = sizeInputOutput;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The parameters have %u elements and the signals %u. They must be scalars or have one element per signal element",
+                         numberOfParameters, sizeInputOutput);
+        }
+    }
+    if (ok) {
+        if (enableIntegral == NULL_PTR(bool *)) {
+            enableIntegral = new bool[sizeInputOutput];
+            lastInput = new float64[sizeInputOutput];
+            lastIntegral = new float64[sizeInputOutput];
+            lastOutput = new float64[sizeInputOutput];
+        }
+        uint32 c;
+        for (c = 0u; c < sizeInputOutput; c++) {
+            enableIntegral[c] = true;
+            lastInput[c] = 0.0;
+            lastIntegral[c] = 0.0;
+            lastOutput[c] = 0.0;
+        }
+    }
 
     return ok;
 }
-bool PIDGAM::Execute() {
-    GetValue();
-    Saturation();
-    return true;
-}
-
 //lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::GetValue() {
-    if (enableSubstraction) {
-        float64 error;
-        error = *reference - *measurement;
-        proportional = kp * error;
-        if (enableIntegral) {
-            integral = (error * kid) + lastIntegral;
+bool PIDGAM::Execute() {
+    //One pass over the structure of arrays, so that the compiler can pipeline (and vectorise) the channels.
+    uint32 c;
+    for (c = 0u; c < sizeInputOutput; c++) {
+        float64 error = reference[c];
+        if (enableSubstraction) {
+            error -= measurement[c];
+        }
+        float64 integral = error * kid[c];
+        if (enableIntegral[c]) {
+            integral += lastIntegral[c];
+        }
+        float64 value = (kp[c] * error) + integral + ((error - lastInput[c]) * kdd[c]);
+        lastInput[c] = error;
+        float64 limitedValue = value;
+        if (limitedValue > maxOutput[c]) {
+            limitedValue = maxOutput[c];
+        }
+        else if (limitedValue < minOutput[c]) {
+            limitedValue = minOutput[c];
         }
         else {
-            integral = error * kid;
+            //NOOP
         }
-        derivative = (error - lastInput) * kdd;
-        lastInput = error;
-    }
-    else {
-        proportional = kp * *reference;
-        if (enableIntegral) {
-            integral = ((*reference * kid) + lastIntegral);
+        if (rateLimit) {
+            float64 upperValue = lastOutput[c] + maxOutputDelta[c];
+            float64 lowerValue = lastOutput[c] - maxOutputDelta[c];
+            if (limitedValue > upperValue) {
+                limitedValue = upperValue;
+            }
+            else if (limitedValue < lowerValue) {
+                limitedValue = lowerValue;
+            }
+            else {
+                //NOOP
+            }
+        }
+        if (backCalculation) {
+            lastIntegral[c] = integral + (ktd[c] * (limitedValue - value));
         }
         else {
-            integral = *reference * kid;
+            lastIntegral[c] = integral;
+            //lint -e{777} exact comparison intended: true only if no limit was applied.
+            enableIntegral[c] = (limitedValue == value);
         }
-        derivative = (*reference - lastInput) * kdd;
-        lastInput = *reference;
+        output[c] = limitedValue;
+        lastOutput[c] = limitedValue;
     }
-    output[0] = proportional + integral + derivative;
-    lastIntegral = integral;
+    return true;
 }
 
-//lint -e{613} The Setup() function guarantee that the pointers are not NULL.
-void PIDGAM::Saturation() {
-    if (output[0] > maxOutput) {
-        output[0] = maxOutput;
-        enableIntegral = false;
-    }
-    else if (output[0] < minOutput) {
-        output[0] = minOutput;
-        enableIntegral = false;
-    }
-    else {
-        enableIntegral = true;
-    }
-}
 CLASS_REGISTER(PIDGAM, "1.0")
 }
 
@@ -71,6 +71,18 @@ namespace MARTe {
  * \f$ \n
  * Notice that the lastIntegral is not added to the output.\n
  *
+ * If TrackingGain (kt) is defined, the flag above is replaced by a back-calculation anti-windup: the integral state is corrected
+ * with the difference between the limited and the computed outputs and keeps integrating:\n
+ * \f$
+ * lastIntegral = ki * sampleTime * error + lastIntegral + kt * sampleTime * (limitedOutput - output)
+ * \f$ \n
+ * If MaxOutputRate is defined, the change of the output between two consecutive cycles (after the saturation) is limited
+ * to MaxOutputRate * sampleTime. The output is assumed to be 0 before the first cycle.\n
+ *
+ * The reference, measurement and output signals can be arrays with N elements. In this case the GAM computes N independent PIDs
+ * (channels) in a single loop and each of the parameters Kp, Ki, Kd, MaxOutput, MinOutput, TrackingGain and MaxOutputRate can either
+ * be a scalar (the same value for all the channels) or an array with one value per channel. The parameters and the state of the PIDs
+ * are stored in one array per variable (indexed by channel).
  *
  *The configuration syntax is (names and signal quantity are only given as an example):
  *
@@ -83,6 +95,8 @@ namespace MARTe {
  *     sampleFrequency = 0.001
  *     maxOutput = 500.0 //optional
  *     minOutput = -500.0 //optional
+ *     TrackingGain = 10.0 //optional. Enables the back-calculation anti-windup
+ *     MaxOutputRate = 1e5 //optional. Maximum output change per second
  *     InputSignals = {
  *         Reference = {
  *             DataSource = "DDB1"
@@ -111,6 +125,36 @@ namespace MARTe {
  * }
  * </pre>
  *
+ * Three channels with per-channel gains and limits:
+ * <pre>
+ * +PID3 = {
+ *     Class = PIDGAM
+ *     Kp = {10.0 12.0 8.0}
+ *     Ki = 1.0
+ *     SampleTime = 0.001
+ *     MaxOutput = {500.0 400.0 500.0}
+ *     MinOutput = {-500.0 -400.0 -500.0}
+ *     InputSignals = {
+ *         References = {
+ *             DataSource = "DDB1"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *         Measurements = {
+ *             DataSource = "DDB2"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ *     OutputSignals = {
+ *         Outputs = {
+ *             DataSource = "LCD"
+ *             Type = float64
+ *             NumberOfElements = 3
+ *         }
+ *     }
+ * }
+ * </pre>
  */
 class PIDGAM: public GAM {
 public:
@@ -118,20 +162,21 @@ public:
     /**
      * @brief Default constructor
      * @post
-     * kp = 0.0\n
-     * proportional = 0.0\n
-     * ki = 0.0\n
-     * kid = 0.0\n
-     * integral = 0.0\n
-     * kd = 0.0\n
-     * kdd = 0.0\n
-     * derivative = 0.0\n
+     * kp = NULL_PTR(float64 *)\n
+     * kid = NULL_PTR(float64 *)\n
+     * kdd = NULL_PTR(float64 *)\n
+     * ktd = NULL_PTR(float64 *)\n
+     * maxOutput = NULL_PTR(float64 *)\n
+     * minOutput = NULL_PTR(float64 *)\n
+     * maxOutputDelta = NULL_PTR(float64 *)\n
+     * numberOfParameters = 0u\n
      * sampleTime = 0.0\n
-     * maxOutput = MAX_FLOAT64\n
-     * minOutput = -MAX_FLOAT64\n
-     * enableIntegral = true\n
-     * lastInput = 0.0\n
-     * lastIntegral = 0.0
+     * backCalculation = false\n
+     * rateLimit = false\n
+     * enableIntegral = NULL_PTR(bool *)\n
+     * lastInput = NULL_PTR(float64 *)\n
+     * lastIntegral = NULL_PTR(float64 *)\n
+     * lastOutput = NULL_PTR(float64 *)\n
      * enableSubstraction = false\n
      * reference = NULL_PTR(float64 *)\n
      * sizeInputOutput = 0u\n
@@ -152,7 +197,7 @@ public:
 PIDGAM    ();
 
     /**
-     * @brief Default constructor.
+     * @brief Destructor. Frees the parameter and state arrays.
      * @post
      * reference = NULL_PTR(float64 *)\n
      * measurement = NULL_PTR(float64 *)\n
@@ -170,10 +215,15 @@ PIDGAM    ();
      * sampleTime\n
      * maxOutput (optional)\n
      * minOutput (optional)\n
+     * TrackingGain (optional)\n
+     * MaxOutputRate (optional)\n
+     * All the parameters but sampleTime can be scalars or arrays (one value per channel). The arrays must have the same
+     * number of elements.
      * @post
-     * kp != 0.0 || ki != 0.0 || kd != 0.0\n
+     * for each channel kp != 0.0 || ki != 0.0 || kd != 0.0\n
      * sampleTime > 0.0\n
-     * maxOutpt > minOutput\n
+     * for each channel maxOutpt > minOutput\n
+     * for each channel MaxOutputRate > 0.0\n
      * @return true if all postconditions are met
      */
     virtual bool Initialise(StructuredDataI &data);
@@ -185,9 +235,10 @@ PIDGAM    ();
      * @post
      * nOfInputSignals = 1 || nOfInputSignals = 2\n
      * nOfOutputSignals = 1\n
-     * numberOfInputElementsReference = 1\n
-     * numberOfInputElementsMeasurement = 1\n
-     * numberOfOutputElements = 1\n
+     * numberOfInputElementsReference > 0 (the number of channels)\n
+     * numberOfInputElementsMeasurement = numberOfInputElementsReference\n
+     * numberOfOutputElements = numberOfInputElementsReference\n
+     * numberOfParameters = 1 || numberOfParameters = numberOfInputElementsReference\n
      * numberOfInputSamplesReference = 1\n
      * numberOfInputSamplesMeasurement = 1\n
      * numberOfOuputSamples = 1\n
@@ -203,52 +254,52 @@ PIDGAM    ();
 
     /**
      * @brief Implements the PID.
-     * @details First computes the PID, then saturates the output if needed. If the output
-     * is saturated a flag prevents the integral term to continuing growing.
+     * @details For each channel first computes the PID, then saturates (and rate limits) the output if needed. If the output
+     * is limited a flag prevents the integral term to continuing growing (or the integral is back-calculated if TrackingGain is set).
      * @return true.
      */
     virtual bool Execute();
 private:
 
     /**
-     * proportional coefficient in the time domain in the time domain
+     * Proportional coefficient of each channel
      */
-    float64 kp;
+    float64 *kp;
 
     /**
-     * contribution of the proportional term
+     * Integral coefficient of each channel in the discrete domain. kid = ki * sampleTime. It is used to speed up the operations
      */
-    float64 proportional;
+    float64 *kid;
 
     /**
-     * integral coefficient in the time domain
+     * Derivative coefficient of each channel in the discrete domain. kdd= kd/sampleTime. It is used to speed up the operations
      */
-    float64 ki;
+    float64 *kdd;
 
     /**
-     * Integral coefficient in the discrete domain. kid = kid * sampleTime. It is used to speed up the operations
+     * Back-calculation coefficient of each channel in the discrete domain. ktd = TrackingGain * sampleTime
      */
-    float64 kid;
+    float64 *ktd;
 
     /**
-     * contribution of the integral term
+     * Upper limit saturation of each channel
      */
-    float64 integral;
+    float64 *maxOutput;
 
     /**
-     * Derivative coefficient in the time domain
+     * Lower limit saturation of each channel
      */
-    float64 kd;
+    float64 *minOutput;
 
     /**
-     * Derivative coefficient in the discrete domain. kdd= kd/sampleTime. It is used to speed up the operations
+     * Maximum output change per cycle of each channel. maxOutputDelta = MaxOutputRate * sampleTime
      */
-    float64 kdd;
+    float64 *maxOutputDelta;
 
     /**
-     * Contribution of the derivative term.
+     * Number of values of the parameter arrays (1 or the number of channels).
      */
-    float64 derivative;
+    uint32 numberOfParameters;
 
     /**
      * Indicates the time between samples.
@@ -256,29 +307,34 @@ private:
     float64 sampleTime;
 
     /**
-     * upper limit saturation
+     * True if the TrackingGain is defined.
      */
-    float64 maxOutput;
+    bool backCalculation;
 
     /**
-     * lower limit saturation
+     * True if the MaxOutputRate is defined.
      */
-    float64 minOutput;
+    bool rateLimit;
 
     /**
-     * Enables/disable the integral term when saturation is acting (anti-windup function)
+     * Enables/disable the integral term of each channel when saturation is acting (anti-windup function)
      */
-    bool enableIntegral;
+    bool *enableIntegral;
 
     /**
-     * Save the last input value
+     * Save the last input value of each channel
      */
-    float64 lastInput;
+    float64 *lastInput;
 
     /**
-     * Save the last integrated term
+     * Save the last integrated term of each channel
      */
-    float64 lastIntegral;
+    float64 *lastIntegral;
+
+    /**
+     * Save the last output of each channel (used by the rate limit)
+     */
+    float64 *lastOutput;
 
     /**
      * When enableSubstraction is 1 the GAM expects two inputs: reference value and the feedback value (the actual measurement).
@@ -362,14 +418,32 @@ private:
     uint32 outputDimension;
 
     /**
-     * @brief Implements the PID
-     */
-    inline void GetValue();
-
-    /**
-     * Saturates the output of the PID if needed.
-     */
-    inline void Saturation();
+     * @brief Reads a parameter which can be either a scalar or an array.
+     * @param[in] data the GAM configuration.
+     * @param[in] name the parameter name.
+     * @param[in] defaultValue the value used when the parameter is not defined.
+     * @param[out] values the parameter values, allocated by this function.
+     * @param[out] numberOfValues the number of values read (1 if the parameter is not defined).
+     * @param[out] found true if the parameter is defined.
+     * @return false if the parameter is defined but cannot be read.
+     */
+    static bool ReadParameter(StructuredDataI &data,
+                              const char8 * const name,
+                              const float64 defaultValue,
+                              float64 *&values,
+                              uint32 &numberOfValues,
+                              bool &found);
+
+    /**
+     * @brief Replicates a single valued parameter to \a numberOfValuesOut values.
+     * @param[in,out] values the parameter values (reallocated if needed).
+     * @param[in] numberOfValuesIn the current number of values.
+     * @param[in] numberOfValuesOut the required number of values.
+     * @return false if numberOfValuesIn is neither 1 nor \a numberOfValuesOut.
+     */
+    static bool ExpandParameter(float64 *&values,
+                                const uint32 numberOfValuesIn,
+                                const uint32 numberOfValuesOut);
 
 };
 
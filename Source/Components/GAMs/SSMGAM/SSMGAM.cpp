@@ -50,8 +50,6 @@ namespace MARTe {
 SSMGAM::SSMGAM() :
         GAM() {
     stateMatrixPointer = NULL_PTR(float64 **);
-    intermediateState1Pointer = NULL_PTR(float64 **);
-    intermediateState2Pointer = NULL_PTR(float64 **);
     stateMatrixNumberOfRows = 0u;
     stateMatrixNumberOfColumns = 0u;
 
@@ -85,10 +83,17 @@ SSMGAM::SSMGAM() :
 
     inputVectorPointer = NULL_PTR(float64 **);
     outputVectorPointer = NULL_PTR(float64 **);
-    intermediateOutput1Pointer = NULL_PTR(float64 **);
-    intermediateOutput2Pointer = NULL_PTR(float64 **);
     stateVectorPointer = NULL_PTR(float64 **);
-    derivativeStateVectorPointer = NULL_PTR(float64 **);
+
+    systemMatrixNumberOfRows = 0u;
+    systemMatrixNumberOfColumns = 0u;
+    systemMatrixNumberOfValues = 0u;
+    systemMatrixValues = NULL_PTR(float64 *);
+    systemMatrixColumns = NULL_PTR(uint32 *);
+    systemMatrixRowStart = NULL_PTR(uint32 *);
+    sparseSystemMatrix = false;
+    stateInputVector = NULL_PTR(float64 *);
+    nextStateInputVector = NULL_PTR(float64 *);
     sampleFrequency = 0.0;
 
     enableFeedthroughMatrix = false;
@@ -164,54 +169,25 @@ SSMGAM::~SSMGAM() {
         delete[] stateVectorPointer;
         stateVectorPointer = NULL_PTR(float64 **);
     }
-    if (derivativeStateVectorPointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeDerivativeStateVector; row++) {
-            if (derivativeStateVectorPointer[row] != NULL_PTR(float64 *)) {
-                delete[] derivativeStateVectorPointer[row];
-            }
-        }
-        delete[] derivativeStateVectorPointer;
-        derivativeStateVectorPointer = NULL_PTR(float64 **);
+    if (systemMatrixValues != NULL_PTR(float64 *)) {
+        delete[] systemMatrixValues;
+        systemMatrixValues = NULL_PTR(float64 *);
     }
-    if (intermediateOutput1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput1Pointer[row];
-                intermediateOutput1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput1Pointer;
-        intermediateOutput1Pointer = NULL_PTR(float64 **);
+    if (systemMatrixColumns != NULL_PTR(uint32 *)) {
+        delete[] systemMatrixColumns;
+        systemMatrixColumns = NULL_PTR(uint32 *);
     }
-    if (intermediateOutput2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < sizeOutputVector; row++) {
-            if (intermediateOutput2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateOutput2Pointer[row];
-                intermediateOutput2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateOutput2Pointer;
-        intermediateOutput2Pointer = NULL_PTR(float64 **);
+    if (systemMatrixRowStart != NULL_PTR(uint32 *)) {
+        delete[] systemMatrixRowStart;
+        systemMatrixRowStart = NULL_PTR(uint32 *);
     }
-    if (intermediateState1Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState1Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState1Pointer[row];
-                intermediateState1Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState1Pointer;
-        intermediateState1Pointer = NULL_PTR(float64 **);
+    if (stateInputVector != NULL_PTR(float64 *)) {
+        delete[] stateInputVector;
+        stateInputVector = NULL_PTR(float64 *);
     }
-    if (intermediateState2Pointer != NULL_PTR(float64 **)) {
-        for (uint32 row = 0u; row < stateMatrixNumberOfRows; row++) {
-            if (intermediateState2Pointer[row] != NULL_PTR(float64 *)) {
-                delete[] intermediateState2Pointer[row];
-                intermediateState2Pointer[row] = NULL_PTR(float64 *);
-            }
-        }
-        delete[] intermediateState2Pointer;
-        intermediateState2Pointer = NULL_PTR(float64 **);
+    if (nextStateInputVector != NULL_PTR(float64 *)) {
+        delete[] nextStateInputVector;
+        nextStateInputVector = NULL_PTR(float64 *);
     }
 }
 
@@ -244,13 +220,9 @@ bool SSMGAM::Initialise(StructuredDataI &data) {
 
         if (ok) { // allocate state matrix memory and read matrix coefficients
             stateMatrixPointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState1Pointer = new float64 *[stateMatrixNumberOfRows];
-            intermediateState2Pointer = new float64 *[stateMatrixNumberOfRows];
             //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
             for (uint32 i = 0u; (i < stateMatrixNumberOfRows) && ok; i++) {
                 stateMatrixPointer[i] = new float64[stateMatrixNumberOfColumns];
-                intermediateState1Pointer[i] = new float64[1u];
-                intermediateState2Pointer[i] = new float64[1u];
             }
             if (ok) {
                 Matrix<float64> matrix(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
@@ -586,8 +558,6 @@ bool SSMGAM::Setup() {
 
         }
         outputVectorPointer = new float64 *[sizeOutputVector];
-        intermediateOutput1Pointer = new float64 *[sizeOutputVector];
-        intermediateOutput2Pointer = new float64 *[sizeOutputVector];
         //lint -e{613} Possible use of null pointer--> If new fails the program crashes.
         for (uint32 i = 0u; (i < sizeOutputVector); i++) {
             outputVectorPointer[i] = static_cast<float64 *>(GetOutputSignalMemory(i));
@@ -596,8 +566,6 @@ bool SSMGAM::Setup() {
                 uint32 auxIdx = i;
                 REPORT_ERROR(ErrorManagement::ParametersError, "GetOutputSignalMemory(%u) returned a null pointer", auxIdx);
             }
-            intermediateOutput1Pointer[i] = new float64[1u];
-            intermediateOutput2Pointer[i] = new float64[1u];
         }
         stateVectorPointer = new float64 *[sizeStateVector];
         uint32 auxIdx = 0u;
@@ -610,61 +578,124 @@ bool SSMGAM::Setup() {
             }
             auxIdx++;
         }
-        derivativeStateVectorPointer = new float64 *[sizeDerivativeStateVector];
-        for (uint32 i = 0u; (i < sizeDerivativeStateVector); i++) {
-            derivativeStateVectorPointer[i] = new float64 [1u];
-        }
+        enableFeedthroughMatrix = (feedthroughMatrixPointer != NULL_PTR(float64 **));
         if (ok) {
-            stateMatrix = Matrix<float64>(stateMatrixPointer, stateMatrixNumberOfRows, stateMatrixNumberOfColumns);
-            intermediateState1 = Matrix<float64>(intermediateState1Pointer, stateMatrixNumberOfRows, 1u);
-            intermediateState2 = Matrix<float64>(intermediateState2Pointer, stateMatrixNumberOfRows, 1u);
-            outputMatrix = Matrix<float64>(outputMatrixPointer, outputMatrixNumberOfRows, outputMatrixNumberOfColumns);
-            if (feedthroughMatrixPointer != NULL_PTR(float64 **)) {
-                feedthroughMatrix = Matrix<float64>(feedthroughMatrixPointer, feedthroughMatrixNumberOfRows, feedthroughMatrixNumberOfColumns);
-                enableFeedthroughMatrix = true;
-            }
-            else {
-                enableFeedthroughMatrix = false;
-            }
-
-            stateVector = Matrix<float64>(stateVectorPointer, sizeStateVector, 1u);
-            outputVector = Matrix<float64>(outputVectorPointer, outputMatrixNumberOfRows, 1u);
-            inputMatrix = Matrix<float64>(inputMatrixPointer, inputMatrixNumberOfRows, inputMatrixNumberOfColumns);
-            inputVector = Matrix<float64>(inputVectorPointer, inputMatrixNumberOfColumns, 1u);
-            intermediateOutput1 = Matrix<float64>(intermediateOutput1Pointer, outputMatrixNumberOfRows, 1u);
-            intermediateOutput2 = Matrix<float64>(intermediateOutput2Pointer, outputMatrixNumberOfRows, 1u);
-            derivativeStateVector = Matrix<float64>(derivativeStateVectorPointer, sizeDerivativeStateVector, 1u);
+            ok = PackSystemMatrix();
         }
     }
     return ok;
 }
 
-bool SSMGAM::Execute() {
-    bool ok = stateVector.Copy(derivativeStateVector);
-    if (ok) {
-        ok = outputMatrix.Product(stateVector, intermediateOutput1);
+bool SSMGAM::PackSystemMatrix() {
+    systemMatrixNumberOfRows = (sizeOutputVector + sizeStateVector);
+    systemMatrixNumberOfColumns = (sizeStateVector + numberOfInputSignalsGAM);
+    uint32 numberOfNonZeros = 0u;
+    for (uint32 row = 0u; row < systemMatrixNumberOfRows; row++) {
+        for (uint32 column = 0u; column < systemMatrixNumberOfColumns; column++) {
+            if (GetSystemMatrixCoefficient(row, column) != 0.0) {
+                numberOfNonZeros++;
+            }
+        }
+    }
+    //the sparse kernel reads a column index and gathers the vector element for each coefficient: only worth it for mostly empty matrices
+    sparseSystemMatrix = ((numberOfNonZeros * 3u) < (systemMatrixNumberOfRows * systemMatrixNumberOfColumns));
+    if (sparseSystemMatrix) {
+        systemMatrixNumberOfValues = numberOfNonZeros;
+        systemMatrixColumns = new uint32[systemMatrixNumberOfValues + 1u];
+        systemMatrixRowStart = new uint32[systemMatrixNumberOfRows + 1u];
+    }
+    else {
+        systemMatrixNumberOfValues = (systemMatrixNumberOfRows * systemMatrixNumberOfColumns);
     }
-    if (ok && enableFeedthroughMatrix) {
-        ok = feedthroughMatrix.Product(inputVector, intermediateOutput2);
+    systemMatrixValues = new float64[systemMatrixNumberOfValues + 1u];
+    stateInputVector = new float64[systemMatrixNumberOfColumns];
+    nextStateInputVector = new float64[systemMatrixNumberOfColumns];
+    bool ok = (systemMatrixValues != NULL_PTR(float64 *));
+    ok = (ok && (stateInputVector != NULL_PTR(float64 *)) && (nextStateInputVector != NULL_PTR(float64 *)));
+    if (sparseSystemMatrix) {
+        ok = (ok && (systemMatrixColumns != NULL_PTR(uint32 *)) && (systemMatrixRowStart != NULL_PTR(uint32 *)));
     }
     if (ok) {
-        if (enableFeedthroughMatrix) {
-            ok = intermediateOutput1.Sum(intermediateOutput2, outputVector);
+        uint32 n = 0u;
+        for (uint32 row = 0u; row < systemMatrixNumberOfRows; row++) {
+            if (sparseSystemMatrix) {
+                systemMatrixRowStart[row] = n;
+            }
+            for (uint32 column = 0u; column < systemMatrixNumberOfColumns; column++) {
+                float64 coefficient = GetSystemMatrixCoefficient(row, column);
+                if (sparseSystemMatrix) {
+                    if (coefficient != 0.0) {
+                        systemMatrixValues[n] = coefficient;
+                        systemMatrixColumns[n] = column;
+                        n++;
+                    }
+                }
+                else {
+                    systemMatrixValues[n] = coefficient;
+                    n++;
+                }
+            }
+        }
+        if (sparseSystemMatrix) {
+            systemMatrixRowStart[systemMatrixNumberOfRows] = n;
+        }
+        //x[0] = 0
+        for (uint32 column = 0u; column < systemMatrixNumberOfColumns; column++) {
+            stateInputVector[column] = 0.0;
+            nextStateInputVector[column] = 0.0;
+        }
+    }
+    else {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the system matrix");
+    }
+    return ok;
+}
+
+float64 SSMGAM::GetSystemMatrixCoefficient(const uint32 row,
+                                           const uint32 column) const {
+    float64 coefficient = 0.0;
+    if (row < sizeOutputVector) {
+        if (column < sizeStateVector) {
+            coefficient = outputMatrixPointer[row][column];
+        }
+        else if (enableFeedthroughMatrix) {
+            coefficient = feedthroughMatrixPointer[row][column - sizeStateVector];
         }
         else {
-            ok = outputVector.Copy(intermediateOutput1);
+            coefficient = 0.0;
         }
     }
-    if (ok) {
-        ok = stateMatrix.Product(stateVector, intermediateState1);
+    else {
+        if (column < sizeStateVector) {
+            coefficient = stateMatrixPointer[row - sizeOutputVector][column];
+        }
+        else {
+            coefficient = inputMatrixPointer[row - sizeOutputVector][column - sizeStateVector];
+        }
     }
-    if (ok) {
-        ok = inputMatrix.Product(inputVector, intermediateState2);
+    return coefficient;
+}
+
+bool SSMGAM::Execute() {
+    //stateInputVector = [x[k]; u[k]]
+    for (uint32 j = 0u; j < numberOfInputSignalsGAM; j++) {
+        stateInputVector[sizeStateVector + j] = *inputVectorPointer[j];
     }
-    if (ok) {
-        ok = intermediateState1.Sum(intermediateState2, derivativeStateVector);
+    for (uint32 i = 0u; i < sizeStateVector; i++) {
+        *stateVectorPointer[i] = stateInputVector[i];
     }
-    return ok;
+    //y[k] = Cx[k] + Du[k]
+    for (uint32 row = 0u; row < sizeOutputVector; row++) {
+        *outputVectorPointer[row] = RowProduct(row);
+    }
+    //x[k+1] = Ax[k] + Bu[k]
+    for (uint32 i = 0u; i < sizeStateVector; i++) {
+        nextStateInputVector[i] = RowProduct(sizeOutputVector + i);
+    }
+    float64 *aux = stateInputVector;
+    stateInputVector = nextStateInputVector;
+    nextStateInputVector = aux;
+    return true;
 }
 
 bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
@@ -672,16 +703,16 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
     bool ret = true;
 
     if (resetInEachState) {
-        bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-        bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+        bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+        bool cond2 = (stateInputVector != NULL_PTR(float64 *));
         if (cond1 && cond2) {
             for (uint32 i = 0u; i < sizeStateVector; i++) {
-                stateVector(i, 0u) = 0.0;
-                derivativeStateVector(i, 0u) = 0.0;
+                *stateVectorPointer[i] = 0.0;
+                stateInputVector[i] = 0.0;
             }
         }
         else {
-            REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
+            REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or stateInputVector = NULL ");
             ret = false;
         }
 
@@ -689,16 +720,16 @@ bool SSMGAM::PrepareNextState(const char8 * const currentStateName,
     else {
         //If the currentStateName and lastStateExecuted are different-> rest values
         if (lastStateExecuted != currentStateName) {
-            bool cond1 = (stateVector.GetDataPointer() != NULL_PTR(float64 **));
-            bool cond2 = (derivativeStateVector.GetDataPointer() != NULL_PTR(float64 **));
+            bool cond1 = (stateVectorPointer != NULL_PTR(float64 **));
+            bool cond2 = (stateInputVector != NULL_PTR(float64 *));
             if (cond1 && cond2) {
                 for (uint32 i = 0u; i < sizeStateVector; i++) {
-                    stateVector(i, 0u) = 0.0;
-                    derivativeStateVector(i, 0u) = 0.0;
+                    *stateVectorPointer[i] = 0.0;
+                    stateInputVector[i] = 0.0;
                 }
             }
             else {
-                REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or derivativeStateVector = NULL ");
+                REPORT_ERROR(ErrorManagement::ParametersError, "stateVector or stateInputVector = NULL ");
                 ret = false;
             }
         }
@@ -87,6 +87,17 @@ namespace MARTe {
  * </li>
  * </ul>
  *
+ * In the Setup the four matrices are packed, row by row, into a single system matrix
+ * \f$
+ * \left[\begin{array}{cc} C & D \\ A & B \end{array}\right]
+ * \f$
+ * which is multiplied by the vector [x[k]; u[k]], so that y[k] and x[k+1] are computed in one pass and without intermediate vectors.
+ * If less than one third of the coefficients of the system matrix are different from zero, the matrix is stored in
+ * the compressed sparse row (CSR) format and only the non-zero coefficients are evaluated in the Execute (this covers the diagonal and the banded matrices).
+ * Otherwise the matrix is stored as a dense array with one contiguous row per output.
+ * As a consequence, several independent models can be executed by a single SSMGAM by declaring block-diagonal matrices, with
+ * no additional cost for the blocks which are zero.
+ *
  * The configuration syntax is (names and signal quantity are only given as an example):
  *
  * <pre>
@@ -144,10 +155,6 @@ public:
     /** @brief Default constructor
      * @post
      * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
-     * stateMatrixNumberOfRows = 0u\n
-     * stateMatrixNumberOfColumns = 0u\n
      * stateMatrixNumberOfRows = 0u\n
      * stateMatrixNumberOfColumns = 0u\n
      * sizeStateVector = 0u\n
@@ -172,10 +179,16 @@ public:
      * numberOfOutputSamples = 0u\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * systemMatrixNumberOfRows = 0u\n
+     * systemMatrixNumberOfColumns = 0u\n
+     * systemMatrixNumberOfValues = 0u\n
+     * systemMatrixValues = NULL_PTR(float64 *)\n
+     * systemMatrixColumns = NULL_PTR(uint32 *)\n
+     * systemMatrixRowStart = NULL_PTR(uint32 *)\n
+     * sparseSystemMatrix = false\n
+     * stateInputVector = NULL_PTR(float64 *)\n
+     * nextStateInputVector = NULL_PTR(float64 *)\n
      * sampleFrequency = 0.0\n
      * enableFeedthroughMatrix = false\n
      * resetInEachState = false\n
@@ -187,17 +200,17 @@ public:
      * @details Frees the memory allocated by the GAM if necessary
      * @post
      * stateMatrixPointer = NULL_PTR(float64 **)\n
-     * intermediateState1Pointer = NULL_PTR(float64 **)\n
-     * intermediateState2Pointer = NULL_PTR(float64 **)\n
      * inputMatrixPointer = NULL_PTR(float64 **)\n
      * outputMatrixPointer = NULL_PTR(float64 **)\n
      * feedthroughMatrixPointer = NULL_PTR(float64 **)\n
      * inputVectorPointer = NULL_PTR(float64 **)\n
      * outputVectorPointer = NULL_PTR(float64 **)\n
-     * intermediateOutput1Pointer = NULL_PTR(float64 **)\n
-     * intermediateOutput2Pointer = NULL_PTR(float64 **)\n
      * stateVectorPointer = NULL_PTR(float64 **)\n
-     * derivativeStateVectorPointer = NULL_PTR(float64 **)\n
+     * systemMatrixValues = NULL_PTR(float64 *)\n
+     * systemMatrixColumns = NULL_PTR(uint32 *)\n
+     * systemMatrixRowStart = NULL_PTR(uint32 *)\n
+     * stateInputVector = NULL_PTR(float64 *)\n
+     * nextStateInputVector = NULL_PTR(float64 *)\n
      */
     virtual ~SSMGAM();
 
@@ -212,7 +225,7 @@ public:
     /**
      * @brief Initialise the inputs and the output of the GAM.
      * @details Allocate memory for the inputs and outputs, get the input and output pointers
-     * and initialise the class Matrix for use their operations.
+     * and pack the SS matrices into the system matrix (dense or CSR).
      * @return true if the dimension matrices are consistent.
      */
     virtual bool Setup();
@@ -227,6 +240,7 @@ public:
      * \f$
      * y[k] = Cx[k]+Du[k]
      * \f$\n
+     * Both equations are evaluated with a single pass over the system matrix.
      *
      * @return true if the operation can be performed.
      */
@@ -256,31 +270,6 @@ private:
      */
     float64 **stateMatrixPointer;
 
-    /**
-     * State matrix initialised using stateMatrixPointer.
-     */
-    Matrix<float64> stateMatrix;
-
-    /**
-     * Holds an intermediate result.
-     */
-    float64 **intermediateState1Pointer;
-
-    /**
-     * Holds an intermediate result. It is initialised with the intermediateState1Pointer
-     */
-    Matrix<float64> intermediateState1;
-
-    /**
-     * Holds an intermediate result.
-     */
-    float64 **intermediateState2Pointer;
-
-    /**
-     * Holds an intermediate result. It is initialised with the intermediateState2Pointer
-     */
-    Matrix<float64> intermediateState2;
-
     /**
      * number of rows of the state matrix.
      */
@@ -306,11 +295,6 @@ private:
      */
     float64 **inputMatrixPointer;
 
-    /**
-     * Input matrix. It is initialised with inputMatrixPointer
-     */
-    Matrix<float64> inputMatrix;
-
     /**
      * number of rows of the input matrix.
      */
@@ -326,11 +310,6 @@ private:
      */
     float64 **outputMatrixPointer;
 
-    /**
-     * Output matrix. It is initialised with outputMatrixPointer
-     */
-    Matrix<float64> outputMatrix;
-
     /**
      * Number of rows of the output matrix
      */
@@ -346,11 +325,6 @@ private:
      */
     float64 **feedthroughMatrixPointer;
 
-    /**
-     * Feedthrough matrix. It is initialised with feedthroughMatrixPointer
-     */
-    Matrix<float64> feedthroughMatrix;
-
     /**
      * Number of rows of the feedthrough matrix
      */
@@ -412,59 +386,59 @@ private:
     float64 **inputVectorPointer;
 
     /**
-     * Input vector. It is initialised with inputVectorPointer
+     * Output of the system (usually this vector is represented by a Y).
      */
-    Matrix<float64> inputVector;
+    float64 **outputVectorPointer;
 
     /**
-     * Output of the system (usually this vector is represented by a Y).
+     * State vector pointer(usually it is represented by a X). This vector is an output of the GAM.
      */
-    float64 **outputVectorPointer;
+    float64 **stateVectorPointer;
 
     /**
-     * Output vector. It is initialised with outputVectorPointer
+     * Number of rows of the system matrix [C D; A B] (sizeOutputVector + sizeStateVector).
      */
-    Matrix<float64> outputVector;
+    uint32 systemMatrixNumberOfRows;
 
     /**
-     * Holds an intermediate value.
+     * Number of columns of the system matrix [C D; A B] (sizeStateVector + numberOfInputSignalsGAM).
      */
-    float64 **intermediateOutput1Pointer;
+    uint32 systemMatrixNumberOfColumns;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput1Pointer
+     * Number of coefficients stored in systemMatrixValues.
      */
-    Matrix<float64> intermediateOutput1;
+    uint32 systemMatrixNumberOfValues;
 
     /**
-     * Holds an intermediate value.
+     * Coefficients of the system matrix. All the coefficients row by row if the matrix is dense, only the non-zero ones if it is sparse.
      */
-    float64 **intermediateOutput2Pointer;
+    float64 *systemMatrixValues;
 
     /**
-     * Holds an intermediate value. It is initialised with intermediateOutput2Pointer
+     * Column of each coefficient of systemMatrixValues (only if the matrix is sparse).
      */
-    Matrix<float64> intermediateOutput2;
+    uint32 *systemMatrixColumns;
 
     /**
-     * State vector pointer(usually it is represented by a X). This vector is an output of the GAM.
+     * Index in systemMatrixValues of the first coefficient of each row, plus the total number of values (only if the matrix is sparse).
      */
-    float64 **stateVectorPointer;
+    uint32 *systemMatrixRowStart;
 
     /**
-     * State vector. It is initialised with stateVectorPointer
+     * True if the system matrix is stored in the CSR format.
      */
-    Matrix<float64> stateVector;
+    bool sparseSystemMatrix;
 
     /**
-     * It is the derivative of the state vector. This vector is also an ouput of the GAM.
+     * The vector [x[k]; u[k]] multiplied by the system matrix.
      */
-    float64 **derivativeStateVectorPointer;
+    float64 *stateInputVector;
 
     /**
-     * It is the derivative of the state vector. It is initialised with stateVectorPointer
+     * Receives x[k+1]. Swapped with stateInputVector at the end of each Execute.
      */
-    Matrix<float64> derivativeStateVector;
+    float64 *nextStateInputVector;
 
     /**
      * sample frequency in which the matrix parameters are given. It will be used for verification
@@ -485,6 +459,28 @@ private:
      * Remember the last executed state.
      */
     StreamString lastStateExecuted;
+
+    /**
+     * @brief Packs the A, B, C and D matrices into the system matrix.
+     * @return true if the memory could be allocated.
+     */
+    bool PackSystemMatrix();
+
+    /**
+     * @brief Gets the coefficient (row, column) of the system matrix [C D; A B].
+     * @param[in] row the row of the system matrix.
+     * @param[in] column the column of the system matrix.
+     * @return the coefficient.
+     */
+    float64 GetSystemMatrixCoefficient(const uint32 row,
+                                       const uint32 column) const;
+
+    /**
+     * @brief Multiplies one row of the system matrix by the stateInputVector.
+     * @param[in] row the row of the system matrix.
+     * @return the product.
+     */
+    inline float64 RowProduct(const uint32 row) const;
 };
 
 }
@@ -493,5 +489,41 @@ private:
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+namespace MARTe {
+
+float64 SSMGAM::RowProduct(const uint32 row) const {
+    float64 result = 0.0;
+    if (sparseSystemMatrix) {
+        uint32 end = systemMatrixRowStart[row + 1u];
+        for (uint32 n = systemMatrixRowStart[row]; n < end; n++) {
+            result += (systemMatrixValues[n] * stateInputVector[systemMatrixColumns[n]]);
+        }
+    }
+    else {
+        //four partial sums to break the dependency chain of the accumulation
+        const float64 *rowValues = &systemMatrixValues[row * systemMatrixNumberOfColumns];
+        float64 sum0 = 0.0;
+        float64 sum1 = 0.0;
+        float64 sum2 = 0.0;
+        float64 sum3 = 0.0;
+        uint32 j = 0u;
+        while ((j + 4u) <= systemMatrixNumberOfColumns) {
+            sum0 += (rowValues[j] * stateInputVector[j]);
+            sum1 += (rowValues[j + 1u] * stateInputVector[j + 1u]);
+            sum2 += (rowValues[j + 2u] * stateInputVector[j + 2u]);
+            sum3 += (rowValues[j + 3u] * stateInputVector[j + 3u]);
+            j += 4u;
+        }
+        while (j < systemMatrixNumberOfColumns) {
+            sum0 += (rowValues[j] * stateInputVector[j]);
+            j++;
+        }
+        result = ((sum0 + sum1) + (sum2 + sum3));
+    }
+    return result;
+}
+
+}
+
 #endif /* SSMGAM_H_ */
 
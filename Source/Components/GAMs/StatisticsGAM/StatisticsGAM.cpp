@@ -52,6 +52,8 @@ StatisticsGAM::StatisticsGAM() :
     startCycleNumber = 0u;
     cycleCounter = 0u;
     infiniteMaxMin = false;
+    multiSample = false;
+    numberOfInputSamples = 1u;
 }
 
 /*lint -e{1551} no exception thrown deleting the StatisticsHelperT<> instance*/
@@ -145,6 +147,12 @@ bool StatisticsGAM::Initialise(StructuredDataI & data) {
         }
         infiniteMaxMin = (infiniteMaxMinTemp > 0u);
         REPORT_ERROR_PARAMETERS(ErrorManagement::Information, "Max and Min are %s", infiniteMaxMin?"absolute":"windowed");
+
+        uint8 multiSampleTemp = 0u;
+        if (!data.Read("MultiSample", multiSampleTemp)) {
+            multiSampleTemp = 0u;
+        }
+        multiSample = (multiSampleTemp > 0u);
     }
 
     return ret;
@@ -180,6 +188,9 @@ bool StatisticsGAM::Setup() {
 
     if (ret) {
         ret = (signalNumberOfDimensions == 0u);
+        if ((!ret) && (multiSample)) {
+            ret = (signalNumberOfDimensions == 1u);
+        }
     }
 
     if (!ret) {
@@ -193,13 +204,25 @@ bool StatisticsGAM::Setup() {
     }
 
     if (ret) {
-        ret = (signalNumberOfElements == 1u);
+        ret = ((signalNumberOfElements == 1u) || (multiSample));
     }
 
     if (!ret) {
         REPORT_ERROR(ErrorManagement::InitialisationError, "GetSignalNumberOfElements(InputSignals, 0u) != 1u");
     }
 
+    if ((ret) && (multiSample)) {
+        uint32 signalNumberOfSamples = 0u;
+        ret = GetSignalNumberOfSamples(InputSignals, 0u, signalNumberOfSamples);
+        if (ret) {
+            numberOfInputSamples = (signalNumberOfElements * signalNumberOfSamples);
+            ret = (numberOfInputSamples > 0u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal shall have at least one sample");
+        }
+    }
+
     uint32 signalIndex;
 
     /*lint -e{850} no modification of the loop index inside the body of the loop (constness issue with the variadic macro ?)*/
@@ -345,15 +368,19 @@ template<class Type> bool StatisticsGAM::ExecuteT() {
     Type input = (Type) 0;
     Type output = (Type) 0;
 
-    bool ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
-
-    if (ret) {
-        ret = (stats != NULL_PTR(void *));
-    }
+    bool ret = (stats != NULL_PTR(void *));
 
     if (ret) {
         ref = static_cast<StatisticsHelperT<Type> *>(stats);
-        ret = ref->PushSample(input, infiniteMaxMin);
+        if (multiSample) {
+            ret = ref->PushSamples(static_cast<const Type *>(GetInputSignalMemory(0u)), numberOfInputSamples, infiniteMaxMin);
+        }
+        else {
+            ret = MemoryOperationsHelper::Copy(&input, GetInputSignalMemory(0u), sizeof(Type));
+            if (ret) {
+                ret = ref->PushSample(input, infiniteMaxMin);
+            }
+        }
     }
 
     if (ret) {
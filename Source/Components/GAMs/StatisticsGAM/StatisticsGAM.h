@@ -46,7 +46,7 @@ namespace MARTe {
  * @details This GAM provides the average, standard deviation, minimum and maximum
  * of its input signal over a moving time window. 
  * The GAM accepts any type of scalar
- * input signal, i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
+ * input signal (or of multi-sample signal, see MultiSample below), i.e. (u)int8, (u)int16, (uint32), (u)int64, float32 and float64, and
  * produces the statistics computation in the same native type. As such, the output
  * signals are required to conform to the type of the input signal.
  *
@@ -60,6 +60,9 @@ namespace MARTe {
  *     StartCycleNumber = 0u // Optional - Defaults to 0. GAM cycles to skip before starting the accumulation.
  *     InfiniteMaxMin = 0u // Optional - Defaults to 0 (false). If true, Max and Min are referred to the GAM lifecycle (until reset).
  *                            If false, Max and Min are referred only to the Sliding Window.
+ *     MultiSample = 0u // Optional - Defaults to 0 (false). If true, the input signal may be a vector (NumberOfDimensions = 1) and/or
+ *                         have more than one sample (Samples > 1). All its values are inserted, as consecutive samples, in the
+ *                         sliding window every cycle.
  *     InputSignals = {
  *         ExecutionTime = {
  *             DataSource = "DDB"
@@ -128,7 +131,7 @@ public:
      * @pre
      *   SetConfiguredDatabase() && GetNumberOfInputSignals() > 0 &&
      *   GetNumberOfOutputSignals() > 0 &&
-     *   All signals are scalar and share the same type.
+     *   All signals are scalar (or the input is a vector if MultiSample) and share the same type.
      * @post 
      *   stats = (void*) new StatisticsHelperT<signalType> (windowSize);
      */
@@ -189,6 +192,16 @@ public:
      */
     bool infiniteMaxMin;
 
+    /**
+     * Accept vector/multi-sample inputs? See class description.
+     */
+    bool multiSample;
+
+    /**
+     * Number of values of the input signal inserted in the sliding window every cycle.
+     */
+    uint32 numberOfInputSamples;
+
 };
 
 }
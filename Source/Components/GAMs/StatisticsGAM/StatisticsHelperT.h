@@ -49,10 +49,12 @@ namespace MARTe {
  * @details The class allocates circular buffers to store values of samples and
  * computes average, standard deviation, minimum and maximum over a moving time
  * window. As such, the sum of samples and sum of squares is computed upon calling
- * the PushSample() method in a way to minimise operations. The minimum or maximum
- * over the historical buffer are re-computed only when needed, i.e. in case the
- * oldest sample being pushed out of the moving time window is equal to the stored
- * minimum or maximum.
+ * the PushSample() method in a way to minimise operations. The minimum and maximum
+ * over the moving time window are tracked with monotonic queues (the candidates to
+ * become the extreme, i.e. the samples not dominated by a newer sample), so that each
+ * sample costs O(1) amortised, independently of the window size.
+ * For floating point types the sums are compensated (Kahan-Neumaier) so that the
+ * rounding errors of adding and removing samples do not accumulate over long runs.
  * The implementation does not perform division, rather uses bit shift operation
  * for integer types, and pre-computes 1.0 / size for floating point types. As such,
  * the computation of average and standard deviation is only exact after the window
@@ -93,10 +95,10 @@ public:
      * @details The method inserts the sample in the historical buffer and re-computes the
      * sum of samples over the time window with two operations, i.e. to remove the oldest
      * sample leaving the buffer from the cumulative sum before adding the new one.
-     * The minimum and maximum sample attributes are changed if the newly inserted sample
-     * is respectively smaller or higher than the currently stored minimum or maximum. The
-     * historical buffer is fully parsed in case the oldest sample leaving the buffer is
-     * equal to the recorded minimum or maximum.
+     * The new sample removes from the monotonic queues of the minimum and maximum all the
+     * samples that it dominates, and the sample leaving the time window is removed from the
+     * front of the queues. The minimum and maximum are the first element of each queue
+     * (or the absolute extremes if \a infiniteMaxMin is true).
      * The new sample is also squared and inserted into a second buffer, with similar sum
      * management.
      * The average, root mean square, and standard deviation are only computed when the
@@ -106,6 +108,18 @@ public:
     bool PushSample(Type sample,
                     const bool infiniteMaxMin = false);
 
+    /**
+     * @brief Inserts \a numberOfSamples consecutive samples in the moving time window.
+     * @details Equivalent to calling PushSample() for each sample (oldest first).
+     * @param[in] samples the samples to insert.
+     * @param[in] numberOfSamples the number of samples to insert.
+     * @param[in] infiniteMaxMin see PushSample().
+     * @return true if all the samples were inserted.
+     */
+    bool PushSamples(const Type * const samples,
+                     const uint32 numberOfSamples,
+                     const bool infiniteMaxMin = false);
+
     /**
      * @brief Accessor. Retrieves the sample at index in the sample buffer.
      * @return sample at index. 0 if index out of bounds.
@@ -237,6 +251,61 @@ private:
      */
     CircularStaticList<Type> * Xsq;
 
+    /**
+     * Compensation of the sum of samples (floating point types only)
+     */
+    Type XavgC;
+
+    /**
+     * Compensation of the sum of squares (floating point types only)
+     */
+    Type XrmsC;
+
+    /**
+     * Number of samples ever inserted (wraps at 2^32), i.e. the index of the next sample.
+     */
+    uint32 Xidx;
+
+    /**
+     * Circular queue of the candidates to be the maximum (decreasing values)
+     */
+    Type *XmaxWin;
+
+    /**
+     * Sample index of each element of XmaxWin
+     */
+    uint32 *XmaxIdx;
+
+    /**
+     * Position of the first (i.e. the maximum) element of XmaxWin
+     */
+    uint32 XmaxFirst;
+
+    /**
+     * Number of elements in XmaxWin
+     */
+    uint32 XmaxCount;
+
+    /**
+     * Circular queue of the candidates to be the minimum (increasing values)
+     */
+    Type *XminWin;
+
+    /**
+     * Sample index of each element of XminWin
+     */
+    uint32 *XminIdx;
+
+    /**
+     * Position of the first (i.e. the minimum) element of XminWin
+     */
+    uint32 XminFirst;
+
+    /**
+     * Number of elements in XminWin
+     */
+    uint32 XminCount;
+
     /**
      * @brief Average of squared samples over the moving window.
      * @return average of sample squares.
@@ -244,22 +313,128 @@ private:
     Type GetRmsSq(void) const;
 
     /**
-     * @brief Finds the maximum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Inserts the newest sample in a monotonic queue of extreme candidates.
+     * @details Removes the sample leaving the time window from the front and all the samples
+     * dominated by \a sample (i.e. smaller or equal for the maximum) from the back.
+     * @param[in] sample the newest sample (with index Xidx).
+     * @param[in, out] values the queue values.
+     * @param[in, out] indices the queue sample indices.
+     * @param[in, out] first the position of the first element.
+     * @param[in, out] count the number of elements.
+     * @param[in] isMax true for the queue of the maximum, false for the minimum.
      */
-    Type FindMax(void) const;
+    void PushExtreme(const Type sample,
+                     Type * const values,
+                     uint32 * const indices,
+                     uint32 &first,
+                     uint32 &count,
+                     const bool isMax) const;
 
     /**
-     * @brief Finds the minimum of samples in the sample buffer.
-     * @return maximum.
+     * @brief Removes \a removed from and adds \a added to a running sum.
+     * @details Compensated (Kahan-Neumaier) for floating point types.
+     * @param[in, out] sum the running sum.
+     * @param[in, out] compensation the running compensation (unused for integer types).
+     * @param[in] added the value to add.
+     * @param[in] removed the value to remove.
      */
-    Type FindMin(void) const;
+    static void Accumulate(Type &sum,
+                           Type &compensation,
+                           const Type added,
+                           const Type removed);
 };
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
 
+/*lint -e{715} compensation not required for integer types*/
+template<typename Type> void StatisticsHelperT<Type>::Accumulate(Type &sum,
+                                                                 Type &compensation,
+                                                                 const Type added,
+                                                                 const Type removed) {
+    sum -= removed;
+    sum += added;
+}
+
+/**
+ * @brief float32 implementation of StatisticsHelperT<>::Accumulate()
+ */
+template<> inline void StatisticsHelperT<float32>::Accumulate(float32 &sum,
+                                                              float32 &compensation,
+                                                              const float32 added,
+                                                              const float32 removed) { // Must be declared/defined before use
+    const float32 values[] = { -removed, added };
+    uint32 v;
+    for (v = 0u; v < 2u; v++) {
+        float32 total = sum + values[v];
+        float32 absSum = (sum < 0.0F) ? -sum : sum;
+        float32 absValue = (values[v] < 0.0F) ? -values[v] : values[v];
+        if (absSum >= absValue) {
+            compensation += ((sum - total) + values[v]);
+        }
+        else {
+            compensation += ((values[v] - total) + sum);
+        }
+        sum = total;
+    }
+}
+
+/**
+ * @brief float64 implementation of StatisticsHelperT<>::Accumulate()
+ */
+template<> inline void StatisticsHelperT<float64>::Accumulate(float64 &sum,
+                                                              float64 &compensation,
+                                                              const float64 added,
+                                                              const float64 removed) { // Must be declared/defined before use
+    const float64 values[] = { -removed, added };
+    uint32 v;
+    for (v = 0u; v < 2u; v++) {
+        float64 total = sum + values[v];
+        float64 absSum = (sum < 0.0) ? -sum : sum;
+        float64 absValue = (values[v] < 0.0) ? -values[v] : values[v];
+        if (absSum >= absValue) {
+            compensation += ((sum - total) + values[v]);
+        }
+        else {
+            compensation += ((values[v] - total) + sum);
+        }
+        sum = total;
+    }
+}
+
+template<typename Type> void StatisticsHelperT<Type>::PushExtreme(const Type sample,
+                                                                  Type * const values,
+                                                                  uint32 * const indices,
+                                                                  uint32 &first,
+                                                                  uint32 &count,
+                                                                  const bool isMax) const {
+    /* The indices are increasing, so at most one sample (the first) leaves the time window */
+    if (count > 0u) {
+        if ((Xidx - indices[first]) >= size) {
+            first++;
+            if (first == size) {
+                first = 0u;
+            }
+            count--;
+        }
+    }
+    /* Remove the samples that can no longer become the extreme */
+    bool dominated = (count > 0u);
+    while (dominated) {
+        uint32 last = ((first + count) - 1u) % size;
+        dominated = isMax ? (values[last] <= sample) : (values[last] >= sample);
+        if (dominated) {
+            count--;
+            dominated = (count > 0u);
+        }
+    }
+    uint32 next = (first + count) % size;
+    values[next] = sample;
+    indices[next] = Xidx;
+    count++;
+}
+
 /*lint -e{9117} [MISRA C++ Rule 5-0-4] signedness of 0 ignored in template method to avoid specializing for all integer types*/
 template<typename Type> bool StatisticsHelperT<Type>::Reset() {
 
@@ -272,6 +447,13 @@ template<typename Type> bool StatisticsHelperT<Type>::Reset() {
     Xmin = std::numeric_limits<Type>::max();
     Xrms = 0;
     Xstd = 0;
+    XavgC = 0;
+    XrmsC = 0;
+    Xidx = 0u;
+    XmaxFirst = 0u;
+    XmaxCount = 0u;
+    XminFirst = 0u;
+    XminCount = 0u;
 
     /* Reset sample buffers */
     bool ok = true;
@@ -302,6 +484,13 @@ template<> inline bool StatisticsHelperT<float32>::Reset() { // Must be declared
     Xmin = std::numeric_limits<float32>::max();
     Xrms = 0.0F;
     Xstd = 0.0F;
+    XavgC = 0.0F;
+    XrmsC = 0.0F;
+    Xidx = 0u;
+    XmaxFirst = 0u;
+    XmaxCount = 0u;
+    XminFirst = 0u;
+    XminCount = 0u;
 
     /* Reset sample buffers */
     bool ok = true;
@@ -331,6 +520,13 @@ template<> inline bool StatisticsHelperT<float64>::Reset() { // Must be declared
     Xmin = std::numeric_limits<float64>::max();
     Xrms = 0.0;
     Xstd = 0.0;
+    XavgC = 0.0;
+    XrmsC = 0.0;
+    Xidx = 0u;
+    XmaxFirst = 0u;
+    XmaxCount = 0u;
+    XminFirst = 0u;
+    XminCount = 0u;
 
     /* Reset sample buffers */
     bool ok = true;
@@ -366,6 +562,10 @@ template<typename Type> StatisticsHelperT<Type>::StatisticsHelperT(const uint32
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<Type>(size);
     Xsq = new CircularStaticList<Type>(size);
+    XmaxWin = new Type[size];
+    XmaxIdx = new uint32[size];
+    XminWin = new Type[size];
+    XminIdx = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -404,6 +604,10 @@ template<> inline StatisticsHelperT<float32>::StatisticsHelperT(const uint32 win
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float32>(size);
     Xsq = new CircularStaticList<float32>(size);
+    XmaxWin = new float32[size];
+    XmaxIdx = new uint32[size];
+    XminWin = new float32[size];
+    XminIdx = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -425,6 +629,10 @@ template<> inline StatisticsHelperT<float64>::StatisticsHelperT(const uint32 win
     /* Instantiate sample buffers */
     Xwin = new CircularStaticList<float64>(size);
     Xsq = new CircularStaticList<float64>(size);
+    XmaxWin = new float64[size];
+    XmaxIdx = new uint32[size];
+    XminWin = new float64[size];
+    XminIdx = new uint32[size];
 
     if (!Reset()) {
         REPORT_ERROR_STATIC(ErrorManagement::FatalError, "Unable to Reset instance");
@@ -446,89 +654,26 @@ template<typename Type> StatisticsHelperT<Type>::~StatisticsHelperT() {
         Xsq = NULL_PTR(CircularStaticList<Type> *);
     }
 
-}
-
-/*lint -e{534} ignore return value of GetData since initialisation error would have been caught earlier*/
-template<typename Type> Type StatisticsHelperT<Type>::FindMax() const {
-
-    Type max = std::numeric_limits<Type>::min();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        Type sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
-        }
+    if (XmaxWin != NULL_PTR(Type *)) {
+        delete[] XmaxWin;
+        XmaxWin = NULL_PTR(Type *);
     }
 
-    return max;
-}
-
-template<> inline float32 StatisticsHelperT<float32>::FindMax() const { // Must be declared/defined before use
-
-    float32 max = -1.0F * std::numeric_limits<float32>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float32 sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
-        }
+    if (XmaxIdx != NULL_PTR(uint32 *)) {
+        delete[] XmaxIdx;
+        XmaxIdx = NULL_PTR(uint32 *);
     }
 
-    return max;
-}
-
-template<> inline float64 StatisticsHelperT<float64>::FindMax() const { // Must be declared/defined before use
-
-    float64 max = -1.0 * std::numeric_limits<float64>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        float64 sample;
-
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample > max) {
-            max = sample;
-        }
+    if (XminWin != NULL_PTR(Type *)) {
+        delete[] XminWin;
+        XminWin = NULL_PTR(Type *);
     }
 
-    return max;
-}
-
-template<typename Type> Type StatisticsHelperT<Type>::FindMin() const {
-
-    Type min = std::numeric_limits<Type>::max();
-
-    uint32 index;
-
-    for (index = 0u; index < size; index++) {
-
-        Type sample;
-        /*lint -e{534} ignore return value of GetData since an initialisation error would make that this method is not called*/
-        Xwin->Peek(index, sample);
-
-        if (sample < min) {
-            min = sample;
-        }
+    if (XminIdx != NULL_PTR(uint32 *)) {
+        delete[] XminIdx;
+        XminIdx = NULL_PTR(uint32 *);
     }
 
-    return min;
 }
 
 template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
@@ -550,27 +695,26 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
     }
 
     if (ok) {
-        /* Compute average */
-        Xavg -= oldest; /* Remove oldest sample from the accumulator */
-        Xavg += Xspl; /* Sum of all sample in time window */
+        /* Compute average: remove oldest sample from the accumulator and add the new one (sum of all sample in time window) */
+        Accumulate(Xavg, XavgC, Xspl, oldest);
 
-        /* Update max/min, if necessary */
-        if (Xspl > Xmax) {
-            Xmax = Xspl;
-        }
-
-        if (Xspl < Xmin) {
-            Xmin = Xspl;
-        }
+        /* Update max/min */
+        PushExtreme(Xspl, XmaxWin, XmaxIdx, XmaxFirst, XmaxCount, true);
+        PushExtreme(Xspl, XminWin, XminIdx, XminFirst, XminCount, false);
+        Xidx++;
 
-        if(!infiniteMaxMin) {
-            if (oldest == Xmax) { /* The removed sample was the max over the time window */
-                Xmax = FindMax();
+        if (infiniteMaxMin) {
+            if (Xspl > Xmax) {
+                Xmax = Xspl;
             }
-            if (oldest == Xmin) { /* The removed sample was the min over the time window */
-                Xmin = FindMin();
+            if (Xspl < Xmin) {
+                Xmin = Xspl;
             }
         }
+        else {
+            Xmax = XmaxWin[XmaxFirst];
+            Xmin = XminWin[XminFirst];
+        }
     }
 
     Type Xspl_sq = Xspl * Xspl; /* Square of the sample */
@@ -581,14 +725,24 @@ template<typename Type> bool StatisticsHelperT<Type>::PushSample(Type sample,
     }
 
     if (ok) {
-        /* Compute root mean square */
-        Xrms -= oldest; /* Remove oldest sample from the accumulator */
-        Xrms += Xspl_sq; /* Sum of squares of all samples in time window */
+        /* Compute root mean square: sum of squares of all samples in time window */
+        Accumulate(Xrms, XrmsC, Xspl_sq, oldest);
     }
 
     return ok;
 }
 
+template<typename Type> bool StatisticsHelperT<Type>::PushSamples(const Type * const samples,
+                                                                  const uint32 numberOfSamples,
+                                                                  const bool infiniteMaxMin) {
+    bool ok = (samples != NULL_PTR(const Type *));
+    uint32 i;
+    for (i = 0u; (i < numberOfSamples) && (ok); i++) {
+        ok = PushSample(samples[i], infiniteMaxMin);
+    }
+    return ok;
+}
+
 template<typename Type> Type StatisticsHelperT<Type>::GetSample(uint32 index) const {
     Type elementOut;
     if (!Xwin->Peek(index, elementOut)) {
@@ -625,7 +779,7 @@ template<typename Type> Type StatisticsHelperT<Type>::GetAvg() const {
  */
 template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
 
-    float32 avg = Xavg * Xdiv;
+    float32 avg = (Xavg + XavgC) * Xdiv;
 
     return avg;
 }
@@ -635,7 +789,7 @@ template<> inline float32 StatisticsHelperT<float32>::GetAvg() const {
  */
 template<> inline float64 StatisticsHelperT<float64>::GetAvg() const {
 
-    float64 avg = Xavg * Xdiv;
+    float64 avg = (Xavg + XavgC) * Xdiv;
 
     return avg;
 }
@@ -649,14 +803,14 @@ template<typename Type> Type StatisticsHelperT<Type>::GetRmsSq() const {
 
 template<> inline float32 StatisticsHelperT<float32>::GetRmsSq() const {
 
-    float32 rms_sq = Xrms * Xdiv;
+    float32 rms_sq = (Xrms + XrmsC) * Xdiv;
 
     return rms_sq;
 }
 
 template<> inline float64 StatisticsHelperT<float64>::GetRmsSq() const {
 
-    float64 rms_sq = Xrms * Xdiv;
+    float64 rms_sq = (Xrms + XrmsC) * Xdiv;
 
     return rms_sq;
 }
@@ -686,6 +840,20 @@ template<typename Type> Type StatisticsHelperT<Type>::GetSum() const {
     return Xavg;
 }
 
+/**
+ * @brief float32 implementation of StatisticsHelperT<>::GetSum()
+ */
+template<> inline float32 StatisticsHelperT<float32>::GetSum() const {
+    return (Xavg + XavgC);
+}
+
+/**
+ * @brief float64 implementation of StatisticsHelperT<>::GetSum()
+ */
+template<> inline float64 StatisticsHelperT<float64>::GetSum() const {
+    return (Xavg + XavgC);
+}
+
 template<typename Type> Type StatisticsHelperT<Type>::GetMax() const {
     return Xmax;
 }
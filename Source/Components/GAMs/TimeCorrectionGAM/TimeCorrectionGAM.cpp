@@ -30,6 +30,7 @@
 /*---------------------------------------------------------------------------*/
 
 #include "AdvancedErrorManagement.h"
+#include "HighResolutionTimer.h"
 #include "TimeCorrectionGAM.h"
 
 /*---------------------------------------------------------------------------*/
@@ -53,12 +54,30 @@ TimeCorrectionGAM::TimeCorrectionGAM() :
     corrected = NULL_PTR(uint8 *);
     lastValidTime = 0ull;
     iterationCounter = 0u;
+    estimatorMode = false;
+    phaseGain = 0.;
+    frequencyGain = 0.;
+    nominalRate = 0.;
+    rate = 0.;
+    estimatedTime = 0ull;
+    estimatedTimeFraction = 0.;
+    lastLocalTime = 0ull;
+    lastValidLocalTime = 0ull;
+    localTime = NULL_PTR(uint64 *);
+    numberOfSamples = 1u;
+    consecutiveCorrections = 0u;
+    jitterVariance = 0.;
+    jitter = NULL_PTR(float64 *);
+    drift = NULL_PTR(float64 *);
 }
 
 TimeCorrectionGAM::~TimeCorrectionGAM() {
     inputTime = NULL_PTR(uint64 *);
     correctedTime = NULL_PTR(uint64 *);
     corrected = NULL_PTR(uint8 *);
+    localTime = NULL_PTR(uint64 *);
+    jitter = NULL_PTR(float64 *);
+    drift = NULL_PTR(float64 *);
 }
 
 bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
@@ -89,10 +108,61 @@ bool TimeCorrectionGAM::Initialise(StructuredDataI & data) {
             }
         }
     }
+    if (ret) {
+        StreamString mode;
+        if (data.Read("Mode", mode)) {
+            estimatorMode = (mode == "Estimator");
+            ret = ((estimatorMode) || (mode == "Filter"));
+            if (!ret) {
+                REPORT_ERROR(ErrorManagement::InitialisationError, "Mode shall be Filter or Estimator");
+            }
+        }
+    }
+    if ((ret) && (estimatorMode)) {
+        if (!data.Read("PhaseGain", phaseGain)) {
+            phaseGain = static_cast<float64>(filterGain);
+        }
+        if (!data.Read("FrequencyGain", frequencyGain)) {
+            //Critically damped alpha-beta filter.
+            frequencyGain = (phaseGain * phaseGain) / (2. - phaseGain);
+        }
+        ret = ((phaseGain > 0.) && (phaseGain < 1.) && (frequencyGain > 0.) && (frequencyGain < 1.));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "PhaseGain and FrequencyGain must be in ]0, 1[");
+        }
+    }
+    if ((ret) && (estimatorMode)) {
+        float64 localFrequency;
+        if (!data.Read("LocalFrequency", localFrequency)) {
+            localFrequency = static_cast<float64>(HighResolutionTimer::Frequency());
+        }
+        float64 timeUnitsPerSecond;
+        if (!data.Read("TimeUnitsPerSecond", timeUnitsPerSecond)) {
+            timeUnitsPerSecond = 1e9;
+        }
+        ret = ((localFrequency > 0.) && (timeUnitsPerSecond > 0.));
+        if (ret) {
+            nominalRate = (timeUnitsPerSecond / localFrequency);
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "LocalFrequency and TimeUnitsPerSecond must be positive");
+        }
+    }
     return ret;
 }
 
 bool TimeCorrectionGAM::Setup() {
+    bool ret;
+    if (estimatorMode) {
+        ret = SetupEstimator();
+    }
+    else {
+        ret = SetupFilter();
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAM::SetupFilter() {
     bool ret = (GetNumberOfInputSignals() == 1u);
 
     if (ret) {
@@ -180,8 +250,158 @@ bool TimeCorrectionGAM::Setup() {
     return ret;
 }
 
+bool TimeCorrectionGAM::SetupEstimator() {
+    uint32 nOfInputSignals = GetNumberOfInputSignals();
+    uint32 nOfOutputSignals = GetNumberOfOutputSignals();
+    bool ret = ((nOfInputSignals > 0u) && (nOfInputSignals <= 2u));
+    if (!ret) {
+        REPORT_ERROR(ErrorManagement::InitialisationError, "The Estimator mode allows only one or two input signals");
+    }
+    if (ret) {
+        ret = ((nOfOutputSignals > 0u) && (nOfOutputSignals <= 4u));
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The Estimator mode allows from one to four output signals");
+        }
+    }
+    uint32 i;
+    for (i = 0u; (i < nOfInputSignals) && (ret); i++) {
+        uint32 numberOfElements = 0u;
+        ret = (GetSignalType(InputSignals, i) == UnsignedInteger64Bit);
+        if (ret) {
+            ret = GetSignalNumberOfElements(InputSignals, i, numberOfElements);
+        }
+        if (ret) {
+            ret = (numberOfElements == 1u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The input signal (%u) must be a scalar uint64", i);
+        }
+    }
+    if (ret) {
+        ret = (GetSignalType(OutputSignals, 0u) == UnsignedInteger64Bit);
+        if (ret) {
+            ret = GetSignalNumberOfElements(OutputSignals, 0u, numberOfSamples);
+        }
+        if (ret) {
+            ret = (numberOfSamples > 0u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The corrected time signal (0) must be uint64");
+        }
+    }
+    for (i = 1u; (i < nOfOutputSignals) && (ret); i++) {
+        uint32 numberOfElements = 0u;
+        TypeDescriptor expectedType = (i == 1u) ? UnsignedInteger8Bit : Float64Bit;
+        ret = (GetSignalType(OutputSignals, i) == expectedType);
+        if (ret) {
+            ret = GetSignalNumberOfElements(OutputSignals, i, numberOfElements);
+        }
+        if (ret) {
+            ret = (numberOfElements == 1u);
+        }
+        if (!ret) {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "The output signal (%u) must be a scalar %s", i, TypeDescriptor::GetTypeNameFromTypeDescriptor(expectedType));
+        }
+    }
+    if (ret) {
+        inputTime = reinterpret_cast<uint64 *>(GetInputSignalMemory(0u));
+        if (nOfInputSignals > 1u) {
+            localTime = reinterpret_cast<uint64 *>(GetInputSignalMemory(1u));
+        }
+        correctedTime = reinterpret_cast<uint64 *>(GetOutputSignalMemory(0u));
+        if (nOfOutputSignals > 1u) {
+            corrected = reinterpret_cast<uint8 *>(GetOutputSignalMemory(1u));
+        }
+        if (nOfOutputSignals > 2u) {
+            jitter = reinterpret_cast<float64 *>(GetOutputSignalMemory(2u));
+        }
+        if (nOfOutputSignals > 3u) {
+            drift = reinterpret_cast<float64 *>(GetOutputSignalMemory(3u));
+        }
+        estimatedDelta = static_cast<float64>(expectedDelta);
+        rate = nominalRate;
+    }
+    return ret;
+}
+
 /*lint -e{613} pointer checked before during the Setup*/
+void TimeCorrectionGAM::ExecuteEstimator() {
+    uint64 local = (localTime != NULL_PTR(uint64 *)) ? (*localTime) : (HighResolutionTimer::Counter());
+    uint8 isCorrected = 0u;
+    if (iterationCounter > 0u) {
+        float64 localDelta = static_cast<float64>(local - lastLocalTime);
+        //Predict
+        float64 cycleAdvance = (rate * localDelta);
+        AddToEstimatedTime(cycleAdvance);
+        //The difference is small, so it can be computed as an integer before converting to float64
+        float64 innovation = (static_cast<float64>(static_cast<int64>((*inputTime) - estimatedTime)) - estimatedTimeFraction);
+        if ((fabs(innovation) <= static_cast<float64>(deltaTolerance)) && (localDelta > 0.)) {
+            //Correct
+            AddToEstimatedTime(phaseGain * innovation);
+            rate += ((frequencyGain * innovation) / localDelta);
+            cycleAdvance += (phaseGain * innovation);
+            float64 gain = static_cast<float64>(filterGain);
+            jitterVariance = (((1.0 - gain) * jitterVariance) + (gain * innovation * innovation));
+            estimatedDelta = (((1.0 - gain) * estimatedDelta) + (gain * cycleAdvance));
+            consecutiveCorrections = 0u;
+            lastValidTime = (*inputTime);
+            lastValidLocalTime = local;
+        }
+        else {
+            isCorrected = 1u;
+            consecutiveCorrections++;
+            if (consecutiveCorrections >= TIME_CORRECTION_GAM_MAX_HOLDOVER_CYCLES) {
+                //Lock lost. Restart from the input time-stamp and from the rate measured since the last accepted time-stamp.
+                //The time-stamps may have gone backwards, so the difference is signed. If it is not positive the predicted rate is kept.
+                int64 validDelta = static_cast<int64>((*inputTime) - lastValidTime);
+                float64 validLocalDelta = static_cast<float64>(local - lastValidLocalTime);
+                if ((validDelta > 0) && (validLocalDelta > 0.)) {
+                    rate = (static_cast<float64>(validDelta) / validLocalDelta);
+                }
+                estimatedTime = (*inputTime);
+                estimatedTimeFraction = 0.;
+                consecutiveCorrections = 0u;
+                lastValidTime = (*inputTime);
+                lastValidLocalTime = local;
+            }
+        }
+    }
+    else {
+        estimatedTime = (*inputTime);
+        estimatedTimeFraction = 0.;
+        lastValidTime = (*inputTime);
+        lastValidLocalTime = local;
+        iterationCounter++;
+    }
+    lastLocalTime = local;
+    float64 samplePeriod = (estimatedDelta / static_cast<float64>(numberOfSamples));
+    uint32 i;
+    for (i = 0u; i < numberOfSamples; i++) {
+        correctedTime[i] = (estimatedTime + static_cast<uint64>((estimatedTimeFraction + (static_cast<float64>(i) * samplePeriod)) + 0.5));
+    }
+    if (corrected != NULL_PTR(uint8 *)) {
+        *corrected = isCorrected;
+    }
+    if (jitter != NULL_PTR(float64 *)) {
+        *jitter = sqrt(jitterVariance);
+    }
+    if (drift != NULL_PTR(float64 *)) {
+        *drift = (((rate / nominalRate) - 1.0) * 1e6);
+    }
+}
+
 bool TimeCorrectionGAM::Execute() {
+    if (estimatorMode) {
+        ExecuteEstimator();
+    }
+    else {
+        ExecuteFilter();
+    }
+    return true;
+}
+
+/*lint -e{613} pointer checked before during the Setup*/
+void TimeCorrectionGAM::ExecuteFilter() {
     //a good value
     if (iterationCounter > 0u) {
         uint64 delta = (*inputTime) - lastValidTime;
@@ -212,8 +432,6 @@ bool TimeCorrectionGAM::Execute() {
         iterationCounter++;
     }
     //REPORT_ERROR(ErrorManagement::FatalError, "estimated delta = %f", estimatedDelta);
-
-    return true;
 }
 CLASS_REGISTER(TimeCorrectionGAM, "1.0")
 }
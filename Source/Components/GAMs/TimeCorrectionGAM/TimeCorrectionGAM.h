@@ -27,6 +27,7 @@
 /*---------------------------------------------------------------------------*/
 /*                        Standard header includes                           */
 /*---------------------------------------------------------------------------*/
+#include <math.h>
 
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
@@ -37,6 +38,11 @@
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe{
+/**
+ * Number of consecutive rejected time-stamps after which the estimator is re-seeded.
+ */
+static const uint32 TIME_CORRECTION_GAM_MAX_HOLDOVER_CYCLES = 16u;
+
 /**
  * @brief GAM which allows to estimate the next time-stamp value in a continuous time stream.
  *
@@ -87,6 +93,65 @@ namespace MARTe{
  *      }
  *  }
  * </pre>
+ *
+ * @details If Mode = Estimator, the GAM runs instead a phase/frequency tracking loop (a steady-state two-state Kalman filter, i.e. an alpha-beta filter)
+ * which estimates the offset and the drift between a local counter and the external time-stamp stream. At each cycle the time-stamp is
+ * predicted from the local counter and the estimated rate:\n
+ *   time_predicted = time_estimated + rate * (local - last_local)\n
+ * and the innovation (time_input - time_predicted) corrects the estimation:\n
+ *   time_estimated = time_predicted + PhaseGain * innovation\n
+ *   rate = rate + FrequencyGain * innovation / (local - last_local)\n
+ * Time-stamps with an innovation larger than DeltaTolerance are not used (and the output is flagged as corrected). After
+ * TIME_CORRECTION_GAM_MAX_HOLDOVER_CYCLES consecutive rejected time-stamps the estimator is re-seeded with the input time-stamp and with the
+ * rate measured since the last accepted time-stamp (the predicted rate is kept if the time-stamps went backwards).
+ *
+ * The local counter is either the optional second input signal (uint64) or, if not defined, HighResolutionTimer::Counter(). The first output
+ * signal can have N elements (e.g. one per sample of an acquired block), in which case the first element is the estimated time-stamp of the
+ * cycle and the following ones are spaced by the estimated period (filtered with FilterGain) divided by N. The optional third and fourth
+ * output signals (float64) are the jitter (root mean square of the innovation filtered with FilterGain, in time-stamp units) and the drift of
+ * the external time-stamp stream with respect to the local counter (in ppm).
+ * <pre>
+ * +TimeCorrectionGAM_1 = {
+ *     Class = TimeCorrectionGAM
+ *     Mode = Estimator //Optional. Filter (default) or Estimator
+ *     ExpectedDelta = 1000000
+ *     DeltaTolerance = 1000 //Maximum innovation
+ *     FilterGain = 0.1 //Used to filter the estimated period and the jitter
+ *     PhaseGain = 0.1 //Optional. Default = FilterGain
+ *     FrequencyGain = 0.005 //Optional. Default = PhaseGain^2 / (2 - PhaseGain)
+ *     LocalFrequency = 1e9 //Optional. Frequency of the local counter. Default = HighResolutionTimer::Frequency()
+ *     TimeUnitsPerSecond = 1e9 //Optional. Units of the time-stamps. Default = 1e9 (ns)
+ *     InputSignals = {
+ *         InputTime = {
+ *             DataSource = Drv1
+ *             Type = uint64
+ *         }
+ *         LocalTime = { //Optional
+ *             DataSource = Drv1
+ *             Type = uint64
+ *         }
+ *      }
+ *      OutputSignals = {
+ *          CorrectedTime = {
+ *              DataSource = DDB
+ *              Type = uint64
+ *              NumberOfElements = 10
+ *          }
+ *          IsCorrected = { //Optional
+ *              DataSource = DDB
+ *              Type = uint8
+ *          }
+ *          Jitter = { //Optional
+ *              DataSource = DDB
+ *              Type = float64
+ *          }
+ *          Drift = { //Optional
+ *              DataSource = DDB
+ *              Type = float64
+ *          }
+ *      }
+ *  }
+ * </pre>
  */
 class TimeCorrectionGAM: public GAM {
 
@@ -112,6 +177,10 @@ public:
      *     it will not be corrected. The range is [ExpectedDelta-DeltaTolerance, ExpectedDelta+DeltaTolerance].\n
      *   FilterGain (float32): is the gain used in the first-order filter to compute the delta estimation that is used
      *     to correct the wrong time-stamps\n
+     * and optionally:\n
+     *   Mode (Filter|Estimator): default Filter\n
+     *   PhaseGain, FrequencyGain, LocalFrequency, TimeUnitsPerSecond (float64): only used in Estimator mode. The gains
+     *     must be in ]0, 1[ and LocalFrequency and TimeUnitsPerSecond must be positive.\n
      * @param[in] data @see GAM::Initialise
      * @return true if all the parameters above are specified.
      */
@@ -121,6 +190,8 @@ public:
      * @see GAM::Setup
      * @brief Checks if the input signal (acquired time-stamp) is unique, scalar and if it is uint64 type. Checks that the first output signal
      * (corrected time-stamp) is scalar and uint64 type and that the second signal (is corrected flag) is scalar and uint8 type.
+     * In Estimator mode the input signals can also include the local counter (scalar uint64), the first output signal can have
+     * more than one element and the (scalar float64) jitter and drift output signals can be added.
      * @return true if all the checks succeeds, false otherwise.
      */
     virtual bool Setup();
@@ -130,6 +201,7 @@ public:
      * @details If the input time-stamp is valid (namely it belongs to the range defined by the user in the configuration), the time-stamp is exactly copied to
      * the output and the delta difference with the previous time-stamp is used to compute the estimation of the delta. If the time-stamp is wrong,
      * the corrected time-stamp is computed as the last time-stamp output plus the estimated delta.
+     * In Estimator mode the output is the estimation computed with the local counter (see class description).
      * @return true.
      */
     virtual bool Execute();
@@ -175,7 +247,7 @@ protected:
     uint8* corrected;
 
     /**
-     * Used to store the last time-stamp output
+     * Used to store the last time-stamp output (the last accepted time-stamp if Mode = Estimator)
      */
     uint64 lastValidTime;
 
@@ -185,12 +257,133 @@ protected:
      */
     uint8 iterationCounter;
 
+    /**
+     * True if Mode = Estimator
+     */
+    bool estimatorMode;
+
+    /**
+     * The phase gain of the estimator
+     */
+    float64 phaseGain;
+
+    /**
+     * The frequency gain of the estimator
+     */
+    float64 frequencyGain;
+
+    /**
+     * The nominal number of time-stamp units per local counter tick
+     */
+    float64 nominalRate;
+
+    /**
+     * The estimated number of time-stamp units per local counter tick
+     */
+    float64 rate;
+
+    /**
+     * Integer part of the estimated time-stamp
+     */
+    uint64 estimatedTime;
+
+    /**
+     * Fractional part of the estimated time-stamp, in [0, 1[. Kept apart so that the
+     * (large) time-stamps do not lose precision in float64.
+     */
+    float64 estimatedTimeFraction;
+
+    /**
+     * The local counter in the last cycle
+     */
+    uint64 lastLocalTime;
+
+    /**
+     * The local counter of the last accepted time-stamp (see lastValidTime)
+     */
+    uint64 lastValidLocalTime;
+
+    /**
+     * Accelerator to the memory of the optional local counter signal
+     */
+    uint64 *localTime;
+
+    /**
+     * Number of elements of the corrected time-stamp signal
+     */
+    uint32 numberOfSamples;
+
+    /**
+     * Number of consecutive rejected time-stamps
+     */
+    uint32 consecutiveCorrections;
+
+    /**
+     * The filtered square of the innovation
+     */
+    float64 jitterVariance;
+
+    /**
+     * Accelerator to the memory of the optional jitter output signal
+     */
+    float64 *jitter;
+
+    /**
+     * Accelerator to the memory of the optional drift output signal
+     */
+    float64 *drift;
+
+private:
+
+    /**
+     * @brief Setup of the Filter mode (see Setup).
+     * @return true if the signals are valid for the Filter mode.
+     */
+    bool SetupFilter();
+
+    /**
+     * @brief Execute of the Filter mode (see Execute).
+     */
+    void ExecuteFilter();
+
+    /**
+     * @brief Setup of the Estimator mode.
+     * @return true if the signals are valid for the Estimator mode.
+     */
+    bool SetupEstimator();
+
+    /**
+     * @brief Execute of the Estimator mode.
+     */
+    void ExecuteEstimator();
+
+    /**
+     * @brief Adds an offset to the estimated time-stamp keeping the fraction in [0, 1[.
+     * @param[in] offset the value to add.
+     */
+    inline void AddToEstimatedTime(const float64 offset);
+
 };
 }
 
 /*---------------------------------------------------------------------------*/
 /*                        Inline method definitions                          */
 /*---------------------------------------------------------------------------*/
+namespace MARTe {
+
+void TimeCorrectionGAM::AddToEstimatedTime(const float64 offset) {
+    float64 fraction = estimatedTimeFraction + offset;
+    float64 wholeUnits = floor(fraction);
+    if (wholeUnits >= 0.0) {
+        estimatedTime += static_cast<uint64>(wholeUnits);
+    }
+    else {
+        estimatedTime -= static_cast<uint64>(-wholeUnits);
+    }
+    estimatedTimeFraction = (fraction - wholeUnits);
+}
+
+}
 
 #endif /* TIMECORRECTIONGAM_H_ */
 
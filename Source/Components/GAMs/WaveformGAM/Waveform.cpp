@@ -65,6 +65,7 @@ Waveform::Waveform() :
     timeIncrement = 0.0;
     timeState = 0u;
     typeVariableOut = NULL_PTR(TypeDescriptor *);
+    getValueFunctions = NULL_PTR(GetValueFunction *);
     indexOutputSignal = 0u;
     triggersEnable = false;
     lastTime = 0.0;
@@ -75,6 +76,10 @@ Waveform::~Waveform() {
         delete[] typeVariableOut;
         typeVariableOut = NULL_PTR(TypeDescriptor *);
     }
+    if (getValueFunctions != NULL_PTR(GetValueFunction *)) {
+        delete[] getValueFunctions;
+        getValueFunctions = NULL_PTR(GetValueFunction *);
+    }
     if (outputValue != NULL_PTR(void **)) {
         for (uint32 i = 0u; i < nOfOutputSignals; i++) {
             outputValue[i] = NULL_PTR(void *);
@@ -243,6 +248,7 @@ bool Waveform::Setup() {
         }
     }
     typeVariableOut = new TypeDescriptor[nOfOutputSignals];
+    getValueFunctions = new GetValueFunction[nOfOutputSignals];
     if (ok) {
         for (uint32 i = 0u; (i < nOfOutputSignals) && ok; i++) {
             typeVariableOut[i] = GetSignalType(OutputSignals, i);
@@ -251,6 +257,10 @@ bool Waveform::Setup() {
                 const uint32 aux = i;
                 REPORT_ERROR(ErrorManagement::ParametersError, "%s::Output variable type for signal %u not supported.", GAMName.Buffer(), aux);
             }
+            if (ok) {
+                getValueFunctions[i] = GetValueFunctionForType(typeVariableOut[i]);
+                ok = (getValueFunctions[i] != NULL_PTR(GetValueFunction));
+            }
         }
     }
     if (ok) { //Read and check input dimensions
@@ -323,40 +333,9 @@ bool Waveform::Execute() {
             currentTime = static_cast<float64>(time0) / 1e6;
             ok = PrecomputeValues();
         }
-        /*lint -e{613} typeVariableOut cannot be NULL as otherwise Execute will not be called*/
+        /*lint -e{613} getValueFunctions cannot be NULL as otherwise Execute will not be called*/
         for (indexOutputSignal = 0u; (indexOutputSignal < numberOfOutputSignals) && ok; indexOutputSignal++) {
-            if (typeVariableOut[indexOutputSignal] == UnsignedInteger8Bit) {
-                ok = GetUInt8Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == SignedInteger8Bit) {
-                ok = GetInt8Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == UnsignedInteger16Bit) {
-                ok = GetUInt16Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == SignedInteger16Bit) {
-                ok = GetInt16Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == UnsignedInteger32Bit) {
-                ok = GetUInt32Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == SignedInteger32Bit) {
-                ok = GetInt32Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == UnsignedInteger64Bit) {
-                ok = GetInt64Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == SignedInteger64Bit) {
-                ok = GetUInt64Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == Float32Bit) {
-                ok = GetFloat32Value();
-            }
-            else if (typeVariableOut[indexOutputSignal] == Float64Bit) {
-                ok = GetFloat64Value();
-            }
-            else {
-            }
+            ok = (this->*getValueFunctions[indexOutputSignal])();
         }
         signalOn = true;
     }
@@ -385,44 +364,11 @@ bool Waveform::Execute() {
         if (ok) {
             currentTime = static_cast<float64>(auxTime) / 1e6;
             if (currentTime > lastTime) {
-                //Check type and call correct function.
+                //Call the Get*Value() resolved in Setup() for the type of each output.
                 ok = PrecomputeValues();
+                /*lint -e{613} getValueFunctions cannot be NULL as otherwise Execute will not be called*/
                 for (indexOutputSignal = 0u; (indexOutputSignal < numberOfOutputSignals) && ok; indexOutputSignal++) {
-                    //If due to MISRA warning about null pointer
-                    if (typeVariableOut != NULL_PTR(TypeDescriptor *)) {
-                        if (typeVariableOut[indexOutputSignal] == UnsignedInteger8Bit) {
-                            ok = GetUInt8Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == SignedInteger8Bit) {
-                            ok = GetInt8Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == UnsignedInteger16Bit) {
-                            ok = GetUInt16Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == SignedInteger16Bit) {
-                            ok = GetInt16Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == UnsignedInteger32Bit) {
-                            ok = GetUInt32Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == SignedInteger32Bit) {
-                            ok = GetInt32Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == UnsignedInteger64Bit) {
-                            ok = GetUInt64Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == SignedInteger64Bit) {
-                            ok = GetInt64Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == Float32Bit) {
-                            ok = GetFloat32Value();
-                        }
-                        else if (typeVariableOut[indexOutputSignal] == Float64Bit) {
-                            ok = GetFloat64Value();
-                        }
-                        else {
-                        }
-                    }
+                    ok = (this->*getValueFunctions[indexOutputSignal])();
                 }
             }
             else {
@@ -519,6 +465,44 @@ bool Waveform::IsValidType(TypeDescriptor const &typeRef) const {
     return retVal;
 }
 
+Waveform::GetValueFunction Waveform::GetValueFunctionForType(TypeDescriptor const &typeRef) {
+    GetValueFunction ret = NULL_PTR(GetValueFunction);
+    if (typeRef == UnsignedInteger8Bit) {
+        ret = &Waveform::GetUInt8Value;
+    }
+    else if (typeRef == SignedInteger8Bit) {
+        ret = &Waveform::GetInt8Value;
+    }
+    else if (typeRef == UnsignedInteger16Bit) {
+        ret = &Waveform::GetUInt16Value;
+    }
+    else if (typeRef == SignedInteger16Bit) {
+        ret = &Waveform::GetInt16Value;
+    }
+    else if (typeRef == UnsignedInteger32Bit) {
+        ret = &Waveform::GetUInt32Value;
+    }
+    else if (typeRef == SignedInteger32Bit) {
+        ret = &Waveform::GetInt32Value;
+    }
+    else if (typeRef == UnsignedInteger64Bit) {
+        ret = &Waveform::GetUInt64Value;
+    }
+    else if (typeRef == SignedInteger64Bit) {
+        ret = &Waveform::GetInt64Value;
+    }
+    else if (typeRef == Float32Bit) {
+        ret = &Waveform::GetFloat32Value;
+    }
+    else if (typeRef == Float64Bit) {
+        ret = &Waveform::GetFloat64Value;
+    }
+    else {
+        //Not supported. Previously checked by IsValidType.
+    }
+    return ret;
+}
+
 //lint -e{613} Possible use of null pointer. Not possible this functions is called only if inputTime != NULL
 bool Waveform::GetInputTime(uint64 &timeOut) {
     bool ok = true;
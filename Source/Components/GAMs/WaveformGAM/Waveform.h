@@ -38,6 +38,12 @@
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
 
+/**
+ * Number of samples after which the sine/chirp recurrences (Method = Recurrence) are re-seeded with the exact sin/cos,
+ * so that the rounding errors of the rotation recurrence cannot accumulate. Shall be a power of 2.
+ */
+static const uint32 WAVEFORM_RECURRENCE_RESEED_PERIOD = 256u;
+
 /**
  * @brief Generic class to implement any kind of waveform
  * @details This class contains the generic common functions and variables to implement any waveform signal.
@@ -48,7 +54,8 @@ namespace MARTe {
  * WaveformChirpGAM
  *
  * This class implements the common functionalities that are common to all the derived classes, which are basically the setup of the
- * trigger mechanism and the selection of the output type.
+ * trigger mechanism and the selection of the output type. The output type of each signal is resolved in Setup() to the corresponding
+ * Get*Value() method, so that Execute() does not have to compare the TypeDescriptor of every signal on every cycle.
  *
  * The trigger time must be specified in seconds and the type shall be float64.
  */
@@ -372,6 +379,23 @@ private:
 
     bool GetInputTime(uint64 &timeOut);
 
+    /**
+     * The signature of the Get*Value() methods.
+     */
+    typedef bool (Waveform::*GetValueFunction)();
+
+    /**
+     * @brief Gets the Get*Value() method for a given output type.
+     * @param[in] typeRef the output type.
+     * @return the Get*Value() method or NULL if the type is not supported.
+     */
+    static GetValueFunction GetValueFunctionForType(TypeDescriptor const &typeRef);
+
+    /**
+     * The Get*Value() method of each output signal (resolved in Setup()).
+     */
+    GetValueFunction *getValueFunctions;
+
 };
 
 }
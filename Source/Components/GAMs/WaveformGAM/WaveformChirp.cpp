@@ -61,6 +61,9 @@ WaveformChirp::WaveformChirp() :
     w12 = w2 - w1;
     chirpDuration = 0.0;
     cD2 = chirpDuration * 2.0;
+    useRecurrence = false;
+    step2Cos = 1.0;
+    step2Sin = 0.0;
 }
 
 WaveformChirp::~WaveformChirp() {
@@ -127,11 +130,37 @@ bool WaveformChirp::Initialise(StructuredDataI &data) {
     if (ok) {
         cD2 = chirpDuration * 2.0;
     }
+    if (ok) {
+        StreamString method;
+        if (!data.Read("Method", method)) {
+            method = "Exact";
+        }
+        if (method == "Recurrence") {
+            useRecurrence = true;
+        }
+        else if (method == "Exact") {
+            useRecurrence = false;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Method %s. Valid methods: Exact, Recurrence", method.Buffer());
+            ok = false;
+        }
+    }
 
     return ok;
 }
 
 bool WaveformChirp::PrecomputeValues() {
+    if (useRecurrence) {
+        PrecomputeValuesRecurrence();
+    }
+    else {
+        PrecomputeValuesExact();
+    }
+    return true;
+}
+
+void WaveformChirp::PrecomputeValuesExact() {
     for (uint32 i = 0u; i < numberOfOutputElements; i++) {
         TriggerMechanism();
         if (signalOn && triggersOn) {
@@ -144,7 +173,39 @@ bool WaveformChirp::PrecomputeValues() {
         }
         currentTime += timeIncrement;
     }
-    return true;
+}
+
+void WaveformChirp::PrecomputeValuesRecurrence() {
+    float64 sinValue = 0.0;
+    float64 cosValue = 1.0;
+    float64 stepSin = 0.0;
+    float64 stepCos = 1.0;
+    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+        if ((i & (WAVEFORM_RECURRENCE_RESEED_PERIOD - 1u)) == 0u) {
+            float64 angle = ((w1 * currentTime) + ((w12 * currentTime * currentTime) / cD2)) + phase;
+            //angle(t + timeIncrement) - angle(t)
+            float64 stepAngle = (w1 * timeIncrement) + ((w12 * ((2.0 * currentTime) + timeIncrement) * timeIncrement) / cD2);
+            sinValue = sin(angle);
+            cosValue = cos(angle);
+            stepSin = sin(stepAngle);
+            stepCos = cos(stepAngle);
+        }
+        TriggerMechanism();
+        if (signalOn && triggersOn) {
+            outputFloat64[i] = (amplitude * sinValue) + offset;
+        }
+        else {
+            outputFloat64[i] = 0.0;
+        }
+        //Rotate (cos, sin) by the phase increment and the phase increment by its (constant) increment.
+        float64 nextSin = (sinValue * stepCos) + (cosValue * stepSin);
+        cosValue = (cosValue * stepCos) - (sinValue * stepSin);
+        sinValue = nextSin;
+        float64 nextStepSin = (stepSin * step2Cos) + (stepCos * step2Sin);
+        stepCos = (stepCos * step2Cos) - (stepSin * step2Sin);
+        stepSin = nextStepSin;
+        currentTime += timeIncrement;
+    }
 }
 
 bool WaveformChirp::TimeIncrementValidation() {
@@ -158,6 +219,11 @@ bool WaveformChirp::TimeIncrementValidation() {
     if (!ok) {
         REPORT_ERROR(ErrorManagement::FatalError, "%s::sample frequency /2 < maxFrequency", GAMName.Buffer());
     }
+    if (ok) {
+        float64 step2Angle = (2.0 * w12 * timeIncrement * timeIncrement) / cD2;
+        step2Cos = cos(step2Angle);
+        step2Sin = sin(step2Angle);
+    }
     return ok;
 }
 
@@ -63,6 +63,8 @@ namespace MARTe {
  *     Frequency2 = 3.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     ChirpDuration = 10.0
+ *     Method = Recurrence //Optional. Exact (default) or Recurrence.
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time less, it means that after the sequence of output on and off, the GAM will remain on forever
  *     Time = {
@@ -85,6 +87,11 @@ namespace MARTe {
  * </pre>
  *
  * Note that when Frequency1 = Frequency2 the resultant chirp is a sinusoidal waveform with a constant frequency.
+ *
+ * By default (Method = Exact) sin() is computed for every sample. With Method = Recurrence the phase increment between two consecutive samples
+ * (which grows linearly with the time) is kept as a rotation that is itself rotated by the constant second difference of the phase,
+ * 2 * w12 * timeIncrement^2 / cD2, so that each sample costs two complex multiplications instead of a sin(). Both rotations are re-seeded with the
+ * exact sin()/cos() every WAVEFORM_RECURRENCE_RESEED_PERIOD samples (and at the beginning of each cycle).
  */
 class WaveformChirp: public Waveform {
 public:
@@ -219,11 +226,22 @@ protected:
 
     /**
      * @brief check that increment between consecutive samples have enough resolution to not violate the sample frequency theorem.
+     * @details Also computes the second difference rotation of the recurrence.
      */
     virtual bool TimeIncrementValidation();
 
 private:
 
+    /**
+     * @brief Computes outputFloat64 calling sin() for each sample (Method = Exact).
+     */
+    void PrecomputeValuesExact();
+
+    /**
+     * @brief Computes outputFloat64 with the rotation recurrence (Method = Recurrence).
+     */
+    void PrecomputeValuesRecurrence();
+
     /**
      * @brief Cast the chirp signal to the specified type.
      * @details Template method which cast the chirp signal saved in #MARTe#Waveform::outputFloat64
@@ -281,6 +299,21 @@ private:
      * 2*chirpDuration
      */
     float64 cD2;
+
+    /**
+     * True if Method = Recurrence.
+     */
+    bool useRecurrence;
+
+    /**
+     * cos(2 * w12 * timeIncrement^2 / cD2)
+     */
+    float64 step2Cos;
+
+    /**
+     * sin(2 * w12 * timeIncrement^2 / cD2)
+     */
+    float64 step2Sin;
 };
 
 }
@@ -51,7 +51,9 @@ WaveformSin::WaveformSin() :
     w = 2.0 * FastMath::PI * frequency;
     phase = 0.0;
     offset = 0.0;
-
+    useRecurrence = false;
+    stepCos = 1.0;
+    stepSin = 0.0;
 }
 
 WaveformSin::~WaveformSin() {
@@ -101,10 +103,36 @@ bool WaveformSin::Initialise(StructuredDataI& data) {
             REPORT_ERROR(ErrorManagement::InitialisationError, "Error reading offset");
         }
     }
+    if (ok) {
+        StreamString method;
+        if (!data.Read("Method", method)) {
+            method = "Exact";
+        }
+        if (method == "Recurrence") {
+            useRecurrence = true;
+        }
+        else if (method == "Exact") {
+            useRecurrence = false;
+        }
+        else {
+            REPORT_ERROR(ErrorManagement::InitialisationError, "Unsupported Method %s. Valid methods: Exact, Recurrence", method.Buffer());
+            ok = false;
+        }
+    }
     return ok;
 }
 
 bool WaveformSin::PrecomputeValues() {
+    if (useRecurrence) {
+        PrecomputeValuesRecurrence();
+    }
+    else {
+        PrecomputeValuesExact();
+    }
+    return true;
+}
+
+void WaveformSin::PrecomputeValuesExact() {
     for (uint32 i = 0u; i < numberOfOutputElements; i++) {
         TriggerMechanism();
         if (signalOn && triggersOn) {
@@ -117,7 +145,30 @@ bool WaveformSin::PrecomputeValues() {
         }
         currentTime += timeIncrement;
     }
-    return true;
+}
+
+void WaveformSin::PrecomputeValuesRecurrence() {
+    float64 sinValue = 0.0;
+    float64 cosValue = 1.0;
+    for (uint32 i = 0u; i < numberOfOutputElements; i++) {
+        if ((i & (WAVEFORM_RECURRENCE_RESEED_PERIOD - 1u)) == 0u) {
+            float64 angle = (w * currentTime) + phase;
+            sinValue = sin(angle);
+            cosValue = cos(angle);
+        }
+        TriggerMechanism();
+        if (signalOn && triggersOn) {
+            outputFloat64[i] = ((amplitude * sinValue) + offset);
+        }
+        else {
+            outputFloat64[i] = 0.0;
+        }
+        //Rotate (cos, sin) by w * timeIncrement.
+        float64 nextSin = (sinValue * stepCos) + (cosValue * stepSin);
+        cosValue = (cosValue * stepCos) - (sinValue * stepSin);
+        sinValue = nextSin;
+        currentTime += timeIncrement;
+    }
 }
 
 bool WaveformSin::TimeIncrementValidation() {
@@ -125,6 +176,10 @@ bool WaveformSin::TimeIncrementValidation() {
     if (!ok) {
         REPORT_ERROR(ErrorManagement::FatalError, "sample frequency /2 < frequency");
     }
+    if (ok) {
+        stepCos = cos(w * timeIncrement);
+        stepSin = sin(w * timeIncrement);
+    }
     return ok;
 }
 
@@ -49,6 +49,11 @@ namespace MARTe {
  *
  * where the phase must be in \b radian and the frequency in \b Hz.
  *
+ * By default (Method = Exact) sin() is computed for every sample. With Method = Recurrence the samples are generated by rotating the
+ * vector (cos, sin) by the constant angle 2*PI*frequency*timeIncrement (two multiplications and two additions per sample). The vector is re-seeded with the
+ * exact sin()/cos() every WAVEFORM_RECURRENCE_RESEED_PERIOD samples (and at the beginning of each cycle), so that the amplitude and phase errors of the
+ * recurrence are bounded (well below 1e-9 of the amplitude in float64).
+ *
  * The input is a single value indicating the current time. The output can be a single array of N elements or multiple equal outputs of N
  * elements with different types (i.e example type output1 = uint8 and type output2 = float64.
  * Note that in the first iteration the output is always 0 due to the fact that a second time is needed to compute the time step (or time increment) for each output sample.
@@ -79,6 +84,7 @@ namespace MARTe {
  *     Frequency = 1.0
  *     Phase = 0.0
  *     Offset = 1.1
+ *     Method = Recurrence //Optional. Exact (default) or Recurrence.
  *     StartTriggerTime = {0.1 0.3 0.5 1.8}
  *     StopTriggerTime = {0.2 0.4 0.6} //the StopTriggerTime has one time value less. It means that after the sequence of output on and off, the GAM will remain on forever
  *     InputSignals = {
@@ -210,10 +216,23 @@ protected:
      */
     virtual bool PrecomputeValues();
 
+    /**
+     * @brief Validates the timeIncrement (Nyquist) and computes the rotation step of the recurrence.
+     */
     virtual bool TimeIncrementValidation();
 
 private:
 
+    /**
+     * @brief Computes outputFloat64 calling sin() for each sample (Method = Exact).
+     */
+    void PrecomputeValuesExact();
+
+    /**
+     * @brief Computes outputFloat64 with the rotation recurrence (Method = Recurrence).
+     */
+    void PrecomputeValuesRecurrence();
+
     /**
      * @brief Cast the sin in the specified type.
      * @details Template method which cast the sin wave computed with GetFloat64OutputValues()
@@ -247,6 +266,21 @@ private:
      */
     float64 offset;
 
+    /**
+     * True if Method = Recurrence.
+     */
+    bool useRecurrence;
+
+    /**
+     * cos(w * timeIncrement)
+     */
+    float64 stepCos;
+
+    /**
+     * sin(w * timeIncrement)
+     */
+    float64 stepSin;
+
 };
 
 }
@@ -24,119 +24,341 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <syslog.h>
+#include <time.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
 #include "ErrorInformation.h"
 #include "ErrorType.h"
+#include "GlobalObjectsDatabase.h"
+#include "MemoryOperationsHelper.h"
+#include "StringHelper.h"
 #include "SysLogger.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+namespace {
+/**
+ * Maps an error type to a syslog severity.
+ */
+struct SysLoggerSeverity {
+    MARTe::ErrorManagement::ErrorIntegerFormat errorType;
+    MARTe::int32 severity;
+};
+
+/**
+ * The syslog severity of each error type. Any other error type is logged with LOG_CRIT.
+ */
+/*lint -e{9130} -e{9117} the LOG_ constants are defined by <syslog.h>*/
+const SysLoggerSeverity SYSLOGGER_SEVERITIES[] = { { MARTe::ErrorManagement::Information, LOG_INFO }, { MARTe::ErrorManagement::Warning, LOG_WARNING }, {
+        MARTe::ErrorManagement::FatalError, LOG_CRIT }, { MARTe::ErrorManagement::RecoverableError, LOG_ERR }, { MARTe::ErrorManagement::Debug, LOG_DEBUG }, {
+        MARTe::ErrorManagement::Timeout, LOG_ERR }, { MARTe::ErrorManagement::ParametersError, LOG_CRIT }, { MARTe::ErrorManagement::CommunicationError, LOG_CRIT }, {
+        MARTe::ErrorManagement::NoError, LOG_INFO }, { MARTe::ErrorManagement::Completed, LOG_WARNING }, { MARTe::ErrorManagement::NotCompleted, LOG_WARNING }, {
+        MARTe::ErrorManagement::ErrorAccessDenied, LOG_ERR }, { MARTe::ErrorManagement::InitialisationError, LOG_CRIT }, {
+        MARTe::ErrorManagement::InternalSetupError, LOG_CRIT }, { MARTe::ErrorManagement::OSError, LOG_CRIT }, { MARTe::ErrorManagement::IllegalOperation, LOG_ERR }, {
+        MARTe::ErrorManagement::ErrorSharing, LOG_ERR }, { MARTe::ErrorManagement::Exception, LOG_CRIT }, { MARTe::ErrorManagement::UnsupportedFeature, LOG_CRIT }, {
+        MARTe::ErrorManagement::SyntaxError, LOG_CRIT } };
+
+/**
+ * Number of elements in SYSLOGGER_SEVERITIES.
+ */
+const MARTe::uint32 SYSLOGGER_NUMBER_OF_SEVERITIES = static_cast<MARTe::uint32>(sizeof(SYSLOGGER_SEVERITIES) / sizeof(SysLoggerSeverity));
+
+/**
+ * Time to wait for new messages before retrying to send the queued messages.
+ */
+const MARTe::uint32 SYSLOGGER_RETRY_PERIOD_MS = 100u;
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
 namespace MARTe {
-SysLogger::SysLogger() : Object(), LoggerConsumerI() {
+SysLogger::SysLogger() :
+        Object(),
+        LoggerConsumerI(),
+        EmbeddedServiceMethodBinderI(),
+        executor(*this) {
     ident = "";
+    socketPath = "/dev/log";
+    socketFd = -1;
+    messages = NULL_PTR(char8 *);
+    messageSizes = NULL_PTR(uint32 *);
+    queueSize = 1024u;
+    firstMessage = 0u;
+    numberOfQueuedMessages = 0u;
+    numberOfDroppedMessages = 0u;
+    numberOfSentMessages = 0u;
+    cpuMask = 0xffu;
+    stackSize = THREADS_DEFAULT_STACKSIZE;
+    queueMux.Create();
+    if (!queueSem.Create()) {
+        REPORT_ERROR(ErrorManagement::FatalError, "Could not create EventSem.");
+    }
 }
 
+/*lint -e{1551} the destructor must guarantee that the thread is stopped and that the socket and the memory are released.*/
 SysLogger::~SysLogger() {
+    if (!executor.Stop()) {
+        if (!executor.Stop()) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not stop SingleThreadService.");
+        }
+    }
+    if (socketFd >= 0) {
+        (void) close(socketFd);
+    }
+    if (messages != NULL_PTR(char8 *)) {
+        GlobalObjectsDatabase::Instance()->GetStandardHeap()->Free(reinterpret_cast<void *&>(messages));
+    }
+    if (messageSizes != NULL_PTR(uint32 *)) {
+        delete[] messageSizes;
+    }
+    (void) queueSem.Close();
 }
 
 void SysLogger::ConsumeLogMessage(LoggerPage * const logPage) {
-    if (logPage != NULL_PTR(LoggerPage *)) {
-        /*lint -e{9130} -e{9117} the LOG_NDELAY and LOG_USER constants are defined by <syslog.h>*/
-        openlog(ident.Buffer(), LOG_NDELAY, LOG_USER);
-
+    if ((logPage != NULL_PTR(LoggerPage *)) && (messages != NULL_PTR(char8 *))) {
         StreamString err;
         PrintToStream(logPage, err);
         ErrorManagement::ErrorType errorType = logPage->errorInfo.header.errorType;
 
-        int32 syslogErrorCode;
-        if (errorType == ErrorManagement::Information) {
-            syslogErrorCode = LOG_INFO;
+        int32 syslogErrorCode = LOG_CRIT;
+        uint32 s;
+        bool found = false;
+        for (s = 0u; (s < SYSLOGGER_NUMBER_OF_SEVERITIES) && (!found); s++) {
+            found = (errorType == SYSLOGGER_SEVERITIES[s].errorType);
+            if (found) {
+                syslogErrorCode = SYSLOGGER_SEVERITIES[s].severity;
+            }
         }
-        else if (errorType == ErrorManagement::Warning) {
-            syslogErrorCode = LOG_WARNING;
+        //RFC 3164 header, as written by syslog(3).
+        time_t now = time(NULL_PTR(time_t *));
+        struct tm nowTm;
+        char8 timestamp[32];
+        timestamp[0] = '\0';
+        if (localtime_r(&now, &nowTm) != NULL_PTR(struct tm *)) {
+            (void) strftime(&timestamp[0], sizeof(timestamp), "%b %e %H:%M:%S", &nowTm);
         }
-        else if (errorType == ErrorManagement::FatalError) {
-            syslogErrorCode = LOG_CRIT;
+        char8 message[SYSLOGGER_MAX_MESSAGE_SIZE];
+        /*lint -e{9130} -e{9117} the LOG_USER constant is defined by <syslog.h>*/
+        int32 messageSize = snprintf(&message[0], sizeof(message), "<%d>%s %s: %s", (syslogErrorCode | LOG_USER), &timestamp[0], ident.Buffer(), err.Buffer());
+        if (messageSize > 0) {
+            uint32 size = static_cast<uint32>(messageSize);
+            //Truncated
+            if (size >= SYSLOGGER_MAX_MESSAGE_SIZE) {
+                size = (SYSLOGGER_MAX_MESSAGE_SIZE - 1u);
+            }
+            bool queued = false;
+            if (queueMux.FastLock() == ErrorManagement::NoError) {
+                if (numberOfQueuedMessages < queueSize) {
+                    uint32 m = ((firstMessage + numberOfQueuedMessages) % queueSize);
+                    (void) MemoryOperationsHelper::Copy(&messages[m * SYSLOGGER_MAX_MESSAGE_SIZE], &message[0], size);
+                    messageSizes[m] = size;
+                    numberOfQueuedMessages++;
+                    queued = true;
+                }
+                else {
+                    numberOfDroppedMessages++;
+                }
+            }
+            queueMux.FastUnLock();
+            if (queued) {
+                (void) queueSem.Post();
+            }
         }
-        else if (errorType == ErrorManagement::RecoverableError) {
-            syslogErrorCode = LOG_ERR;
-        }
-        else if (errorType == ErrorManagement::Debug) {
-            syslogErrorCode = LOG_DEBUG;
+    }
+}
+
+bool SysLogger::Initialise(StructuredDataI &data) {
+    bool ok = Object::Initialise(data);
+    if (ok) {
+        ok = LoadPrintPreferences(data);
+    }
+    if (ok) {
+        ok = data.Read("Ident", ident);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::ParametersError, "The Ident shall be specified");
         }
-        else if (errorType == ErrorManagement::Timeout) {
-            syslogErrorCode = LOG_ERR;
+    }
+    if (ok) {
+        if (data.Read("QueueSize", queueSize)) {
+            ok = (queueSize > 0u);
+            if (!ok) {
+                REPORT_ERROR(ErrorManagement::ParametersError, "The QueueSize shall be > 0");
+            }
         }
-        else if (errorType == ErrorManagement::ParametersError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    if (ok) {
+        if (!data.Read("SocketPath", socketPath)) {
+            socketPath = "/dev/log";
         }
-        else if (errorType == ErrorManagement::CommunicationError) {
-            syslogErrorCode = LOG_CRIT;
+        if (!data.Read("CPUMask", cpuMask)) {
+            REPORT_ERROR(ErrorManagement::Information, "No CPUMask defined. Using default 0xff.");
         }
-        else if (errorType == ErrorManagement::NoError) {
-            syslogErrorCode = LOG_INFO;
+        if (!data.Read("StackSize", stackSize)) {
+            REPORT_ERROR(ErrorManagement::Information, "No StackSize defined. Using default thread stack size.");
         }
-        else if (errorType == ErrorManagement::Completed) {
-            syslogErrorCode = LOG_WARNING;
+    }
+    if (ok) {
+        ok = (messages == NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::IllegalOperation, "The SysLogger was already initialised");
         }
-        else if (errorType == ErrorManagement::NotCompleted) {
-            syslogErrorCode = LOG_WARNING;
+    }
+    if (ok) {
+        messages = reinterpret_cast<char8 *>(GlobalObjectsDatabase::Instance()->GetStandardHeap()->Malloc(queueSize * SYSLOGGER_MAX_MESSAGE_SIZE));
+        messageSizes = new uint32[queueSize];
+        ok = (messages != NULL_PTR(char8 *));
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not allocate the memory for %d messages", queueSize);
         }
-        else if (errorType == ErrorManagement::ErrorAccessDenied) {
-            syslogErrorCode = LOG_ERR;
+    }
+    if (ok) {
+        //The messages are queued until the syslog socket becomes available.
+        if (!Connect()) {
+            REPORT_ERROR(ErrorManagement::Warning, "Could not connect to %s. Will retry.", socketPath.Buffer());
         }
-        else if (errorType == ErrorManagement::InitialisationError) {
-            syslogErrorCode = LOG_CRIT;
+        executor.SetCPUMask(cpuMask);
+        executor.SetStackSize(stackSize);
+        executor.SetName(GetName());
+        ok = (executor.Start() == ErrorManagement::NoError);
+        if (!ok) {
+            REPORT_ERROR(ErrorManagement::FatalError, "Could not start the SingleThreadService");
         }
-        else if (errorType == ErrorManagement::InternalSetupError) {
-            syslogErrorCode = LOG_CRIT;
+    }
+    return ok;
+}
+
+ErrorManagement::ErrorType SysLogger::Execute(ExecutionInfo &info) {
+    if (info.GetStage() == ExecutionInfo::MainStage) {
+        //Reset before sending so that a message queued while sending is not missed.
+        (void) queueSem.ResetWait(static_cast<TimeoutType>(SYSLOGGER_RETRY_PERIOD_MS));
+    }
+    if (info.GetStage() != ExecutionInfo::BadTerminationStage) {
+        SendQueuedMessages();
+    }
+    return ErrorManagement::NoError;
+}
+
+uint32 SysLogger::GetQueueDepth() {
+    uint32 depth = 0u;
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        depth = numberOfQueuedMessages;
+    }
+    queueMux.FastUnLock();
+    return depth;
+}
+
+uint32 SysLogger::GetNumberOfDroppedMessages() {
+    uint32 dropped = 0u;
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        dropped = numberOfDroppedMessages;
+    }
+    queueMux.FastUnLock();
+    return dropped;
+}
+
+uint32 SysLogger::GetNumberOfSentMessages() {
+    uint32 sent = 0u;
+    if (queueMux.FastLock() == ErrorManagement::NoError) {
+        sent = numberOfSentMessages;
+    }
+    queueMux.FastUnLock();
+    return sent;
+}
+
+bool SysLogger::Connect() {
+    if (socketFd >= 0) {
+        (void) close(socketFd);
+    }
+    socketFd = socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    bool ok = (socketFd >= 0);
+    if (ok) {
+        struct sockaddr_un address;
+        (void) MemoryOperationsHelper::Set(&address, '\0', static_cast<uint32>(sizeof(address)));
+        address.sun_family = AF_UNIX;
+        ok = (socketPath.Size() < sizeof(address.sun_path));
+        if (ok) {
+            ok = StringHelper::Copy(&address.sun_path[0], socketPath.Buffer());
         }
-        else if (errorType == ErrorManagement::OSError) {
-            syslogErrorCode = LOG_CRIT;
+        if (ok) {
+            /*lint -e{740} -e{929} standard BSD socket cast*/
+            ok = (connect(socketFd, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) == 0);
         }
-        else if (errorType == ErrorManagement::IllegalOperation) {
-            syslogErrorCode = LOG_ERR;
+        if (!ok) {
+            (void) close(socketFd);
+            socketFd = -1;
         }
-        else if (errorType == ErrorManagement::ErrorSharing) {
-            syslogErrorCode = LOG_ERR;
+    }
+    return ok;
+}
+
+void SysLogger::SendQueuedMessages() {
+    //Only this thread removes messages from the queue, so that the messages being sent cannot be overwritten.
+    bool sendMore = true;
+    while (sendMore) {
+        uint32 first = 0u;
+        uint32 batchSize = 0u;
+        if (queueMux.FastLock() == ErrorManagement::NoError) {
+            first = firstMessage;
+            batchSize = numberOfQueuedMessages;
         }
-        else if (errorType == ErrorManagement::Exception) {
-            syslogErrorCode = LOG_CRIT;
+        queueMux.FastUnLock();
+        //Only contiguous messages in a batch
+        if (batchSize > (queueSize - first)) {
+            batchSize = (queueSize - first);
         }
-        else if (errorType == ErrorManagement::UnsupportedFeature) {
-            syslogErrorCode = LOG_CRIT;
+        if (batchSize > SYSLOGGER_MAX_BATCH_SIZE) {
+            batchSize = SYSLOGGER_MAX_BATCH_SIZE;
         }
-        else if (errorType == ErrorManagement::SyntaxError) {
-            syslogErrorCode = LOG_CRIT;
+        sendMore = (batchSize > 0u);
+        if (sendMore) {
+            if (socketFd < 0) {
+                sendMore = Connect();
+            }
         }
-        else {
-            syslogErrorCode = LOG_CRIT;
+        int32 sent = 0;
+        if (sendMore) {
+            struct mmsghdr headers[SYSLOGGER_MAX_BATCH_SIZE];
+            struct iovec buffers[SYSLOGGER_MAX_BATCH_SIZE];
+            (void) MemoryOperationsHelper::Set(&headers[0], '\0', static_cast<uint32>(sizeof(headers)));
+            uint32 m;
+            for (m = 0u; m < batchSize; m++) {
+                buffers[m].iov_base = &messages[(first + m) * SYSLOGGER_MAX_MESSAGE_SIZE];
+                buffers[m].iov_len = messageSizes[first + m];
+                headers[m].msg_hdr.msg_iov = &buffers[m];
+                headers[m].msg_hdr.msg_iovlen = 1u;
+            }
+            sent = sendmmsg(socketFd, &headers[0], batchSize, MSG_DONTWAIT);
+            if (sent < 0) {
+                //EAGAIN: the syslog daemon is not keeping up. Otherwise the daemon was probably restarted.
+                if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                    (void) close(socketFd);
+                    socketFd = -1;
+                }
+                sendMore = false;
+            }
         }
-        syslog(syslogErrorCode, "%s", err.Buffer());
-    }
-}
-
-bool SysLogger::Initialise(StructuredDataI &data) {
-    bool ok = Object::Initialise(data);
-    if (ok) {
-        ok = LoadPrintPreferences(data);
-    }
-    if (ok) {
-        ok = data.Read("Ident", ident);
-        if (!ok) {
-            REPORT_ERROR(ErrorManagement::ParametersError, "The Ident shall be specified");
+        if (sent > 0) {
+            if (queueMux.FastLock() == ErrorManagement::NoError) {
+                firstMessage = ((firstMessage + static_cast<uint32>(sent)) % queueSize);
+                numberOfQueuedMessages -= static_cast<uint32>(sent);
+                numberOfSentMessages += static_cast<uint32>(sent);
+            }
+            queueMux.FastUnLock();
+            sendMore = (static_cast<uint32>(sent) == batchSize);
         }
     }
-    return ok;
 }
 
 CLASS_REGISTER(SysLogger, "1.0")
@@ -31,8 +31,12 @@
 /*---------------------------------------------------------------------------*/
 /*                        Project header includes                            */
 /*---------------------------------------------------------------------------*/
+#include "EmbeddedServiceMethodBinderI.h"
+#include "EventSem.h"
+#include "FastPollingMutexSem.h"
 #include "LoggerConsumerI.h"
 #include "Object.h"
+#include "SingleThreadService.h"
 #include "StreamString.h"
 
 /*---------------------------------------------------------------------------*/
@@ -40,9 +44,25 @@
 /*---------------------------------------------------------------------------*/
 
 namespace MARTe {
+/**
+ * Maximum size of a syslog message (including the header). Longer messages are truncated.
+ */
+static const uint32 SYSLOGGER_MAX_MESSAGE_SIZE = 1024u;
+
+/**
+ * Maximum number of messages sent with a single system call.
+ */
+static const uint32 SYSLOGGER_MAX_BATCH_SIZE = 64u;
+
 /**
  * @brief A LoggerConsumerI which outputs the log messages to a syslog.
- * @details The configuration syntax is (names are only given as an example):
+ * @details The ConsumeLogMessage only formats the message (with the syslog header) and copies it into a queue,
+ *  so that the LoggerService pages are immediately released. A background thread sends the queued messages in batches
+ *  (one sendmmsg per batch) to the syslog socket, which is kept open (and reopened if the syslog daemon is restarted).
+ *  The socket is non-blocking: while the syslog daemon does not accept more messages they stay in the queue and
+ *  the messages that do not fit in the queue are dropped (see GetNumberOfDroppedMessages).
+ *
+ * The configuration syntax is (names are only given as an example):
  *
  * <pre>
  * +SysLogger = {
@@ -50,10 +70,14 @@ namespace MARTe {
  *     Format = ItOoFm //Compulsory. As described in LoggerConsumerI::LoadPrintPreferences
  *     PrintKeys = 1 //Optional. As described in LoggerConsumerI::LoadPrintPreferences
  *     Ident = myapp //Compulsory. Name of the syslog ident.
+ *     QueueSize = 1024 //Optional. Maximum number of messages waiting to be sent. Default = 1024.
+ *     SocketPath = /dev/log //Optional. The syslog socket. Default = /dev/log.
+ *     CPUMask = 0x1 //Optional. The affinity of the thread that sends the messages.
+ *     StackSize = 1000000 //Optional. The stack size of the thread that sends the messages.
  * }
  * </pre>
  */
-class SysLogger: public Object, public LoggerConsumerI {
+class SysLogger: public Object, public LoggerConsumerI, public EmbeddedServiceMethodBinderI {
 public:
     CLASS_REGISTER_DECLARATION()
 
@@ -63,27 +87,135 @@ public:
     SysLogger();
 
     /**
-     * @brief Destructor. Closes the console.NOOP.
+     * @brief Destructor. Stops the sending thread and closes the syslog socket.
      */
     virtual ~SysLogger();
 
     /**
-     * @brief Prints the logPage in the console output.
+     * @brief Formats the logPage as a syslog message and adds it to the queue of messages to be sent.
+     * @details If the queue is full the message is dropped.
      * @param logPage the log message to be printed.
      */
     virtual void ConsumeLogMessage(LoggerPage *logPage);
 
     /**
-     * @brief Calls Object::Initialise and reads the Format, Ident and PrintKeys parameters (see class description) .
+     * @brief Calls Object::Initialise and reads the parameters (see class description), opens the syslog socket
+     *  and starts the thread that sends the messages.
      * @param[in] data see Object::Initialise.
      * @return true if Object::Initialise returns true and if the compulsory are correctly set..
      */
     virtual bool Initialise(StructuredDataI &data);
+
+    /**
+     * @brief Sends the queued messages (callback of the SingleThreadService).
+     * @return ErrorManagement::NoError.
+     */
+    virtual ErrorManagement::ErrorType Execute(ExecutionInfo &info);
+
+    /**
+     * @brief Gets the number of messages waiting to be sent.
+     * @return the number of queued messages.
+     */
+    uint32 GetQueueDepth();
+
+    /**
+     * @brief Gets the number of messages that were dropped because the queue was full.
+     * @return the number of dropped messages.
+     */
+    uint32 GetNumberOfDroppedMessages();
+
+    /**
+     * @brief Gets the number of messages sent to the syslog socket.
+     * @return the number of sent messages.
+     */
+    uint32 GetNumberOfSentMessages();
+
 private:
+    /**
+     * @brief (Re)opens the syslog socket.
+     * @return true if the socket is connected.
+     */
+    bool Connect();
+
+    /**
+     * @brief Sends the queued messages until the queue is empty or until the socket does not accept more messages.
+     */
+    void SendQueuedMessages();
+
     /**
      * The syslog ident
      */
     StreamString ident;
+
+    /**
+     * The path of the syslog socket.
+     */
+    StreamString socketPath;
+
+    /**
+     * The syslog socket (-1 if not connected).
+     */
+    int32 socketFd;
+
+    /**
+     * The queue memory (queueSize messages of SYSLOGGER_MAX_MESSAGE_SIZE bytes).
+     */
+    char8 *messages;
+
+    /**
+     * The size of each queued message.
+     */
+    uint32 *messageSizes;
+
+    /**
+     * The maximum number of queued messages.
+     */
+    uint32 queueSize;
+
+    /**
+     * The index of the oldest queued message.
+     */
+    uint32 firstMessage;
+
+    /**
+     * The number of queued messages.
+     */
+    uint32 numberOfQueuedMessages;
+
+    /**
+     * The number of dropped messages.
+     */
+    uint32 numberOfDroppedMessages;
+
+    /**
+     * The number of sent messages.
+     */
+    uint32 numberOfSentMessages;
+
+    /**
+     * Protects the queue indices and the counters.
+     */
+    FastPollingMutexSem queueMux;
+
+    /**
+     * Wakes the sending thread when a message is queued.
+     */
+    EventSem queueSem;
+
+    /**
+     * The thread that sends the messages.
+     */
+    SingleThreadService executor;
+
+    /**
+     * The affinity of the sending thread.
+     */
+    uint32 cpuMask;
+
+    /**
+     * The stack size of the sending thread.
+     */
+    uint32 stackSize;
 };
 }
 
@@ -109,6 +109,16 @@ TEST(DANSourceGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(DANSourceGTest,TestInitialise_NumberOfCyclesPerBlock) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_NumberOfCyclesPerBlock());
+}
+
+TEST(DANSourceGTest,TestInitialise_False_NumberOfCyclesPerBlock_0) {
+    DANSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfCyclesPerBlock_0());
+}
+
 TEST(DANSourceGTest,TestInitialise_False_NumberOfBuffers) {
     DANSourceTest test;
     ASSERT_TRUE(test.TestInitialise_False_NumberOfBuffers());
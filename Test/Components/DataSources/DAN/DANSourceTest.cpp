@@ -2349,9 +2349,42 @@ bool DANSourceTest::TestInitialise() {
     ok &= (test.IsStoreOnTrigger());
     ok &= (test.GetNumberOfPreTriggers() == 2);
     ok &= (test.GetNumberOfPostTriggers() == 3);
+    ok &= (test.GetNumberOfCyclesPerBlock() == 1);
     return ok;
 }
 
+bool DANSourceTest::TestInitialise_NumberOfCyclesPerBlock() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfCyclesPerBlock", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetNumberOfCyclesPerBlock() == 8);
+    return ok;
+}
+
+bool DANSourceTest::TestInitialise_False_NumberOfCyclesPerBlock_0() {
+    using namespace MARTe;
+    DANSource test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("NumberOfCyclesPerBlock", 0);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool DANSourceTest::TestInitialise_False_NumberOfBuffers() {
     using namespace MARTe;
     DANSource test;
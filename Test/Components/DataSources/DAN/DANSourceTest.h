@@ -120,6 +120,16 @@ public:
      */
     bool TestInitialise();
 
+    /**
+     * @brief Tests the Initialise method with NumberOfCyclesPerBlock.
+     */
+    bool TestInitialise_NumberOfCyclesPerBlock();
+
+    /**
+     * @brief Tests the Initialise method with NumberOfCyclesPerBlock = 0.
+     */
+    bool TestInitialise_False_NumberOfCyclesPerBlock_0();
+
     /**
      * @brief Tests the Initialise method without specifying the number of buffers.
      */
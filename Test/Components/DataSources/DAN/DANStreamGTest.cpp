@@ -119,6 +119,21 @@ TEST(DANStreamGTest,TestPutData_Float64) {
     ASSERT_TRUE(test.TestPutData_Float64());
 }
 
+TEST(DANStreamGTest,TestPutData_NumberOfCyclesPerBlock) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestPutData_NumberOfCyclesPerBlock());
+}
+
+TEST(DANStreamGTest,TestPutData_NumberOfCyclesPerBlock_TimeJump) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestPutData_NumberOfCyclesPerBlock_TimeJump());
+}
+
+TEST(DANStreamGTest,TestSetNumberOfCyclesPerBlock) {
+    DANStreamTest test;
+    ASSERT_TRUE(test.TestSetNumberOfCyclesPerBlock());
+}
+
 TEST(DANStreamGTest,TestOpenStream) {
     DANStreamTest test;
     ASSERT_TRUE(test.TestOpenStream());
@@ -46,7 +46,7 @@
 /**
  * Checks the PutData function against a list of know types.
  */
-template<typename typeToCheck> static bool TestPutDataT(bool useAbsoluteTime = false, bool useRelativeTime = false, MARTe::uint32 numberOfRuns = 1u) {
+template<typename typeToCheck> static bool TestPutDataT(bool useAbsoluteTime = false, bool useRelativeTime = false, MARTe::uint32 numberOfRuns = 1u, MARTe::uint32 numberOfCyclesPerBlock = 1u) {
     using namespace MARTe;
 
     //To discover the type
@@ -78,6 +78,7 @@ template<typename typeToCheck> static bool TestPutDataT(bool useAbsoluteTime = f
     ds.AddSignal(0u);
     ds.AddSignal(2u);
     ds.AddSignal(5u);
+    ds.SetNumberOfCyclesPerBlock(numberOfCyclesPerBlock);
     ds.Finalise();
     typeToCheck *signal0Ptr = NULL;
     ok &= ds.GetSignalMemoryBuffer(0u, reinterpret_cast<void *&>(signal0Ptr));
@@ -391,6 +392,96 @@ bool DANStreamTest::TestPutData_Float64() {
     return TestPutDataT<MARTe::float64>();
 }
 
+bool DANStreamTest::TestPutData_NumberOfCyclesPerBlock() {
+    bool ok = TestPutDataT<MARTe::float32>(false, false, 1u, 2u);
+    if (ok) {
+        ok = TestPutDataT<MARTe::uint64>(false, false, 1u, 4u);
+    }
+    return ok;
+}
+
+bool DANStreamTest::TestPutData_NumberOfCyclesPerBlock_TimeJump() {
+    using namespace MARTe;
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    bool ok = danSource.Initialise(cdb);
+
+    const uint32 numberOfSamples = 5u;
+    const float64 samplingFrequency = 1e3;
+    //Relative time (in us) of each cycle. The third cycle jumps 1 s ahead (e.g. a new trigger window).
+    const uint32 numberOfWrites = 5u;
+    uint32 externalTimeRelativeArr[numberOfWrites] = { 0u, 5000u, 1000000u, 1005000u, 1010000u };
+    //Cycles in the batch after each PutData: the jump submits the first two cycles and starts a new batch
+    const uint32 expectedBatchedCycles[numberOfWrites] = { 1u, 2u, 1u, 2u, 3u };
+
+    DANStream ds(Float32Bit, "DANStreamTest", 4, samplingFrequency, numberOfSamples, true);
+    ds.AddSignal(0u);
+    ds.AddSignal(1u);
+    ds.SetNumberOfCyclesPerBlock(4u);
+    ds.Finalise();
+    if (ok) {
+        ds.Reset();
+        ok = ds.OpenStream();
+    }
+    hpn_timestamp_t hpnTimeStamp;
+    if (ok) {
+        ok = (tcn_get_time(&hpnTimeStamp) == TCN_SUCCESS);
+    }
+    if (ok) {
+        ds.SetAbsoluteStartTime(hpnTimeStamp);
+    }
+    uint32 k;
+    for (k = 0u; (k < numberOfWrites) && (ok); k++) {
+        ds.SetRelativeTimeSignal(&externalTimeRelativeArr[k]);
+        ok = ds.PutData();
+        if (ok) {
+            ok = (ds.GetNumberOfBatchedCycles() == expectedBatchedCycles[k]);
+        }
+    }
+    if (ok) {
+        ok = ds.CloseStream();
+    }
+    if (ok) {
+        ok = (ds.GetNumberOfBatchedCycles() == 0u);
+    }
+    return ok;
+}
+
+bool DANStreamTest::TestSetNumberOfCyclesPerBlock() {
+    using namespace MARTe;
+    //This is required in order to create the dan_initLibrary
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 1);
+    cdb.Write("StackSize", 1048576);
+    cdb.Write("DanBufferMultiplier", 4);
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    DANSource danSource;
+    bool ok = danSource.Initialise(cdb);
+
+    DANStream ds(Float32Bit, "DANStreamTest", 4, 2e6, 8, true);
+    ok &= (ds.GetNumberOfCyclesPerBlock() == 1u);
+    ds.SetNumberOfCyclesPerBlock(4u);
+    ok &= (ds.GetNumberOfCyclesPerBlock() == 4u);
+    ds.SetNumberOfCyclesPerBlock(0u);
+    ok &= (ds.GetNumberOfCyclesPerBlock() == 4u);
+    ds.AddSignal(0u);
+    ds.Finalise();
+    ds.SetNumberOfCyclesPerBlock(2u);
+    ok &= (ds.GetNumberOfCyclesPerBlock() == 4u);
+    return ok;
+}
+
 bool DANStreamTest::TestOpenStream() {
     using namespace MARTe;
     //This is required in order to create the dan_initLibrary
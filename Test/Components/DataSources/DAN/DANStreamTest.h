@@ -124,6 +124,21 @@ public:
      */
     bool TestPutData_Float64();
 
+    /**
+     * @brief Tests the PutData method batching several cycles in a single block.
+     */
+    bool TestPutData_NumberOfCyclesPerBlock();
+
+    /**
+     * @brief Tests that the PutData method submits an incomplete batch when the relative time signal jumps.
+     */
+    bool TestPutData_NumberOfCyclesPerBlock_TimeJump();
+
+    /**
+     * @brief Tests the SetNumberOfCyclesPerBlock and GetNumberOfCyclesPerBlock methods.
+     */
+    bool TestSetNumberOfCyclesPerBlock();
+
     /**
      * @brief Tests the OpenStream method.
      */
@@ -139,4 +139,23 @@ TEST(EPICSCAInputGTest,TestExecute_Arrays) {
     EPICSCAInputTest test;
     ASSERT_TRUE(test.TestExecute_Arrays());
 }
-	
+
+TEST(EPICSCAInputGTest,TestSetConfiguredDatabase_False_UpdateCounterType) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_UpdateCounterType());
+}
+
+TEST(EPICSCAInputGTest,TestSetConfiguredDatabase_False_UpdateCounterNotPV) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_UpdateCounterNotPV());
+}
+
+TEST(EPICSCAInputGTest,TestSynchronise) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
+
+TEST(EPICSCAInputGTest,TestExecute_UpdateCounter) {
+    EPICSCAInputTest test;
+    ASSERT_TRUE(test.TestExecute_UpdateCounter());
+}
@@ -131,6 +131,37 @@ public:
 };
 CLASS_REGISTER(EPICSCAInputGAMTestHelper, "1.0")
 
+/**
+ * @brief GAM which reads a PV together with its UpdateCounterOf and TimestampOf signals
+ */
+class EPICSCAInputUpdatesGAMTestHelper: public MARTe::GAM {
+public:
+    CLASS_REGISTER_DECLARATION()EPICSCAInputUpdatesGAMTestHelper() {
+        valueSignal = NULL;
+        updatesSignal = NULL;
+        timestampSignal = NULL;
+    }
+
+    virtual ~EPICSCAInputUpdatesGAMTestHelper() {
+    }
+
+    virtual bool Setup() {
+        using namespace MARTe;
+        valueSignal = reinterpret_cast<uint32 *>(GetInputSignalMemory(0u));
+        updatesSignal = reinterpret_cast<uint32 *>(GetInputSignalMemory(1u));
+        timestampSignal = reinterpret_cast<uint64 *>(GetInputSignalMemory(2u));
+        return true;
+    }
+
+    virtual bool Execute() {
+        return true;
+    }
+    MARTe::uint32 *valueSignal;
+    MARTe::uint32 *updatesSignal;
+    MARTe::uint64 *timestampSignal;
+};
+CLASS_REGISTER(EPICSCAInputUpdatesGAMTestHelper, "1.0")
+
 /**
  * @brief Manual scheduler to test the correct interface between the EPICSCAInput and the GAMs
  */
@@ -909,6 +940,204 @@ static const MARTe::char8 * const config7 = ""
         "    }"
         "}";
 
+//Configuration with the UpdateCounterOf and TimestampOf signals
+static const MARTe::char8 * const config8 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputUpdatesGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    UpdateCounterOf = SignalUInt32"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    TimestampOf = SignalUInt32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an UpdateCounterOf signal with the wrong type
+static const MARTe::char8 * const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputUpdatesGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    Type = uint16"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    UpdateCounterOf = SignalUInt32"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    TimestampOf = SignalUInt32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//Configuration with an UpdateCounterOf signal which does not refer to a PV signal
+static const MARTe::char8 * const config10 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAInputUpdatesGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    Type = uint64"
+        "                    DataSource = EPICSCAInputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAInputTest = {"
+        "            Class = EPICSCAInput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAInput::Test::UInt32\""
+        "                }"
+        "                SignalUInt32Updates = {"
+        "                    UpdateCounterOf = SignalUInt32Time"
+        "                }"
+        "                SignalUInt32Time = {"
+        "                    TimestampOf = SignalUInt32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAInputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -963,7 +1192,7 @@ bool EPICSCAInputTest::TestGetBrokerName() {
     using namespace MARTe;
     EPICSCAInput test;
     ConfigurationDatabase cdb;
-    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapInputBroker") == 0);
+    bool ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "MemoryMapSynchronisedInputBroker") == 0);
 
     return ok;
 }
@@ -1050,6 +1279,20 @@ bool EPICSCAInputTest::TestSetConfiguredDatabase_False_WrongStringSize() {
     return !TestIntegratedInApplication(config7, true);
 }
 
+bool EPICSCAInputTest::TestSetConfiguredDatabase_False_UpdateCounterType() {
+    return !TestIntegratedInApplication(config9, true);
+}
+
+bool EPICSCAInputTest::TestSetConfiguredDatabase_False_UpdateCounterNotPV() {
+    return !TestIntegratedInApplication(config10, true);
+}
+
+bool EPICSCAInputTest::TestSynchronise() {
+    using namespace MARTe;
+    EPICSCAInput test;
+    return test.Synchronise();
+}
+
 bool EPICSCAInputTest::TestExecute() {
     using namespace MARTe;
     bool ok = TestIntegratedInApplication(config1, false);
@@ -1337,3 +1580,83 @@ bool EPICSCAInputTest::TestExecute_Arrays() {
     return ok;
 }
 
+bool EPICSCAInputTest::TestExecute_UpdateCounter() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config8, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAInputUpdatesGAMTestHelper> gam1;
+    ReferenceT<EPICSCAInputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback) == ECA_NORMAL);
+    }
+    chid pvChid;
+    if (ok) {
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::UInt32", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChid) == ECA_NORMAL);
+    }
+    //Wait for a first value and then check that a new value increments the counter and the timestamp
+    uint32 lastUpdates = 0u;
+    uint64 lastTimestamp = 0u;
+    uint32 uint32Value = 1000u;
+    uint32 step;
+    for (step = 0u; (step < 2u) && (ok); step++) {
+        uint32Value++;
+        bool done = false;
+        uint32 timeOutCounts = 50u;
+        while ((!done) && (timeOutCounts > 0u)) {
+            ca_put(DBR_LONG, pvChid, &uint32Value);
+            ca_pend_io(1.0);
+            scheduler->ExecuteThreadCycle(0u);
+            done = (*gam1->valueSignal == uint32Value);
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+        }
+        ok = done;
+        if (ok) {
+            ok = (*gam1->updatesSignal > lastUpdates);
+        }
+        if (ok) {
+            ok = (*gam1->timestampSignal > lastTimestamp);
+        }
+        lastUpdates = *gam1->updatesSignal;
+        lastTimestamp = *gam1->timestampSignal;
+    }
+    if (ok) {
+        //No new values => the counter shall not change
+        scheduler->ExecuteThreadCycle(0u);
+        ok = (*gam1->updatesSignal == lastUpdates);
+    }
+
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    ca_clear_channel(pvChid);
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
@@ -135,6 +135,21 @@ public:
      */
     bool TestSetConfiguredDatabase_False_WrongStringSize();
 
+    /**
+     * @brief Tests the SetConfiguredDatabase method with an UpdateCounterOf signal which is not uint32.
+     */
+    bool TestSetConfiguredDatabase_False_UpdateCounterType();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with an UpdateCounterOf signal which does not refer to a PV signal.
+     */
+    bool TestSetConfiguredDatabase_False_UpdateCounterNotPV();
+
+    /**
+     * @brief Tests the Synchronise method.
+     */
+    bool TestSynchronise();
+
     /**
      * @brief Tests that the PV values are correctly captured by the DataSourceI
      */
@@ -145,6 +160,11 @@ public:
      */
     bool TestExecute_Arrays();
 
+    /**
+     * @brief Tests that the UpdateCounterOf and TimestampOf signals are updated with the PV values.
+     */
+    bool TestExecute_UpdateCounter();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -173,4 +173,39 @@ TEST(EPICSCAOutputGTest,TestIsIgnoringBufferOverrun) {
 TEST(EPICSCAOutputGTest,TestAsyncCaPut) {
     EPICSCAOutputTest test;
     ASSERT_TRUE(test.TestAsyncCaPut());
-}
\ No newline at end of file
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_False_PutMode) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_PutMode());
+}
+
+TEST(EPICSCAOutputGTest,TestInitialise_False_OnlyOnChangeBlocking) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_OnlyOnChangeBlocking());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_Batched) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_Batched());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_Callback) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_Callback());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_OnlyOnChange) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_OnlyOnChange());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_OnlyOnChange_Deadband) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_OnlyOnChange_Deadband());
+}
+
+TEST(EPICSCAOutputGTest,TestExecute_PutCounters) {
+    EPICSCAOutputTest test;
+    ASSERT_TRUE(test.TestExecute_PutCounters());
+}
@@ -40,6 +40,7 @@
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
+#include "StringHelper.h"
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -60,6 +61,8 @@ public:
         int32Signal = NULL;
         float32Signal = NULL;
         float64Signal = NULL;
+        failedPutsSignal = NULL;
+        sentPutsSignal = NULL;
         numberOfElements = 1u;
     }
 
@@ -108,6 +111,16 @@ public:
                 float64Signal = reinterpret_cast<float64 *>(GetOutputSignalMemory(n));
             }
         }
+        for(n=0; n<GetNumberOfInputSignals(); n++) {
+            StreamString signalName;
+            GetSignalName(InputSignals, n, signalName);
+            if (signalName == "SentPuts") {
+                sentPutsSignal = reinterpret_cast<uint32 *>(GetInputSignalMemory(n));
+            }
+            else {
+                failedPutsSignal = reinterpret_cast<uint32 *>(GetInputSignalMemory(n));
+            }
+        }
 
         return true;
     }
@@ -127,6 +140,8 @@ public:
     MARTe::int32 *int32Signal;
     MARTe::float32 *float32Signal;
     MARTe::float64 *float64Signal;
+    MARTe::uint32 *failedPutsSignal;
+    MARTe::uint32 *sentPutsSignal;
     MARTe::uint32 numberOfElements;
 };
 CLASS_REGISTER(EPICSCAOutputGAMTestHelper, "1.0")
@@ -993,6 +1008,419 @@ static const MARTe::char8 * const config8 = ""
         "    }"
         "}";
 
+//Put counters configuration. The PV does not exist so all the puts fail.
+static const MARTe::char8 * const config9 = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1 = {"
+        "            Class = EPICSCAOutputGAMTestHelper"
+        "            InputSignals = {"
+        "                FailedPuts = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "            }"
+        "            OutputSignals = {"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = EPICSCAOutputTest"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +EPICSCAOutputTest = {"
+        "            Class = EPICSCAOutput"
+        "            CPUMask = 15"
+        "            StackSize = 10000000"
+        "            NumberOfBuffers = 8"
+        "            PutMode = Batched"
+        "            Signals = {"
+        "                SignalUInt32 = {"
+        "                    PVName = \"MARTe2::EPICSCAOutput::Test::DoesNotExist\""
+        "                }"
+        "                FailedPuts = {"
+        "                    Type = uint32"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = EPICSCAOutputSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * @brief Adds parameters to the EPICSCAOutput of a configuration (after its NumberOfBuffers).
+ */
+static MARTe::StreamString AddDataSourceParameters(const MARTe::char8 * const config,
+                                                   const MARTe::char8 * const parameters) {
+    using namespace MARTe;
+    const char8 * const token = "NumberOfBuffers = 8";
+    const char8 *position = StringHelper::SearchString(config, token);
+    StreamString newConfig;
+    if (position != NULL) {
+        uint32 size = static_cast<uint32>(position - config) + StringHelper::Length(token);
+        (void) newConfig.Write(config, size);
+        newConfig += " ";
+        newConfig += parameters;
+        newConfig += " ";
+        newConfig += &position[StringHelper::Length(token)];
+    }
+    return newConfig;
+}
+
+/**
+ * @brief Executes cycles (sleeping in between) until the SentPuts signal read by the GAM is equal to \a expectedSentPuts.
+ * @details If \a untilEqual is false all the \a maxCycles are executed and the SentPuts signal shall be equal to \a expectedSentPuts in every cycle.
+ */
+static bool TestExecuteOnlyOnChangeCycles(MARTe::ReferenceT<EPICSCAOutputGAMTestHelper> &gam1,
+                                          MARTe::ReferenceT<EPICSCAOutputSchedulerTestHelper> &scheduler,
+                                          const MARTe::uint32 expectedSentPuts,
+                                          const bool untilEqual,
+                                          const MARTe::uint32 maxCycles) {
+    using namespace MARTe;
+    bool done = false;
+    bool ok = true;
+    uint32 c;
+    for (c = 0u; (c < maxCycles) && (!done) && (ok); c++) {
+        scheduler->ExecuteThreadCycle(0u);
+        if (untilEqual) {
+            done = (*gam1->sentPutsSignal == expectedSentPuts);
+        }
+        else {
+            ok = (*gam1->sentPutsSignal == expectedSentPuts);
+        }
+        Sleep::Sec(0.1);
+    }
+    if (untilEqual) {
+        ok = done;
+    }
+    return ok;
+}
+
+/**
+ * @brief Tests that OnlyOnChange = 1 only puts a PV when its value changes (more than the \a deadband, if set).
+ */
+static bool TestExecuteOnlyOnChange(const MARTe::float64 deadband) {
+    using namespace MARTe;
+    StreamString config = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAM1 = {"
+            "            Class = EPICSCAOutputGAMTestHelper"
+            "            InputSignals = {"
+            "                SentPuts = {"
+            "                    Type = uint32"
+            "                    DataSource = EPICSCAOutputTest"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "                SignalFloat64 = {"
+            "                    Type = float64"
+            "                    DataSource = EPICSCAOutputTest"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "        +EPICSCAOutputTest = {"
+            "            Class = EPICSCAOutput"
+            "            CPUMask = 15"
+            "            StackSize = 10000000"
+            "            NumberOfBuffers = 8"
+            "            PutMode = Callback"
+            "            OnlyOnChange = 1"
+            "            Signals = {"
+            "                SignalFloat64 = {"
+            "                    PVName = \"MARTe2::EPICSCAInput::Test::Float64\"";
+    if (deadband > 0.0) {
+        StreamString deadbandParameter;
+        (void) deadbandParameter.Printf(" Deadband = %f", deadband);
+        config += deadbandParameter;
+    }
+    config += ""
+            "                }"
+            "                SentPuts = {"
+            "                    Type = uint32"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAM1}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = EPICSCAOutputSchedulerTestHelper"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
+    ReferenceT<EPICSCAOutputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        ok = ((gam1->sentPutsSignal != NULL) && (gam1->float64Signal != NULL));
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    //The first value is always put.
+    float64 value = 1.0;
+    if (ok) {
+        *gam1->float64Signal = value;
+        ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 1u, true, 50u);
+    }
+    //The same value is not put again, no matter how many cycles are executed.
+    if (ok) {
+        ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 1u, false, 10u);
+    }
+    if ((ok) && (deadband > 0.0)) {
+        //A change smaller than the deadband is not put...
+        *gam1->float64Signal = value + (deadband / 2.0);
+        ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 1u, false, 10u);
+        //...a change larger than the deadband (w.r.t. the last value put) is.
+        if (ok) {
+            value += (deadband * 2.0);
+            *gam1->float64Signal = value;
+            ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 2u, true, 50u);
+        }
+    }
+    else {
+        //Any change is put.
+        if (ok) {
+            value += 1.0;
+            *gam1->float64Signal = value;
+            ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 2u, true, 50u);
+        }
+    }
+    if (ok) {
+        ok = TestExecuteOnlyOnChangeCycles(gam1, scheduler, 2u, false, 10u);
+    }
+    //Check that the last value reached the PV.
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback) == ECA_NORMAL);
+    }
+    if (ok) {
+        chid pvChid;
+        float64 pvValue = 0.0;
+        /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+        ok = (ca_create_channel("MARTe2::EPICSCAInput::Test::Float64", NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChid) == ECA_NORMAL);
+        if (ok) {
+            (void) ca_pend_io(1.0);
+            ok = (ca_get(DBR_DOUBLE, pvChid, &pvValue) == ECA_NORMAL);
+        }
+        if (ok) {
+            ok = (ca_pend_io(1.0) == ECA_NORMAL);
+        }
+        if (ok) {
+            ok = (pvValue == value);
+        }
+        (void) ca_clear_channel(pvChid);
+        ca_detach_context();
+        ca_context_destroy();
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    godb->Purge();
+    return ok;
+}
+
+static bool TestExecuteSignals(const MARTe::char8 * const config) {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
+    ReferenceT<EPICSCAOutputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+
+    if (ok) {
+        ok = (ca_context_create(ca_enable_preemptive_callback));
+    }
+    const uint32 NUMBER_OF_PVS = 10u;
+    chid pvChids[NUMBER_OF_PVS];
+    chtype pvTypes[] = { DBR_STRING, DBR_STRING, DBR_CHAR, DBR_CHAR, DBR_SHORT, DBR_SHORT, DBR_LONG, DBR_LONG, DBR_FLOAT, DBR_DOUBLE };
+    const char8 *pvNames[] = { "MARTe2::EPICSCAInput::Test::String", "MARTe2::EPICSCAInput::Test::Char8", "MARTe2::EPICSCAInput::Test::UInt8",
+            "MARTe2::EPICSCAInput::Test::Int8", "MARTe2::EPICSCAInput::Test::UInt16", "MARTe2::EPICSCAInput::Test::Int16", "MARTe2::EPICSCAInput::Test::UInt32",
+            "MARTe2::EPICSCAInput::Test::Int32", "MARTe2::EPICSCAInput::Test::Float32", "MARTe2::EPICSCAInput::Test::Float64" };
+    char8 char8Value[40];
+    char8 stringValue[40];
+    uint8 uint8Value = 0;
+    int8 int8Value = 0;
+    uint32 uint16Value = 0;
+    int32 int16Value = 0;
+    uint32 uint32Value = 0;
+    int32 int32Value = 0;
+    float32 float32Value = 0;
+    float64 float64Value = 0;
+    void *pvMemory[] = { &stringValue[0], &char8Value[0], &uint8Value, &int8Value, &uint16Value, &int16Value, &uint32Value, &int32Value, &float32Value,
+            &float64Value };
+
+    if (ok) {
+        uint32 n;
+        for (n = 0u; (n < NUMBER_OF_PVS) && (ok); n++) {
+            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
+            ok = (ca_create_channel(pvNames[n], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChids[n]) == ECA_NORMAL);
+        }
+    }
+
+    if (ok) {
+        uint32 n;
+        bool done = 0;
+        uint32 doneC = 0;
+        uint32 timeOutCounts = 50;
+        StringHelper::Copy(&gam1->char8Signal[0], "EPICSCATEST");
+        StringHelper::Copy(&gam1->stringSignal[0], "EPICSCATESTSTR");
+        *gam1->uint8Signal = 11;
+        *gam1->int8Signal = 12;
+        *gam1->uint16Signal = 1;
+        *gam1->uint32Signal = 2;
+        *gam1->float64Signal = 3;
+        *gam1->int16Signal = 4;
+        *gam1->int32Signal = 5;
+        *gam1->float32Signal = 6;
+
+        while ((!done) && (timeOutCounts > 0u) && (ok)) {
+            scheduler->ExecuteThreadCycle(0);
+
+            for (n = 0u; (n < NUMBER_OF_PVS) && (ok); n++) {
+                ca_get(pvTypes[n], pvChids[n], pvMemory[n]);
+            }
+            if (ok) {
+                ca_pend_io(1.0);
+            }
+
+            StreamString tmpChar8 = &char8Value[0];
+            StreamString tmpString = &stringValue[0];
+            done = (*gam1->uint16Signal == uint16Value);
+            done &= (*gam1->uint32Signal == uint32Value);
+            done &= (*gam1->float64Signal == float64Value);
+            done &= (*gam1->int16Signal == int16Value);
+            done &= (*gam1->int32Signal == int32Value);
+            done &= (*gam1->float32Signal == float32Value);
+            done &= (*gam1->int8Signal == int8Value);
+            done &= (*gam1->uint8Signal == uint8Value);
+            done &= (tmpChar8 == gam1->char8Signal);
+            done &= (tmpString == gam1->stringSignal);
+
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+            if ((done) && (doneC == 0)) {
+                *gam1->uint16Signal *= 2;
+                *gam1->uint32Signal *= 2;
+                *gam1->float64Signal *= 2;
+                *gam1->int16Signal *= 2;
+                *gam1->int32Signal *= 2;
+                *gam1->float32Signal *= 2;
+                *gam1->int8Signal *= 2;
+                *gam1->uint8Signal *= 2;
+                gam1->char8Signal[0] = 'A';
+                gam1->stringSignal[0] = 'B';
+                done = false;
+                doneC++;
+            }
+
+        }
+        if (ok) {
+            ok = done;
+        }
+    }
+
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    if (ok) {
+        uint32 n;
+        for (n = 0u; (n < NUMBER_OF_PVS); n++) {
+            ca_clear_channel(pvChids[n]);
+        }
+    }
+    ca_detach_context();
+    ca_context_destroy();
+    godb->Purge();
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1121,6 +1549,29 @@ bool EPICSCAOutputTest::TestInitialise_False_NumberOfBuffers() {
     return !test.Initialise(cdb);
 }
 
+bool EPICSCAOutputTest::TestInitialise_False_PutMode() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("PutMode", "Sometimes");
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool EPICSCAOutputTest::TestInitialise_False_OnlyOnChangeBlocking() {
+    using namespace MARTe;
+    EPICSCAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("PutMode", "Blocking");
+    cdb.Write("OnlyOnChange", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool EPICSCAOutputTest::TestSetConfiguredDatabase() {
     return TestIntegratedInApplication(config1, true);
 }
@@ -1326,140 +1777,7 @@ bool EPICSCAOutputTest::TestAsyncCaPut() {
 }
 
 bool EPICSCAOutputTest::TestExecute() {
-    using namespace MARTe;
-    bool ok = TestIntegratedInApplication(config1, false);
-    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
-
-    ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
-    ReferenceT<EPICSCAOutputSchedulerTestHelper> scheduler;
-    ReferenceT<RealTimeApplication> application;
-
-    if (ok) {
-        application = godb->Find("Test");
-        ok = application.IsValid();
-    }
-    if (ok) {
-        gam1 = godb->Find("Test.Functions.GAM1");
-        ok = gam1.IsValid();
-    }
-    if (ok) {
-        scheduler = godb->Find("Test.Scheduler");
-        ok = scheduler.IsValid();
-    }
-    if (ok) {
-        ok = application->PrepareNextState("State1");
-    }
-    if (ok) {
-        ok = application->StartNextStateExecution();
-    }
-
-    if (ok) {
-        ok = (ca_context_create(ca_enable_preemptive_callback));
-    }
-    const uint32 NUMBER_OF_PVS = 10u;
-    chid pvChids[NUMBER_OF_PVS];
-    chtype pvTypes[] = { DBR_STRING, DBR_STRING, DBR_CHAR, DBR_CHAR, DBR_SHORT, DBR_SHORT, DBR_LONG, DBR_LONG, DBR_FLOAT, DBR_DOUBLE };
-    const char8 *pvNames[] = { "MARTe2::EPICSCAInput::Test::String", "MARTe2::EPICSCAInput::Test::Char8", "MARTe2::EPICSCAInput::Test::UInt8",
-            "MARTe2::EPICSCAInput::Test::Int8", "MARTe2::EPICSCAInput::Test::UInt16", "MARTe2::EPICSCAInput::Test::Int16", "MARTe2::EPICSCAInput::Test::UInt32",
-            "MARTe2::EPICSCAInput::Test::Int32", "MARTe2::EPICSCAInput::Test::Float32", "MARTe2::EPICSCAInput::Test::Float64" };
-    char8 char8Value[40];
-    char8 stringValue[40];
-    uint8 uint8Value = 0;
-    int8 int8Value = 0;
-    uint32 uint16Value = 0;
-    int32 int16Value = 0;
-    uint32 uint32Value = 0;
-    int32 int32Value = 0;
-    float32 float32Value = 0;
-    float64 float64Value = 0;
-    void *pvMemory[] = { &stringValue[0], &char8Value[0], &uint8Value, &int8Value, &uint16Value, &int16Value, &uint32Value, &int32Value, &float32Value,
-            &float64Value };
-
-    if (ok) {
-        uint32 n;
-        for (n = 0u; (n < NUMBER_OF_PVS) && (ok); n++) {
-            /*lint -e{9130} -e{835} -e{845} -e{747} Several false positives. lint is getting confused here for some reason.*/
-            ok = (ca_create_channel(pvNames[n], NULL_PTR(caCh *), NULL_PTR(void *), 20u, &pvChids[n]) == ECA_NORMAL);
-        }
-    }
-
-    if (ok) {
-        uint32 n;
-        bool done = 0;
-        uint32 doneC = 0;
-        uint32 timeOutCounts = 50;
-        StringHelper::Copy(&gam1->char8Signal[0], "EPICSCATEST");
-        StringHelper::Copy(&gam1->stringSignal[0], "EPICSCATESTSTR");
-        *gam1->uint8Signal = 11;
-        *gam1->int8Signal = 12;
-        *gam1->uint16Signal = 1;
-        *gam1->uint32Signal = 2;
-        *gam1->float64Signal = 3;
-        *gam1->int16Signal = 4;
-        *gam1->int32Signal = 5;
-        *gam1->float32Signal = 6;
-
-        while ((!done) && (timeOutCounts > 0u) && (ok)) {
-            scheduler->ExecuteThreadCycle(0);
-
-            for (n = 0u; (n < NUMBER_OF_PVS) && (ok); n++) {
-                ca_get(pvTypes[n], pvChids[n], pvMemory[n]);
-            }
-            if (ok) {
-                ca_pend_io(1.0);
-            }
-
-            StreamString tmpChar8 = &char8Value[0];
-            StreamString tmpString = &stringValue[0];
-            done = (*gam1->uint16Signal == uint16Value);
-            done &= (*gam1->uint32Signal == uint32Value);
-            done &= (*gam1->float64Signal == float64Value);
-            done &= (*gam1->int16Signal == int16Value);
-            done &= (*gam1->int32Signal == int32Value);
-            done &= (*gam1->float32Signal == float32Value);
-            done &= (*gam1->int8Signal == int8Value);
-            done &= (*gam1->uint8Signal == uint8Value);
-            done &= (tmpChar8 == gam1->char8Signal);
-            done &= (tmpString == gam1->stringSignal);
-
-            if (!done) {
-                timeOutCounts--;
-                Sleep::Sec(0.1);
-            }
-            if ((done) && (doneC == 0)) {
-                *gam1->uint16Signal *= 2;
-                *gam1->uint32Signal *= 2;
-                *gam1->float64Signal *= 2;
-                *gam1->int16Signal *= 2;
-                *gam1->int32Signal *= 2;
-                *gam1->float32Signal *= 2;
-                *gam1->int8Signal *= 2;
-                *gam1->uint8Signal *= 2;
-                gam1->char8Signal[0] = 'A';
-                gam1->stringSignal[0] = 'B';
-                done = false;
-                doneC++;
-            }
-
-        }
-        if (ok) {
-            ok = done;
-        }
-    }
-
-    if (ok) {
-        ok = application->StopCurrentStateExecution();
-    }
-    if (ok) {
-        uint32 n;
-        for (n = 0u; (n < NUMBER_OF_PVS); n++) {
-            ca_clear_channel(pvChids[n]);
-        }
-    }
-    ca_detach_context();
-    ca_context_destroy();
-    godb->Purge();
-    return ok;
+    return TestExecuteSignals(config1);
 }
 
 bool EPICSCAOutputTest::TestExecute_Arrays() {
@@ -1614,3 +1932,80 @@ bool EPICSCAOutputTest::TestExecute_Arrays() {
     return ok;
 }
 
+bool EPICSCAOutputTest::TestExecute_Batched() {
+    using namespace MARTe;
+    StreamString config = AddDataSourceParameters(config1, "PutMode = Batched");
+    return TestExecuteSignals(config.Buffer());
+}
+
+bool EPICSCAOutputTest::TestExecute_Callback() {
+    using namespace MARTe;
+    StreamString config = AddDataSourceParameters(config1, "PutMode = Callback");
+    return TestExecuteSignals(config.Buffer());
+}
+
+bool EPICSCAOutputTest::TestExecute_OnlyOnChange() {
+    using namespace MARTe;
+    StreamString config = AddDataSourceParameters(config1, "PutMode = Callback OnlyOnChange = 1");
+    bool ok = TestExecuteSignals(config.Buffer());
+    if (ok) {
+        ok = TestExecuteOnlyOnChange(0.0);
+    }
+    return ok;
+}
+
+bool EPICSCAOutputTest::TestExecute_OnlyOnChange_Deadband() {
+    return TestExecuteOnlyOnChange(0.5);
+}
+
+bool EPICSCAOutputTest::TestExecute_PutCounters() {
+    using namespace MARTe;
+    bool ok = TestIntegratedInApplication(config9, false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSCAOutputGAMTestHelper> gam1;
+    ReferenceT<EPICSCAOutputSchedulerTestHelper> scheduler;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        ok = (gam1->failedPutsSignal != NULL);
+    }
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        //The PV does not exist, so every put is counted as failed.
+        uint32 timeOutCounts = 50u;
+        bool done = false;
+        while ((!done) && (timeOutCounts > 0u)) {
+            *gam1->uint32Signal = timeOutCounts;
+            scheduler->ExecuteThreadCycle(0u);
+            done = (*gam1->failedPutsSignal > 0u);
+            if (!done) {
+                timeOutCounts--;
+                Sleep::Sec(0.1);
+            }
+        }
+        ok = done;
+    }
+    if (ok) {
+        ok = application->StopCurrentStateExecution();
+    }
+    godb->Purge();
+    return ok;
+}
@@ -101,6 +101,16 @@ public:
      */
     bool TestInitialise_False_NumberOfBuffers();
 
+    /**
+     * @brief Tests that the Initialise method fails if the PutMode is not supported.
+     */
+    bool TestInitialise_False_PutMode();
+
+    /**
+     * @brief Tests that the Initialise method fails if OnlyOnChange is set with the Blocking PutMode.
+     */
+    bool TestInitialise_False_OnlyOnChangeBlocking();
+
     /**
      * @brief Tests the SetConfiguredDatabase method.
      */
@@ -171,6 +181,31 @@ public:
      */
     bool TestAsyncCaPut();
 
+    /**
+     * @brief Tests the Execute method with PutMode = Batched.
+     */
+    bool TestExecute_Batched();
+
+    /**
+     * @brief Tests the Execute method with PutMode = Callback.
+     */
+    bool TestExecute_Callback();
+
+    /**
+     * @brief Tests the Execute method with OnlyOnChange = 1 and that an unchanged value is not put again.
+     */
+    bool TestExecute_OnlyOnChange();
+
+    /**
+     * @brief Tests the Execute method with OnlyOnChange = 1 and a Deadband.
+     */
+    bool TestExecute_OnlyOnChange_Deadband();
+
+    /**
+     * @brief Tests that the FailedPuts signal counts the puts to a PV that does not exist.
+     */
+    bool TestExecute_PutCounters();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -84,6 +84,16 @@ TEST(EPICSPVAOutputGTest,TestInitialise_Defaults) {
     ASSERT_TRUE(test.TestInitialise_Defaults());
 }
 
+TEST(EPICSPVAOutputGTest,TestInitialise_PutOptions) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_PutOptions());
+}
+
+TEST(EPICSPVAOutputGTest,TestInitialise_False_PutTimeout) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_PutTimeout());
+}
+
 TEST(EPICSPVAOutputGTest,TestInitialise_False_Signals) {
     EPICSPVAOutputTest test;
     ASSERT_TRUE(test.TestInitialise_False_Signals());
@@ -134,6 +144,21 @@ TEST(EPICSPVAOutputGTest,TestSynchronise) {
     ASSERT_TRUE(test.TestSynchronise());
 }
 
+TEST(EPICSPVAOutputGTest,TestSynchronise_PipelinePuts) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_PipelinePuts());
+}
+
+TEST(EPICSPVAOutputGTest,TestSynchronise_CoalescePuts) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_CoalescePuts());
+}
+
+TEST(EPICSPVAOutputGTest,TestSynchronise_CoalescePuts_LastValue) {
+    EPICSPVAOutputTest test;
+    ASSERT_TRUE(test.TestSynchronise_CoalescePuts_LastValue());
+}
+
 TEST(EPICSPVAOutputGTest,TestSynchronise_Arrays) {
     EPICSPVAOutputTest test;
     ASSERT_TRUE(test.TestSynchronise_Arrays());
@@ -391,6 +391,339 @@ public:
 };
 CLASS_REGISTER(EPICSPVAOutputGAMTestHelperSA, "1.0")
 
+/**
+ * @brief Writes scalar values on five records, with \a putParameters added to the EPICSPVAOutput configuration.
+ */
+static bool TestSynchroniseWithParameters(const MARTe::char8 * const putParameters) {
+    using namespace MARTe;
+    StreamString config = ""
+            "+Types = {\n"
+            "    Class = ReferenceContainer"
+            "    +UnsignedIntegers = {\n"
+            "        Class = IntrospectionStructure"
+            "        UInt8 = {\n"
+            "            Type = uint8\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        UInt16 = {\n"
+            "            Type = uint16\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        UInt32 = {\n"
+            "            Type = uint32\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        UInt64 = {\n"
+            "            Type = uint64\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "    }\n"
+            "    +SignedIntegers = {\n"
+            "        Class = IntrospectionStructure"
+            "        Int8 = {\n"
+            "            Type = int8\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        Int16 = {\n"
+            "            Type = int16\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        Int32 = {\n"
+            "            Type = int32\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "        Int64 = {\n"
+            "            Type = int64\n"
+            "            NumberOfElements = 1\n"
+            "        }\n"
+            "    }\n"
+            "}\n"
+            "+EPICSPVADatabase1 = {\n"
+            "    Class = EPICSPVADatabase\n"
+            "    +RecordOut1 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Structure = {\n"
+            "             UnsignedIntegers = {\n"
+            "                  Type = UnsignedIntegers\n"
+            "             }\n"
+            "        }\n"
+            "    }\n"
+            "    +RecordOut2 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Alias = \"TEST::RECORDOUT2\"\n"
+            "        Structure = {\n"
+            "             SignedIntegers = {\n"
+            "                  Type = SignedIntegers\n"
+            "             }\n"
+            "        }\n"
+            "    }\n"
+            "    +RecordOut3 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Structure = {\n"
+            "            Element1 = {\n"
+            "                Type = float32\n"
+            "                NumberOfElements = 1\n"
+            "            }\n"
+            "       }\n"
+            "    }\n"
+            "    +RecordOut4 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Structure = {\n"
+            "            Element1 = {\n"
+            "                Type = float64\n"
+            "                NumberOfElements = 1\n"
+            "            }\n"
+            "       }\n"
+            "    }\n"
+            "    +RecordOut5 = {\n"
+            "        Class = EPICSPVA::EPICSPVARecord\n"
+            "        Alias = \"TEST::RECORDOUT5\"\n"
+            "        Structure = {\n"
+            "             Strings = {\n"
+            "                  Type = EPICSPVAOutputTestString\n"
+            "             }\n"
+            "        }\n"
+            "    }\n"
+            "}\n"
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAM1 = {\n"
+            "            Class = EPICSPVAOutputGAMTestHelper\n"
+            "            OutputSignals = {\n"
+            "                SignalUInt8 = {\n"
+            "                    Type = uint8\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut1.UInt8\n"
+            "                }\n"
+            "                SignalUInt16 = {\n"
+            "                    Type = uint16\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut1.UInt16\n"
+            "                }\n"
+            "                SignalUInt32 = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut1.UInt32\n"
+            "                }\n"
+            "                SignalUInt64 = {\n"
+            "                    Type = uint64\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut1.UInt64\n"
+            "                }\n"
+            "                SignalFloat64 = {\n"
+            "                    Type = float64\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut4\n"
+            "                }\n"
+            "                SignalInt8 = {\n"
+            "                    Type = int8\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut2.Int8\n"
+            "                }\n"
+            "                SignalInt16 = {\n"
+            "                    Type = int16\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut2.Int16\n"
+            "                }\n"
+            "                SignalInt32 = {\n"
+            "                    Type = int32\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut2.Int32\n"
+            "                }\n"
+            "                SignalIn64 = {\n"
+            "                    Type = int64\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut2.Int64\n"
+            "                }\n"
+            "                SignalFloat32 = {\n"
+            "                    Type = float32\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    Alias = RecordOut3\n"
+            "                }\n"
+            "                SignalString = {\n"
+            "                    Type = char8\n"
+            "                    DataSource = EPICSPVAOutputTest\n"
+            "                    NumberOfElements = 128\n"
+            "                    Alias = RecordOut5.SString\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +EPICSPVAOutputTest = {\n"
+            "            Class = EPICSPVAOutput\n"
+            "            CPUMask = 15\n"
+            "            StackSize = 10000000\n"
+            "            NumberOfBuffers = 2\n";
+    config += putParameters;
+    config += ""
+            "            Signals = {\n"
+            "                RecordOut1 = {\n"
+            "                    Type = UnsignedIntegers\n"
+            "                    Field = UnsignedIntegers\n"
+            "                }\n"
+            "                RecordOut2 = {\n"
+            "                    Alias = \"TEST::RECORDOUT2\""
+            "                    Type = SignedIntegers\n"
+            "                    Field = SignedIntegers\n"
+            "                }\n"
+            "                RecordOut3 = {\n"
+            "                     Field = Element1\n"
+            "                     Type = float32\n"
+            "                     NumberOfElements = 1\n"
+            "                }\n"
+            "                RecordOut4 = {\n"
+            "                    Field = Element1\n"
+            "                    Type = float64\n"
+            "                    NumberOfElements = 1\n"
+            "                }\n"
+            "                RecordOut5 = {\n"
+            "                    Alias = \"TEST::RECORDOUT5\""
+            "                    Field = Strings\n"
+            "                    Type = EPICSPVAOutputTestString\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAM1}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = EPICSPVAOutputSchedulerTestHelper\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+
+    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
+
+    ReferenceT<EPICSPVAOutputGAMTestHelper> gam1;
+    ReferenceT<RealTimeApplication> application;
+
+    if (ok) {
+        application = godb->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        gam1 = godb->Find("Test.Functions.GAM1");
+        ok = gam1.IsValid();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    ReferenceT<EPICSPVAOutputSchedulerTestHelper> scheduler;
+    if (ok) {
+        scheduler = godb->Find("Test.Scheduler");
+        ok = scheduler.IsValid();
+    }
+    if (ok) {
+        ok = application->StartNextStateExecution();
+    }
+    if (ok) {
+        *gam1->uint8Signal = 1;
+        *gam1->uint16Signal = 2;
+        *gam1->uint32Signal = 3;
+        *gam1->uint64Signal = 4;
+        *gam1->int8Signal = -1;
+        *gam1->int16Signal = -2;
+        *gam1->int32Signal = -3;
+        *gam1->int64Signal = -4;
+        *gam1->float32Signal = 32;
+        *gam1->float64Signal = 64;
+        StreamString expectedStringValue = "STRINGSIGNAL";
+
+        StringHelper::CopyN(&gam1->char8Signal[0], expectedStringValue.Buffer(), expectedStringValue.Size());
+
+        scheduler->ExecuteThreadCycle(0u);
+        pvac::ClientProvider provider("pva");
+        uint32 timeOutCounts = 50;
+        ok = false;
+        while ((!ok) && (timeOutCounts != 0u)) {
+            {
+                pvac::ClientChannel record1(provider.connect("RecordOut1"));
+                epics::pvData::PVStructure::const_shared_pointer getStruct = record1.get();
+                std::shared_ptr<const epics::pvData::PVUByte> uint8Value = getStruct->getSubField<epics::pvData::PVUByte>("UnsignedIntegers.UInt8");
+                std::shared_ptr<const epics::pvData::PVUShort> uint16Value = getStruct->getSubField<epics::pvData::PVUShort>("UnsignedIntegers.UInt16");
+                std::shared_ptr<const epics::pvData::PVUInt> uint32Value = getStruct->getSubField<epics::pvData::PVUInt>("UnsignedIntegers.UInt32");
+                std::shared_ptr<const epics::pvData::PVULong> uint64Value = getStruct->getSubField<epics::pvData::PVULong>("UnsignedIntegers.UInt64");
+                ok = (uint8Value ? true : false);
+                if (ok) {
+                    ok = (uint8Value->get() == *gam1->uint8Signal);
+                    ok &= (uint16Value->get() == *gam1->uint16Signal);
+                    ok &= (uint32Value->get() == *gam1->uint32Signal);
+                    ok &= (uint64Value->get() == *gam1->uint64Signal);
+                }
+            }
+            {
+                pvac::ClientChannel record2(provider.connect("TEST::RECORDOUT2"));
+                epics::pvData::PVStructure::const_shared_pointer getStruct = record2.get();
+                std::shared_ptr<const epics::pvData::PVByte> int8Value = getStruct->getSubField<epics::pvData::PVByte>("SignedIntegers.Int8");
+                std::shared_ptr<const epics::pvData::PVShort> int16Value = getStruct->getSubField<epics::pvData::PVShort>("SignedIntegers.Int16");
+                std::shared_ptr<const epics::pvData::PVInt> int32Value = getStruct->getSubField<epics::pvData::PVInt>("SignedIntegers.Int32");
+                std::shared_ptr<const epics::pvData::PVLong> int64Value = getStruct->getSubField<epics::pvData::PVLong>("SignedIntegers.Int64");
+                ok &= (int8Value ? true : false);
+                if (ok) {
+                    ok = (int8Value->get() == *gam1->int8Signal);
+                    ok &= (int16Value->get() == *gam1->int16Signal);
+                    ok &= (int32Value->get() == *gam1->int32Signal);
+                    ok &= (int64Value->get() == *gam1->int64Signal);
+                }
+            }
+            {
+                pvac::ClientChannel record3(provider.connect("RecordOut3"));
+                epics::pvData::PVStructure::const_shared_pointer getStruct = record3.get();
+                std::shared_ptr<const epics::pvData::PVFloat> float32Value = getStruct->getSubField<epics::pvData::PVFloat>("Element1");
+                ok &= (float32Value ? true : false);
+                if (ok) {
+                    ok = (float32Value->get() == *gam1->float32Signal);
+                }
+            }
+            {
+                pvac::ClientChannel record4(provider.connect("RecordOut4"));
+                epics::pvData::PVStructure::const_shared_pointer getStruct = record4.get();
+                std::shared_ptr<const epics::pvData::PVDouble> float64Value = getStruct->getSubField<epics::pvData::PVDouble>("Element1");
+                ok &= (float64Value ? true : false);
+                if (ok) {
+                    ok = (float64Value->get() == *gam1->float64Signal);
+                }
+            }
+            {
+                pvac::ClientChannel record5(provider.connect("TEST::RECORDOUT5"));
+                epics::pvData::PVStructure::const_shared_pointer getStruct = record5.get();
+                std::shared_ptr<const epics::pvData::PVString> stringValue = getStruct->getSubField<epics::pvData::PVString>("Strings.SString");
+
+                ok &= (stringValue ? true : false);
+                if (ok) {
+                    std::string val = stringValue->get();
+                    ok = (expectedStringValue == val.c_str());
+                }
+            }
+            Sleep::Sec(0.1);
+            timeOutCounts--;
+        }
+    }
+    godb->Purge();
+
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -458,6 +791,36 @@ bool EPICSPVAOutputTest::TestInitialise() {
     return ok;
 }
 
+bool EPICSPVAOutputTest::TestInitialise_PutOptions() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("PutTimeout", 500);
+    cdb.Write("PipelinePuts", 1);
+    cdb.Write("CoalescePuts", 1);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetPutTimeout() == 500u);
+        ok &= (test.IsPipeliningPuts());
+        ok &= (test.IsCoalescingPuts());
+    }
+    return ok;
+}
+
+bool EPICSPVAOutputTest::TestInitialise_False_PutTimeout() {
+    using namespace MARTe;
+    EPICSPVAOutput test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("PutTimeout", 0);
+    cdb.CreateAbsolute("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
 bool EPICSPVAOutputTest::TestInitialise_Defaults() {
     using namespace MARTe;
     EPICSPVAOutput test;
@@ -1319,77 +1682,22 @@ bool EPICSPVAOutputTest::TestIsIgnoringBufferOverrun() {
 }
 
 bool EPICSPVAOutputTest::TestSynchronise() {
+    return TestSynchroniseWithParameters("");
+}
+
+bool EPICSPVAOutputTest::TestSynchronise_PipelinePuts() {
+    return TestSynchroniseWithParameters("            PipelinePuts = 1\n");
+}
+
+bool EPICSPVAOutputTest::TestSynchronise_CoalescePuts() {
+    return TestSynchroniseWithParameters("            CoalescePuts = 1\n");
+}
+
+bool EPICSPVAOutputTest::TestSynchronise_CoalescePuts_LastValue() {
     using namespace MARTe;
-    StreamString config = ""
-            "+Types = {\n"
-            "    Class = ReferenceContainer"
-            "    +UnsignedIntegers = {\n"
-            "        Class = IntrospectionStructure"
-            "        UInt8 = {\n"
-            "            Type = uint8\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        UInt16 = {\n"
-            "            Type = uint16\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        UInt32 = {\n"
-            "            Type = uint32\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        UInt64 = {\n"
-            "            Type = uint64\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "    }\n"
-            "    +SignedIntegers = {\n"
-            "        Class = IntrospectionStructure"
-            "        Int8 = {\n"
-            "            Type = int8\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        Int16 = {\n"
-            "            Type = int16\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        Int32 = {\n"
-            "            Type = int32\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "        Int64 = {\n"
-            "            Type = int64\n"
-            "            NumberOfElements = 1\n"
-            "        }\n"
-            "    }\n"
-            "}\n"
+    const char8 * const config = ""
             "+EPICSPVADatabase1 = {\n"
             "    Class = EPICSPVADatabase\n"
-            "    +RecordOut1 = {\n"
-            "        Class = EPICSPVA::EPICSPVARecord\n"
-            "        Structure = {\n"
-            "             UnsignedIntegers = {\n"
-            "                  Type = UnsignedIntegers\n"
-            "             }\n"
-            "        }\n"
-            "    }\n"
-            "    +RecordOut2 = {\n"
-            "        Class = EPICSPVA::EPICSPVARecord\n"
-            "        Alias = \"TEST::RECORDOUT2\"\n"
-            "        Structure = {\n"
-            "             SignedIntegers = {\n"
-            "                  Type = SignedIntegers\n"
-            "             }\n"
-            "        }\n"
-            "    }\n"
-            "    +RecordOut3 = {\n"
-            "        Class = EPICSPVA::EPICSPVARecord\n"
-            "        Structure = {\n"
-            "            Element1 = {\n"
-            "                Type = float32\n"
-            "                NumberOfElements = 1\n"
-            "            }\n"
-            "       }\n"
-            "    }\n"
             "    +RecordOut4 = {\n"
             "        Class = EPICSPVA::EPICSPVARecord\n"
             "        Structure = {\n"
@@ -1399,15 +1707,6 @@ bool EPICSPVAOutputTest::TestSynchronise() {
             "            }\n"
             "       }\n"
             "    }\n"
-            "    +RecordOut5 = {\n"
-            "        Class = EPICSPVA::EPICSPVARecord\n"
-            "        Alias = \"TEST::RECORDOUT5\"\n"
-            "        Structure = {\n"
-            "             Strings = {\n"
-            "                  Type = EPICSPVAOutputTestString\n"
-            "             }\n"
-            "        }\n"
-            "    }\n"
             "}\n"
             "$Test = {\n"
             "    Class = RealTimeApplication\n"
@@ -1416,62 +1715,11 @@ bool EPICSPVAOutputTest::TestSynchronise() {
             "        +GAM1 = {\n"
             "            Class = EPICSPVAOutputGAMTestHelper\n"
             "            OutputSignals = {\n"
-            "                SignalUInt8 = {\n"
-            "                    Type = uint8\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut1.UInt8\n"
-            "                }\n"
-            "                SignalUInt16 = {\n"
-            "                    Type = uint16\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut1.UInt16\n"
-            "                }\n"
-            "                SignalUInt32 = {\n"
-            "                    Type = uint32\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut1.UInt32\n"
-            "                }\n"
-            "                SignalUInt64 = {\n"
-            "                    Type = uint64\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut1.UInt64\n"
-            "                }\n"
             "                SignalFloat64 = {\n"
             "                    Type = float64\n"
             "                    DataSource = EPICSPVAOutputTest\n"
             "                    Alias = RecordOut4\n"
             "                }\n"
-            "                SignalInt8 = {\n"
-            "                    Type = int8\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut2.Int8\n"
-            "                }\n"
-            "                SignalInt16 = {\n"
-            "                    Type = int16\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut2.Int16\n"
-            "                }\n"
-            "                SignalInt32 = {\n"
-            "                    Type = int32\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut2.Int32\n"
-            "                }\n"
-            "                SignalIn64 = {\n"
-            "                    Type = int64\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut2.Int64\n"
-            "                }\n"
-            "                SignalFloat32 = {\n"
-            "                    Type = float32\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    Alias = RecordOut3\n"
-            "                }\n"
-            "                SignalString = {\n"
-            "                    Type = char8\n"
-            "                    DataSource = EPICSPVAOutputTest\n"
-            "                    NumberOfElements = 128\n"
-            "                    Alias = RecordOut5.SString\n"
-            "                }\n"
             "            }\n"
             "        }\n"
             "    }\n"
@@ -1486,31 +1734,13 @@ bool EPICSPVAOutputTest::TestSynchronise() {
             "            CPUMask = 15\n"
             "            StackSize = 10000000\n"
             "            NumberOfBuffers = 2\n"
+            "            CoalescePuts = 1\n"
             "            Signals = {\n"
-            "                RecordOut1 = {\n"
-            "                    Type = UnsignedIntegers\n"
-            "                    Field = UnsignedIntegers\n"
-            "                }\n"
-            "                RecordOut2 = {\n"
-            "                    Alias = \"TEST::RECORDOUT2\""
-            "                    Type = SignedIntegers\n"
-            "                    Field = SignedIntegers\n"
-            "                }\n"
-            "                RecordOut3 = {\n"
-            "                     Field = Element1\n"
-            "                     Type = float32\n"
-            "                     NumberOfElements = 1\n"
-            "                }\n"
             "                RecordOut4 = {\n"
             "                    Field = Element1\n"
             "                    Type = float64\n"
             "                    NumberOfElements = 1\n"
             "                }\n"
-            "                RecordOut5 = {\n"
-            "                    Alias = \"TEST::RECORDOUT5\""
-            "                    Field = Strings\n"
-            "                    Type = EPICSPVAOutputTestString\n"
-            "                }\n"
             "            }\n"
             "        }\n"
             "    }\n"
@@ -1533,7 +1763,7 @@ bool EPICSPVAOutputTest::TestSynchronise() {
             "    }\n"
             "}\n";
 
-    bool ok = TestIntegratedInApplication(config.Buffer(), false);
+    bool ok = TestIntegratedInApplication(config, false);
     ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
 
     ReferenceT<EPICSPVAOutputGAMTestHelper> gam1;
@@ -1559,83 +1789,22 @@ bool EPICSPVAOutputTest::TestSynchronise() {
         ok = application->StartNextStateExecution();
     }
     if (ok) {
-        *gam1->uint8Signal = 1;
-        *gam1->uint16Signal = 2;
-        *gam1->uint32Signal = 3;
-        *gam1->uint64Signal = 4;
-        *gam1->int8Signal = -1;
-        *gam1->int16Signal = -2;
-        *gam1->int32Signal = -3;
-        *gam1->int64Signal = -4;
-        *gam1->float32Signal = 32;
-        *gam1->float64Signal = 64;
-        StreamString expectedStringValue = "STRINGSIGNAL";
-
-        StringHelper::CopyN(&gam1->char8Signal[0], expectedStringValue.Buffer(), expectedStringValue.Size());
-
+        //Two values back-to-back: the second one is coalesced while the first put is outstanding and shall be sent when it completes.
+        *gam1->float64Signal = 1;
+        scheduler->ExecuteThreadCycle(0u);
+        *gam1->float64Signal = 2;
         scheduler->ExecuteThreadCycle(0u);
+        //No more cycles.
         pvac::ClientProvider provider("pva");
         uint32 timeOutCounts = 50;
         ok = false;
         while ((!ok) && (timeOutCounts != 0u)) {
-            {
-                pvac::ClientChannel record1(provider.connect("RecordOut1"));
-                epics::pvData::PVStructure::const_shared_pointer getStruct = record1.get();
-                std::shared_ptr<const epics::pvData::PVUByte> uint8Value = getStruct->getSubField<epics::pvData::PVUByte>("UnsignedIntegers.UInt8");
-                std::shared_ptr<const epics::pvData::PVUShort> uint16Value = getStruct->getSubField<epics::pvData::PVUShort>("UnsignedIntegers.UInt16");
-                std::shared_ptr<const epics::pvData::PVUInt> uint32Value = getStruct->getSubField<epics::pvData::PVUInt>("UnsignedIntegers.UInt32");
-                std::shared_ptr<const epics::pvData::PVULong> uint64Value = getStruct->getSubField<epics::pvData::PVULong>("UnsignedIntegers.UInt64");
-                ok = (uint8Value ? true : false);
-                if (ok) {
-                    ok = (uint8Value->get() == *gam1->uint8Signal);
-                    ok &= (uint16Value->get() == *gam1->uint16Signal);
-                    ok &= (uint32Value->get() == *gam1->uint32Signal);
-                    ok &= (uint64Value->get() == *gam1->uint64Signal);
-                }
-            }
-            {
-                pvac::ClientChannel record2(provider.connect("TEST::RECORDOUT2"));
-                epics::pvData::PVStructure::const_shared_pointer getStruct = record2.get();
-                std::shared_ptr<const epics::pvData::PVByte> int8Value = getStruct->getSubField<epics::pvData::PVByte>("SignedIntegers.Int8");
-                std::shared_ptr<const epics::pvData::PVShort> int16Value = getStruct->getSubField<epics::pvData::PVShort>("SignedIntegers.Int16");
-                std::shared_ptr<const epics::pvData::PVInt> int32Value = getStruct->getSubField<epics::pvData::PVInt>("SignedIntegers.Int32");
-                std::shared_ptr<const epics::pvData::PVLong> int64Value = getStruct->getSubField<epics::pvData::PVLong>("SignedIntegers.Int64");
-                ok &= (int8Value ? true : false);
-                if (ok) {
-                    ok = (int8Value->get() == *gam1->int8Signal);
-                    ok &= (int16Value->get() == *gam1->int16Signal);
-                    ok &= (int32Value->get() == *gam1->int32Signal);
-                    ok &= (int64Value->get() == *gam1->int64Signal);
-                }
-            }
-            {
-                pvac::ClientChannel record3(provider.connect("RecordOut3"));
-                epics::pvData::PVStructure::const_shared_pointer getStruct = record3.get();
-                std::shared_ptr<const epics::pvData::PVFloat> float32Value = getStruct->getSubField<epics::pvData::PVFloat>("Element1");
-                ok &= (float32Value ? true : false);
-                if (ok) {
-                    ok = (float32Value->get() == *gam1->float32Signal);
-                }
-            }
-            {
-                pvac::ClientChannel record4(provider.connect("RecordOut4"));
-                epics::pvData::PVStructure::const_shared_pointer getStruct = record4.get();
-                std::shared_ptr<const epics::pvData::PVDouble> float64Value = getStruct->getSubField<epics::pvData::PVDouble>("Element1");
-                ok &= (float64Value ? true : false);
-                if (ok) {
-                    ok = (float64Value->get() == *gam1->float64Signal);
-                }
-            }
-            {
-                pvac::ClientChannel record5(provider.connect("TEST::RECORDOUT5"));
-                epics::pvData::PVStructure::const_shared_pointer getStruct = record5.get();
-                std::shared_ptr<const epics::pvData::PVString> stringValue = getStruct->getSubField<epics::pvData::PVString>("Strings.SString");
-
-                ok &= (stringValue ? true : false);
-                if (ok) {
-                    std::string val = stringValue->get();
-                    ok = (expectedStringValue == val.c_str());
-                }
+            pvac::ClientChannel record4(provider.connect("RecordOut4"));
+            epics::pvData::PVStructure::const_shared_pointer getStruct = record4.get();
+            std::shared_ptr<const epics::pvData::PVDouble> float64Value = getStruct->getSubField<epics::pvData::PVDouble>("Element1");
+            ok = (float64Value ? true : false);
+            if (ok) {
+                ok = (float64Value->get() == 2.0);
             }
             Sleep::Sec(0.1);
             timeOutCounts--;
@@ -87,6 +87,16 @@ public:
      */
     bool TestInitialise_Defaults();
 
+    /**
+     * @brief Tests the Initialise method with the PutTimeout, PipelinePuts and CoalescePuts parameters.
+     */
+    bool TestInitialise_PutOptions();
+
+    /**
+     * @brief Tests that the Initialise method fails with PutTimeout = 0.
+     */
+    bool TestInitialise_False_PutTimeout();
+
     /**
      * @brief Tests the Initialise method without specifying the Signals
      */
@@ -137,6 +147,21 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests the Synchronise method with PipelinePuts = 1.
+     */
+    bool TestSynchronise_PipelinePuts();
+
+    /**
+     * @brief Tests the Synchronise method with CoalescePuts = 1.
+     */
+    bool TestSynchronise_CoalescePuts();
+
+    /**
+     * @brief Tests that with CoalescePuts = 1 the last value written is sent even if no other cycle is executed.
+     */
+    bool TestSynchronise_CoalescePuts_LastValue();
+
     /**
      * @brief Tests the Synchronise method with arrays.
      */
@@ -430,3 +430,48 @@ TEST(FileReaderGTest,TestEOF_Error_Binary_Preload) {
     ASSERT_TRUE(test.TestEOF_Error_Binary_Preload());
 }
 
+TEST(FileReaderGTest,TestInitialise_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_MemoryMap_CSV) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MemoryMap_CSV());
+}
+
+TEST(FileReaderGTest,TestInitialise_False_MemoryMap_ReadAheadByteSize) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestInitialise_False_MemoryMap_ReadAheadByteSize());
+}
+
+TEST(FileReaderGTest,TestGetBrokerName_FileReaderMappedInputBroker) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestGetBrokerName_FileReaderMappedInputBroker());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestSynchronise_Binary_Interpolation_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestSynchronise_Binary_Interpolation_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestEOF_Rewind_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestEOF_Rewind_Binary_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestEOF_Last_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestEOF_Last_Binary_MemoryMap());
+}
+
+TEST(FileReaderGTest,TestEOF_Error_Binary_MemoryMap) {
+    FileReaderTest test;
+    ASSERT_TRUE(test.TestEOF_Error_Binary_MemoryMap());
+}
+
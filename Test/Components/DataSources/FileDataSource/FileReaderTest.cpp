@@ -2915,6 +2915,42 @@ static const MARTe::char8 *const config11P = ""
         "    }"
         "}";
 
+/**
+ * Returns a copy of a Preload = yes configuration with Preload = mmap.
+ */
+static MARTe::StreamString MemoryMappedConfig(const MARTe::char8 *const config) {
+    using namespace MARTe;
+    const char8 *const preloadYes = "Preload = yes";
+    StreamString patched;
+    const char8 *found = StringHelper::SearchString(config, preloadYes);
+    if (found != NULL_PTR(const char8 *)) {
+        uint32 prefixSize = static_cast<uint32>(found - config);
+        patched.Write(config, prefixSize);
+        patched += "Preload = mmap";
+        patched += &found[StringHelper::Length(preloadYes)];
+    }
+    return patched;
+}
+
+/**
+ * Generates a binary file with three samples of scalar signals.
+ */
+static void GenerateBinaryFile(const MARTe::char8 *const filename) {
+    using namespace MARTe;
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    const uint32 signalToVerifyNumberOfSamples = 3u;
+    FRTSignalToVerify **signals = new FRTSignalToVerify*[signalToVerifyNumberOfSamples];
+    uint32 i;
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        signals[i] = new FRTSignalToVerify(numberOfElements, i + 1);
+    }
+    GenerateBinaryFile(filename, signals, numberOfElements, signalToVerifyNumberOfSamples);
+    for (i = 0; i < signalToVerifyNumberOfSamples; i++) {
+        delete signals[i];
+    }
+    delete signals;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -4015,3 +4051,133 @@ bool FileReaderTest::TestEOF_Error_Binary_Preload() {
     uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
     return TestIntegratedExecution(config11P, false, &numberOfElements[0], ";", false, false, true);
 }
+
+bool FileReaderTest::TestInitialise_MemoryMap() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    GenerateBinaryFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "mmap");
+    cdb.Write("ReadAheadByteSize", 4096);
+    cdb.MoveToRoot();
+    bool ok = !test.IsMemoryMapped();
+    if (ok) {
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        ok = test.IsMemoryMapped();
+    }
+    if (ok) {
+        ok = (test.GetCurrentRecord() == NULL_PTR(const char8 *));
+    }
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_MemoryMap_CSV() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.csv";
+    GenerateFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "mmap");
+    cdb.Write("CSVSeparator", ";");
+    cdb.Write("FileFormat", "csv");
+    cdb.MoveToRoot();
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestInitialise_False_MemoryMap_ReadAheadByteSize() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_TestInitialise.bin";
+    GenerateBinaryFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "mmap");
+    cdb.Write("ReadAheadByteSize", 0);
+    cdb.MoveToRoot();
+    bool ok = !test.Initialise(cdb);
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestGetBrokerName_FileReaderMappedInputBroker() {
+    using namespace MARTe;
+    FileReader test;
+    ConfigurationDatabase cdb;
+    const char8 *const filename = "FileReaderTest_Test.bin";
+    GenerateBinaryFile(filename);
+    cdb.Write("Filename", filename);
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Interpolate", "no");
+    cdb.Write("Preload", "mmap");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (StringHelper::Compare(test.GetBrokerName(cdb, InputSignals), "FileReaderMappedInputBroker") == 0);
+    }
+    DeleteTestFile(filename);
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_Binary_MemoryMap() {
+    using namespace MARTe;
+    StreamString config = MemoryMappedConfig(config1P);
+    bool ok = (config.Size() > 0u);
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecution(config.Buffer(), false, &numberOfElements[0], ";");
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 3, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecution(config.Buffer(), false, &numberOfElements[0], ";");
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestSynchronise_Binary_Interpolation_MemoryMap() {
+    using namespace MARTe;
+    StreamString config = MemoryMappedConfig(config1P);
+    bool ok = (config.Size() > 0u);
+    if (ok) {
+        uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+        ok = TestIntegratedExecutionInterpolation(config.Buffer(), false, &numberOfElements[0]);
+    }
+    if (ok) {
+        uint32 numberOfElements[] = { 2, 4, 5, 2, 1, 4, 3, 2, 4, 2 };
+        ok = TestIntegratedExecutionInterpolation(config.Buffer(), false, &numberOfElements[0]);
+    }
+    return ok;
+}
+
+bool FileReaderTest::TestEOF_Rewind_Binary_MemoryMap() {
+    using namespace MARTe;
+    StreamString config = MemoryMappedConfig(config9P);
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    return TestIntegratedExecution(config.Buffer(), false, &numberOfElements[0], ";", true, false, false);
+}
+
+bool FileReaderTest::TestEOF_Last_Binary_MemoryMap() {
+    using namespace MARTe;
+    StreamString config = MemoryMappedConfig(config10P);
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    return TestIntegratedExecution(config.Buffer(), false, &numberOfElements[0], ";", false, true, false);
+}
+
+bool FileReaderTest::TestEOF_Error_Binary_MemoryMap() {
+    using namespace MARTe;
+    StreamString config = MemoryMappedConfig(config11P);
+    uint32 numberOfElements[] = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+    return TestIntegratedExecution(config.Buffer(), false, &numberOfElements[0], ";", false, false, true);
+}
@@ -430,6 +430,51 @@ public:
      * @brief Tests the EOF for binary files with the Error behaviour using preload..
      */
     bool TestEOF_Error_Binary_Preload();
+
+    /**
+     * @brief Tests the Initialise method with Preload = mmap.
+     */
+    bool TestInitialise_MemoryMap();
+
+    /**
+     * @brief Tests that the Initialise method fails with Preload = mmap and FileFormat = csv.
+     */
+    bool TestInitialise_False_MemoryMap_CSV();
+
+    /**
+     * @brief Tests that the Initialise method fails with Preload = mmap and ReadAheadByteSize = 0.
+     */
+    bool TestInitialise_False_MemoryMap_ReadAheadByteSize();
+
+    /**
+     * @brief Tests the GetBrokerName method with Preload = mmap.
+     */
+    bool TestGetBrokerName_FileReaderMappedInputBroker();
+
+    /**
+     * @brief Tests the Synchronise method with a binary file using mmap.
+     */
+    bool TestSynchronise_Binary_MemoryMap();
+
+    /**
+     * @brief Tests the Synchronise method with a binary file and interpolation using mmap.
+     */
+    bool TestSynchronise_Binary_Interpolation_MemoryMap();
+
+    /**
+     * @brief Tests the EOF for binary files with the Rewind behaviour using mmap.
+     */
+    bool TestEOF_Rewind_Binary_MemoryMap();
+
+    /**
+     * @brief Tests the EOF for binary files with the Last behaviour using mmap.
+     */
+    bool TestEOF_Last_Binary_MemoryMap();
+
+    /**
+     * @brief Tests the EOF for binary files with the Error behaviour using mmap.
+     */
+    bool TestEOF_Error_Binary_MemoryMap();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -317,3 +317,33 @@ TEST(FileWriterGTest,TestInvalidMessageType) {
     FileWriterTest test;
     ASSERT_TRUE(test.TestInvalidMessageType());
 }
+
+TEST(FileWriterGTest,TestInitialise_WriteBuffer) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_WriteBuffer());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_WriteBuffer_CSV) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WriteBuffer_CSV());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_WriteBuffer_RefreshContent) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_WriteBuffer_RefreshContent());
+}
+
+TEST(FileWriterGTest,TestInitialise_False_NumberOfWriteBuffers) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestInitialise_False_NumberOfWriteBuffers());
+}
+
+TEST(FileWriterGTest,TestSetConfiguredDatabase_False_WriteBufferByteSize) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_WriteBufferByteSize());
+}
+
+TEST(FileWriterGTest,TestSynchronise_WriteBuffer) {
+    FileWriterTest test;
+    ASSERT_TRUE(test.TestSynchronise_WriteBuffer());
+}
@@ -340,7 +340,8 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
                                     MARTe::uint32 numberOfPreTriggers, MARTe::uint32 numberOfPostTriggers, MARTe::float32 period,
                                     const MARTe::char8 * const filename, const MARTe::char8 * const expectedFileContent, bool csv,
                                     const MARTe::uint32 sleepMSec = 100, 
-                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL) {
+                                    const MARTe::uint8 refreshContent = 0u, MARTe::uint32 * detectedSize = NULL,
+                                    const MARTe::uint32 writeBufferByteSize = 0u) {
     using namespace MARTe;
     ConfigurationDatabase cdb;
     StreamString configStream = config;
@@ -384,6 +385,9 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
     cdb.Write("StoreOnTrigger", storeOnTrigger);
     cdb.Delete("RefreshContent");
     cdb.Write("RefreshContent", refreshContent);
+    if (writeBufferByteSize > 0u) {
+        cdb.Write("WriteBufferByteSize", writeBufferByteSize);
+    }
 
     cdb.Delete("FileFormat");
     if (csv) {
@@ -467,6 +471,23 @@ static bool TestIntegratedExecution(const MARTe::char8 * const config, MARTe::ui
             MessageI::SendMessage(messageFlush, NULL);
         }
     }
+    if ((ok) && (writeBufferByteSize > 0u)) {
+        //All the records shall have been written by the I/O thread
+        ok = (fileWriter->GetWriteBufferHighWaterMark() > 0u);
+        if (ok) {
+            uint32 recordSize = 0u;
+            uint32 n;
+            for (n = 0u; n < fileWriter->GetNumberOfSignals(); n++) {
+                uint32 signalByteSize = 0u;
+                fileWriter->GetSignalByteSize(n, signalByteSize);
+                recordSize += signalByteSize;
+            }
+            ok = (fileWriter->GetNumberOfBytesWritten() == static_cast<uint64>(gam->numberOfExecutes * recordSize));
+        }
+        if (ok) {
+            ok = (fileWriter->GetWriteBandwidth() > 0.0);
+        }
+    }
     godb->Purge();
     File generatedFile;
     if (ok) {
@@ -3133,7 +3154,7 @@ bool FileWriterTest::TestIntegratedInApplication_RefreshContent(const MARTe::cha
     return TestIntegratedInApplication_NoTrigger( filename, csv, 1u, detectedFileSize);
 }
 
-bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize) {
+bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *filename, bool csv, MARTe::uint8 refreshContent, MARTe::uint32* detectedFileSize, MARTe::uint32 writeBufferByteSize) {
     using namespace MARTe;
     uint32 signalToGenerate[] = { 1, 2, 3, 4, 5 };
     uint32 numberOfElements = sizeof(signalToGenerate) / sizeof(uint32);
@@ -3251,7 +3272,7 @@ bool FileWriterTest::TestIntegratedInApplication_NoTrigger( const MARTe::char8 *
         }
     }
 
-    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize);
+    bool ok = TestIntegratedExecution(config1, signalToGenerate, numberOfElements, NULL, 1u, numberOfBuffers, 0, 0, period, filename, expectedFileContent, csv, 100, refreshContent, detectedFileSize, writeBufferByteSize);
     if (!csv) {
         if (expectedFileContent != NULL) {
             char8 *mem = const_cast<char8 *>(&expectedFileContent[0]);
@@ -3835,3 +3856,99 @@ bool FileWriterTest::TestInvalidMessageType() {
     bool ok = TestIntegratedInApplication(config12, true);
     return !ok;
 }
+
+bool FileWriterTest::TestInitialise_WriteBuffer() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_WriteBuffer");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("WriteBufferByteSize", 4194304);
+    cdb.Write("NumberOfWriteBuffers", 4);
+    cdb.Write("SyncEveryNBuffers", 8);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    bool ok = test.Initialise(cdb);
+    ok &= (test.GetWriteBufferByteSize() == 4194304);
+    ok &= (test.GetNumberOfWriteBuffers() == 4);
+    ok &= (test.GetSyncEveryNBuffers() == 8);
+    ok &= (test.GetWriteBufferHighWaterMark() == 0);
+    ok &= (test.GetNumberOfWriteBufferStalls() == 0);
+    ok &= (test.GetNumberOfBytesWritten() == 0);
+    ok &= (test.GetWriteBandwidth() == 0.0);
+    return ok;
+}
+
+bool FileWriterTest::TestInitialise_False_WriteBuffer_CSV() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_WriteBuffer");
+    cdb.Write("FileFormat", "csv");
+    cdb.Write("CSVSeparator", ",");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("WriteBufferByteSize", 4194304);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_WriteBuffer_RefreshContent() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_WriteBuffer");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("RefreshContent", 1);
+    cdb.Write("WriteBufferByteSize", 4194304);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestInitialise_False_NumberOfWriteBuffers() {
+    using namespace MARTe;
+    FileWriter test;
+    ConfigurationDatabase cdb;
+    cdb.Write("NumberOfBuffers", 10);
+    cdb.Write("CPUMask", 15);
+    cdb.Write("StackSize", 10000000);
+    cdb.Write("Filename", "FileWriterTest_TestInitialise_WriteBuffer");
+    cdb.Write("FileFormat", "binary");
+    cdb.Write("Overwrite", "yes");
+    cdb.Write("StoreOnTrigger", 0);
+    cdb.Write("WriteBufferByteSize", 4194304);
+    cdb.Write("NumberOfWriteBuffers", 1);
+    cdb.CreateRelative("Signals");
+    cdb.MoveToRoot();
+    return !test.Initialise(cdb);
+}
+
+bool FileWriterTest::TestSetConfiguredDatabase_False_WriteBufferByteSize() {
+    //One record is 49 bytes
+    return !TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSetConfiguredDatabase_False_WriteBufferByteSize", false, 0u, NULL, 16u);
+}
+
+bool FileWriterTest::TestSynchronise_WriteBuffer() {
+    //Two records per buffer, so that the two buffers are cycled and the last record is only written by the flush
+    bool ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_WriteBuffer_Small", false, 0u, NULL, 100u);
+    if (ok) {
+        //All the records are only written by the flush
+        ok = TestIntegratedInApplication_NoTrigger("FileWriterTest_TestSynchronise_WriteBuffer_Large", false, 0u, NULL, 4194304u);
+    }
+    return ok;
+}
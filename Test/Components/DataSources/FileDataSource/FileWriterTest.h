@@ -224,7 +224,7 @@ public:
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
      */
-    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0);
+    bool TestIntegratedInApplication_NoTrigger(const MARTe::char8 *filename, bool csv = true, MARTe::uint8 refreshContent = 0u, MARTe::uint32* detectedFileSize = 0, MARTe::uint32 writeBufferByteSize = 0u);
 
     /**
      * @brief Tests the FileWriter integrated in an application which continuously stores data.
@@ -341,6 +341,36 @@ public:
      */
     bool TestInvalidMessageType();
 
+    /**
+     * @brief Tests the Initialise method with the write buffer parameters.
+     */
+    bool TestInitialise_WriteBuffer();
+
+    /**
+     * @brief Tests that the Initialise method fails if WriteBufferByteSize is set with FileFormat = csv.
+     */
+    bool TestInitialise_False_WriteBuffer_CSV();
+
+    /**
+     * @brief Tests that the Initialise method fails if WriteBufferByteSize is set with RefreshContent.
+     */
+    bool TestInitialise_False_WriteBuffer_RefreshContent();
+
+    /**
+     * @brief Tests that the Initialise method fails if NumberOfWriteBuffers < 2.
+     */
+    bool TestInitialise_False_NumberOfWriteBuffers();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if WriteBufferByteSize is smaller than one record.
+     */
+    bool TestSetConfiguredDatabase_False_WriteBufferByteSize();
+
+    /**
+     * @brief Tests the Synchronise method with the records written by the I/O thread.
+     */
+    bool TestSynchronise_WriteBuffer();
+
 };
 
 /*---------------------------------------------------------------------------*/
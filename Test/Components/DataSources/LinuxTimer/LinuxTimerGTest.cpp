@@ -290,6 +290,31 @@ TEST(LinuxTimerGTest, TestSetConfiguredDatabase_WithBackwardCompatOnHRT) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_WithBackwardCompatOnHRT());
 }
 
+TEST(LinuxTimerGTest, TestInitialise_Histograms) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_Histograms());
+}
+
+TEST(LinuxTimerGTest, TestInitialise_False_HistogramBinWidth) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_HistogramBinWidth());
+}
+
+TEST(LinuxTimerGTest, TestExecute_Histograms) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestExecute_Histograms());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_HistogramNumberOfElements) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_HistogramNumberOfElements());
+}
+
+TEST(LinuxTimerGTest, TestSetConfiguredDatabase_False_HistogramsDisabled) {
+    LinuxTimerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_HistogramsDisabled());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
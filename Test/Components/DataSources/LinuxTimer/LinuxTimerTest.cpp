@@ -2446,3 +2446,379 @@ bool LinuxTimerTest::TestGetSleepPercentage() {
     return TestInitialise_Busy_SleepPercentage();
 }
 
+bool LinuxTimerTest::TestInitialise_Histograms() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetHistogramNumberOfBins() == 0u);
+    }
+    if (ok) {
+        ok = (test.GetHistogramBinWidth() == 1000u);
+    }
+    if (ok) {
+        ok = !test.ReportHistograms().ErrorsCleared();
+    }
+    if (ok) {
+        ok = !test.ResetHistograms().ErrorsCleared();
+    }
+    LinuxTimer testHistograms;
+    ConfigurationDatabase cdbHistograms;
+    if (ok) {
+        cdbHistograms.Write("HistogramNumberOfBins", 16);
+        cdbHistograms.Write("HistogramBinWidth", 500);
+        ok = testHistograms.Initialise(cdbHistograms);
+    }
+    if (ok) {
+        ok = (testHistograms.GetHistogramNumberOfBins() == 16u);
+    }
+    if (ok) {
+        ok = (testHistograms.GetHistogramBinWidth() == 500u);
+    }
+    uint32 b;
+    for (b = 0u; (b < 16u) && (ok); b++) {
+        ok = ((testHistograms.GetLatencyHistogramBin(b) == 0u) && (testHistograms.GetOverrunHistogramBin(b) == 0u));
+    }
+    if (ok) {
+        ok = (testHistograms.GetLatencyPercentile(99.99) == 0u);
+    }
+    if (ok) {
+        ok = (testHistograms.GetMaxLatency() == 0u);
+    }
+    if (ok) {
+        ok = testHistograms.ReportHistograms().ErrorsCleared();
+    }
+    if (ok) {
+        ok = testHistograms.ResetHistograms().ErrorsCleared();
+    }
+    return ok;
+}
+
+bool LinuxTimerTest::TestInitialise_False_HistogramBinWidth() {
+    using namespace MARTe;
+    LinuxTimer test;
+    ConfigurationDatabase cdb;
+    cdb.Write("HistogramNumberOfBins", 16);
+    cdb.Write("HistogramBinWidth", 0);
+    return !test.Initialise(cdb);
+}
+
+bool LinuxTimerTest::TestExecute_Histograms() {
+    using namespace MARTe;
+
+    const MARTe::char8 *const configHistograms = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LinuxTimerTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                }"
+            "                Time = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    Frequency = 1000"
+            "                }"
+            "                AbsTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                DeltaTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                RephaseTrigger = {"
+            "                    DataSource = Timer"
+            "                    Type = uint8"
+            "                }"
+            "                LatencyHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "                OverrunHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timer = {"
+            "            Class = LinuxTimer"
+            "            ExecutionMode = RealTimeThread"
+            "            HistogramNumberOfBins = 16"
+            "            HistogramBinWidth = 10000"
+            "            +TimeProvider = {"
+            "                Class = MonotonicTimeProvider"
+            "                SpinTime = 20"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = configHistograms;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ok = parser.Parse();
+
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        ok = application->PrepareNextState("State1");
+    }
+    ReferenceT<LinuxTimer> test;
+    if (ok) {
+        test = god->Find("Test.Data.Timer");
+        ok = test.IsValid();
+    }
+    uint32 *latencyHistogram = NULL_PTR(uint32 *);
+    if (ok) {
+        ok = test->GetSignalMemoryBuffer(5u, 0u, reinterpret_cast<void *&>(latencyHistogram));
+    }
+    if (ok) {
+        application->StartNextStateExecution();
+        Sleep::MSec(1000);
+    }
+    uint32 totalLatency = 0u;
+    uint32 totalOverrun = 0u;
+    uint32 b;
+    for (b = 0u; (b < 16u) && (ok); b++) {
+        totalLatency += test->GetLatencyHistogramBin(b);
+        totalOverrun += test->GetOverrunHistogramBin(b);
+        ok = (latencyHistogram[b] >= test->GetLatencyHistogramBin(b));
+    }
+    if (ok) {
+        //The histograms are updated by the same thread, so they can differ by at most one cycle
+        ok = (totalLatency > 100u);
+    }
+    if (ok) {
+        ok = ((totalOverrun + 1u) >= totalLatency);
+    }
+    if (ok) {
+        ok = (test->GetLatencyPercentile(99.99) >= test->GetLatencyPercentile(50.0));
+    }
+    if (ok) {
+        ok = (test->GetLatencyPercentile(50.0) > 0u);
+    }
+    if (ok) {
+        ok = test->ReportHistograms().ErrorsCleared();
+    }
+    if (ok) {
+        ok = test->ResetHistograms().ErrorsCleared();
+    }
+    if (ok) {
+        Sleep::MSec(100);
+        uint32 totalAfterReset = 0u;
+        for (b = 0u; b < 16u; b++) {
+            totalAfterReset += test->GetLatencyHistogramBin(b);
+        }
+        ok = (totalAfterReset < totalLatency);
+    }
+    if (application.IsValid()) {
+        application->StopCurrentStateExecution();
+    }
+    god->Purge();
+    return ok;
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_HistogramNumberOfElements() {
+    const MARTe::char8 *const configHistograms = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LinuxTimerTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                }"
+            "                Time = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    Frequency = 1000"
+            "                }"
+            "                AbsTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                DeltaTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                RephaseTrigger = {"
+            "                    DataSource = Timer"
+            "                    Type = uint8"
+            "                }"
+            "                LatencyHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 8"
+            "                }"
+            "                OverrunHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timer = {"
+            "            Class = LinuxTimer"
+            "            ExecutionMode = RealTimeThread"
+            "            HistogramNumberOfBins = 16"
+            "            HistogramBinWidth = 10000"
+            "            +TimeProvider = {"
+            "                Class = MonotonicTimeProvider"
+            "                SpinTime = 20"
+            "            }"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    return !TestIntegratedInApplication(configHistograms);
+}
+
+bool LinuxTimerTest::TestSetConfiguredDatabase_False_HistogramsDisabled() {
+    const MARTe::char8 *const configHistograms = ""
+            "$Test = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = LinuxTimerTestGAM"
+            "            InputSignals = {"
+            "                Counter = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                }"
+            "                Time = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    Frequency = 1000"
+            "                }"
+            "                AbsTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                DeltaTime = {"
+            "                    DataSource = Timer"
+            "                    Type = uint64"
+            "                }"
+            "                RephaseTrigger = {"
+            "                    DataSource = Timer"
+            "                    Type = uint8"
+            "                }"
+            "                LatencyHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "                OverrunHistogram = {"
+            "                    DataSource = Timer"
+            "                    Type = uint32"
+            "                    NumberOfElements = 16"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        DefaultDataSource = DDB1"
+            "        +Timer = {"
+            "            Class = LinuxTimer"
+            "            ExecutionMode = RealTimeThread"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    return !TestIntegratedInApplication(configHistograms);
+}
+
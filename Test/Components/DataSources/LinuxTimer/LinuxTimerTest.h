@@ -296,6 +296,31 @@ public:
      */
     bool TestSetConfiguredDatabase_WithBackwardCompatOnHRT();
 
+    /**
+     * @brief Tests the Initialise method with the HistogramNumberOfBins and HistogramBinWidth parameters.
+     */
+    bool TestInitialise_Histograms();
+
+    /**
+     * @brief Tests that the Initialise method fails with HistogramBinWidth = 0.
+     */
+    bool TestInitialise_False_HistogramBinWidth();
+
+    /**
+     * @brief Tests the Execute method with the histogram signals, the MonotonicTimeProvider and the ReportHistograms and ResetHistograms methods.
+     */
+    bool TestExecute_Histograms();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the number of elements of a histogram signal is not HistogramNumberOfBins.
+     */
+    bool TestSetConfiguredDatabase_False_HistogramNumberOfElements();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the histogram signals are requested without HistogramNumberOfBins.
+     */
+    bool TestSetConfiguredDatabase_False_HistogramsDisabled();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,123 @@
+/**
+ * @file MonotonicTimeProviderTest.cpp
+ * @brief Source file for class MonotonicTimeProviderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class MonotonicTimeProviderTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "AdvancedErrorManagement.h"
+#include "ConfigurationDatabase.h"
+#include "MonotonicTimeProvider.h"
+#include "MonotonicTimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+MonotonicTimeProviderTest::MonotonicTimeProviderTest() : TimeProviderTest() {
+    timeProvider = new MARTe::MonotonicTimeProvider();
+}
+
+MonotonicTimeProviderTest::~MonotonicTimeProviderTest() {
+}
+
+bool MonotonicTimeProviderTest::TestInitialise() {
+    MonotonicTimeProvider provider;
+    ConfigurationDatabase cdb;
+    bool ok = (provider.GetSpinTime() == 0u);
+    if (ok) {
+        ok = (provider.GetSleepPercentage() == 100u);
+    }
+    if (ok) {
+        ok = cdb.Write("SpinTime", 50);
+    }
+    if (ok) {
+        ok = provider.Initialise(cdb);
+    }
+    if (ok) {
+        ok = (provider.GetSpinTime() == 50000u);
+    }
+    if (ok) {
+        ok = (provider.GetSleepPercentage() == 100u);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestInitialise_False_SleepNature() {
+    MonotonicTimeProvider provider;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepNature", "Invalid");
+    if (ok) {
+        ok = !provider.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestBackwardCompatibilityInit() {
+    MonotonicTimeProvider provider;
+    ConfigurationDatabase cdb;
+    bool ok = cdb.Write("SleepNature", "Busy");
+    if (ok) {
+        ok = cdb.Write("SleepPercentage", 30);
+    }
+    if (ok) {
+        ok = provider.BackwardCompatibilityInit(cdb);
+    }
+    if (ok) {
+        ok = (provider.GetSleepPercentage() == 30u);
+    }
+    return ok;
+}
+
+bool MonotonicTimeProviderTest::TestSleep_AbsoluteDeadline() {
+    bool ok = (timeProvider != NULL);
+
+    if (ok) {
+        //Start 5 ms in the past, the deadline is 5 ms in the future
+        uint64 deltaTime = 10000000u;
+        uint64 startTime = timeProvider->Counter() - (deltaTime / 2u);
+        ok = timeProvider->Sleep(startTime, deltaTime);
+        uint64 endTime = timeProvider->Counter();
+        if (ok) {
+            ok = (endTime >= (startTime + deltaTime));
+        }
+        if (ok) {
+            //The time spent before Sleep was called must not have been added to the delta
+            ok = (endTime < (startTime + (2u * deltaTime)));
+        }
+        REPORT_ERROR_STATIC(ErrorManagement::Information, "Absolute deadline wake-up latency %d ns", (endTime - (startTime + deltaTime)));
+    }
+
+    return ok;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file MonotonicTimeProviderTest.h
+ * @brief Header file for class MonotonicTimeProviderTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing, 
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class MonotonicTimeProviderTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_
+#define LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "TimeProviderTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the MonotonicTimeProvider public methods.
+ */
+class MonotonicTimeProviderTest : public TimeProviderTest {
+    public:
+        MonotonicTimeProviderTest();
+        ~MonotonicTimeProviderTest();
+
+        /**
+         * @brief Tests the Initialise method with the SpinTime parameter.
+         */
+        bool TestInitialise();
+
+        /**
+         * @brief Tests that the Initialise method fails with an invalid SleepNature.
+         */
+        bool TestInitialise_False_SleepNature();
+
+        /**
+         * @brief Tests the BackwardCompatibilityInit method with SleepNature = Busy.
+         */
+        bool TestBackwardCompatibilityInit();
+
+        /**
+         * @brief Tests that the Sleep method waits until start + delta, even if start is in the past.
+         */
+        bool TestSleep_AbsoluteDeadline();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* LINUXTIMERTEST_MONOTONICTIMEPROVIDERTEST_H_ */
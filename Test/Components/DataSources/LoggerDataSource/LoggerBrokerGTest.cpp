@@ -56,6 +56,31 @@ TEST(LoggerBrokerGTest,TestExecute) {
     ASSERT_TRUE(test.TestExecute());
 }
 
+TEST(LoggerBrokerGTest,TestSetDeferred) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestSetDeferred());
+}
+
+TEST(LoggerBrokerGTest,TestSetDeferred_False) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestSetDeferred_False());
+}
+
+TEST(LoggerBrokerGTest,TestExecute_Deferred) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Deferred());
+}
+
+TEST(LoggerBrokerGTest,TestFlush) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestFlush());
+}
+
+TEST(LoggerBrokerGTest,TestGetNumberOfDroppedEntries) {
+    LoggerBrokerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfDroppedEntries());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -39,6 +39,7 @@
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
 #include "StandardParser.h"
+#include "StringHelper.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
@@ -166,6 +167,113 @@ void LoggerBrokerTestErrorProcessFunction(const MARTe::ErrorManagement::ErrorInf
     lastError += errorDescription;
 }
 
+/**
+ * Configuration with the logging deferred (the %d are replaced by the QueueSize).
+ */
+static const MARTe::char8 * const deferredConfig = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = LoggerBrokerTestGAM"
+        "            OutputSignals = {"
+        "                Signal1 = {"
+        "                    DataSource = LoggerDS"
+        "                    Type = uint32"
+        "                }"
+        "                Signal2 = {"
+        "                    DataSource = LoggerDS"
+        "                    Type = uint32"
+        "                    NumberOfElements = 8"
+        "                    Ranges = {{1 2}}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +LoggerDS = {"
+        "            Class = LoggerDataSource"
+        "            Deferred = 1"
+        "            QueueSize = %d"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = LoggerBrokerTestScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+/**
+ * Configures the deferredConfig application and gets the LoggerBroker of GAMA.
+ */
+static bool LoggerBrokerTestConfigureDeferred(const MARTe::uint32 queueSize,
+                                              MARTe::ReferenceT<LoggerBrokerTestScheduler> &scheduler,
+                                              MARTe::ReferenceT<MARTe::LoggerBroker> &broker) {
+    using namespace MARTe;
+    StreamString configStream;
+    bool ok = configStream.Printf(deferredConfig, queueSize);
+    ConfigurationDatabase cdb;
+    if (ok) {
+        configStream.Seek(0);
+        StandardParser parser(configStream, cdb);
+        ok = parser.Parse();
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    if (ok) {
+        scheduler = application->Find("Scheduler");
+        ok = scheduler.IsValid();
+    }
+    ReferenceT<GAM> gam;
+    if (ok) {
+        gam = application->Find("Functions.GAMA");
+        ok = gam.IsValid();
+    }
+    ReferenceContainer brokers;
+    if (ok) {
+        ok = gam->GetOutputBrokers(brokers);
+    }
+    if (ok) {
+        broker = brokers.Get(0u);
+        ok = broker.IsValid();
+    }
+    if (ok) {
+        scheduler->PrepareNextState("", "State1");
+        ok = (application->StartNextStateExecution() == ErrorManagement::NoError);
+    }
+    return ok;
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -293,3 +401,127 @@ bool LoggerBrokerTest::TestInit() {
 bool LoggerBrokerTest::TestExecute() {
     return TestInit();
 }
+
+bool LoggerBrokerTest::TestSetDeferred() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerBroker> broker;
+    bool ok = LoggerBrokerTestConfigureDeferred(4u, scheduler, broker);
+    if (ok) {
+        //Already allocated by the LoggerDataSource
+        ok = !broker->SetDeferred(4u);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoggerBrokerTest::TestSetDeferred_False() {
+    using namespace MARTe;
+    LoggerBroker broker;
+    bool ok = !broker.SetDeferred(4u);
+    if (ok) {
+        ReferenceT<LoggerBrokerTestScheduler> scheduler;
+        ReferenceT<LoggerBroker> deferredBroker;
+        ok = LoggerBrokerTestConfigureDeferred(0u, scheduler, deferredBroker);
+        ok = !ok;
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoggerBrokerTest::TestExecute_Deferred() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerBroker> broker;
+    bool ok = LoggerBrokerTestConfigureDeferred(4u, scheduler, broker);
+    if (ok) {
+        lastError = "";
+        ErrorManagement::ErrorProcessFunctionType currentErrorMessageProcessFunction = MARTe::ErrorManagement::errorMessageProcessFunction;
+        SetErrorProcessFunction(&LoggerBrokerTestErrorProcessFunction);
+        scheduler->ExecuteThreadCycle(0);
+        //Nothing is printed from the real-time thread
+        ok = (lastError.Size() == 0u);
+        if (ok) {
+            broker->Flush();
+            ok = (StringHelper::SearchString(lastError.Buffer(), "Signal1 [0:0]:1 (t = ") != NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(lastError.Buffer(), "Signal2 [1:2]:{ 2 3 }") != NULL_PTR(const char8 *));
+        }
+        SetErrorProcessFunction(currentErrorMessageProcessFunction);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoggerBrokerTest::TestFlush() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerBroker> broker;
+    bool ok = LoggerBrokerTestConfigureDeferred(4u, scheduler, broker);
+    if (ok) {
+        ErrorManagement::ErrorProcessFunctionType currentErrorMessageProcessFunction = MARTe::ErrorManagement::errorMessageProcessFunction;
+        SetErrorProcessFunction(&LoggerBrokerTestErrorProcessFunction);
+        uint32 c;
+        for (c = 0u; c < 3u; c++) {
+            scheduler->ExecuteThreadCycle(0);
+        }
+        lastError = "";
+        broker->Flush();
+        //Two copies per cycle
+        uint32 nOfMessages = 0u;
+        const char8 *message = StringHelper::SearchString(lastError.Buffer(), "(t = ");
+        while (message != NULL_PTR(const char8 *)) {
+            nOfMessages++;
+            message = StringHelper::SearchString(&message[1], "(t = ");
+        }
+        ok = (nOfMessages == 6u);
+        if (ok) {
+            //Nothing left to be printed
+            lastError = "";
+            broker->Flush();
+            ok = (lastError.Size() == 0u);
+        }
+        SetErrorProcessFunction(currentErrorMessageProcessFunction);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool LoggerBrokerTest::TestGetNumberOfDroppedEntries() {
+    using namespace MARTe;
+    ReferenceT<LoggerBrokerTestScheduler> scheduler;
+    ReferenceT<LoggerBroker> broker;
+    bool ok = LoggerBrokerTestConfigureDeferred(2u, scheduler, broker);
+    if (ok) {
+        ok = (broker->GetNumberOfDroppedEntries() == 0u);
+    }
+    if (ok) {
+        ErrorManagement::ErrorProcessFunctionType currentErrorMessageProcessFunction = MARTe::ErrorManagement::errorMessageProcessFunction;
+        SetErrorProcessFunction(&LoggerBrokerTestErrorProcessFunction);
+        uint32 c;
+        for (c = 0u; c < 5u; c++) {
+            scheduler->ExecuteThreadCycle(0);
+        }
+        ok = (broker->GetNumberOfDroppedEntries() == 3u);
+        if (ok) {
+            lastError = "";
+            broker->Flush();
+            ok = (StringHelper::SearchString(lastError.Buffer(), "3 cycles were not logged") != NULL_PTR(const char8 *));
+        }
+        if (ok) {
+            //There is space again in the queue
+            scheduler->ExecuteThreadCycle(0);
+            ok = (broker->GetNumberOfDroppedEntries() == 3u);
+        }
+        if (ok) {
+            //The drops are only reported once
+            lastError = "";
+            broker->Flush();
+            ok = (StringHelper::SearchString(lastError.Buffer(), "cycles were not logged") == NULL_PTR(const char8 *));
+        }
+        SetErrorProcessFunction(currentErrorMessageProcessFunction);
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -55,6 +55,31 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute();
+
+    /**
+     * @brief Tests the SetDeferred method.
+     */
+    bool TestSetDeferred();
+
+    /**
+     * @brief Tests that the SetDeferred method fails if the broker was not initialised or if the number of entries is 0.
+     */
+    bool TestSetDeferred_False();
+
+    /**
+     * @brief Tests the Execute method with the logging deferred to the LoggerDataSource thread.
+     */
+    bool TestExecute_Deferred();
+
+    /**
+     * @brief Tests the Flush method.
+     */
+    bool TestFlush();
+
+    /**
+     * @brief Tests the GetNumberOfDroppedEntries method.
+     */
+    bool TestGetNumberOfDroppedEntries();
 };
 
 
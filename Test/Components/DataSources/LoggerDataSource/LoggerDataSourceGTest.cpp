@@ -91,6 +91,21 @@ TEST(LoggerDataSourceGTest,TestInitialise) {
     ASSERT_TRUE(test.TestInitialise());
 }
 
+TEST(LoggerDataSourceGTest,TestInitialise_Deferred) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_Deferred());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_QueueSize) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_QueueSize());
+}
+
+TEST(LoggerDataSourceGTest,TestInitialise_False_QueueSize_NotDeferred) {
+    LoggerDataSourceTest test;
+    ASSERT_TRUE(test.TestInitialise_False_QueueSize_NotDeferred());
+}
+
 
 
 /*---------------------------------------------------------------------------*/
@@ -208,3 +208,30 @@ bool LoggerDataSourceTest::TestInitialise() {
     ConfigurationDatabase cdb;
     return lds.Initialise(cdb);
 }
+
+bool LoggerDataSourceTest::TestInitialise_Deferred() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("QueueSize", 16);
+    cdb.Write("FlushPeriod", 5);
+    return lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_QueueSize() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("Deferred", 1);
+    cdb.Write("QueueSize", 0);
+    return !lds.Initialise(cdb);
+}
+
+bool LoggerDataSourceTest::TestInitialise_False_QueueSize_NotDeferred() {
+    using namespace MARTe;
+    LoggerDataSource lds;
+    ConfigurationDatabase cdb;
+    cdb.Write("QueueSize", 16);
+    return !lds.Initialise(cdb);
+}
@@ -90,6 +90,21 @@ public:
      * @brief Tests the Initialise method.
      */
     bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with Deferred = 1.
+     */
+    bool TestInitialise_Deferred();
+
+    /**
+     * @brief Tests that the Initialise method fails with Deferred = 1 and QueueSize = 0.
+     */
+    bool TestInitialise_False_QueueSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if the QueueSize is set without Deferred = 1.
+     */
+    bool TestInitialise_False_QueueSize_NotDeferred();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -50,6 +50,16 @@ TEST(OPCUAClientReadGTest,Test_SetServiceRequest) {
     ASSERT_TRUE(test.Test_SetServiceRequest());
 }
 
+TEST(OPCUAClientReadGTest,Test_Monitor) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_Monitor());
+}
+
+TEST(OPCUAClientReadGTest,Test_Monitor_False_NoServiceRequest) {
+    OPCUAClientReadTest test;
+    ASSERT_TRUE(test.Test_Monitor_False_NoServiceRequest());
+}
+
 TEST(OPCUAClientReadGTest,Test_GetExtensionObjectByteString) {
     OPCUAClientReadTest test;
     ASSERT_TRUE(test.Test_GetExtensionObjectByteString());
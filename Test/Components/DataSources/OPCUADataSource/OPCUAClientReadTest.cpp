@@ -89,6 +89,82 @@ bool OPCUAClientReadTest::Test_SetServiceRequest() {
     return ok;
 }
 
+bool OPCUAClientReadTest::Test_Monitor() {
+    using namespace MARTe;
+    StreamString config = ""
+            "+ServerTest = {"
+            "     Class = OPCUA::OPCUAServer"
+            "     AddressSpace = {"
+            "         MyNode = {"
+            "             Type = uint32"
+            "         }"
+            "     }"
+            "}";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    StreamString *path = new StreamString("MyNode");
+    uint16 ns = 1;
+    uint16 *nsp = &ns;
+    const uint32 nOfNodes = 1u;
+    TypeDescriptor types[] = { UnsignedInteger32Bit };
+    uint32 nElements[] = { 1u };
+    OPCUAClientRead ocr;
+    ocr.SetServerAddress("opc.tcp://localhost:4840");
+    if (ok) {
+        ok = ocr.Connect();
+    }
+    Sleep::MSec(200);
+    if (ok) {
+        ok = ocr.SetServiceRequest(nsp, path, nOfNodes);
+    }
+    uint32 *value = NULL_PTR(uint32*);
+    if (ok) {
+        ocr.SetValueMemories(nOfNodes);
+        void *mem = NULL_PTR(void*);
+        ok = ocr.GetSignalMemory(mem, 0u, types[0], nElements[0]);
+        value = reinterpret_cast<uint32*>(mem);
+    }
+    if (ok) {
+        *value = 0xFFFFFFFFu;
+        ok = ocr.Monitor(10.0, 1u, &types[0], &nElements[0]);
+    }
+    if (ok) {
+        /* The server always notifies the initial value of a new MonitoredItem */
+        uint32 timeout = 100u;
+        while ((ocr.GetNumberOfNotifications() == 0u) && (timeout > 0u) && (ok)) {
+            ok = ocr.Iterate(10u);
+            timeout--;
+        }
+    }
+    if (ok) {
+        ok = (ocr.GetNumberOfNotifications() > 0u);
+    }
+    if (ok) {
+        ok = ocr.GetLatestValues();
+    }
+    if (ok) {
+        ok = (*value == 0u);
+    }
+    delete path;
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUAClientReadTest::Test_Monitor_False_NoServiceRequest() {
+    using namespace MARTe;
+    TypeDescriptor types[] = { UnsignedInteger32Bit };
+    uint32 nElements[] = { 1u };
+    OPCUAClientRead ocr;
+    return !ocr.Monitor(10.0, 1u, &types[0], &nElements[0]);
+}
+
 bool OPCUAClientReadTest::Test_GetExtensionObjectByteString() {
     using namespace MARTe;
     OPCUATestServer ots;
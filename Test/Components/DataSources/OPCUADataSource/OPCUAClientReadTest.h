@@ -49,6 +49,16 @@ public:
 
     bool Test_SetServiceRequest();
 
+    /**
+     * @brief Tests that the initial value of a MonitoredItem is received by Iterate and copied by GetLatestValues.
+     */
+    bool Test_Monitor();
+
+    /**
+     * @brief Tests that Monitor fails if SetServiceRequest was not called.
+     */
+    bool Test_Monitor_False_NoServiceRequest();
+
     bool Test_GetExtensionObjectByteString();
 
     bool Test_Read_Single();
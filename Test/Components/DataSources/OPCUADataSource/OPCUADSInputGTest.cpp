@@ -131,5 +131,17 @@ TEST(OPCUADSInputGTest,Test_SetConfiguredDatabase_ExtensionObject) {
     ASSERT_TRUE(test.Test_SetConfiguredDatabase_ExtensionObject());
 }
 
+TEST(OPCUADSInputGTest,TestInitialise_Monitor_QueueSize) {
+    OPCUADSInputTest test;
+    ASSERT_TRUE(test.TestInitialise_Monitor_QueueSize());
+}
 
-	
+TEST(OPCUADSInputGTest,TestInitialise_False_Monitor_QueueSize) {
+    OPCUADSInputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Monitor_QueueSize());
+}
+
+TEST(OPCUADSInputGTest,TestInitialise_False_Monitor_ExtensionObject) {
+    OPCUADSInputTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Monitor_ExtensionObject());
+}
@@ -2238,3 +2238,69 @@ bool OPCUADSInputTest::Test_SetConfiguredDatabase_ExtensionObject() {
     return ok;
 }
 
+static bool InitialiseMonitorDataSource(const MARTe::char8 *const parameters,
+                                        MARTe::OPCUADSInput &ds) {
+    using namespace MARTe;
+    StreamString config = ""
+            "Address = \"opc.tcp://localhost.localdomain:4840\"\n"
+            "ReadMode = \"Monitor\"\n";
+    config += parameters;
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ds.Initialise(cdb);
+    }
+    return ok;
+}
+
+bool OPCUADSInputTest::TestInitialise_Monitor_QueueSize() {
+    using namespace MARTe;
+    OPCUADSInput ds;
+    bool ok = InitialiseMonitorDataSource(""
+            "SamplingTime = 10\n"
+            "QueueSize = 4\n"
+            "Signals = {\n"
+            "    MyNode = {\n"
+            "        NamespaceIndex = 1\n"
+            "        Path = MyNode\n"
+            "        Type = uint32\n"
+            "    }\n"
+            "}\n", ds);
+    if (ok) {
+        ok = (ds.GetQueueSize() == 4u);
+    }
+    return ok;
+}
+
+bool OPCUADSInputTest::TestInitialise_False_Monitor_QueueSize() {
+    using namespace MARTe;
+    OPCUADSInput ds;
+    return !InitialiseMonitorDataSource(""
+            "QueueSize = 0\n"
+            "Signals = {\n"
+            "    MyNode = {\n"
+            "        NamespaceIndex = 1\n"
+            "        Path = MyNode\n"
+            "        Type = uint32\n"
+            "    }\n"
+            "}\n", ds);
+}
+
+bool OPCUADSInputTest::TestInitialise_False_Monitor_ExtensionObject() {
+    using namespace MARTe;
+    OPCUADSInput ds;
+    return !InitialiseMonitorDataSource(""
+            "Signals = {\n"
+            "    MyNode = {\n"
+            "        NamespaceIndex = 1\n"
+            "        Path = MyNode\n"
+            "        Type = uint32\n"
+            "        ExtensionObject = \"yes\"\n"
+            "    }\n"
+            "}\n", ds);
+}
@@ -131,6 +131,21 @@ public:
      */
     bool Test_SetConfiguredDatabase_ExtensionObject();
 
+    /**
+     * @brief Tests the Initialise method with ReadMode = "Monitor" and a valid QueueSize.
+     */
+    bool TestInitialise_Monitor_QueueSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with ReadMode = "Monitor" and QueueSize = 0.
+     */
+    bool TestInitialise_False_Monitor_QueueSize();
+
+    /**
+     * @brief Tests that the Initialise method fails with ReadMode = "Monitor" and ExtensionObject = "yes".
+     */
+    bool TestInitialise_False_Monitor_ExtensionObject();
+
 };
 
 
@@ -0,0 +1,88 @@
+/**
+ * @file OPCUADSServerGTest.cpp
+ * @brief Source file for class OPCUADSServerGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUADSServerGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "OPCUADSServerTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(OPCUADSServerGTest,TestConstructor) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(OPCUADSServerGTest,TestInitialise) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(OPCUADSServerGTest,TestInitialise_Defaults) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestInitialise_Defaults());
+}
+
+TEST(OPCUADSServerGTest,TestInitialise_False_SamplingInterval) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_SamplingInterval());
+}
+
+TEST(OPCUADSServerGTest,TestInitialise_False_PublishingInterval) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_PublishingInterval());
+}
+
+TEST(OPCUADSServerGTest,TestGetBrokerName) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestGetBrokerName());
+}
+
+TEST(OPCUADSServerGTest,TestSetConfiguredDatabase) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase());
+}
+
+TEST(OPCUADSServerGTest,TestSetConfiguredDatabase_False_NumberOfDimensions) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_NumberOfDimensions());
+}
+
+TEST(OPCUADSServerGTest,TestSynchronise) {
+    OPCUADSServerTest test;
+    ASSERT_TRUE(test.TestSynchronise());
+}
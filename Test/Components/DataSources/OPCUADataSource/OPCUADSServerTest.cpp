@@ -0,0 +1,319 @@
+/**
+ * @file OPCUADSServerTest.cpp
+ * @brief Source file for class OPCUADSServerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class OPCUADSServerTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+
+#include "ConfigurationDatabase.h"
+#include "ObjectRegistryDatabase.h"
+#include "OPCUADSServer.h"
+#include "OPCUADSServerTest.h"
+#include "RealTimeApplication.h"
+#include "ReferenceT.h"
+#include "StandardParser.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+static bool InitialiseServerDataSource(const MARTe::char8 *const parameters,
+                                       MARTe::OPCUADSServer &ds) {
+    using namespace MARTe;
+    StreamString config = parameters;
+    config += ""
+            "Signals = {\n"
+            "    Counter = {\n"
+            "        Type = uint32\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    if (ok) {
+        ok = ds.Initialise(cdb);
+    }
+    return ok;
+}
+
+static bool ConfigureServerApplication(const MARTe::char8 *const timeParameters) {
+    using namespace MARTe;
+    StreamString config = ""
+            "$Test = {\n"
+            "    Class = RealTimeApplication\n"
+            "    +Functions = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +GAMTimer = {\n"
+            "            Class = IOGAM\n"
+            "            InputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Frequency = 10\n"
+            "                    Type = uint32\n"
+            "                    DataSource = Timer\n"
+            "                }\n"
+            "            }\n"
+            "            OutputSignals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = OPCUAServer\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                    DataSource = OPCUAServer\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Data = {\n"
+            "        Class = ReferenceContainer\n"
+            "        DefaultDataSource = DDB1\n"
+            "        +DDB1 = {\n"
+            "            Class = GAMDataSource\n"
+            "        }\n"
+            "        +Timings = {\n"
+            "            Class = TimingDataSource\n"
+            "        }\n"
+            "        +OPCUAServer = {\n"
+            "            Class = OPCUADataSource::OPCUADSServer\n"
+            "            Port = 4852\n"
+            "            SamplingInterval = 10\n"
+            "            PublishingInterval = 10\n"
+            "            Signals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n";
+    config += timeParameters;
+    config += ""
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "        +Timer = {\n"
+            "            Class = LinuxTimer\n"
+            "            SleepNature = \"Default\"\n"
+            "            Signals = {\n"
+            "                Counter = {\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "                Time = {\n"
+            "                    Type = uint32\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +States = {\n"
+            "        Class = ReferenceContainer\n"
+            "        +State1 = {\n"
+            "            Class = RealTimeState\n"
+            "            +Threads = {\n"
+            "                Class = ReferenceContainer\n"
+            "                +Thread1 = {\n"
+            "                    Class = RealTimeThread\n"
+            "                    Functions = {GAMTimer}\n"
+            "                }\n"
+            "            }\n"
+            "        }\n"
+            "    }\n"
+            "    +Scheduler = {\n"
+            "        Class = GAMScheduler\n"
+            "        TimingDataSource = Timings\n"
+            "    }\n"
+            "}\n";
+    config.Seek(0LLU);
+    ConfigurationDatabase cdb;
+    StandardParser parser(config, cdb, NULL);
+    bool ok = parser.Parse();
+    cdb.MoveToRoot();
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> app;
+    if (ok) {
+        app = ord->Find("Test");
+        ok = app.IsValid();
+    }
+    if (ok) {
+        ok = app->ConfigureApplication();
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool OPCUADSServerTest::TestConstructor() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    bool ok = (ds.GetPort() == 4840u);
+    if (ok) {
+        ok = (ds.GetNumberOfReads() == 0u);
+    }
+    return ok;
+}
+
+bool OPCUADSServerTest::TestInitialise() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    bool ok = InitialiseServerDataSource(""
+            "Port = 4853\n"
+            "SamplingInterval = 5\n"
+            "PublishingInterval = 20\n", ds);
+    if (ok) {
+        ok = (ds.GetPort() == 4853u);
+    }
+    if (ok) {
+        ok = (ds.GetSamplingInterval() == 5.0);
+    }
+    if (ok) {
+        ok = (ds.GetPublishingInterval() == 20.0);
+    }
+    return ok;
+}
+
+bool OPCUADSServerTest::TestInitialise_Defaults() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    bool ok = InitialiseServerDataSource("", ds);
+    if (ok) {
+        ok = (ds.GetPort() == 4840u);
+    }
+    if (ok) {
+        ok = (ds.GetSamplingInterval() == 100.0);
+    }
+    if (ok) {
+        ok = (ds.GetPublishingInterval() == 100.0);
+    }
+    return ok;
+}
+
+bool OPCUADSServerTest::TestInitialise_False_SamplingInterval() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    return !InitialiseServerDataSource("SamplingInterval = 0\n", ds);
+}
+
+bool OPCUADSServerTest::TestInitialise_False_PublishingInterval() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    return !InitialiseServerDataSource("PublishingInterval = 0\n", ds);
+}
+
+bool OPCUADSServerTest::TestGetBrokerName() {
+    using namespace MARTe;
+    OPCUADSServer ds;
+    ConfigurationDatabase cdb;
+    StreamString brokerName = ds.GetBrokerName(cdb, OutputSignals);
+    bool ok = (brokerName == "MemoryMapSynchronisedOutputBroker");
+    if (ok) {
+        brokerName = ds.GetBrokerName(cdb, InputSignals);
+        ok = (brokerName == "");
+    }
+    return ok;
+}
+
+bool OPCUADSServerTest::TestSetConfiguredDatabase() {
+    using namespace MARTe;
+    bool ok = ConfigureServerApplication("");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool OPCUADSServerTest::TestSetConfiguredDatabase_False_NumberOfDimensions() {
+    using namespace MARTe;
+    bool ok = ConfigureServerApplication("NumberOfDimensions = 2\n");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return !ok;
+}
+
+bool OPCUADSServerTest::TestSynchronise() {
+    using namespace MARTe;
+    bool ok = ConfigureServerApplication("");
+    ReferenceT<OPCUADSServer> ds;
+    if (ok) {
+        ds = ObjectRegistryDatabase::Instance()->Find("Test.Data.OPCUAServer");
+        ok = ds.IsValid();
+    }
+    void *counterPtr = NULL_PTR(void*);
+    if (ok) {
+        ok = ds->GetSignalMemoryBuffer(0u, 0u, counterPtr);
+    }
+    if (ok) {
+        *reinterpret_cast<uint32*>(counterPtr) = 1234u;
+        ok = ds->Synchronise();
+    }
+    /* Let the server thread start listening */
+    Sleep::MSec(200);
+    UA_Client *client = UA_Client_new();
+    (void) UA_ClientConfig_setDefault(UA_Client_getConfig(client));
+    if (ok) {
+        ok = (UA_Client_connect(client, const_cast<char8*>("opc.tcp://localhost:4852")) == UA_STATUSCODE_GOOD);
+    }
+    UA_Variant value;
+    UA_Variant_init(&value);
+    if (ok) {
+        ok = (UA_Client_readValueAttribute(client, UA_NODEID_STRING(1, const_cast<char8*>("OPCUAServer.Counter")), &value) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = UA_Variant_hasScalarType(&value, &UA_TYPES[UA_TYPES_UINT32]);
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<UA_UInt32*>(value.data) == 1234u);
+    }
+    UA_Variant_clear(&value);
+    /* A new value is only served after the next Synchronise */
+    if (ok) {
+        *reinterpret_cast<uint32*>(counterPtr) = 4321u;
+        ok = ds->Synchronise();
+    }
+    if (ok) {
+        ok = (UA_Client_readValueAttribute(client, UA_NODEID_STRING(1, const_cast<char8*>("OPCUAServer.Counter")), &value) == UA_STATUSCODE_GOOD);
+    }
+    if (ok) {
+        ok = (*reinterpret_cast<UA_UInt32*>(value.data) == 4321u);
+    }
+    UA_Variant_clear(&value);
+    if (ok) {
+        ok = (ds->GetNumberOfReads() >= 2u);
+    }
+    (void) UA_Client_disconnect(client);
+    UA_Client_delete(client);
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
@@ -0,0 +1,93 @@
+/**
+ * @file OPCUADSServerTest.h
+ * @brief Header file for class OPCUADSServerTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class OPCUADSServerTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVERTEST_H_
+#define TEST_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVERTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the OPCUADSServer public methods.
+ */
+class OPCUADSServerTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests the Initialise method with default parameters.
+     */
+    bool TestInitialise_Defaults();
+
+    /**
+     * @brief Tests that the Initialise method fails with SamplingInterval = 0.
+     */
+    bool TestInitialise_False_SamplingInterval();
+
+    /**
+     * @brief Tests that the Initialise method fails with PublishingInterval = 0.
+     */
+    bool TestInitialise_False_PublishingInterval();
+
+    /**
+     * @brief Tests the GetBrokerName method.
+     */
+    bool TestGetBrokerName();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method.
+     */
+    bool TestSetConfiguredDatabase();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails with a multidimensional signal.
+     */
+    bool TestSetConfiguredDatabase_False_NumberOfDimensions();
+
+    /**
+     * @brief Tests that the values written by Synchronise are served to an OPCUA client.
+     */
+    bool TestSynchronise();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_DATASOURCES_OPCUADATASOURCE_OPCUADSSERVERTEST_H_ */
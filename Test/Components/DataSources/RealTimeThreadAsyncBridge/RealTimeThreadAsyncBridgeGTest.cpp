@@ -59,6 +59,21 @@ TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_GreaterNumberOfBuffers)
     ASSERT_TRUE(test.TestInitialise_False_GreaterNumberOfBuffers());
 }
 
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_LockFreeMode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_LockFreeMode());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_LockFreeMode_BlockingMode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LockFreeMode_BlockingMode());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestInitialise_False_LockFreeMode_NumberOfBuffers) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestInitialise_False_LockFreeMode_NumberOfBuffers());
+}
+
 TEST(RealTimeThreadAsyncBridgeGTest,TestSetConfiguredDatabase) {
     RealTimeThreadAsyncBridgeTest test;
     ASSERT_TRUE(test.TestSetConfiguredDatabase());
@@ -154,3 +169,18 @@ TEST(RealTimeThreadAsyncBridgeGTest,TestResetSignalValue) {
     RealTimeThreadAsyncBridgeTest test;
     ASSERT_TRUE(test.TestResetSignalValue());
 }
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestGetOffset_LockFreeMode) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestGetOffset_LockFreeMode());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestGetOutputOffset_LockFreeMode_Overrun) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestGetOutputOffset_LockFreeMode_Overrun());
+}
+
+TEST(RealTimeThreadAsyncBridgeGTest,TestPrepareNextState_False_LockFreeMode_WrittenCounter) {
+    RealTimeThreadAsyncBridgeTest test;
+    ASSERT_TRUE(test.TestPrepareNextState_False_LockFreeMode_WrittenCounter());
+}
@@ -561,6 +561,75 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Application with a RealTimeThreadAsyncBridge in LockFreeMode. GAMB reads the diagnostic counters.
+ */
+static const char8 * const lockFreeConfig = ""
+        "$Application1 = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAMA = {"
+        "            Class = RealTimeThreadAsyncBridgeTestGAMWriter"
+        "            OutputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "        +GAMB = {"
+        "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+        "            InputSignals = {"
+        "               Signal1 = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               ReadRetries = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "               WriteOverruns = {"
+        "                   DataSource = Drv1"
+        "                   Type = uint32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        +Drv1 = {"
+        "            Class = RealTimeThreadAsyncBridge"
+        "            NumberOfBuffers = 3"
+        "            LockFreeMode = 1"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMA}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAMB}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 RealTimeThreadAsyncBridgeTest::RealTimeThreadAsyncBridgeTest() {
 // Auto-generated constructor stub for RealTimeThreadAsyncBridgeTest
 // TODO Verify if manual additions are needed
@@ -625,6 +694,77 @@ bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_GreaterNumberOfBuffers(
     return ret;
 }
 
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_LockFreeMode() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            LockFreeMode = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = dataSource.Initialise(cdb);
+    }
+    if (ret) {
+        //one extra buffer for the overruns
+        ret = (dataSource.GetNumberOfMemoryBuffers() == 4u);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_LockFreeMode_BlockingMode() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 3"
+            "            BlockingMode = 1"
+            "            LockFreeMode = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = !dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestInitialise_False_LockFreeMode_NumberOfBuffers() {
+    RealTimeThreadAsyncBridgeTestDS dataSource;
+    const char8 *conf1 = "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridgeTestDS"
+            "            NumberOfBuffers = 1"
+            "            LockFreeMode = 1"
+            "        }";
+
+    ConfigurationDatabase cdb;
+    StreamString configStream = conf1;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+
+    bool ret = parser.Parse();
+    if (ret) {
+        cdb.MoveAbsolute("+Drv1");
+        ret = !dataSource.Initialise(cdb);
+    }
+
+    return ret;
+}
+
 bool RealTimeThreadAsyncBridgeTest::TestSetConfiguredDatabase() {
 
     static const char8 * const config = ""
@@ -2506,3 +2646,230 @@ bool RealTimeThreadAsyncBridgeTest::TestResetSignalValue() {
 
 }
 
+bool RealTimeThreadAsyncBridgeTest::TestGetOffset_LockFreeMode() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(lockFreeConfig);
+    ReferenceT<RealTimeThreadAsyncBridge> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("", "State1");
+    }
+    uint32 signalIdx = 0u;
+    if (ret) {
+        ret = dataSource->GetSignalIndex(signalIdx, "Signal1");
+    }
+    uint32 *mem = NULL;
+    if (ret) {
+        ret = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, (void*&) mem);
+    }
+    //the writer never writes on the last published buffer and the readers always get the last published buffer
+    uint32 expectedBuffer = 0u;
+    for (uint32 n = 0u; (n < 10u) && (ret); n++) {
+        uint32 writeOffset = 0u;
+        ret = dataSource->GetOutputOffset(signalIdx, 1u, writeOffset);
+        if (ret) {
+            expectedBuffer = ((expectedBuffer + 1u) % 3u);
+            ret = (writeOffset == (expectedBuffer * sizeof(uint32)));
+        }
+        if (ret) {
+            mem[writeOffset / sizeof(uint32)] = (n + 10u);
+            ret = dataSource->TerminateOutputCopy(signalIdx, writeOffset, 1u);
+        }
+        uint32 readOffset = 0u;
+        if (ret) {
+            ret = dataSource->GetInputOffset(signalIdx, 1u, readOffset);
+        }
+        if (ret) {
+            ret = (readOffset == writeOffset);
+        }
+        if (ret) {
+            ret = (mem[readOffset / sizeof(uint32)] == (n + 10u));
+        }
+        if (ret) {
+            ret = dataSource->TerminateInputCopy(signalIdx, readOffset, 1u);
+        }
+    }
+    if (ret) {
+        ret = (dataSource->GetReadRetries() == 0u);
+    }
+    if (ret) {
+        ret = (dataSource->GetWriteOverruns() == 0u);
+    }
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestGetOutputOffset_LockFreeMode_Overrun() {
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(lockFreeConfig);
+    ReferenceT<RealTimeThreadAsyncBridge> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = dataSource->PrepareNextState("", "State1");
+    }
+    uint32 signalIdx = 0u;
+    uint32 overrunsSignalIdx = 0u;
+    if (ret) {
+        ret = dataSource->GetSignalIndex(signalIdx, "Signal1");
+    }
+    if (ret) {
+        ret = dataSource->GetSignalIndex(overrunsSignalIdx, "WriteOverruns");
+    }
+    uint32 *mem = NULL;
+    if (ret) {
+        ret = dataSource->GetSignalMemoryBuffer(signalIdx, 0u, (void*&) mem);
+    }
+    //publish three values and keep a reader on each of the three buffers
+    uint32 readOffsets[3];
+    for (uint32 n = 0u; (n < 3u) && (ret); n++) {
+        uint32 writeOffset = 0u;
+        ret = dataSource->GetOutputOffset(signalIdx, 1u, writeOffset);
+        if (ret) {
+            mem[writeOffset / sizeof(uint32)] = (n + 10u);
+            ret = dataSource->TerminateOutputCopy(signalIdx, writeOffset, 1u);
+        }
+        if (ret) {
+            ret = dataSource->GetInputOffset(signalIdx, 1u, readOffsets[n]);
+        }
+        if (ret) {
+            ret = (readOffsets[n] == writeOffset);
+        }
+    }
+    //the writer does not block and writes on the extra buffer
+    uint32 writeOffset = 0u;
+    if (ret) {
+        ret = dataSource->GetOutputOffset(signalIdx, 1u, writeOffset);
+    }
+    if (ret) {
+        ret = (writeOffset == (3u * sizeof(uint32)));
+    }
+    if (ret) {
+        mem[writeOffset / sizeof(uint32)] = 100u;
+        ret = dataSource->TerminateOutputCopy(signalIdx, writeOffset, 1u);
+    }
+    if (ret) {
+        ret = (dataSource->GetWriteOverruns() == 1u);
+    }
+    //the lost value is not published
+    uint32 readOffset = 0u;
+    if (ret) {
+        ret = dataSource->GetInputOffset(signalIdx, 1u, readOffset);
+    }
+    if (ret) {
+        ret = (readOffset == readOffsets[2]);
+    }
+    if (ret) {
+        ret = (mem[readOffset / sizeof(uint32)] == 12u);
+    }
+    if (ret) {
+        ret = dataSource->TerminateInputCopy(signalIdx, readOffset, 1u);
+    }
+    for (uint32 n = 0u; (n < 3u) && (ret); n++) {
+        ret = dataSource->TerminateInputCopy(signalIdx, readOffsets[n], 1u);
+    }
+    //the counter is exposed as a signal
+    if (ret) {
+        ret = dataSource->GetInputOffset(overrunsSignalIdx, 1u, readOffset);
+    }
+    uint32 *overrunsMem = NULL;
+    if (ret) {
+        ret = dataSource->GetSignalMemoryBuffer(overrunsSignalIdx, 0u, (void*&) overrunsMem);
+    }
+    if (ret) {
+        ret = (overrunsMem[readOffset / sizeof(uint32)] == 1u);
+    }
+    if (ret) {
+        ret = dataSource->TerminateInputCopy(overrunsSignalIdx, readOffset, 1u);
+    }
+    //with the readers gone the writer publishes again
+    if (ret) {
+        ret = dataSource->GetOutputOffset(signalIdx, 1u, writeOffset);
+    }
+    if (ret) {
+        ret = (writeOffset < (3u * sizeof(uint32)));
+    }
+    if (ret) {
+        ret = dataSource->TerminateOutputCopy(signalIdx, writeOffset, 1u);
+    }
+    if (ret) {
+        ret = (dataSource->GetWriteOverruns() == 1u);
+    }
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
+
+bool RealTimeThreadAsyncBridgeTest::TestPrepareNextState_False_LockFreeMode_WrittenCounter() {
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAMWriter"
+            "            OutputSignals = {"
+            "               WriteOverruns = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "        +GAMB = {"
+            "            Class = RealTimeThreadAsyncBridgeTestGAM1"
+            "            InputSignals = {"
+            "               WriteOverruns = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint32"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +Drv1 = {"
+            "            Class = RealTimeThreadAsyncBridge"
+            "            NumberOfBuffers = 3"
+            "            LockFreeMode = 1"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "                +Thread2 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMB}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+    ReferenceT<RealTimeThreadAsyncBridge> dataSource;
+    if (ret) {
+        dataSource = ObjectRegistryDatabase::Instance()->Find("Application1.Data.Drv1");
+        ret = dataSource.IsValid();
+    }
+    if (ret) {
+        ret = !dataSource->PrepareNextState("", "State1");
+    }
+    MARTe::ObjectRegistryDatabase::Instance()->Purge();
+    return ret;
+}
@@ -69,6 +69,21 @@ public:
      */
     bool TestInitialise_False_GreaterNumberOfBuffers();
 
+    /**
+     * @brief Tests the Initialise method with LockFreeMode set
+     */
+    bool TestInitialise_LockFreeMode();
+
+    /**
+     * @brief Tests the Initialise method that fails if both LockFreeMode and BlockingMode are set
+     */
+    bool TestInitialise_False_LockFreeMode_BlockingMode();
+
+    /**
+     * @brief Tests the Initialise method that fails if LockFreeMode is set with less than two buffers
+     */
+    bool TestInitialise_False_LockFreeMode_NumberOfBuffers();
+
     /**
      * @brief Tests the SetConfiguredDatabase method
      */
@@ -166,6 +181,22 @@ public:
      */
     bool TestResetSignalValue();
 
+    /**
+     * @brief Tests the GetOutputOffset and GetInputOffset methods in LockFreeMode
+     */
+    bool TestGetOffset_LockFreeMode();
+
+    /**
+     * @brief Tests that in LockFreeMode the GetOutputOffset method does not fail if all the buffers are being read
+     * and that the overrun is counted
+     */
+    bool TestGetOutputOffset_LockFreeMode_Overrun();
+
+    /**
+     * @brief Tests the PrepareNextState method that fails in LockFreeMode if a GAM writes a diagnostic counter
+     */
+    bool TestPrepareNextState_False_LockFreeMode_WrittenCounter();
+
 };
 
 /*---------------------------------------------------------------------------*/
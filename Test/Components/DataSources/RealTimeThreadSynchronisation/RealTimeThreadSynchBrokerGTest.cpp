@@ -73,3 +73,23 @@ TEST(RealTimeThreadSynchBrokerGTest,TestExecute) {
     RealTimeThreadSynchBrokerTest test;
     ASSERT_TRUE(test.TestExecute());
 }
+
+TEST(RealTimeThreadSynchBrokerGTest,TestSetRing) {
+    RealTimeThreadSynchBrokerTest test;
+    ASSERT_TRUE(test.TestSetRing());
+}
+
+TEST(RealTimeThreadSynchBrokerGTest,TestNotify) {
+    RealTimeThreadSynchBrokerTest test;
+    ASSERT_TRUE(test.TestNotify());
+}
+
+TEST(RealTimeThreadSynchBrokerGTest,TestGetNumberOfSamples) {
+    RealTimeThreadSynchBrokerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSamples());
+}
+
+TEST(RealTimeThreadSynchBrokerGTest,TestExecute_Ring) {
+    RealTimeThreadSynchBrokerTest test;
+    ASSERT_TRUE(test.TestExecute_Ring());
+}
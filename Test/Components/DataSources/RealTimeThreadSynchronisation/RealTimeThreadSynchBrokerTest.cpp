@@ -75,3 +75,27 @@ bool RealTimeThreadSynchBrokerTest::TestExecute() {
     RealTimeThreadSynchronisationTest test;
     return test.TestSynchronise();
 }
+
+bool RealTimeThreadSynchBrokerTest::TestSetRing() {
+    RealTimeThreadSynchronisationTest test;
+    return test.TestSetConfiguredDatabase_RingBuffer();
+}
+
+bool RealTimeThreadSynchBrokerTest::TestNotify() {
+    RealTimeThreadSynchronisationTest test;
+    return test.TestSynchronise_RingBuffer();
+}
+
+bool RealTimeThreadSynchBrokerTest::TestGetNumberOfSamples() {
+    RealTimeThreadSynchronisationTest test;
+    return test.TestSetConfiguredDatabase_False_RingBufferSize();
+}
+
+bool RealTimeThreadSynchBrokerTest::TestExecute_Ring() {
+    RealTimeThreadSynchronisationTest test;
+    bool ok = test.TestSynchronise_RingBuffer();
+    if (ok) {
+        ok = test.TestSynchronise_RingBuffer_BusyPoll();
+    }
+    return ok;
+}
@@ -76,6 +76,26 @@ public:
      * @brief Tests the Execute method.
      */
     bool TestExecute();
+
+    /**
+     * @brief Tests the SetRing method.
+     */
+    bool TestSetRing();
+
+    /**
+     * @brief Tests the Notify method.
+     */
+    bool TestNotify();
+
+    /**
+     * @brief Tests the GetNumberOfSamples method.
+     */
+    bool TestGetNumberOfSamples();
+
+    /**
+     * @brief Tests the Execute method reading from the ring.
+     */
+    bool TestExecute_Ring();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -0,0 +1,76 @@
+/**
+ * @file RealTimeThreadSynchRingGTest.cpp
+ * @brief Source file for class RealTimeThreadSynchRingGTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeThreadSynchRingGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                          Standard header includes                         */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                          Project header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeThreadSynchRingTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                             Static definitions                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                             Method definitions                            */
+/*---------------------------------------------------------------------------*/
+
+TEST(RealTimeThreadSynchRingGTest,TestConstructor) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestInitialise) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestInitialise_False_ZeroSize) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestInitialise_False_ZeroSize());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestInitialise_False_Twice) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestInitialise_False_Twice());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestWrite) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestWrite());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestBeginRead_False_Overwritten) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestBeginRead_False_Overwritten());
+}
+
+TEST(RealTimeThreadSynchRingGTest,TestEndRead_False_Overwritten) {
+    RealTimeThreadSynchRingTest test;
+    ASSERT_TRUE(test.TestEndRead_False_Overwritten());
+}
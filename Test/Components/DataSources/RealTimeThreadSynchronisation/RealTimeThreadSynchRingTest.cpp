@@ -0,0 +1,188 @@
+/**
+ * @file RealTimeThreadSynchRingTest.cpp
+ * @brief Source file for class RealTimeThreadSynchRingTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class RealTimeThreadSynchRingTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                          Standard header includes                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                          Project header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeThreadSynchRingTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                             Static definitions                            */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * Writes a sample where all the bytes are equal to the (truncated) sample index.
+ */
+static void WriteTestSample(MARTe::RealTimeThreadSynchRing &ring,
+                            const MARTe::uint32 sampleSize,
+                            const MARTe::uint32 sample) {
+    using namespace MARTe;
+    char8 source[32];
+    uint32 i;
+    for (i = 0u; i < sampleSize; i++) {
+        source[i] = static_cast<char8>(sample);
+    }
+    ring.Write(&source[0]);
+}
+
+/**
+ * Reads a sample and checks that all the bytes are equal to the (truncated) sample index.
+ */
+static bool ReadTestSample(const MARTe::RealTimeThreadSynchRing &ring,
+                           const MARTe::uint32 sampleSize,
+                           const MARTe::uint32 sample) {
+    using namespace MARTe;
+    int32 sequence = 0;
+    const char8 *data = NULL_PTR(const char8 *);
+    bool ok = ring.BeginRead(sample, sequence, data);
+    uint32 i;
+    for (i = 0u; (i < sampleSize) && (ok); i++) {
+        ok = (data[i] == static_cast<char8>(sample));
+    }
+    if (ok) {
+        ok = ring.EndRead(sample, sequence);
+    }
+    return ok;
+}
+
+/*---------------------------------------------------------------------------*/
+/*                             Method definitions                            */
+/*---------------------------------------------------------------------------*/
+
+bool RealTimeThreadSynchRingTest::TestConstructor() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    bool ok = (ring.GetNumberOfSlots() == 0u);
+    if (ok) {
+        ok = (ring.GetNumberOfWrittenSamples() == 0u);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestInitialise() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    bool ok = ring.Initialise(12u, 5u);
+    if (ok) {
+        ok = (ring.GetNumberOfSlots() == 8u);
+    }
+    if (ok) {
+        ok = (ring.GetNumberOfWrittenSamples() == 0u);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestInitialise_False_ZeroSize() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring1;
+    RealTimeThreadSynchRing ring2;
+    bool ok = !ring1.Initialise(0u, 4u);
+    if (ok) {
+        ok = !ring2.Initialise(4u, 0u);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestInitialise_False_Twice() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    bool ok = ring.Initialise(4u, 4u);
+    if (ok) {
+        ok = !ring.Initialise(4u, 4u);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestWrite() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    const uint32 sampleSize = 20u;
+    bool ok = ring.Initialise(sampleSize, 4u);
+    uint32 n;
+    for (n = 0u; (n < 10u) && (ok); n++) {
+        WriteTestSample(ring, sampleSize, n);
+        ok = (ring.GetNumberOfWrittenSamples() == (n + 1u));
+        //All the samples still in the ring can be read
+        uint32 first = 0u;
+        if (n >= 4u) {
+            first = (n - 3u);
+        }
+        uint32 s;
+        for (s = first; (s <= n) && (ok); s++) {
+            ok = ReadTestSample(ring, sampleSize, s);
+        }
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestBeginRead_False_Overwritten() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    const uint32 sampleSize = 8u;
+    bool ok = ring.Initialise(sampleSize, 4u);
+    int32 sequence = 0;
+    const char8 *data = NULL_PTR(const char8 *);
+    //Not yet written
+    if (ok) {
+        ok = !ring.BeginRead(0u, sequence, data);
+    }
+    uint32 n;
+    for (n = 0u; (n < 5u) && (ok); n++) {
+        WriteTestSample(ring, sampleSize, n);
+    }
+    //Sample 0 was overwritten by sample 4
+    if (ok) {
+        ok = !ring.BeginRead(0u, sequence, data);
+    }
+    if (ok) {
+        ok = ReadTestSample(ring, sampleSize, 4u);
+    }
+    return ok;
+}
+
+bool RealTimeThreadSynchRingTest::TestEndRead_False_Overwritten() {
+    using namespace MARTe;
+    RealTimeThreadSynchRing ring;
+    const uint32 sampleSize = 8u;
+    bool ok = ring.Initialise(sampleSize, 2u);
+    int32 sequence = 0;
+    const char8 *data = NULL_PTR(const char8 *);
+    if (ok) {
+        WriteTestSample(ring, sampleSize, 0u);
+        ok = ring.BeginRead(0u, sequence, data);
+    }
+    if (ok) {
+        WriteTestSample(ring, sampleSize, 1u);
+        //The slot of sample 0 was not touched
+        ok = ring.EndRead(0u, sequence);
+    }
+    if (ok) {
+        WriteTestSample(ring, sampleSize, 2u);
+        ok = !ring.EndRead(0u, sequence);
+    }
+    return ok;
+}
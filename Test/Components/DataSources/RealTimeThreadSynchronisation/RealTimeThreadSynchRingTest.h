@@ -0,0 +1,84 @@
+/**
+ * @file RealTimeThreadSynchRingTest.h
+ * @brief Header file for class RealTimeThreadSynchRingTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class RealTimeThreadSynchRingTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef REALTIMETHREADSYNCHRINGTEST_H_
+#define REALTIMETHREADSYNCHRINGTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                          Standard header includes                         */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                          Project header includes                          */
+/*---------------------------------------------------------------------------*/
+#include "RealTimeThreadSynchRing.h"
+
+/*---------------------------------------------------------------------------*/
+/*                             Class declaration                             */
+/*---------------------------------------------------------------------------*/
+/**
+ * @brief Tests the RealTimeThreadSynchRing public methods.
+ */
+class RealTimeThreadSynchRingTest {
+public:
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method and that the number of slots is rounded up to a power of two.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails with a zero sample size or number of slots.
+     */
+    bool TestInitialise_False_ZeroSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if called twice.
+     */
+    bool TestInitialise_False_Twice();
+
+    /**
+     * @brief Tests the Write method and that all the written samples can be read while they are not overwritten.
+     */
+    bool TestWrite();
+
+    /**
+     * @brief Tests that the BeginRead method fails for a sample already overwritten or not yet written.
+     */
+    bool TestBeginRead_False_Overwritten();
+
+    /**
+     * @brief Tests that the EndRead method fails if the sample is overwritten after BeginRead.
+     */
+    bool TestEndRead_False_Overwritten();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                         Inline method definitions                         */
+/*---------------------------------------------------------------------------*/
+
+#endif /* REALTIMETHREADSYNCHRINGTEST_H_ */
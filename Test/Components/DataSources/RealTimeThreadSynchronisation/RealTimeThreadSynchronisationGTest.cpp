@@ -144,4 +144,32 @@ TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_WaitForNext) {
     ASSERT_TRUE(test.TestSetConfiguredDatabase_WaitForNext());
 }
 
-	
+TEST(RealTimeThreadSynchronisationGTest,TestInitialise_False_RingBufferSize) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestInitialise_False_RingBufferSize());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestInitialise_False_BusyPoll) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestInitialise_False_BusyPoll());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_RingBuffer) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_RingBuffer());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSetConfiguredDatabase_False_RingBufferSize) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSetConfiguredDatabase_False_RingBufferSize());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_RingBuffer) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_RingBuffer());
+}
+
+TEST(RealTimeThreadSynchronisationGTest,TestSynchronise_RingBuffer_BusyPoll) {
+    RealTimeThreadSynchronisationTest test;
+    ASSERT_TRUE(test.TestSynchronise_RingBuffer_BusyPoll());
+}
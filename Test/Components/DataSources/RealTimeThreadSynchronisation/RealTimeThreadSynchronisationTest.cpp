@@ -537,6 +537,479 @@ static const MARTe::char8 * const config1b = ""
         "    }"
         "}";
 
+//As config1 with RingBuffer
+static const MARTe::char8 * const config1c = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            RingBuffer = 1"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//As config1 with RingBuffer and BusyPoll
+static const MARTe::char8 * const config1d = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            RingBuffer = 1"
+        "            BusyPoll = 1"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+//As config1 with a RingBufferSize which is too small for the GAM reading 4 samples
+static const MARTe::char8 * const config1e = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +GAM1Thread1 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            OutputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread2 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread3 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 2"
+        "                }"
+        "            }"
+        "        }"
+        "        +GAM1Thread4 = {"
+        "            Class = RealTimeThreadSynchronisationGAMTestHelper"
+        "            InputSignals = {"
+        "                SignalUInt16 = {"
+        "                    Type = uint16"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 3"
+        "                }"
+        "                SignalUInt32 = {"
+        "                    Type = uint32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "                SignalUInt64 = {"
+        "                    Type = uint64"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                    NumberOfDimensions = 1"
+        "                    NumberOfElements = 5"
+        "                }"
+        "                SignalInt32 = {"
+        "                    Type = int32"
+        "                    DataSource = RealTimeThreadSynchronisationTest"
+        "                    Samples = 4"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB1"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "        +RealTimeThreadSynchronisationTest = {"
+        "            Class = RealTimeThreadSynchronisation"
+        "            RingBuffer = 1"
+        "            RingBufferSize = 7"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +State1 = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread1 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread1}"
+        "                }"
+        "                +Thread2 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread2}"
+        "                }"
+        "                +Thread3 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread3}"
+        "                }"
+        "                +Thread4 = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {GAM1Thread4}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = RealTimeThreadSynchronisationSchedulerTestHelper"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
 
 //Configuration with no GAMs producing/consuming data from the RealTimeThreadSynchronisation which is OK
 static const MARTe::char8 * const config2 = ""
@@ -1642,9 +2115,12 @@ bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_False_Differen
     return !TestIntegratedInApplication(config8, true);
 }
 
-bool RealTimeThreadSynchronisationTest::TestSynchronise() {
+/**
+ * Executes the threads of an application configured as config1 and checks the values read by each thread.
+ */
+static bool TestSynchroniseInApplication(const MARTe::char8 * const config) {
     using namespace MARTe;
-    bool ok = TestIntegratedInApplication(config1, false);
+    bool ok = TestIntegratedInApplication(config, false);
     ObjectRegistryDatabase *godb = ObjectRegistryDatabase::Instance();
 
     ReferenceT<RealTimeThreadSynchronisationGAMTestHelper> gam1Thread1;
@@ -1772,3 +2248,41 @@ bool RealTimeThreadSynchronisationTest::TestSynchronise() {
     godb->Purge();
     return ok;
 }
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise() {
+    return TestSynchroniseInApplication(config1);
+}
+
+bool RealTimeThreadSynchronisationTest::TestInitialise_False_RingBufferSize() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    ConfigurationDatabase cdb;
+    uint32 ringBufferSize = 16u;
+    cdb.Write("RingBufferSize", ringBufferSize);
+    return !test.Initialise(cdb);
+}
+
+bool RealTimeThreadSynchronisationTest::TestInitialise_False_BusyPoll() {
+    using namespace MARTe;
+    RealTimeThreadSynchronisation test;
+    ConfigurationDatabase cdb;
+    uint8 busyPoll = 1u;
+    cdb.Write("BusyPoll", busyPoll);
+    return !test.Initialise(cdb);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_RingBuffer() {
+    return TestIntegratedInApplication(config1c, true);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSetConfiguredDatabase_False_RingBufferSize() {
+    return !TestIntegratedInApplication(config1e, true);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_RingBuffer() {
+    return TestSynchroniseInApplication(config1c);
+}
+
+bool RealTimeThreadSynchronisationTest::TestSynchronise_RingBuffer_BusyPoll() {
+    return TestSynchroniseInApplication(config1d);
+}
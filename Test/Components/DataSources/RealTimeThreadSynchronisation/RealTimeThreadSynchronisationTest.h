@@ -145,6 +145,36 @@ public:
      */
     bool TestSynchronise();
 
+    /**
+     * @brief Tests that the Initialise method fails if RingBufferSize is set without RingBuffer.
+     */
+    bool TestInitialise_False_RingBufferSize();
+
+    /**
+     * @brief Tests that the Initialise method fails if BusyPoll is set without RingBuffer.
+     */
+    bool TestInitialise_False_BusyPoll();
+
+    /**
+     * @brief Tests the SetConfiguredDatabase method with RingBuffer = 1.
+     */
+    bool TestSetConfiguredDatabase_RingBuffer();
+
+    /**
+     * @brief Tests that the SetConfiguredDatabase method fails if the RingBufferSize is less than twice the number of samples read by a GAM.
+     */
+    bool TestSetConfiguredDatabase_False_RingBufferSize();
+
+    /**
+     * @brief Tests the Synchronise method with RingBuffer = 1.
+     */
+    bool TestSynchronise_RingBuffer();
+
+    /**
+     * @brief Tests the Synchronise method with RingBuffer = 1 and BusyPoll = 1.
+     */
+    bool TestSynchronise_RingBuffer_BusyPoll();
+
 };
 
 /*---------------------------------------------------------------------------*/
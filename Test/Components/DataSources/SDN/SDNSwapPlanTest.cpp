@@ -0,0 +1,171 @@
+/**
+ * @file SDNSwapPlanTest.cpp
+ * @brief Source file for class SDNSwapPlanTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This source file contains the definition of all the methods for
+ * the class SDNSwapPlanTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+#define DLL_API
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "Endianity.h"
+#include "MemoryOperationsHelper.h"
+#include "SDNSwapPlan.h"
+#include "SDNSwapPlanTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+/**
+ * Payload with mixed widths used by the tests.
+ */
+struct SDNSwapPlanTestPayload {
+    MARTe::uint32 a[3];
+    MARTe::float32 b;
+    MARTe::uint64 c[2];
+    MARTe::float64 d;
+    MARTe::uint16 e[4];
+    MARTe::uint8 f[8];
+};
+
+static bool IsHostBigEndian() {
+    MARTe::uint16 probe = 0x0102u;
+    MARTe::Endianity::ToBigEndian(probe);
+    return (probe == 0x0102u);
+}
+
+static void InitialisePayload(SDNSwapPlanTestPayload &payload) {
+    using namespace MARTe;
+    uint8 *bytes = reinterpret_cast<uint8 *>(&payload);
+    uint32 i;
+    for (i = 0u; i < sizeof(SDNSwapPlanTestPayload); i++) {
+        bytes[i] = static_cast<uint8>((i * 7u) + 1u);
+    }
+}
+
+static void AddPayload(MARTe::SDNSwapPlan &plan, SDNSwapPlanTestPayload &payload) {
+    plan.AddSegment(&payload.a[0], 32u, 3u);
+    plan.AddSegment(&payload.b, 32u, 1u);
+    plan.AddSegment(&payload.c[0], 64u, 2u);
+    plan.AddSegment(&payload.d, 64u, 1u);
+    plan.AddSegment(&payload.e[0], 16u, 4u);
+    plan.AddSegment(&payload.f[0], 8u, 8u);
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+bool SDNSwapPlanTest::TestConstructor() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    bool ok = (plan.GetNumberOfRuns() == 0u);
+    ok &= (plan.GetNumberOfElements() == 0u);
+    return ok;
+}
+
+bool SDNSwapPlanTest::TestAddSegment_Merge() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    SDNSwapPlanTestPayload payload;
+    AddPayload(plan, payload);
+    bool ok = true;
+    if (IsHostBigEndian()) {
+        ok = (plan.GetNumberOfRuns() == 0u);
+    }
+    else {
+        ok = (plan.GetNumberOfRuns() == 3u);
+        ok &= (plan.GetNumberOfElements() == 11u);
+    }
+    return ok;
+}
+
+bool SDNSwapPlanTest::TestAddSegment_NoMerge() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    uint32 a[4];
+    uint16 b[4];
+    plan.AddSegment(&a[0], 32u, 1u);
+    plan.AddSegment(&a[2], 32u, 2u);
+    plan.AddSegment(&b[0], 16u, 4u);
+    bool ok = true;
+    if (IsHostBigEndian()) {
+        ok = (plan.GetNumberOfRuns() == 0u);
+    }
+    else {
+        ok = (plan.GetNumberOfRuns() == 3u);
+        ok &= (plan.GetNumberOfElements() == 7u);
+    }
+    return ok;
+}
+
+bool SDNSwapPlanTest::TestAddSegment_Ignored() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    uint8 a[4];
+    uint32 b[4];
+    plan.AddSegment(&a[0], 8u, 4u);
+    plan.AddSegment(&b[0], 32u, 0u);
+    return (plan.GetNumberOfRuns() == 0u);
+}
+
+bool SDNSwapPlanTest::TestSwap() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    SDNSwapPlanTestPayload payload;
+    SDNSwapPlanTestPayload expected;
+    InitialisePayload(payload);
+    InitialisePayload(expected);
+    AddPayload(plan, payload);
+    plan.Swap();
+
+    uint32 i;
+    for (i = 0u; i < 3u; i++) {
+        Endianity::ToBigEndian(expected.a[i]);
+    }
+    Endianity::ToBigEndian(expected.b);
+    for (i = 0u; i < 2u; i++) {
+        Endianity::ToBigEndian(expected.c[i]);
+    }
+    Endianity::ToBigEndian(expected.d);
+    for (i = 0u; i < 4u; i++) {
+        Endianity::ToBigEndian(expected.e[i]);
+    }
+    return (MemoryOperationsHelper::Compare(&payload, &expected, sizeof(SDNSwapPlanTestPayload)) == 0);
+}
+
+bool SDNSwapPlanTest::TestSwap_Twice() {
+    using namespace MARTe;
+    SDNSwapPlan plan;
+    SDNSwapPlanTestPayload payload;
+    SDNSwapPlanTestPayload expected;
+    InitialisePayload(payload);
+    InitialisePayload(expected);
+    AddPayload(plan, payload);
+    plan.Swap();
+    plan.Swap();
+    return (MemoryOperationsHelper::Compare(&payload, &expected, sizeof(SDNSwapPlanTestPayload)) == 0);
+}
+
@@ -0,0 +1,82 @@
+/**
+ * @file SDNSwapPlanTest.h
+ * @brief Header file for class SDNSwapPlanTest
+ * @date 18/10/2026
+ * @author Andre Neto
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+ *
+ * @details This header file contains the declaration of the class SDNSwapPlanTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef SDNSWAPPLANTEST_H_
+#define SDNSWAPPLANTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief Tests the SDNSwapPlan public methods.
+ */
+class SDNSwapPlanTest {
+
+public:
+
+    /**
+     * @brief Tests the constructor.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests that AddSegment merges contiguous segments with the same width.
+     */
+    bool TestAddSegment_Merge();
+
+    /**
+     * @brief Tests that AddSegment does not merge segments with different widths or which are not contiguous.
+     */
+    bool TestAddSegment_NoMerge();
+
+    /**
+     * @brief Tests that AddSegment ignores 8 bit and empty segments.
+     */
+    bool TestAddSegment_Ignored();
+
+    /**
+     * @brief Tests that Swap converts the payload as Endianity::ToBigEndian.
+     */
+    bool TestSwap();
+
+    /**
+     * @brief Tests that Swap twice restores the original payload.
+     */
+    bool TestSwap_Twice();
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* SDNSWAPPLANTEST_H_ */
+
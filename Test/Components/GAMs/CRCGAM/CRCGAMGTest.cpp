@@ -122,6 +122,26 @@ TEST(CRCGAMGTest,TestExecuteUint32) {
     ASSERT_TRUE(test.TestExecuteUint32());
 }
 
+TEST(CRCGAMGTest,TestSetupMultipleCRCs) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestSetupMultipleCRCs());
+}
+
+TEST(CRCGAMGTest,TestSetupMultipleCRCsDifferentOutputTypes) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestSetupMultipleCRCsDifferentOutputTypes());
+}
+
+TEST(CRCGAMGTest,TestSetupMultipleCRCsWrongNumberOfOutput) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestSetupMultipleCRCsWrongNumberOfOutput());
+}
+
+TEST(CRCGAMGTest,TestExecuteMultipleCRCs) {
+    CRCGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultipleCRCs());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
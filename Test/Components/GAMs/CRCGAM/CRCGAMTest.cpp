@@ -540,4 +540,138 @@ bool CRCGAMTest::TestExecuteUint16() {
 bool CRCGAMTest::TestExecuteUint32() {
     return TestExecute<MARTe::uint32>(1024);
 }
-	
+
+bool CRCGAMTest::ConfigureMultipleCRCs(const MARTe::uint32 numberOfOutputs,
+                                       const MARTe::char8 * const otherOutputsType) {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ok = parser.Parse();
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1");
+    }
+    if (ok) {
+        ok = cdb.Delete("Polynomial");
+    }
+    if (ok) {
+        ok = cdb.Write("Polynomial", 0x1021);
+    }
+    if (ok) {
+        ok = cdb.Delete("Inverted");
+    }
+    if (ok) {
+        ok = cdb.Write("Inverted", 0);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal2");
+    }
+    if (ok) {
+        ok = cdb.Delete("Type");
+    }
+    if (ok) {
+        ok = cdb.Write("Type", "uint16");
+    }
+    for (uint32 i = 1u; (i < 3u) && (ok); i++) {
+        StreamString signalName;
+        ok = signalName.Printf("Signal%u", (2u * i) + 1u);
+        if (ok) {
+            ok = cdb.MoveAbsolute("$Test.+Data.+DSH.Signals");
+        }
+        if (ok) {
+            ok = cdb.CreateRelative(signalName.Buffer());
+        }
+        if (ok) {
+            ok = cdb.Write("Type", "uint8");
+        }
+        if (ok) {
+            ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.InputSignals");
+        }
+        if (ok) {
+            ok = cdb.CreateRelative(signalName.Buffer());
+        }
+        if (ok) {
+            ok = cdb.Write("DataSource", "DSH");
+        }
+        if ((ok) && (i < numberOfOutputs)) {
+            signalName = "";
+            ok = signalName.Printf("Signal%u", (2u * i) + 2u);
+            if (ok) {
+                ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals");
+            }
+            if (ok) {
+                ok = cdb.CreateRelative(signalName.Buffer());
+            }
+            if (ok) {
+                ok = cdb.Write("DataSource", "DDB1");
+            }
+            if (ok) {
+                ok = cdb.Write("Type", otherOutputsType);
+            }
+        }
+    }
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    if (ok) {
+        cdb.MoveToRoot();
+        ord->Purge();
+        ok = ord->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = ord->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = application->ConfigureApplication();
+    }
+    return ok;
+}
+
+bool CRCGAMTest::TestSetupMultipleCRCs() {
+    using namespace MARTe;
+    bool ok = ConfigureMultipleCRCs(3u, "uint16");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestSetupMultipleCRCsDifferentOutputTypes() {
+    using namespace MARTe;
+    bool ok = !ConfigureMultipleCRCs(3u, "uint32");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestSetupMultipleCRCsWrongNumberOfOutput() {
+    using namespace MARTe;
+    bool ok = !ConfigureMultipleCRCs(2u, "uint16");
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool CRCGAMTest::TestExecuteMultipleCRCs() {
+    using namespace MARTe;
+    bool ok = ConfigureMultipleCRCs(3u, "uint16");
+    ObjectRegistryDatabase *ord = ObjectRegistryDatabase::Instance();
+    ReferenceT<CRCTestHelper> gam;
+    if (ok) {
+        gam = ord->Find("Test.Functions.GAM1");
+        ok = gam.IsValid();
+    }
+    if (ok) {
+        uint8 values[] = { 10u, 0x31u, 0x0u };
+        for (uint32 i = 0u; i < 3u; i++) {
+            *reinterpret_cast<uint8*>(gam->GetInputSignalMemory(i)) = values[i];
+        }
+        ok = gam->Execute();
+    }
+    if (ok) {
+        //CRC-16/XMODEM of each single byte
+        uint16 expected[] = { 0xA14Au, 0x2672u, 0x0u };
+        for (uint32 i = 0u; (i < 3u) && (ok); i++) {
+            ok = (*reinterpret_cast<uint16*>(gam->GetOutputSignalMemory(i)) == expected[i]);
+        }
+    }
+    ord->Purge();
+    return ok;
+}
@@ -135,6 +135,37 @@ public:
      * @brief Test the execute function for output type = uint32
      */
     bool TestExecuteUint32();
+
+    /**
+     * @brief Test the setup function with two input signals and two output signals (one CRC per input signal)
+     */
+    bool TestSetupMultipleCRCs();
+
+    /**
+     * @brief Test the setup function when the output signals do not have the same type
+     */
+    bool TestSetupMultipleCRCsDifferentOutputTypes();
+
+    /**
+     * @brief Test the setup function when the number of output signals is neither one nor the number of input signals
+     */
+    bool TestSetupMultipleCRCsWrongNumberOfOutput();
+
+    /**
+     * @brief Test the execute function with two input signals and two output signals (one CRC per input signal)
+     */
+    bool TestExecuteMultipleCRCs();
+
+private:
+
+    /**
+     * @brief Configures the application with three input signals and \a numberOfOutputs output signals.
+     * @param[in] numberOfOutputs the number of output signals (the first has type uint16).
+     * @param[in] otherOutputsType the type of the other output signals.
+     * @return true if the application is configured.
+     */
+    bool ConfigureMultipleCRCs(const MARTe::uint32 numberOfOutputs,
+                               const MARTe::char8 * const otherOutputsType);
 };
 
 
@@ -68,3 +68,23 @@ TEST(CRCHelperTGTest,TestCompute) {
     CRCHelperTTest test;
     ASSERT_TRUE(test.TestCompute());
 }
+
+TEST(CRCHelperTGTest,TestComputeCheckValues) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeCheckValues());
+}
+
+TEST(CRCHelperTGTest,TestComputeAllSizesUint8) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeAllSizesUint8());
+}
+
+TEST(CRCHelperTGTest,TestComputeAllSizesUint16) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeAllSizesUint16());
+}
+
+TEST(CRCHelperTGTest,TestComputeAllSizesUint32) {
+    CRCHelperTTest test;
+    ASSERT_TRUE(test.TestComputeAllSizesUint32());
+}
@@ -126,4 +126,76 @@ bool CRCHelperTTest::TestCompute() {
 
     return ok;
 }
-	
+
+bool CRCHelperTTest::TestComputeCheckValues() {
+    const char8 * const check = "123456789";
+    const uint8 * data = reinterpret_cast<const uint8 *>(check);
+    int32 size = 9;
+
+    uint8 p8 = 0x7u;
+    uint8 i8 = 0x0u;
+    uint8 ret8 = 0u;
+    CRCHelperT<uint8> t8;
+    t8.ComputeTable(&p8);
+    t8.Compute(data, size, &i8, false, &ret8);
+
+    uint16 p16 = 0x1021u;
+    uint16 i16 = 0x0u;
+    uint16 ret16 = 0u;
+    CRCHelperT<uint16> t16;
+    t16.ComputeTable(&p16);
+    t16.Compute(data, size, &i16, false, &ret16);
+
+    uint32 p32 = 0x4C11DB7u;
+    uint32 i32 = 0xFFFFFFFFu;
+    uint32 ret32 = 0u;
+    CRCHelperT<uint32> t32;
+    t32.ComputeTable(&p32);
+    t32.Compute(data, size, &i32, false, &ret32);
+
+    return (ret8 == 0xF4u) && (ret16 == 0x31C3u) && (ret32 == 0x0376E6E7u);
+}
+
+template <typename T>
+bool CRCHelperTTest::TestComputeAllSizes(T pol) {
+    const uint32 nBits = sizeof(T) * 8u;
+    const T topBit = static_cast<T>(1u << (nBits - 1u));
+    uint8 data[64];
+    for (uint32 i = 0u; i < 64u; i++) {
+        data[i] = static_cast<uint8>((i * 37u) + 11u);
+    }
+    CRCHelperT<T> test;
+    test.ComputeTable(&pol);
+    bool ok = true;
+    for (int32 size = 0; (size <= 64) && (ok); size++) {
+        T init = static_cast<T>(0xA5A5A5A5u);
+        T expected = init;
+        for (int32 i = 0; i < size; i++) {
+            expected ^= static_cast<T>(static_cast<T>(data[i]) << (nBits - 8u));
+            for (uint32 bit = 0u; bit < 8u; bit++) {
+                if ((expected & topBit) != 0u) {
+                    expected = static_cast<T>((expected << 1u) ^ pol);
+                }
+                else {
+                    expected = static_cast<T>(expected << 1u);
+                }
+            }
+        }
+        T ret = 0u;
+        test.Compute(&data[0], size, &init, false, &ret);
+        ok = (ret == expected);
+    }
+    return ok;
+}
+
+bool CRCHelperTTest::TestComputeAllSizesUint8() {
+    return TestComputeAllSizes<uint8>(0x7u);
+}
+
+bool CRCHelperTTest::TestComputeAllSizesUint16() {
+    return TestComputeAllSizes<uint16>(0x1021u);
+}
+
+bool CRCHelperTTest::TestComputeAllSizesUint32() {
+    return TestComputeAllSizes<uint32>(0x4C11DB7u);
+}
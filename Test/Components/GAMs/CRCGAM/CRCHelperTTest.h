@@ -74,6 +74,35 @@ public:
      */
     bool TestCompute();
 
+    /**
+     * @brief Test the function Compute against the standard check values (CRC of "123456789")
+     * of CRC-8, CRC-16/XMODEM and CRC-32/MPEG-2.
+     */
+    bool TestComputeCheckValues();
+
+    /**
+     * @brief Generic test function to be used by TestComputeAllSizesUint8, TestComputeAllSizesUint16
+     * and TestComputeAllSizesUint32. Compares the function Compute with a bit-by-bit CRC computation
+     * for all the sizes from 0 to 64 bytes (i.e. with and without the slicing-by-8 path).
+     */
+    template <typename T>
+    bool TestComputeAllSizes(T pol);
+
+    /**
+     * @brief TestComputeAllSizes with type = uint8
+     */
+    bool TestComputeAllSizesUint8();
+
+    /**
+     * @brief TestComputeAllSizes with type = uint16
+     */
+    bool TestComputeAllSizesUint16();
+
+    /**
+     * @brief TestComputeAllSizes with type = uint32
+     */
+    bool TestComputeAllSizesUint32();
+
 };
 
 
@@ -229,6 +229,11 @@ TEST(ConversionGAMGTest,TestSetup_False_InvalidOutputSamplesMismatch) {
     ASSERT_TRUE(test.TestSetup_False_InvalidOutputSamplesMismatch());
 }
 
+TEST(ConversionGAMGTest,TestSetup_False_InvalidSaturate) {
+    ConversionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_InvalidSaturate());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
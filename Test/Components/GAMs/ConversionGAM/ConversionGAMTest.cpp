@@ -203,6 +203,43 @@ bool ConversionGAMTest::TestSetup_False_InvalidInputSignalType() {
     return ok;
 }
 
+bool ConversionGAMTest::TestSetup_False_InvalidSaturate() {
+    using namespace MARTe;
+    ConfigurationDatabase cdb;
+    StreamString configStream = configFromBasicTypeTemplate;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    //Parse the template configuration file
+    bool ok = parser.Parse();
+
+    //Patch it with a saturation on an integer to integer conversion
+    if (ok) {
+        ok = cdb.MoveAbsolute("$Test.+Functions.+GAM1.OutputSignals.Signal1");
+    }
+    if (ok) {
+        ok = cdb.Write("Saturate", 1);
+    }
+    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+
+    //Initialise the application
+    if (ok) {
+        cdb.MoveToRoot();
+        god->Purge();
+        ok = god->Initialise(cdb);
+    }
+    ReferenceT<RealTimeApplication> application;
+    if (ok) {
+        application = god->Find("Test");
+        ok = application.IsValid();
+    }
+    if (ok) {
+        ok = !application->ConfigureApplication();
+    }
+
+    god->Purge();
+    return ok;
+}
+
 bool ConversionGAMTest::TestSetup_False_InvalidNumberOfInputsOutputs() {
     using namespace MARTe;
     ConfigurationDatabase cdb;
@@ -95,6 +95,11 @@ public:
      */
     bool TestSetup_False_InvalidOutputSamplesMismatch();
 
+    /**
+     * @brief Tests the Setup method with Saturate = 1 on a conversion that is not from floating point to integer.
+     */
+    bool TestSetup_False_InvalidSaturate();
+
     /**
      * @brief Tests the Execute method for all the basic types.
      */
@@ -75,6 +75,41 @@ TEST(ConversionHelperTGTest,TestLoadGain) {
     ASSERT_TRUE(test.TestLoadGain());
 }
 
+TEST(ConversionHelperTGTest,TestLoadParameters) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadParameters());
+}
+
+TEST(ConversionHelperTGTest,TestLoadParameters_False_Saturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadParameters_False_Saturate());
+}
+
+TEST(ConversionHelperTGTest,TestLoadParameters_False_Rounding) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestLoadParameters_False_Rounding());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_GainOffset) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_GainOffset());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Saturate) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Saturate());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Rounding) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Rounding());
+}
+
+TEST(ConversionHelperTGTest,TestConvert_Rounding_Exact) {
+    ConversionHelperTTest test;
+    ASSERT_TRUE(test.TestConvert_Rounding_Exact());
+}
+
 TEST(ConversionHelperTGTest,TestSetNumberOfElements) {
     ConversionHelperTTest test;
     ASSERT_TRUE(test.TestSetNumberOfElements());
@@ -65,6 +65,143 @@ bool ConversionHelperTTest::TestLoadGain() {
     return ok;
 }
 
+bool ConversionHelperTTest::TestLoadParameters() {
+    using namespace MARTe;
+    float32 input = 1.5;
+    int16 output = 0;
+    ConversionHelperT<float32, int16> test(&input, &output);
+    test.SetNumberOfElements(1u);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    bool ok = test.LoadParameters(cdb);
+    if (ok) {
+        test.Convert();
+        ok = (output == 1);
+    }
+    if (ok) {
+        cdb.Write("Gain", 2);
+        cdb.Write("Offset", 3);
+        cdb.Write("Saturate", 1);
+        cdb.Write("Rounding", "Nearest");
+        ok = test.LoadParameters(cdb);
+    }
+    if (ok) {
+        test.Convert();
+        ok = (output == 6);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestLoadParameters_False_Saturate() {
+    using namespace MARTe;
+    ConversionHelperT<int32, int16> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    bool ok = !test.LoadParameters(cdb);
+    if (ok) {
+        ConversionHelperT<float32, float64> test2(NULL, NULL);
+        ok = !test2.LoadParameters(cdb);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestLoadParameters_False_Rounding() {
+    using namespace MARTe;
+    ConversionHelperT<float32, int16> test(NULL, NULL);
+    ConfigurationDatabase cdb;
+    cdb.Write("Rounding", "Up");
+    return !test.LoadParameters(cdb);
+}
+
+bool ConversionHelperTTest::TestConvert_GainOffset() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 8u;
+    int16 input[numberOfElements] = { 1, -2, 3, -4, 5, -6, 7, -8 };
+    float32 output[numberOfElements];
+    ConversionHelperT<int16, float32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(4u);
+    test.SetNumberOfSamples(2u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Gain", 0.5);
+    cdb.Write("Offset", 10);
+    bool ok = test.LoadParameters(cdb);
+    if (ok) {
+        test.Convert();
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = (output[i] == ((0.5F * static_cast<float32>(input[i])) + 10.0F));
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Saturate() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 6u;
+    float64 input[numberOfElements] = { 1.7, -1.7, 300.0, -300.0, 127.0, -128.0 };
+    int8 output[numberOfElements];
+    int8 expected[numberOfElements] = { 1, -1, 127, -128, 127, -128 };
+    ConversionHelperT<float64, int8> test(&input[0], &output[0]);
+    test.SetNumberOfElements(numberOfElements);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Saturate", 1);
+    bool ok = test.LoadParameters(cdb);
+    if (ok) {
+        test.Convert();
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = (output[i] == expected[i]);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Rounding() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 6u;
+    float32 input[numberOfElements] = { 1.5, -1.5, 2.4, -2.4, 2.6, -2.6 };
+    int32 output[numberOfElements];
+    int32 expected[numberOfElements] = { 2, -2, 2, -2, 3, -3 };
+    ConversionHelperT<float32, int32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(numberOfElements);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Rounding", "Nearest");
+    bool ok = test.LoadParameters(cdb);
+    if (ok) {
+        test.Convert();
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = (output[i] == expected[i]);
+    }
+    return ok;
+}
+
+bool ConversionHelperTTest::TestConvert_Rounding_Exact() {
+    using namespace MARTe;
+    const uint32 numberOfElements = 6u;
+    //The largest float32 below 0.5, values from 2^23 (where all the float32 are integers) and a .5 just below 2^23.
+    float32 input[numberOfElements] = { 0.49999997F, -0.49999997F, 8388609.0F, -8388609.0F, 8388607.5F, -8388607.5F };
+    int32 output[numberOfElements];
+    int32 expected[numberOfElements] = { 0, 0, 8388609, -8388609, 8388608, -8388608 };
+    ConversionHelperT<float32, int32> test(&input[0], &output[0]);
+    test.SetNumberOfElements(numberOfElements);
+    test.SetNumberOfSamples(1u);
+    ConfigurationDatabase cdb;
+    cdb.Write("Rounding", "Nearest");
+    bool ok = test.LoadParameters(cdb);
+    if (ok) {
+        test.Convert();
+    }
+    uint32 i;
+    for (i = 0u; (i < numberOfElements) && (ok); i++) {
+        ok = (output[i] == expected[i]);
+    }
+    return ok;
+}
+
 bool ConversionHelperTTest::TestGetInputMemory() {
     using namespace MARTe;
     ConversionHelperT<uint32, float32> test(NULL, NULL);
@@ -56,6 +56,41 @@ public:
      */
     bool TestLoadGain();
 
+    /**
+     * @brief Tests the LoadParameters method.
+     */
+    bool TestLoadParameters();
+
+    /**
+     * @brief Tests that the LoadParameters method fails if Saturate is set for an integer input.
+     */
+    bool TestLoadParameters_False_Saturate();
+
+    /**
+     * @brief Tests that the LoadParameters method fails if the Rounding is not supported.
+     */
+    bool TestLoadParameters_False_Rounding();
+
+    /**
+     * @brief Tests the Convert method with a gain and an offset.
+     */
+    bool TestConvert_GainOffset();
+
+    /**
+     * @brief Tests the Convert method with Saturate = 1.
+     */
+    bool TestConvert_Saturate();
+
+    /**
+     * @brief Tests the Convert method with Rounding = Nearest.
+     */
+    bool TestConvert_Rounding();
+
+    /**
+     * @brief Tests the Convert method with Rounding = Nearest on values where adding 0.5 before truncating is not exact.
+     */
+    bool TestConvert_Rounding_Exact();
+
     /**
      * @brief Tests the GetInputMemory method.
      */
@@ -0,0 +1,171 @@
+/**
+ * @file FFTGAMGTest.cpp
+ * @brief Source file for class FFTGAMGTest
+ * @date 18/10/2026
+ * @author Bertrand Bauvir
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FFTGAMGTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <limits.h>
+#include "gtest/gtest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "FFTGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+TEST(FFTGAMGTest,TestConstructor) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestConstructor());
+}
+
+TEST(FFTGAMGTest,TestInitialise) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestInitialise());
+}
+
+TEST(FFTGAMGTest,TestInitialise_False_OutputFormat) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_False_OutputFormat());
+}
+
+TEST(FFTGAMGTest,TestSetup) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup());
+}
+
+TEST(FFTGAMGTest,TestSetup_OneSided) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_OneSided());
+}
+
+TEST(FFTGAMGTest,TestSetup_False_NumberOfInputSignals) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_NumberOfInputSignals());
+}
+
+TEST(FFTGAMGTest,TestSetup_False_NumberOfOutputSignals) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_NumberOfOutputSignals());
+}
+
+TEST(FFTGAMGTest,TestSetup_False_Type) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_Type());
+}
+
+TEST(FFTGAMGTest,TestSetup_False_OutputNumberOfElements) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_OutputNumberOfElements());
+}
+
+TEST(FFTGAMGTest,TestSetup_False_OneSidedComplexInput) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_OneSidedComplexInput());
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Real_PowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(64u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Real_OddPowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(128u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Real_Bluestein) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(100u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Real_Odd) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(45u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Complex_PowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(256u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Complex_Bluestein) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(17u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float32_Complex_One) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float32(1u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Real_PowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(64u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Real_OddPowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(128u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Real_Bluestein) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(100u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Real_Odd) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(45u, false));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Complex_PowerOfTwo) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(256u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Complex_Bluestein) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(17u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_Float64_Complex_One) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Float64(1u, true));
+}
+
+TEST(FFTGAMGTest,TestExecute_MagnitudePhase_Float32) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MagnitudePhase_Float32());
+}
+
+TEST(FFTGAMGTest,TestExecute_MagnitudePhase_Float64) {
+    FFTGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MagnitudePhase_Float64());
+}
@@ -0,0 +1,335 @@
+/**
+ * @file FFTGAMTest.cpp
+ * @brief Source file for class FFTGAMTest
+ * @date 18/10/2026
+ * @author Bertrand Bauvir
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This source file contains the definition of all the methods for
+ * the class FFTGAMTest (public, protected, and private). Be aware that some
+ * methods, such as those inline could be defined on the header file, instead.
+ */
+
+/*---------------------------------------------------------------------------*/
+/*                         Standard header includes                          */
+/*---------------------------------------------------------------------------*/
+#include <math.h>
+
+/*---------------------------------------------------------------------------*/
+/*                         Project header includes                           */
+/*---------------------------------------------------------------------------*/
+#include "ConfigurationDatabase.h"
+#include "FFTGAM.h"
+#include "FFTGAMTest.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Static definitions                              */
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief FFTGAM with access to the signals memory and a helper to create the signals configuration.
+ */
+class FFTGAMTestHelper: public FFTGAM {
+public:
+    CLASS_REGISTER_DECLARATION()
+
+    FFTGAMTestHelper() {
+    }
+
+    virtual ~FFTGAMTestHelper() {
+    }
+
+    void *GetInputSignalMemory(const uint32 idx) {
+        return GAM::GetInputSignalMemory(idx);
+    }
+
+    void *GetOutputSignalMemory(const uint32 idx) {
+        return GAM::GetOutputSignalMemory(idx);
+    }
+
+    bool ConfigureSignals(const char8 * const type,
+                          const uint32 typeSize,
+                          const uint32 numberOfInputs,
+                          const uint32 inputElements,
+                          const uint32 numberOfOutputs,
+                          const uint32 outputElements) {
+        bool ok = CreateSignals("InputSignals", type, typeSize, numberOfInputs, inputElements);
+        if (ok) {
+            ok = CreateSignals("OutputSignals", type, typeSize, numberOfOutputs, outputElements);
+        }
+        if (ok) {
+            ok = SetConfiguredDatabase(configSignals);
+        }
+        if (ok) {
+            ok = AllocateInputSignalsMemory();
+        }
+        if (ok) {
+            ok = AllocateOutputSignalsMemory();
+        }
+        return ok;
+    }
+
+    ConfigurationDatabase config;
+
+private:
+
+    bool CreateSignals(const char8 * const direction,
+                       const char8 * const type,
+                       const uint32 typeSize,
+                       const uint32 numberOfSignals,
+                       const uint32 numberOfElements) {
+        StreamString signalsPath = "Signals.";
+        signalsPath += direction;
+        StreamString memoryPath = "Memory.";
+        memoryPath += direction;
+        uint32 byteSize = (numberOfElements * typeSize);
+        bool ok = configSignals.MoveToRoot();
+        ok &= configSignals.CreateAbsolute(signalsPath.Buffer());
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString signalIdx;
+            StreamString signalName;
+            ok &= signalIdx.Printf("%u", i);
+            ok &= signalName.Printf("Signal%u", i);
+            ok &= configSignals.MoveAbsolute(signalsPath.Buffer());
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", type);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", byteSize);
+        }
+        ok &= configSignals.MoveAbsolute(signalsPath.Buffer());
+        ok &= configSignals.Write("ByteSize", (byteSize * numberOfSignals));
+        ok &= configSignals.MoveToRoot();
+        ok &= configSignals.CreateAbsolute(memoryPath.Buffer());
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; i < numberOfSignals; i++) {
+            StreamString signalIdx;
+            ok &= signalIdx.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalIdx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
+    ConfigurationDatabase configSignals;
+};
+CLASS_REGISTER(FFTGAMTestHelper, "1.0")
+
+/**
+ * @brief Deterministic test input in [-1, 1].
+ */
+static float64 FFTGAMTestInput(const uint32 n,
+                               const uint32 seed) {
+    return sin((0.37 * static_cast<float64>(n * (seed + 1u))) + (0.11 * static_cast<float64>(n * n)));
+}
+
+/*---------------------------------------------------------------------------*/
+/*                           Method definitions                              */
+/*---------------------------------------------------------------------------*/
+
+FFTGAMTest::FFTGAMTest() {
+}
+
+FFTGAMTest::~FFTGAMTest() {
+}
+
+bool FFTGAMTest::TestConstructor() {
+    FFTGAM gam;
+    bool ok = (gam.GetSize() == 0u);
+    ok &= (!gam.IsComplexInput());
+    ok &= (!gam.IsMagnitudePhase());
+    ok &= (gam.GetNumberOfOutputElements() == 0u);
+    return ok;
+}
+
+bool FFTGAMTest::TestInitialise() {
+    FFTGAMTestHelper gam;
+    bool ok = gam.config.Write("OutputFormat", "MagnitudePhase");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.IsMagnitudePhase();
+    return ok;
+}
+
+bool FFTGAMTest::TestInitialise_False_OutputFormat() {
+    FFTGAMTestHelper gam;
+    bool ok = gam.config.Write("OutputFormat", "Polar");
+    ok &= !gam.Initialise(gam.config);
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float32", sizeof(float32), 1u, 64u, 2u, 64u);
+    ok &= gam.Setup();
+    ok &= (gam.GetSize() == 64u);
+    ok &= (gam.GetNumberOfOutputElements() == 64u);
+    ok &= (!gam.IsComplexInput());
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_OneSided() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.config.Write("OutputFormat", "MagnitudePhase");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float64", sizeof(float64), 1u, 100u, 1u, 51u);
+    ok &= gam.Setup();
+    ok &= (gam.GetSize() == 100u);
+    ok &= (gam.GetNumberOfOutputElements() == 51u);
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_False_NumberOfInputSignals() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float32", sizeof(float32), 3u, 64u, 2u, 64u);
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_False_NumberOfOutputSignals() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float32", sizeof(float32), 1u, 64u, 1u, 64u);
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_False_Type() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("int32", sizeof(int32), 1u, 64u, 2u, 64u);
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_False_OutputNumberOfElements() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float32", sizeof(float32), 1u, 64u, 2u, 32u);
+    ok &= !gam.Setup();
+    return ok;
+}
+
+bool FFTGAMTest::TestSetup_False_OneSidedComplexInput() {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals("float32", sizeof(float32), 2u, 64u, 2u, 33u);
+    ok &= !gam.Setup();
+    return ok;
+}
+
+template<typename T>
+bool FFTGAMTest::TestExecuteT(const char8 * const typeName,
+                              const uint32 size,
+                              const bool complexInput,
+                              const T tolerance) {
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gam.config);
+    uint32 numberOfInputs = (complexInput) ? (2u) : (1u);
+    ok &= gam.ConfigureSignals(typeName, sizeof(T), numberOfInputs, size, 2u, size);
+    ok &= gam.Setup();
+    if (ok) {
+        T *inputReal = static_cast<T *>(gam.GetInputSignalMemory(0u));
+        T *inputImaginary = (complexInput) ? (static_cast<T *>(gam.GetInputSignalMemory(1u))) : (NULL_PTR(T *));
+        for (uint32 n = 0u; n < size; n++) {
+            inputReal[n] = static_cast<T>(FFTGAMTestInput(n, 0u));
+            if (complexInput) {
+                inputImaginary[n] = static_cast<T>(FFTGAMTestInput(n, 1u));
+            }
+        }
+        ok = gam.Execute();
+        T *outputReal = static_cast<T *>(gam.GetOutputSignalMemory(0u));
+        T *outputImaginary = static_cast<T *>(gam.GetOutputSignalMemory(1u));
+        for (uint32 k = 0u; (k < size) && (ok); k++) {
+            float64 expectedReal = 0.0;
+            float64 expectedImaginary = 0.0;
+            for (uint32 n = 0u; n < size; n++) {
+                uint64 index = ((static_cast<uint64>(k) * static_cast<uint64>(n)) % static_cast<uint64>(size));
+                float64 angle = (-2.0 * M_PI * static_cast<float64>(index)) / static_cast<float64>(size);
+                float64 xr = static_cast<float64>(inputReal[n]);
+                float64 xi = (complexInput) ? (static_cast<float64>(inputImaginary[n])) : (0.0);
+                expectedReal += ((xr * cos(angle)) - (xi * sin(angle)));
+                expectedImaginary += ((xr * sin(angle)) + (xi * cos(angle)));
+            }
+            ok = (fabs(expectedReal - static_cast<float64>(outputReal[k])) < static_cast<float64>(tolerance));
+            ok &= (fabs(expectedImaginary - static_cast<float64>(outputImaginary[k])) < static_cast<float64>(tolerance));
+        }
+    }
+    return ok;
+}
+
+template<typename T>
+bool FFTGAMTest::TestExecuteMagnitudePhaseT(const char8 * const typeName,
+                                            const T tolerance) {
+    const uint32 size = 32u;
+    const uint32 bin = 5u;
+    FFTGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = gam.config.Write("OutputFormat", "MagnitudePhase");
+    ok &= gam.Initialise(gam.config);
+    ok &= gam.ConfigureSignals(typeName, sizeof(T), 1u, size, 2u, (size / 2u) + 1u);
+    ok &= gam.Setup();
+    if (ok) {
+        //x[n] = 1 + 2 * cos(2*pi*bin*n/N + pi/4) => |X[0]| = N, |X[bin]| = N, arg(X[bin]) = pi/4, 0 elsewhere
+        T *input = static_cast<T *>(gam.GetInputSignalMemory(0u));
+        for (uint32 n = 0u; n < size; n++) {
+            float64 angle = ((2.0 * M_PI * static_cast<float64>(bin * n)) / static_cast<float64>(size)) + (M_PI / 4.0);
+            input[n] = static_cast<T>(1.0 + (2.0 * cos(angle)));
+        }
+        ok = gam.Execute();
+        T *magnitude = static_cast<T *>(gam.GetOutputSignalMemory(0u));
+        T *phase = static_cast<T *>(gam.GetOutputSignalMemory(1u));
+        for (uint32 k = 0u; (k <= (size / 2u)) && (ok); k++) {
+            T expected = ((k == 0u) || (k == bin)) ? (static_cast<T>(size)) : (static_cast<T>(0));
+            ok = (fabs(static_cast<float64>(magnitude[k] - expected)) < static_cast<float64>(tolerance));
+        }
+        if (ok) {
+            ok = (fabs(static_cast<float64>(phase[bin]) - (M_PI / 4.0)) < static_cast<float64>(tolerance));
+        }
+    }
+    return ok;
+}
+
+bool FFTGAMTest::TestExecute_Float32(const uint32 size,
+                                     const bool complexInput) {
+    return TestExecuteT<float32>("float32", size, complexInput, 1e-3F);
+}
+
+bool FFTGAMTest::TestExecute_Float64(const uint32 size,
+                                     const bool complexInput) {
+    return TestExecuteT<float64>("float64", size, complexInput, 1e-9);
+}
+
+bool FFTGAMTest::TestExecute_MagnitudePhase_Float32() {
+    return TestExecuteMagnitudePhaseT<float32>("float32", 1e-4F);
+}
+
+bool FFTGAMTest::TestExecute_MagnitudePhase_Float64() {
+    return TestExecuteMagnitudePhaseT<float64>("float64", 1e-10);
+}
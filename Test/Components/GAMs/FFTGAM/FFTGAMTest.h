@@ -0,0 +1,155 @@
+/**
+ * @file FFTGAMTest.h
+ * @brief Header file for class FFTGAMTest
+ * @date 18/10/2026
+ * @author Bertrand Bauvir
+ *
+ * @copyright Copyright 2015 F4E | European Joint Undertaking for ITER and
+ * the Development of Fusion Energy ('Fusion for Energy').
+ * Licensed under the EUPL, Version 1.1 or - as soon they will be approved
+ * by the European Commission - subsequent versions of the EUPL (the "Licence")
+ * You may not use this work except in compliance with the Licence.
+ * You may obtain a copy of the Licence at: http://ec.europa.eu/idabc/eupl
+ *
+ * @warning Unless required by applicable law or agreed to in writing,
+ * software distributed under the Licence is distributed on an "AS IS"
+ * basis, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+ * or implied. See the Licence permissions and limitations under the Licence.
+
+ * @details This header file contains the declaration of the class FFTGAMTest
+ * with all of its public, protected and private members. It may also include
+ * definitions for inline methods which need to be visible to the compiler.
+ */
+
+#ifndef TEST_COMPONENTS_GAMS_FFTGAM_FFTGAMTEST_H_
+#define TEST_COMPONENTS_GAMS_FFTGAM_FFTGAMTEST_H_
+
+/*---------------------------------------------------------------------------*/
+/*                        Standard header includes                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+/*                        Project header includes                            */
+/*---------------------------------------------------------------------------*/
+#include "FFTGAM.h"
+
+/*---------------------------------------------------------------------------*/
+/*                           Class declaration                               */
+/*---------------------------------------------------------------------------*/
+
+using namespace MARTe;
+
+/**
+ * @brief Tests the FFTGAM public methods.
+ */
+class FFTGAMTest {
+public:
+    /**
+     * @brief Constructor. NOOP.
+     */
+    FFTGAMTest();
+
+    /**
+     * @brief Destructor. NOOP.
+     */
+    virtual ~FFTGAMTest();
+
+    /**
+     * @brief Tests the default constructor post-conditions.
+     */
+    bool TestConstructor();
+
+    /**
+     * @brief Tests the Initialise method with OutputFormat = MagnitudePhase.
+     */
+    bool TestInitialise();
+
+    /**
+     * @brief Tests that the Initialise method fails with an invalid OutputFormat.
+     */
+    bool TestInitialise_False_OutputFormat();
+
+    /**
+     * @brief Tests the Setup method with a real input and a complex output.
+     */
+    bool TestSetup();
+
+    /**
+     * @brief Tests the Setup method with a real input and a one-sided spectrum.
+     */
+    bool TestSetup_OneSided();
+
+    /**
+     * @brief Tests that the Setup method fails with three input signals.
+     */
+    bool TestSetup_False_NumberOfInputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails with a single output signal and OutputFormat = Complex.
+     */
+    bool TestSetup_False_NumberOfOutputSignals();
+
+    /**
+     * @brief Tests that the Setup method fails if the signals are not float32 or float64.
+     */
+    bool TestSetup_False_Type();
+
+    /**
+     * @brief Tests that the Setup method fails if the output signals do not have the expected number of elements.
+     */
+    bool TestSetup_False_OutputNumberOfElements();
+
+    /**
+     * @brief Tests that the Setup method fails with a one-sided spectrum and a complex input.
+     */
+    bool TestSetup_False_OneSidedComplexInput();
+
+    /**
+     * @brief Tests the Execute method with float32 signals against a direct evaluation of the DFT.
+     * @param[in] size the number of points of the transform.
+     * @param[in] complexInput true to have two input signals.
+     */
+    bool TestExecute_Float32(const uint32 size,
+                             const bool complexInput);
+
+    /**
+     * @brief Tests the Execute method with float64 signals against a direct evaluation of the DFT.
+     * @param[in] size the number of points of the transform.
+     * @param[in] complexInput true to have two input signals.
+     */
+    bool TestExecute_Float64(const uint32 size,
+                             const bool complexInput);
+
+    /**
+     * @brief Tests the Execute method with OutputFormat = MagnitudePhase and a one-sided spectrum of float32 signals.
+     */
+    bool TestExecute_MagnitudePhase_Float32();
+
+    /**
+     * @brief Tests the Execute method with OutputFormat = MagnitudePhase and a one-sided spectrum of float64 signals.
+     */
+    bool TestExecute_MagnitudePhase_Float64();
+
+private:
+    /**
+     * @brief See TestExecute_Float32.
+     */
+    template<typename T>
+    bool TestExecuteT(const char8 * const typeName,
+                      const uint32 size,
+                      const bool complexInput,
+                      const T tolerance);
+
+    /**
+     * @brief See TestExecute_MagnitudePhase_Float32.
+     */
+    template<typename T>
+    bool TestExecuteMagnitudePhaseT(const char8 * const typeName,
+                                    const T tolerance);
+};
+
+/*---------------------------------------------------------------------------*/
+/*                        Inline method definitions                          */
+/*---------------------------------------------------------------------------*/
+
+#endif /* TEST_COMPONENTS_GAMS_FFTGAM_FFTGAMTEST_H_ */
@@ -284,6 +284,46 @@ TEST(FilterGAMGTest,TestResetOnlyWhenRequiredMemoryNotInit) {
     ASSERT_TRUE(test.TestResetOnlyWhenRequiredMemoryNotInit());
 }
 
+TEST(FilterGAMGTest,TestInitialiseSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOS());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSWrongNumberOfColumns) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSWrongNumberOfColumns());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSNotNormalised) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSNotNormalised());
+}
+
+TEST(FilterGAMGTest,TestInitialiseSOSAndNum) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseSOSAndNum());
+}
+
+TEST(FilterGAMGTest,TestSetupDifferentInputOutputTypes) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestSetupDifferentInputOutputTypes());
+}
+
+TEST(FilterGAMGTest,TestExecuteIIRConstantFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteIIRConstantFloat64());
+}
+
+TEST(FilterGAMGTest,TestExecuteSeveralSignalsFIRFloat64) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSeveralSignalsFIRFloat64());
+}
+
+TEST(FilterGAMGTest,TestExecuteSOS) {
+    FilterGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSOS());
+}
+
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
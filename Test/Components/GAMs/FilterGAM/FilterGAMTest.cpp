@@ -34,6 +34,8 @@
 #include "ConfigurationDatabase.h"
 #include "FilterGAM.h"
 #include "FilterGAMTest.h"
+#include "Matrix.h"
+#include "StreamString.h"
 #include "Vector.h"
 #include "stdio.h"
 
@@ -147,9 +149,98 @@ FilterGAMTestHelper    (MARTe::uint32 elements=10, MARTe::uint32 samples=1) {
         return ret;
     }
 
+    bool InitialiseFilterSOS() {
+        using namespace MARTe;
+        bool ret = true;
+        if(isInitialised == false) {
+            //2 * (0.5 + 0.5z^-1) / (1 - z^-1) = (1 + z^-1) / (1 - z^-1)
+            float64 sos[2][6] = { { 0.5, 0.5, 0.0, 1.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0, 1.0, -1.0, 0.0 } };
+            Matrix<float64> sosMat(sos);
+            ret &= config.Write("SOS", sosMat);
+            ret &= config.Write("Gain", 2.0);
+            bool resetInEachState = 0;
+            ret &= config.Write("ResetInEachState", resetInEachState);
+            isInitialised = ret;
+        }
+        else {
+            ret = false;
+        }
+        return ret;
+    }
+
     bool IsInitialised() {
         return isInitialised;
     }
+
+    bool InitialiseConfigDataBaseSignalType(const MARTe::char8 * const inputType,
+                                            const MARTe::char8 * const outputType,
+                                            const MARTe::uint32 typeSize,
+                                            const MARTe::uint32 numberOfSignals) {
+        using namespace MARTe;
+        bool ok = true;
+        uint32 signalByteSize = numberOfElements * typeSize;
+        uint32 totalByteSize = signalByteSize * numberOfSignals;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        for (uint32 i = 0u; (i < numberOfSignals) && ok; i++) {
+            StreamString signalName;
+            signalName.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalName.Buffer());
+            signalName = "";
+            signalName.Printf("InputSignal%u", i);
+            ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", inputType);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", signalByteSize);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        for (uint32 i = 0u; (i < numberOfSignals) && ok; i++) {
+            StreamString signalName;
+            signalName.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalName.Buffer());
+            signalName = "";
+            signalName.Printf("OutputSignal%u", i);
+            ok &= configSignals.Write("QualifiedName", signalName.Buffer());
+            ok &= configSignals.Write("DataSource", "TestDataSource");
+            ok &= configSignals.Write("Type", outputType);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("NumberOfElements", numberOfElements);
+            ok &= configSignals.Write("ByteSize", signalByteSize);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", totalByteSize);
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; (i < numberOfSignals) && ok; i++) {
+            StreamString signalName;
+            signalName.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalName.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 0u; (i < numberOfSignals) && ok; i++) {
+            StreamString signalName;
+            signalName.Printf("%u", i);
+            ok &= configSignals.CreateRelative(signalName.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
     bool InitialiseConfigDataBaseSignal1() {
         bool ok = true;
         MARTe::uint32 totalByteSize = byteSize;
@@ -2828,3 +2919,224 @@ bool FilterGAMTest::TestResetOnlyWhenRequiredMemoryNotInit() {
     return ok;
 }
 
+bool FilterGAMTest::TestInitialiseSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+    ok &= (gam.GetNumberOfSections() == 2u);
+    ok &= (gam.GetNumberOfNumCoeff() == 0u);
+    ok &= (gam.GetNumberOfDenCoeff() == 0u);
+    bool isInfinite = false;
+    gam.GetStaticGain(isInfinite);
+    ok &= isInfinite;
+    return ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSWrongNumberOfColumns() {
+    using namespace MARTe;
+    FilterGAM gam;
+    gam.SetName("Test");
+    bool ok = true;
+    ConfigurationDatabase config;
+    float64 sos[1][5] = { { 1.0, 0.0, 0.0, 1.0, 0.0 } };
+    Matrix<float64> sosMat(sos);
+    ok &= config.Write("SOS", sosMat);
+    ok &= gam.Initialise(config);
+    return !ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSNotNormalised() {
+    using namespace MARTe;
+    FilterGAM gam;
+    gam.SetName("Test");
+    bool ok = true;
+    ConfigurationDatabase config;
+    float64 sos[2][6] = { { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0, 2.0, 0.0, 0.0 } };
+    Matrix<float64> sosMat(sos);
+    ok &= config.Write("SOS", sosMat);
+    ok &= gam.Initialise(config);
+    return !ok;
+}
+
+bool FilterGAMTest::TestInitialiseSOSAndNum() {
+    using namespace MARTe;
+    FilterGAM gam;
+    gam.SetName("Test");
+    bool ok = true;
+    ConfigurationDatabase config;
+    float64 sos[1][6] = { { 1.0, 0.0, 0.0, 1.0, 0.0, 0.0 } };
+    Matrix<float64> sosMat(sos);
+    float32 num[2] = { 0.5, 0.5 };
+    Vector<float32> numVec(num, 2);
+    ok &= config.Write("SOS", sosMat);
+    ok &= config.Write("Num", numVec);
+    ok &= gam.Initialise(config);
+    return !ok;
+}
+
+bool FilterGAMTest::TestSetupDifferentInputOutputTypes() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", "float32", sizeof(float64), 1u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+    return !ok;
+}
+
+bool FilterGAMTest::TestExecuteIIRConstantFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterIIR();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", "float64", sizeof(float64), 1u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+
+    float64 *gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    //assign inputs and outputs
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn[i] = 1;
+        gamMemoryOut[i] = 0;
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut[i] == 1 + i);
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut[i] == 1 + gam.numberOfElements + i);
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSeveralSignalsFIRFloat64() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterFIR();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignalType("float64", "float64", sizeof(float64), 3u);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+
+    float64 *gamMemoryIn[3];
+    float64 *gamMemoryOut[3];
+    for (uint32 s = 0u; s < 3u; s++) {
+        gamMemoryIn[s] = static_cast<float64 *>(gam.GetInputSignalsMemory(s));
+        gamMemoryOut[s] = static_cast<float64 *>(gam.GetOutputSignalsMemory(s));
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        for (uint32 s = 0u; s < 3u; s++) {
+            gamMemoryIn[s][i] = (s + 1u) * i;
+            gamMemoryOut[s][i] = 0;
+        }
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 s = 0u; (s < 3u) && ok; s++) {
+        float64 gain = static_cast<float64>(s + 1u);
+        ok &= (gamMemoryOut[s][0] == 0);
+        for (uint32 i = 1u; i < gam.numberOfElements; i++) {
+            ok &= (gamMemoryOut[s][i] == (gain * (i - 0.5)));
+        }
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        for (uint32 s = 0u; s < 3u; s++) {
+            gamMemoryIn[s][i] = (s + 1u) * (i + 10u);
+        }
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 s = 0u; (s < 3u) && ok; s++) {
+        float64 gain = static_cast<float64>(s + 1u);
+        for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+            ok &= (gamMemoryOut[s][i] == (gain * (10 + i - 0.5)));
+        }
+    }
+    return ok;
+}
+
+bool FilterGAMTest::TestExecuteSOS() {
+    using namespace MARTe;
+    FilterGAMTestHelper gam;
+    gam.SetName("Test");
+    bool ok = true;
+
+    ok &= gam.InitialiseFilterSOS();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignal1();
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+
+    ok &= gam.Setup();
+
+    float32 *gamMemoryIn = static_cast<float32 *>(gam.GetInputSignalsMemory());
+    float32 *gamMemoryOut = static_cast<float32 *>(gam.GetOutputSignalsMemory());
+    //assign inputs and outputs
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        gamMemoryIn[i] = 1;
+        gamMemoryOut[i] = 0;
+    }
+    //(1 + z^-1) / (1 - z^-1) with a constant input: y[n] = 2n + 1
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut[i] == (2 * i) + 1);
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut[i] == (2 * (gam.numberOfElements + i)) + 1);
+    }
+    if (ok) {
+        ok &= gam.PrepareNextState("A", "B");
+    }
+    if (ok) {
+        gam.Execute();
+    }
+    for (uint32 i = 0u; i < gam.numberOfElements; i++) {
+        ok &= (gamMemoryOut[i] == (2 * i) + 1);
+    }
+    return ok;
+}
@@ -393,6 +393,56 @@ public:
      * @return true if PrepareNextState() fails.
      */
     bool TestResetOnlyWhenRequiredMemoryNotInit();
+
+    /**
+     * @brief Tests the Initialise() function with a cascade of second order sections.
+     * @return true if the number of sections and the static gain are as expected.
+     */
+    bool TestInitialiseSOS();
+
+    /**
+     * @brief Tests the Initialise() function with a SOS matrix which does not have 6 columns.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSWrongNumberOfColumns();
+
+    /**
+     * @brief Tests the Initialise() function with a second order section where a0 != 1.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSNotNormalised();
+
+    /**
+     * @brief Tests the Initialise() function with both SOS and Num specified.
+     * @return true if Initialise() fails.
+     */
+    bool TestInitialiseSOSAndNum();
+
+    /**
+     * @brief Tests the Setup() function with a float64 input and a float32 output.
+     * @return true if Setup() fails.
+     */
+    bool TestSetupDifferentInputOutputTypes();
+
+    /**
+     * @brief Tests the IIR filter with float64 signals and a constant input.
+     * @return true if the output values are as expected on two consecutive executions.
+     */
+    bool TestExecuteIIRConstantFloat64();
+
+    /**
+     * @brief Tests the FIR filter with three float64 signals.
+     * @return true if the output values of each signal are as expected on two consecutive executions.
+     */
+    bool TestExecuteSeveralSignalsFIRFloat64();
+
+    /**
+     * @brief Tests the filter with a cascade of two second order sections.
+     * @details The cascade is equivalent to the direct form (1 + z^-1) / (1 - z^-1). The filter is executed twice,
+     * reset and executed again.
+     * @return true if the output values are as expected.
+     */
+    bool TestExecuteSOS();
 };
 
 /*---------------------------------------------------------------------------*/
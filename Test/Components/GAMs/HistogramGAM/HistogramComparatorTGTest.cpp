@@ -192,3 +192,73 @@ TEST(HistogramComparatorTGTest,TestGetNumberOfBins) {
     HistogramComparatorTTest<uint8> test;
     ASSERT_TRUE(test.TestGetNumberOfBins());
 }
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestInRange_AllValues(10, 100, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_I16) {
+    HistogramComparatorTTest<int16> test;
+    ASSERT_TRUE(test.TestInRange_AllValues(-100, 800, 11));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestInRange_AllValues(-1000, 8000, 13));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_F32) {
+    HistogramComparatorTTest<float32> test;
+    ASSERT_TRUE(test.TestInRange_AllValues(-10.5, 20.5, 7));
+}
+
+TEST(HistogramComparatorTGTest,TestInRange_AllValues_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestInRange_AllValues(-10.5, 20.5, 7));
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_NotIncreasing_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestSetEdges_False_NotIncreasing());
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_U8) {
+    HistogramComparatorTTest<uint8> test;
+    ASSERT_TRUE(test.TestAccumulate());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_NotIncreasing_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestSetEdges_False_NotIncreasing());
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_I32) {
+    HistogramComparatorTTest<int32> test;
+    ASSERT_TRUE(test.TestAccumulate());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestSetEdges());
+}
+
+TEST(HistogramComparatorTGTest,TestSetEdges_False_NotIncreasing_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestSetEdges_False_NotIncreasing());
+}
+
+TEST(HistogramComparatorTGTest,TestAccumulate_F64) {
+    HistogramComparatorTTest<float64> test;
+    ASSERT_TRUE(test.TestAccumulate());
+}
@@ -85,6 +85,29 @@ public:
                      T value,
                      uint32 expected);
 
+    /**
+     * @brief Tests that the HistogramComparatorT::InRange method returns, for all the values in [min - 2, max + 2),
+     * the same bin as a linear search over the bin ranges.
+     */
+    bool TestInRange_AllValues(T min,
+                               T max,
+                               uint32 nBins);
+
+    /**
+     * @brief Tests the HistogramComparatorT::SetEdges method with non-uniform edges.
+     */
+    bool TestSetEdges();
+
+    /**
+     * @brief Tests that the HistogramComparatorT::SetEdges method fails if the edges are not strictly increasing.
+     */
+    bool TestSetEdges_False_NotIncreasing();
+
+    /**
+     * @brief Tests the HistogramComparatorT::Accumulate method.
+     */
+    bool TestAccumulate();
+
 };
 
 /*---------------------------------------------------------------------------*/
@@ -140,5 +163,98 @@ bool HistogramComparatorTTest<T>::TestInRange(T min,
 
 }
 
-#endif /* HISTOGRAM_COMPARATORTTEST_H_ */
+template<typename T>
+bool HistogramComparatorTTest<T>::TestInRange_AllValues(T min,
+                                                        T max,
+                                                        uint32 nBins) {
+    HistogramComparatorT<T> test;
+
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(nBins);
+
+    T delta = static_cast<T>((max - min) / static_cast<T>(nBins - 2u));
+    bool ret = true;
+    T value = static_cast<T>(min - 2);
+    while ((value < static_cast<T>(max + 2)) && (ret)) {
+        uint32 expected = 0u;
+        if (value >= max) {
+            expected = (nBins - 1u);
+        }
+        else if (value >= min) {
+            expected = 1u;
+            for (uint32 i = 1u; i < (nBins - 2u); i++) {
+                if (value >= static_cast<T>(min + static_cast<T>(i * delta))) {
+                    expected = (i + 1u);
+                }
+            }
+        }
+        else {
+            expected = 0u;
+        }
+        ret = (test.InRange((void*) &value) == expected);
+        value++;
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetEdges() {
+    HistogramComparatorT<T> test;
+    T edges[] = { 1, 2, 4, 8, 16 };
+    bool ret = test.SetEdges((void*) &edges[0], 5u);
+    if (ret) {
+        ret = (test.GetNumberOfBins() == 6u);
+    }
+    T values[] = { 0, 1, 2, 3, 4, 7, 8, 15, 16, 100 };
+    uint32 expected[] = { 0u, 1u, 2u, 2u, 3u, 3u, 4u, 4u, 5u, 5u };
+    for (uint32 i = 0u; (i < 10u) && (ret); i++) {
+        ret = (test.InRange((void*) &values[i]) == expected[i]);
+    }
+    return ret;
+}
+
+template<typename T>
+bool HistogramComparatorTTest<T>::TestSetEdges_False_NotIncreasing() {
+    HistogramComparatorT<T> test;
+    T edges[] = { 1, 2, 2, 8 };
+    bool ret = !test.SetEdges((void*) &edges[0], 4u);
+    if (ret) {
+        ret = !test.SetEdges((void*) &edges[0], 1u);
+    }
+    if (ret) {
+        ret = (test.GetNumberOfBins() == 3u);
+    }
+    return ret;
+}
 
+template<typename T>
+bool HistogramComparatorTTest<T>::TestAccumulate() {
+    HistogramComparatorT<T> test;
+    T min = 0;
+    T max = 10;
+    test.SetMin((void*) &min);
+    test.SetMax((void*) &max);
+    test.SetNumberOfBins(12u);
+    T values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 5, 5, 120 };
+    uint32 histogram[12];
+    for (uint32 i = 0u; i < 12u; i++) {
+        histogram[i] = 0u;
+    }
+    test.Accumulate((void*) &values[0], 15u, &histogram[0]);
+    bool ret = (histogram[0] == 0u);
+    for (uint32 i = 1u; (i < 11u) && (ret); i++) {
+        if (i == 6u) {
+            ret = (histogram[i] == 3u);
+        }
+        else {
+            ret = (histogram[i] == 1u);
+        }
+    }
+    if (ret) {
+        ret = (histogram[11] == 3u);
+    }
+    return ret;
+}
+
+#endif /* HISTOGRAM_COMPARATORTTEST_H_ */
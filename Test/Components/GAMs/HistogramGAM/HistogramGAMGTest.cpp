@@ -64,14 +64,29 @@ TEST(HistogramGAMGTest,TestSetup_DifferentInputOutputNSignals) {
     ASSERT_TRUE(test.TestSetup_DifferentInputOutputNSignals());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseInputNotScalar) {
+TEST(HistogramGAMGTest,TestSetup_InputNotScalar) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseInputNotScalar());
+    ASSERT_TRUE(test.TestSetup_InputNotScalar());
 }
 
-TEST(HistogramGAMGTest,TestSetup_FalseSamplesNotOne) {
+TEST(HistogramGAMGTest,TestSetup_SamplesNotOne) {
     HistogramGAMTest test;
-    ASSERT_TRUE(test.TestSetup_FalseSamplesNotOne());
+    ASSERT_TRUE(test.TestSetup_SamplesNotOne());
+}
+
+TEST(HistogramGAMGTest,TestSetup_Edges) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Edges());
+}
+
+TEST(HistogramGAMGTest,TestSetup_False_EdgesNumberOfBins) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_EdgesNumberOfBins());
+}
+
+TEST(HistogramGAMGTest,TestSetup_False_EdgesNotIncreasing) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestSetup_False_EdgesNotIncreasing());
 }
 
 TEST(HistogramGAMGTest,TestSetup_UndefinedMaxLim) {
@@ -104,6 +119,16 @@ TEST(HistogramGAMGTest,TestExecute_BeginCycleNumber) {
     ASSERT_TRUE(test.TestExecute_BeginCycleNumber());
 }
 
+TEST(HistogramGAMGTest,TestExecute_MultipleSamples) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultipleSamples());
+}
+
+TEST(HistogramGAMGTest,TestExecute_Edges) {
+    HistogramGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Edges());
+}
+
 TEST(HistogramGAMGTest,TestPrepareNextState) {
     HistogramGAMTest test;
     ASSERT_TRUE(test.TestPrepareNextState());
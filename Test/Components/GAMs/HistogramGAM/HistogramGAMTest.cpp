@@ -235,6 +235,74 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function to configure the signals of a HistogramGAM with one input signal and one output signal,
+ * without a RealTimeApplication.
+ */
+static bool ConfigureSingleSignal(ConfigurationDatabase &cdb,
+                                  const char8 * const inputType,
+                                  const uint32 typeSize,
+                                  const uint32 numberOfElements,
+                                  const uint32 numberOfSamples,
+                                  const uint32 numberOfBins) {
+    uint32 inputByteSize = typeSize * numberOfElements;
+    uint32 outputByteSize = static_cast<uint32>(sizeof(uint32)) * numberOfBins;
+    bool ok = cdb.CreateAbsolute("Signals.InputSignals.0");
+    ok &= cdb.Write("QualifiedName", "Input0");
+    ok &= cdb.Write("DataSource", "TestDataSource");
+    ok &= cdb.Write("Type", inputType);
+    ok &= cdb.Write("NumberOfDimensions", 1);
+    ok &= cdb.Write("NumberOfElements", numberOfElements);
+    ok &= cdb.Write("ByteSize", inputByteSize);
+    ok &= cdb.MoveToAncestor(1u);
+    ok &= cdb.Write("ByteSize", inputByteSize * numberOfSamples);
+
+    ok &= cdb.CreateAbsolute("Signals.OutputSignals.0");
+    ok &= cdb.Write("QualifiedName", "Output0");
+    ok &= cdb.Write("DataSource", "TestDataSource");
+    ok &= cdb.Write("Type", "uint32");
+    ok &= cdb.Write("NumberOfDimensions", 1);
+    ok &= cdb.Write("NumberOfElements", numberOfBins);
+    ok &= cdb.Write("ByteSize", outputByteSize);
+    ok &= cdb.MoveToAncestor(1u);
+    ok &= cdb.Write("ByteSize", outputByteSize);
+
+    ok &= cdb.CreateAbsolute("Memory.InputSignals.0");
+    ok &= cdb.Write("DataSource", "TestDataSource");
+    ok &= cdb.CreateAbsolute("Memory.InputSignals.0.Signals.0");
+    ok &= cdb.Write("Samples", numberOfSamples);
+
+    ok &= cdb.CreateAbsolute("Memory.OutputSignals.0");
+    ok &= cdb.Write("DataSource", "TestDataSource");
+    ok &= cdb.CreateAbsolute("Memory.OutputSignals.0.Signals.0");
+    ok &= cdb.Write("Samples", 1);
+    ok &= cdb.MoveToRoot();
+    return ok;
+}
+
+/**
+ * Helper function to initialise a HistogramGAM configured with ConfigureSingleSignal.
+ */
+static bool InitialiseGAM(HistogramGAMTestGAM &gam,
+                          ConfigurationDatabase &cdb) {
+    ConfigurationDatabase gamCdb;
+    gam.SetName("Test");
+    bool ok = gam.Initialise(gamCdb);
+    if (ok) {
+        ok = gam.SetConfiguredDatabase(cdb);
+    }
+    if (ok) {
+        ok = gam.AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok = gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok = gam.Setup();
+    }
+    return ok;
+}
+
 HistogramGAMTest::HistogramGAMTest() {
 
 }
@@ -635,7 +703,7 @@ bool HistogramGAMTest::TestSetup_DifferentInputOutputNSignals() {
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
+bool HistogramGAMTest::TestSetup_InputNotScalar() {
 
     const char8 *config = ""
             "$Application = {"
@@ -811,187 +879,30 @@ bool HistogramGAMTest::TestSetup_FalseInputNotScalar() {
             "}";
 
     ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
     god->Purge();
     return ret;
 }
 
-bool HistogramGAMTest::TestSetup_FalseSamplesNotOne() {
-
-    const char8 *config = ""
-            "$Application = {"
-            "   Class = RealTimeApplication"
-            "   +Functions = {"
-            "       Class = ReferenceContainer"
-            "       +GAM1 = {"
-            "           Class = HistogramGAMTestGAM"
-            "             BeginCycleNumber = 10"
-            "             InputSignals = {"
-            "                 Source_U8 = {"
-            "                     DataSource = Input"
-            "                     Frequency = 1"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = uint8"
-            "                 }"
-            "                 Source_I8 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = int8"
-            "                     Samples = 2"
-            "                 }"
-            "                 Source_U16 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = uint16"
-            "                 }"
-            "                 Source_I16 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = int16"
-            "                 }"
-            "                 Source_U32 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = uint32"
-            "                 }"
-            "                 Source_i32 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = int32"
-            "                 }"
-            "                 Source_U64 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = uint64"
-            "                 }"
-            "                 Source_I64 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = int64"
-            "                 }"
-            "                 Source_F32 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = float32"
-            "                 }"
-            "                 Source_F64 = {"
-            "                     DataSource = Input"
-            "                     MaxLim = 10"
-            "                     MinLim = 0"
-            "                     Type = float64"
-            "                 }"
-            "             }"
-            "             OutputSignals = {"
-            "                 Statistics_U8 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_I8 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_U16 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_I16 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_U32 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_I32 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_U64 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_I64 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_F32 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "                 Statistics_F64 = {"
-            "                     DataSource = DDB1"
-            "                     Type = uint32"
-            "                     NumberOfDimensions = 1"
-            "                     NumberOfElements = 12"
-            "                 }"
-            "             }"
-            "        }"
-            "    }"
-            "    +Data = {"
-            "        Class = ReferenceContainer"
-            "        DefaultDataSource = DDB1"
-            "        +DDB1 = {"
-            "            Class = GAMDataSource"
-            "        }"
-            "        +Timings = {"
-            "            Class = TimingDataSource"
-            "        }"
-            "        +LoggerDataSource = {"
-            "            Class = LoggerDataSource"
-            "        }"
-            "        +Input = {"
-            "            Class = HistogramGAMTestDS"
-            "        }"
-            "    }"
-            "    +States = {"
-            "        Class = ReferenceContainer"
-            "        +Idle = {"
-            "            Class = RealTimeState"
-            "            +Threads = {"
-            "                Class = ReferenceContainer"
-            "                +Thread1 = {"
-            "                    Class = RealTimeThread"
-            "                    CPUs = 2"
-            "                    Functions = { GAM1 }"
-            "                }"
-            "            }"
-            "         }"
-            "     }"
-            "     +Scheduler = {"
-            "         Class = GAMScheduler"
-            "         TimingDataSource = Timings"
-            "     }"
-            "}";
-    ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
-    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
-    god->Purge();
+bool HistogramGAMTest::TestSetup_SamplesNotOne() {
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "float32", sizeof(float32), 10u, 4u, 12u);
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("MinLim", 0.0);
+    }
+    if (ret) {
+        ret = cdb.Write("MaxLim", 10.0);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb);
+    }
     return ret;
 }
 
@@ -3686,3 +3597,154 @@ bool HistogramGAMTest::TestPrepareNextState_Reset_State() {
     god->Purge();
     return ret;
 }
+
+bool HistogramGAMTest::TestSetup_Edges() {
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "int16", sizeof(int16), 1u, 1u, 6u);
+    int16 edges[] = { -100, -10, 0, 10, 100 };
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("Edges", edges);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb);
+    }
+    if (ret) {
+        ret = (gam.GetComps()[0]->GetNumberOfBins() == 6u);
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_False_EdgesNumberOfBins() {
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "int16", sizeof(int16), 1u, 1u, 5u);
+    int16 edges[] = { -100, -10, 0, 10, 100 };
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("Edges", edges);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = !InitialiseGAM(gam, cdb);
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestSetup_False_EdgesNotIncreasing() {
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "int16", sizeof(int16), 1u, 1u, 6u);
+    int16 edges[] = { -100, -10, 10, 0, 100 };
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("Edges", edges);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = !InitialiseGAM(gam, cdb);
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_MultipleSamples() {
+    const uint32 numberOfSamples = 2000u;
+    const uint32 numberOfBins = 1024u;
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "float32", sizeof(float32), 1u, numberOfSamples, numberOfBins);
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("MinLim", -1.0);
+    }
+    if (ret) {
+        ret = cdb.Write("MaxLim", 1.0);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb);
+    }
+    if (ret) {
+        float32 *inMem = static_cast<float32 *>(gam.GetInputSignalsMemory());
+        uint32 *outMem = static_cast<uint32 *>(gam.GetOutputSignalsMemory());
+        //bin width = 2 / 1022. Put one value in the middle of each in range bin and the rest out of range.
+        const float32 delta = static_cast<float32>(2.0 / (numberOfBins - 2u));
+        for (uint32 j = 0u; j < numberOfBins; j++) {
+            outMem[j] = 0u;
+        }
+        for (uint32 n = 0u; n < numberOfSamples; n++) {
+            if (n < (numberOfBins - 2u)) {
+                inMem[n] = static_cast<float32>(-1.0 + ((n + 0.5) * delta));
+            }
+            else if ((n % 2u) == 0u) {
+                inMem[n] = -2.0F;
+            }
+            else {
+                inMem[n] = 2.0F;
+            }
+        }
+        ret = gam.Execute();
+        ret &= gam.Execute();
+        uint32 outOfRange = (numberOfSamples - (numberOfBins - 2u)) / 2u;
+        ret &= (outMem[0] == (2u * outOfRange));
+        ret &= (outMem[numberOfBins - 1u] == (2u * outOfRange));
+        for (uint32 j = 1u; (j < (numberOfBins - 1u)) && (ret); j++) {
+            ret = (outMem[j] == 2u);
+        }
+    }
+    return ret;
+}
+
+bool HistogramGAMTest::TestExecute_Edges() {
+    HistogramGAMTestGAM gam;
+    ConfigurationDatabase cdb;
+    bool ret = ConfigureSingleSignal(cdb, "int16", sizeof(int16), 8u, 2u, 6u);
+    int16 edges[] = { -100, -10, 0, 10, 100 };
+    if (ret) {
+        ret = cdb.MoveAbsolute("Signals.InputSignals.0");
+    }
+    if (ret) {
+        ret = cdb.Write("Edges", edges);
+    }
+    if (ret) {
+        ret = cdb.MoveToRoot();
+    }
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb);
+    }
+    if (ret) {
+        int16 values[] = { -1000, -100, -11, -10, -1, 0, 9, 10, 99, 100, 1000, 5, 5, 5, -50, -101 };
+        uint32 expected[] = { 2u, 3u, 2u, 5u, 2u, 2u };
+        int16 *inMem = static_cast<int16 *>(gam.GetInputSignalsMemory());
+        uint32 *outMem = static_cast<uint32 *>(gam.GetOutputSignalsMemory());
+        for (uint32 n = 0u; n < 16u; n++) {
+            inMem[n] = values[n];
+        }
+        for (uint32 j = 0u; j < 6u; j++) {
+            outMem[j] = 0u;
+        }
+        ret = gam.Execute();
+        for (uint32 j = 0u; (j < 6u) && (ret); j++) {
+            ret = (outMem[j] == expected[j]);
+        }
+    }
+    return ret;
+}
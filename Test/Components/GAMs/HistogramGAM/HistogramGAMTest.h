@@ -76,16 +76,32 @@ public:
     bool TestSetup_DifferentInputOutputNSignals();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfElements>1
+     * @brief Tests the HistogramGAM::Setup method with one or more
+     * input signals with NumberOfElements>1
      */
-    bool TestSetup_FalseInputNotScalar();
+    bool TestSetup_InputNotScalar();
 
     /**
-     * @brief Tests the HistogramGAM::Setup method that fails if one or more
-     * input signals have NumberOfSamples > 1
+     * @brief Tests the HistogramGAM::Setup method with one or more
+     * input signals with NumberOfSamples > 1
      */
-    bool TestSetup_FalseSamplesNotOne();
+    bool TestSetup_SamplesNotOne();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method with non-uniform Edges.
+     */
+    bool TestSetup_Edges();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method that fails if the output NumberOfElements
+     * is not the number of Edges + 1.
+     */
+    bool TestSetup_False_EdgesNumberOfBins();
+
+    /**
+     * @brief Tests the HistogramGAM::Setup method that fails if the Edges are not strictly increasing.
+     */
+    bool TestSetup_False_EdgesNotIncreasing();
 
     /**
      * @brief Tests the HistogramGAM::Setup method that fails if MaxLim is not
@@ -121,6 +137,16 @@ public:
      */
     bool TestExecute_BeginCycleNumber();
 
+    /**
+     * @brief Tests the HistogramGAM::Execute method with 2000 samples per cycle and 1024 bins.
+     */
+    bool TestExecute_MultipleSamples();
+
+    /**
+     * @brief Tests the HistogramGAM::Execute method with non-uniform Edges and a multi-sample array input signal.
+     */
+    bool TestExecute_Edges();
+
     /**
      * @brief Tests the PrepareNextState without a reset
      */
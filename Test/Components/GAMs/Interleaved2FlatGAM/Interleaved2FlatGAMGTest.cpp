@@ -107,3 +107,23 @@ TEST(Interleaved2FlatGAMGTest,TestExecute_MultiPacketNoSamples) {
     Interleaved2FlatGAMTest test;
     ASSERT_TRUE(test.TestExecute_MultiPacketNoSamples());
 }
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_HomogeneousPacket_Interleaved2Flat) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_HomogeneousPacket_Interleaved2Flat());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_HomogeneousPacket_Flat2Interleaved) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_HomogeneousPacket_Flat2Interleaved());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_OddPacketMemberSizes) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_OddPacketMemberSizes());
+}
+
+TEST(Interleaved2FlatGAMGTest,TestExecute_InputSpanningMultipleOutputs) {
+    Interleaved2FlatGAMTest test;
+    ASSERT_TRUE(test.TestExecute_InputSpanningMultipleOutputs());
+}
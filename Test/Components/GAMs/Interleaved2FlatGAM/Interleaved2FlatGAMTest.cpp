@@ -73,6 +73,10 @@ Interleaved2FlatGAMTestGAM    ();
 
     uint32 GetTotalSignalsByteSize();
 
+    Interleaved2FlatGAMCopyOperation *GetCopyPlan();
+
+    uint32 GetNumberOfCopyOperations();
+
     void *GetInputSignalsMemory1();
 
     void *GetOutputSignalsMemory1();
@@ -122,6 +126,14 @@ uint32 Interleaved2FlatGAMTestGAM::GetTotalSignalsByteSize() {
     return totalSignalsByteSize;
 }
 
+Interleaved2FlatGAMCopyOperation *Interleaved2FlatGAMTestGAM::GetCopyPlan() {
+    return copyPlan;
+}
+
+uint32 Interleaved2FlatGAMTestGAM::GetNumberOfCopyOperations() {
+    return numberOfCopyOperations;
+}
+
 void *Interleaved2FlatGAMTestGAM::GetInputSignalsMemory1() {
     return GAM::GetInputSignalsMemory();
 }
@@ -985,6 +997,116 @@ static bool InitialiseMemoryMapInputBrokerEnviroment(const char8 * const config)
     return ok;
 }
 
+/**
+ * Helper function to add a signal to the configured database of a GAM which is not part of a RealTimeApplication.
+ */
+static bool AddSignal(ConfigurationDatabase &cdb,
+                      const char8 * const direction,
+                      const uint32 signalIdx,
+                      const char8 * const type,
+                      const uint32 typeSize,
+                      const uint32 numberOfElements) {
+    StreamString path;
+    bool ok = path.Printf("Signals.%s.%d", direction, signalIdx);
+    if (ok) {
+        ok = cdb.CreateAbsolute(path.Buffer());
+    }
+    StreamString name;
+    if (ok) {
+        ok = name.Printf("%s%d", direction, signalIdx);
+    }
+    if (ok) {
+        ok = cdb.Write("QualifiedName", name.Buffer());
+        ok &= cdb.Write("DataSource", "TestDataSource");
+        ok &= cdb.Write("Type", type);
+        ok &= cdb.Write("NumberOfDimensions", 1);
+        ok &= cdb.Write("NumberOfElements", numberOfElements);
+        ok &= cdb.Write("ByteSize", typeSize * numberOfElements);
+    }
+    if (ok) {
+        path = "";
+        ok = path.Printf("Memory.%s.0.Signals.%d", direction, signalIdx);
+    }
+    if (ok) {
+        ok = cdb.CreateAbsolute(path.Buffer());
+    }
+    if (ok) {
+        ok = cdb.Write("Samples", 1);
+    }
+    if (ok) {
+        ok = cdb.MoveToAncestor(2u);
+    }
+    if (ok) {
+        ok = cdb.Write("DataSource", "TestDataSource");
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * Helper function to set the PacketMemberSizes of a signal added with AddSignal.
+ */
+static bool SetPacketMemberSizes(ConfigurationDatabase &cdb,
+                                 const char8 * const direction,
+                                 const uint32 signalIdx,
+                                 uint32 * const packetMemberSizes,
+                                 const uint32 numberOfPacketMembers) {
+    StreamString path;
+    bool ok = path.Printf("Signals.%s.%d", direction, signalIdx);
+    if (ok) {
+        ok = cdb.MoveAbsolute(path.Buffer());
+    }
+    if (ok) {
+        Vector<uint32> sizes(packetMemberSizes, numberOfPacketMembers);
+        ok = cdb.Write("PacketMemberSizes", sizes);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    return ok;
+}
+
+/**
+ * Helper function to set the total byte size of the signals of one direction and to setup the GAM.
+ */
+static bool InitialiseGAM(Interleaved2FlatGAMTestGAM &gam,
+                          ConfigurationDatabase &cdb,
+                          const uint32 totalByteSize) {
+    bool ok = cdb.MoveAbsolute("Signals.InputSignals");
+    if (ok) {
+        ok = cdb.Write("ByteSize", totalByteSize);
+    }
+    if (ok) {
+        ok = cdb.MoveAbsolute("Signals.OutputSignals");
+    }
+    if (ok) {
+        ok = cdb.Write("ByteSize", totalByteSize);
+    }
+    if (ok) {
+        ok = cdb.MoveToRoot();
+    }
+    ConfigurationDatabase gamCdb;
+    gam.SetName("Test");
+    if (ok) {
+        ok = gam.Initialise(gamCdb);
+    }
+    if (ok) {
+        ok = gam.SetConfiguredDatabase(cdb);
+    }
+    if (ok) {
+        ok = gam.AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok = gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok = gam.Setup();
+    }
+    return ok;
+}
+
 Interleaved2FlatGAMTest::Interleaved2FlatGAMTest() {
 }
 
@@ -1003,6 +1125,8 @@ bool Interleaved2FlatGAMTest::TestConstructor() {
     ret &= gam.GetPacketInputChunkSize() == NULL;
     ret &= gam.GetPacketOutputChunkSize() == NULL;
     ret &= gam.GetTotalSignalsByteSize() == 0;
+    ret &= gam.GetCopyPlan() == NULL;
+    ret &= gam.GetNumberOfCopyOperations() == 0;
 
     return ret;
 
@@ -2994,3 +3118,168 @@ bool Interleaved2FlatGAMTest::TestExecute_MultiPacketNoSamples() {
     }
     return ret;
 }
+
+bool Interleaved2FlatGAMTest::TestExecute_HomogeneousPacket_Interleaved2Flat() {
+    const uint32 numberOfChannels = 16u;
+    const uint32 numberOfSamples = 1000u;
+    uint32 packetMemberSizes[numberOfChannels];
+    ConfigurationDatabase cdb;
+    bool ret = AddSignal(cdb, "InputSignals", 0u, "uint16", sizeof(uint16), numberOfChannels * numberOfSamples);
+    for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+        packetMemberSizes[c] = sizeof(uint16);
+        ret = AddSignal(cdb, "OutputSignals", c, "uint16", sizeof(uint16), numberOfSamples);
+    }
+    if (ret) {
+        ret = SetPacketMemberSizes(cdb, "InputSignals", 0u, &packetMemberSizes[0], numberOfChannels);
+    }
+    Interleaved2FlatGAMTestGAM gam;
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb, numberOfChannels * numberOfSamples * sizeof(uint16));
+    }
+    //all the channels are moved by the same transpose
+    if (ret) {
+        ret = (gam.GetNumberOfCopyOperations() == 1u);
+    }
+    if (ret) {
+        ret = (gam.GetCopyPlan()[0].numberOfChannels == numberOfChannels);
+    }
+    if (ret) {
+        uint16 *mem = static_cast<uint16 *>(gam.GetInputSignalsMemory1());
+        for (uint32 k = 0u; k < numberOfSamples; k++) {
+            for (uint32 c = 0u; c < numberOfChannels; c++) {
+                mem[(k * numberOfChannels) + c] = static_cast<uint16>((c * numberOfSamples) + k);
+            }
+        }
+        ret = gam.Execute();
+    }
+    if (ret) {
+        uint16 *mem = static_cast<uint16 *>(gam.GetOutputSignalsMemory1());
+        for (uint32 n = 0u; (n < (numberOfChannels * numberOfSamples)) && (ret); n++) {
+            ret = (mem[n] == n);
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_HomogeneousPacket_Flat2Interleaved() {
+    const uint32 numberOfChannels = 16u;
+    const uint32 numberOfSamples = 1000u;
+    uint32 packetMemberSizes[numberOfChannels];
+    ConfigurationDatabase cdb;
+    bool ret = AddSignal(cdb, "OutputSignals", 0u, "uint16", sizeof(uint16), numberOfChannels * numberOfSamples);
+    for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+        packetMemberSizes[c] = sizeof(uint16);
+        ret = AddSignal(cdb, "InputSignals", c, "uint16", sizeof(uint16), numberOfSamples);
+    }
+    if (ret) {
+        ret = SetPacketMemberSizes(cdb, "OutputSignals", 0u, &packetMemberSizes[0], numberOfChannels);
+    }
+    Interleaved2FlatGAMTestGAM gam;
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb, numberOfChannels * numberOfSamples * sizeof(uint16));
+    }
+    if (ret) {
+        ret = (gam.GetNumberOfCopyOperations() == 1u);
+    }
+    if (ret) {
+        ret = (gam.GetCopyPlan()[0].numberOfChannels == numberOfChannels);
+    }
+    if (ret) {
+        uint16 *mem = static_cast<uint16 *>(gam.GetInputSignalsMemory1());
+        for (uint32 n = 0u; n < (numberOfChannels * numberOfSamples); n++) {
+            mem[n] = static_cast<uint16>(n);
+        }
+        ret = gam.Execute();
+    }
+    if (ret) {
+        uint16 *mem = static_cast<uint16 *>(gam.GetOutputSignalsMemory1());
+        for (uint32 k = 0u; (k < numberOfSamples) && (ret); k++) {
+            for (uint32 c = 0u; (c < numberOfChannels) && (ret); c++) {
+                ret = (mem[(k * numberOfChannels) + c] == ((c * numberOfSamples) + k));
+            }
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_OddPacketMemberSizes() {
+    const uint32 numberOfMembers = 4u;
+    const uint32 numberOfSamples = 10u;
+    uint32 packetMemberSizes[numberOfMembers] = { 3u, 5u, 1u, 7u };
+    const uint32 packetSize = 16u;
+    ConfigurationDatabase cdb;
+    bool ret = AddSignal(cdb, "InputSignals", 0u, "uint8", sizeof(uint8), packetSize * numberOfSamples);
+    for (uint32 i = 0u; (i < numberOfMembers) && (ret); i++) {
+        ret = AddSignal(cdb, "OutputSignals", i, "uint8", sizeof(uint8), packetMemberSizes[i] * numberOfSamples);
+    }
+    if (ret) {
+        ret = SetPacketMemberSizes(cdb, "InputSignals", 0u, &packetMemberSizes[0], numberOfMembers);
+    }
+    Interleaved2FlatGAMTestGAM gam;
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb, packetSize * numberOfSamples);
+    }
+    if (ret) {
+        ret = (gam.GetNumberOfCopyOperations() == numberOfMembers);
+    }
+    if (ret) {
+        uint8 *mem = static_cast<uint8 *>(gam.GetInputSignalsMemory1());
+        for (uint32 n = 0u; n < (packetSize * numberOfSamples); n++) {
+            mem[n] = static_cast<uint8>(n);
+        }
+        ret = gam.Execute();
+    }
+    if (ret) {
+        uint8 *mem = static_cast<uint8 *>(gam.GetOutputSignalsMemory1());
+        uint32 memberOffset = 0u;
+        for (uint32 i = 0u; (i < numberOfMembers) && (ret); i++) {
+            for (uint32 k = 0u; (k < numberOfSamples) && (ret); k++) {
+                for (uint32 b = 0u; (b < packetMemberSizes[i]) && (ret); b++) {
+                    ret = (*mem == static_cast<uint8>((k * packetSize) + memberOffset + b));
+                    mem++;
+                }
+            }
+            memberOffset += packetMemberSizes[i];
+        }
+    }
+    return ret;
+}
+
+bool Interleaved2FlatGAMTest::TestExecute_InputSpanningMultipleOutputs() {
+    const uint32 numberOfOutputs = 3u;
+    //a flat block of 4 bytes, then 2 packets {1, 2} and then 2 packets {2, 2}
+    const uint32 outputSizes[numberOfOutputs] = { 4u, 6u, 8u };
+    uint32 packetMemberSizes1[] = { 1u, 2u };
+    uint32 packetMemberSizes2[] = { 2u, 2u };
+    const uint32 totalSize = 18u;
+    ConfigurationDatabase cdb;
+    bool ret = AddSignal(cdb, "InputSignals", 0u, "uint8", sizeof(uint8), totalSize);
+    for (uint32 i = 0u; (i < numberOfOutputs) && (ret); i++) {
+        ret = AddSignal(cdb, "OutputSignals", i, "uint8", sizeof(uint8), outputSizes[i]);
+    }
+    if (ret) {
+        ret = SetPacketMemberSizes(cdb, "OutputSignals", 1u, &packetMemberSizes1[0], 2u);
+    }
+    if (ret) {
+        ret = SetPacketMemberSizes(cdb, "OutputSignals", 2u, &packetMemberSizes2[0], 2u);
+    }
+    Interleaved2FlatGAMTestGAM gam;
+    if (ret) {
+        ret = InitialiseGAM(gam, cdb, totalSize);
+    }
+    if (ret) {
+        uint8 *mem = static_cast<uint8 *>(gam.GetInputSignalsMemory1());
+        for (uint32 n = 0u; n < totalSize; n++) {
+            mem[n] = static_cast<uint8>(n);
+        }
+        ret = gam.Execute();
+    }
+    if (ret) {
+        const uint8 expected[totalSize] = { 0u, 1u, 2u, 3u, 4u, 6u, 7u, 5u, 8u, 9u, 10u, 11u, 14u, 15u, 12u, 13u, 16u, 17u };
+        uint8 *mem = static_cast<uint8 *>(gam.GetOutputSignalsMemory1());
+        for (uint32 n = 0u; (n < totalSize) && (ret); n++) {
+            ret = (mem[n] == expected[n]);
+        }
+    }
+    return ret;
+}
@@ -121,6 +121,26 @@ public:
      */
     bool TestExecute_MultiPacketNoSamples();
 
+    /**
+     * @brief Tests the Execute method with 16 interleaved uint16 channels x 1000 samples (a single transpose in the copy plan).
+     */
+    bool TestExecute_HomogeneousPacket_Interleaved2Flat();
+
+    /**
+     * @brief Tests the Execute method with 16 flat uint16 channels x 1000 samples translated into an interleaved signal.
+     */
+    bool TestExecute_HomogeneousPacket_Flat2Interleaved();
+
+    /**
+     * @brief Tests the Execute method with packet members whose size is not 1, 2, 4 or 8 bytes.
+     */
+    bool TestExecute_OddPacketMemberSizes();
+
+    /**
+     * @brief Tests the Execute method with one flat input signal spanning a flat output signal followed by two interleaved output signals.
+     */
+    bool TestExecute_InputSpanningMultipleOutputs();
+
 };
 
 /*---------------------------------------------------------------------------*/
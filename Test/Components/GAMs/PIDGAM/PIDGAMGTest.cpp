@@ -315,5 +315,27 @@ TEST(PIDGAMGTest, TestExecuteSaturationki3) {
     ASSERT_TRUE(test.TestExecuteSaturationki3());
 }
 
+TEST(PIDGAMGTest, TestInitialiseWrongNumberOfParameters) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongNumberOfParameters());
+}
+
+TEST(PIDGAMGTest, TestSetupWrongNumberOfParameters) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestSetupWrongNumberOfParameters());
+}
+
+TEST(PIDGAMGTest, TestExecuteMultiChannel) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteMultiChannel());
+}
 
+TEST(PIDGAMGTest, TestExecuteBackCalculation) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteBackCalculation());
+}
 
+TEST(PIDGAMGTest, TestExecuteOutputRateLimit) {
+    PIDGAMTest test;
+    ASSERT_TRUE(test.TestExecuteOutputRateLimit());
+}
@@ -97,7 +97,7 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -116,7 +116,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -145,14 +145,14 @@ public:
 
         ok = configSignals.CreateAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
         ok &= configSignals.Write("ByteSize", byteSizePerSignal);
         ok &= configSignals.MoveAbsolute("Signals.InputSignals");
         ok &= configSignals.CreateRelative("1");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Measurement");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -177,7 +177,7 @@ public:
         ok &= configSignals.MoveToRoot();
         ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
         ok &= configSignals.CreateRelative("0");
-        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfElements", numberOfElements);
         ok &= configSignals.Write("DataSource", "Reference");
         ok &= configSignals.Write("NumberOfDimensions", 1);
         ok &= configSignals.Write("Type", "float64");
@@ -2415,5 +2415,143 @@ bool PIDGAMTest::TestExecuteSaturationki3() {
     return ret;
 }
 
+
+bool PIDGAMTest::TestInitialiseWrongNumberOfParameters() {
+    PIDGAM gam;
+    ConfigurationDatabase config;
+    bool ret;
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    float64 kiArray[] = { 1.0, 2.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    Vector<float64> kiVector(kiArray, 2u);
+    ret = config.Write("Kp", kpVector);
+    ret &= config.Write("Ki", kiVector);
+    ret &= config.Write("SampleTime", 0.001);
+    if (ret) {
+        ret = !gam.Initialise(config);
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestSetupWrongNumberOfParameters() {
+    bool ret;
+    PIDGAMTestHelper gam(1, 0, 0, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 2);
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    ret = gam.config.Write("Kp", kpVector);
+    ret &= gam.config.Write("SampleTime", 0.001);
+    ret &= gam.Initialise(gam.config);
+
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    if (ret) {
+        ret = !gam.Setup();
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteMultiChannel() {
+    bool ret;
+    PIDGAMTestHelper gam(1, 0, 0, 0.001, 0x1.FFFFFFFFFFFFFp1023, -0x1.FFFFFFFFFFFFFp1023, 3);
+    float64 kpArray[] = { 1.0, 2.0, 3.0 };
+    float64 maxOutputArray[] = { 10.0, 10.0, 1.0 };
+    Vector<float64> kpVector(kpArray, 3u);
+    ret = gam.config.Write("Kp", kpVector);
+    ret &= gam.config.Write("SampleTime", 0.001);
+    Vector<float64> maxOutputVector(maxOutputArray, 3u);
+    ret &= gam.config.Write("MaxOutput", maxOutputVector);
+    ret &= gam.config.Write("MinOutput", -10.0);
+    ret &= gam.Initialise(gam.config);
+
+    ret &= gam.HelperSetup2();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    if (ret) {
+        float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        float64 *gamMemoryInM = static_cast<float64 *>(gam.GetInputSignalsMemory(1));
+        float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        float64 expectedValue[] = { 1.0, 4.0, 1.0 };
+        gamMemoryInR[0] = 1.0;
+        gamMemoryInR[1] = 1.0;
+        gamMemoryInR[2] = 1.0;
+        gamMemoryInM[0] = 0.0;
+        gamMemoryInM[1] = -1.0;
+        gamMemoryInM[2] = 0.0;
+        gam.Execute();
+        for (uint32 i = 0u; (i < 3u) && (ret); i++) {
+            ret = gam.IsEqualLargerMargins(gamMemoryOut[i], expectedValue[i]);
+            if (!ret) {
+                printf("output value = %.17lf. expectedValue = %.17lf. index = %u \n", gamMemoryOut[i], expectedValue[i], i);
+            }
+        }
+    }
+    return ret;
+}
+
+bool PIDGAMTest::TestExecuteBackCalculation() {
+    bool ret;
+    PIDGAMTestHelper gam(0, 500, 0, 0.001, 0.2, -0.2);
+    ret = gam.HelperInitialise();
+    ret &= gam.config.Write("TrackingGain", 1000.0);
+    ret &= gam.Initialise(gam.config);
+
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    uint32 maxRep = 6;
+    //While saturated the integral is kept at the saturation value, so the output leaves the saturation as soon as the error changes sign.
+    float64 expectedValue[] = { 0.2, 0.2, 0.2, 0.15, 0.1, 0.05 };
+    for (uint32 i = 0u; i < maxRep && ret; i++) {
+        //set inputs
+        *gamMemoryInR = (i < 3u) ? 1.0 : -0.1;
+        gam.Execute();
+        //Check output
+        ret &= ((*gamMemoryOut - expectedValue[i]) < 1e-12) && ((*gamMemoryOut - expectedValue[i]) > -1e-12);
+        if (!ret) {
+            printf("output value = %.17lf. expectedValue = %.17lf. index = %u \n", *gamMemoryOut, expectedValue[i], i);
+        }
+    }
+    return ret;
 }
 
+bool PIDGAMTest::TestExecuteOutputRateLimit() {
+    bool ret;
+    PIDGAMTestHelper gam(1, 0, 0, 0.001);
+    ret = gam.HelperInitialise();
+    ret &= gam.config.Write("MaxOutputRate", 100.0);
+    ret &= gam.Initialise(gam.config);
+
+    ret &= gam.HelperSetup1();
+    ret &= gam.SetConfiguredDatabase(gam.configSignals);
+    ret &= gam.AllocateInputSignalsMemory();
+    ret &= gam.AllocateOutputSignalsMemory();
+    ret &= gam.Setup();
+
+    float64 *gamMemoryInR = static_cast<float64 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    uint32 maxRep = 15;
+    for (uint32 i = 0u; i < maxRep && ret; i++) {
+        //set inputs
+        *gamMemoryInR = 1.0;
+        gam.Execute();
+        //Check output. The output ramps 0.1 per cycle until it reaches the reference.
+        float64 expectedValue = (i < 10u) ? (0.1 * (i + 1u)) : 1.0;
+        ret &= ((*gamMemoryOut - expectedValue) < 1e-12) && ((*gamMemoryOut - expectedValue) > -1e-12);
+        if (!ret) {
+            printf("output value = %.17lf. expectedValue = %.17lf. index = %u \n", *gamMemoryOut, expectedValue, i);
+        }
+    }
+    return ret;
+}
+
+}
@@ -345,6 +345,30 @@ public:
      */
     bool TestExecuteSaturationki3();
 
+    /**
+     * @brief Tests that the PIDGAM::Initialise() fails if the parameter arrays have different number of elements.
+     */
+    bool TestInitialiseWrongNumberOfParameters();
+
+    /**
+     * @brief Tests that the PIDGAM::Setup() fails if the parameter arrays do not have one element per signal element.
+     */
+    bool TestSetupWrongNumberOfParameters();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with three channels and per-channel gains and saturation limits.
+     */
+    bool TestExecuteMultiChannel();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with saturation and the back-calculation anti-windup.
+     */
+    bool TestExecuteBackCalculation();
+
+    /**
+     * @brief Test the PIDGAM::Execute() with the output rate limit.
+     */
+    bool TestExecuteOutputRateLimit();
 
 };
 
@@ -219,6 +219,11 @@ TEST(SSMGAMGTest, TestExecuteSpringNoFeedthroughMatrix) {
     ASSERT_TRUE(test.TestExecuteSpringNoFeedthroughMatrix());
 }
 
+TEST(SSMGAMGTest, TestExecuteSparse) {
+    SSMGAMTest test;
+    ASSERT_TRUE(test.TestExecuteSparse());
+}
+
 TEST(SSMGAMGTest, TestPrepareNextStateReset) {
     SSMGAMTest test;
     ASSERT_TRUE(test.TestPrepareNextStateReset(1));
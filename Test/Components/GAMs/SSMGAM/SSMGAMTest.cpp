@@ -352,6 +352,82 @@ SSMGAMTestHelper    () {
         ok &= configSignals.MoveToRoot();
         return ok;
     }
+    bool InitialiseConfigSparse() {
+        bool ok = true;
+        //x1[k+1] = 0.5 x1[k] + u[k], x2[k+1] = x1[k], x3[k+1] = x2[k], y[k] = x3[k]
+        float64 stateMatrix[3][3] = { { 0.5, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } };
+        Matrix<float64> matrix(&stateMatrix[0][0], 3u, 3u);
+        ok &= config.Write("StateMatrix", matrix);
+
+        float64 inputMatrix[3][1] = { { 1.0 }, { 0.0 }, { 0.0 } };
+        Matrix<float64> matrix2(&inputMatrix[0][0], 3u, 1u);
+        ok &= config.Write("InputMatrix", matrix2);
+
+        float64 outputMatrix[1][3] = { { 0.0, 0.0, 1.0 } };
+        Matrix<float64> matrix3(&outputMatrix[0][0], 1u, 3u);
+        ok &= config.Write("OutputMatrix", matrix3);
+        ok &= config.Write("ResetInEachState", 1);
+        return ok;
+    }
+
+    bool InitialiseConfigSignalsSparse() {
+        bool ok = true;
+        ok &= configSignals.CreateAbsolute("Signals.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Type", "float64");
+        ok &= configSignals.Write("NumberOfElements", 1);
+        ok &= configSignals.Write("NumberOfDimensions", 1);
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.Write("ByteSize", 8);
+        ok &= configSignals.MoveToAncestor(1u);
+        ok &= configSignals.Write("ByteSize", 8);
+
+        ok &= configSignals.CreateAbsolute("Signals.OutputSignals");
+        const char8 * const names[] = { "outputVector1", "stateVector1", "stateVector2", "stateVector3" };
+        for (uint32 i = 0u; i < 4u; i++) {
+            StreamString idx;
+            ok &= idx.Printf("%u", i);
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            ok &= configSignals.Write("QualifiedName", names[i]);
+            ok &= configSignals.Write("Type", "float64");
+            ok &= configSignals.Write("NumberOfElements", 1);
+            ok &= configSignals.Write("NumberOfDimensions", 1);
+            ok &= configSignals.Write("ByteSize", 8);
+            ok &= configSignals.Write("DataSource", (i == 0u) ? ("DataSourceOutputVector") : ("DataSourceStateVector"));
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+        ok &= configSignals.Write("ByteSize", 32);
+
+        ok &= configSignals.CreateAbsolute("Memory.InputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "TestDataSource");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Samples", 1);
+
+        ok &= configSignals.CreateAbsolute("Memory.OutputSignals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("DataSource", "DataSourceOutputVector");
+        ok &= configSignals.CreateRelative("Signals");
+        ok &= configSignals.CreateRelative("0");
+        ok &= configSignals.Write("Samples", 1);
+
+        ok &= configSignals.MoveToAncestor(3u);
+        ok &= configSignals.CreateRelative("1");
+        ok &= configSignals.Write("DataSource", "DataSourceStateVector");
+        ok &= configSignals.CreateRelative("Signals");
+        for (uint32 i = 1u; i < 4u; i++) {
+            StreamString idx;
+            ok &= idx.Printf("%u", i);
+            ok &= configSignals.CreateRelative(idx.Buffer());
+            ok &= configSignals.Write("Samples", 1);
+            ok &= configSignals.MoveToAncestor(1u);
+        }
+
+        ok &= configSignals.MoveToRoot();
+        return ok;
+    }
+
     bool IsEqualLargerMargins(const float64 f1, const float64 f2) {
         float64 *min=reinterpret_cast<float64*>(const_cast<uint64*>(&EPSILON_FLOAT64));
         float64 minLarger = 2 * *min;
@@ -2011,5 +2087,56 @@ bool SSMGAMTest::TestPrepareNextStateNoMemoryAllocated(uint32 resetEachStateConf
     return ok;
 }
 
+bool SSMGAMTest::TestExecuteSparse() {
+    bool ok = true;
+    SSMGAMTestHelper gam;
+    //n = 3, p = 1 and q = 1. Only 5 of the 16 coefficients of [C D; A B] are not zero.
+    ok &= gam.InitialiseConfigSparse();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigSignalsSparse();
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    float64 *gamMemoryIn = NULL_PTR(float64 *);
+    float64 *gamMemoryOut = NULL_PTR(float64 *);
+    if (ok) {
+        gamMemoryIn = static_cast<float64 *>(gam.GetInputSignalsMemory());
+        gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+        gamMemoryIn[0] = 1.0;
+    }
+    //{y, x1, x2, x3} for k = 0..4 with a step input
+    const float64 expected[5][4] = { { 0.0, 0.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0, 0.0 }, { 0.0, 1.5, 1.0, 0.0 }, { 1.0, 1.75, 1.5, 1.0 }, { 1.5, 1.875,
+            1.75, 1.5 } };
+    for (uint32 k = 0u; (k < 5u) && (ok); k++) {
+        ok = gam.Execute();
+        for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+            ok = gam.IsEqualLargerMargins(gamMemoryOut[i], expected[k][i]);
+            if (!ok) {
+                printf("k = %u, output %u = %.16lf\n", k, i, gamMemoryOut[i]);
+            }
+        }
+    }
+    if (ok) {
+        ok = gam.PrepareNextState("A", "B");
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = gam.IsEqualLargerMargins(gamMemoryOut[i], 0.0);
+    }
+    return ok;
 }
 
+}
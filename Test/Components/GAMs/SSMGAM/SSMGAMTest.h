@@ -258,6 +258,14 @@ public:
      */
     bool TestExecuteSpringNoFeedthroughMatrix();
 
+    /**
+     * @brief Test SSM::Execute().
+     * @details A chain of three states driven by a step, which is stored in the sparse (CSR) format.
+     * A[3x3], B[3x1], C[1x3] and no D. Also checks that PrepareNextState resets the states.
+     * @return true if the output is as expected.
+     */
+    bool TestExecuteSparse();
+
     /**
      * @brief Test the reset function
      */
@@ -169,6 +169,16 @@ TEST(StatisticsGAMGTest,TestExecute_uint32_withAbsoluteMaxMin) {
     ASSERT_TRUE(test.TestExecute_uint32_withAbsoluteMaxMin());
 }
 
+TEST(StatisticsGAMGTest,TestSetup_MultiSample) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestSetup_MultiSample());
+}
+
+TEST(StatisticsGAMGTest,TestExecute_MultiSample) {
+    StatisticsGAMTest test;
+    ASSERT_TRUE(test.TestExecute_MultiSample());
+}
+
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
 /*---------------------------------------------------------------------------*/
@@ -1400,3 +1400,167 @@ bool StatisticsGAMTest::TestExecute_uint32_withCycleCounter() {
 bool StatisticsGAMTest::TestExecute_uint32_withAbsoluteMaxMin() {
     return TestExecute_AnyType<MARTe::uint32>(324, 1, true);
 }
+
+/**
+ * Configuration with a vector input signal (the %d is replaced by the value of MultiSample).
+ */
+static const MARTe::char8 * const multiSampleConfig = ""
+        "$Test = {"
+        "    Class = RealTimeApplication"
+        "    +Functions = {"
+        "        Class = ReferenceContainer"
+        "        +Constants = {"
+        "            Class = StatisticsGAMTestHelper_Constant"
+        "            OutputSignals = {"
+        "                Constant_float32 = {"
+        "                    DataSource = DDB"
+        "                    Type = float32"
+        "                    NumberOfElements = 8"
+        "                    NumberOfDimensions = 1"
+        "                    Default = {1.0 2.0 3.0 4.0 5.0 6.0 7.0 8.0}"
+        "                }"
+        "            }"
+        "        }"
+        "        +Statistics = {"
+        "            Class = StatisticsGAM"
+        "            WindowSize = 4"
+        "            MultiSample = %d"
+        "            InputSignals = {"
+        "               Constant_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "                   NumberOfElements = 8"
+        "                   NumberOfDimensions = 1"
+        "               }"
+        "            }"
+        "            OutputSignals = {"
+        "               Average_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Stdev_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Minimum_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Maximum_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "            }"
+        "        }"
+        "        +Sink = {"
+        "            Class = SinkGAM"
+        "            InputSignals = {"
+        "               Average_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Stdev_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Minimum_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "               Maximum_float32 = {"
+        "                   DataSource = DDB"
+        "                   Type = float32"
+        "               }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Data = {"
+        "        Class = ReferenceContainer"
+        "        DefaultDataSource = DDB"
+        "        +DDB = {"
+        "            Class = GAMDataSource"
+        "        }"
+        "        +Timings = {"
+        "            Class = TimingDataSource"
+        "        }"
+        "    }"
+        "    +States = {"
+        "        Class = ReferenceContainer"
+        "        +Running = {"
+        "            Class = RealTimeState"
+        "            +Threads = {"
+        "                Class = ReferenceContainer"
+        "                +Thread = {"
+        "                    Class = RealTimeThread"
+        "                    Functions = {Constants Statistics Sink}"
+        "                }"
+        "            }"
+        "        }"
+        "    }"
+        "    +Scheduler = {"
+        "        Class = GAMScheduler"
+        "        TimingDataSource = Timings"
+        "    }"
+        "}";
+
+bool StatisticsGAMTest::TestSetup_MultiSample() {
+    using namespace MARTe;
+    StreamString cfgStream;
+    cfgStream.Printf(multiSampleConfig, 0);
+    /* A vector is only accepted with MultiSample = 1 */
+    bool ok = !StatisticsGAMTestHelper::ConfigureApplication(cfgStream.Buffer());
+    if (ok) {
+        cfgStream = "";
+        cfgStream.Printf(multiSampleConfig, 1);
+        ok = StatisticsGAMTestHelper::ConfigureApplication(cfgStream.Buffer());
+    }
+    ObjectRegistryDatabase::Instance()->Purge();
+    return ok;
+}
+
+bool StatisticsGAMTest::TestExecute_MultiSample() {
+    using namespace MARTe;
+    StreamString cfgStream;
+    cfgStream.Printf(multiSampleConfig, 1);
+    bool ok = StatisticsGAMTestHelper::ConfigureApplication(cfgStream.Buffer());
+
+    ReferenceT<SinkGAM> sink;
+    if (ok) {
+        ObjectRegistryDatabase *god = ObjectRegistryDatabase::Instance();
+        ReferenceT<RealTimeApplication> application = god->Find("Test");
+        sink = application->Find("Functions.Sink");
+        ok = sink.IsValid();
+    }
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StartApplication();
+    }
+    if (ok) {
+        Sleep::Sec(1.0);
+    }
+    float32 avg = 0.0F;
+    float32 min = 0.0F;
+    float32 max = 0.0F;
+    if (ok) {
+        ok = sink->GetInput<float32>(0u, avg);
+    }
+    if (ok) {
+        ok = sink->GetInput<float32>(2u, min);
+    }
+    if (ok) {
+        ok = sink->GetInput<float32>(3u, max);
+    }
+    /* The window holds the last 4 elements of the vector */
+    if (ok) {
+        ok = (avg == 6.5F);
+    }
+    if (ok) {
+        ok = (min == 5.0F);
+    }
+    if (ok) {
+        ok = (max == 8.0F);
+    }
+    if (ok) {
+        ok = StatisticsGAMTestHelper::StopApplication();
+    }
+    return ok;
+}
@@ -219,6 +219,16 @@ public:
      * @brief Tests the absolute Max/Min handling mode
      */
     bool TestExecute_uint32_withAbsoluteMaxMin();
+
+    /**
+     * @brief Tests the Setup method with MultiSample = 1 and a vector input signal.
+     */
+    bool TestSetup_MultiSample();
+
+    /**
+     * @brief Tests the Execute method with MultiSample = 1, i.e. that all the elements of the input vector are inserted in the window.
+     */
+    bool TestExecute_MultiSample();
 };
 
 /*---------------------------------------------------------------------------*/
@@ -107,6 +107,33 @@ public:
      */
     bool TestGetSum(const uint32 windowSize);
 
+    /**
+     * @brief Tests the PushSamples method against PushSample.
+     */
+    bool TestPushSamples(const uint32 windowSize);
+
+    /**
+     * @brief Tests the GetMax method against a full scan of the window, with the maximum leaving the window every sample.
+     */
+    bool TestGetMax_Sliding(const uint32 windowSize);
+
+    /**
+     * @brief Tests the GetMin method against a full scan of the window, with the minimum leaving the window every sample.
+     */
+    bool TestGetMin_Sliding(const uint32 windowSize);
+
+    /**
+     * @brief Tests that the GetSum method does not accumulate rounding errors (floating point types only).
+     */
+    bool TestGetSum_Compensated();
+
+private:
+
+    /**
+     * @brief Pushes samples (with ramps and pseudo-random values) and compares the max/min with a full scan of the window.
+     */
+    bool TestSliding(const uint32 windowSize, const bool testMax);
+
 };
 }
 /*---------------------------------------------------------------------------*/
@@ -273,6 +300,119 @@ bool StatisticsHelperTTest<Type>::TestGetSum(const uint32 windowSize) {
     return (myStatisticsHelper.GetSum() == sum);
 }
 
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestPushSamples(const uint32 windowSize) {
+    StatisticsHelperT<Type> oneByOne(windowSize);
+    StatisticsHelperT<Type> multiple(windowSize);
+    const uint32 numberOfSamples = 7u;
+    Type samples[numberOfSamples];
+    bool ok = true;
+    uint32 j = 0u;
+    for (uint32 i = 0u; (i < (3u * windowSize)) && (ok); i++) {
+        for (uint32 s = 0u; (s < numberOfSamples) && (ok); s++) {
+            samples[s] = static_cast<Type>(((j * 37u) + 11u) % 100u);
+            ok = oneByOne.PushSample(samples[s]);
+            j++;
+        }
+        if (ok) {
+            ok = multiple.PushSamples(&samples[0], numberOfSamples);
+        }
+        if (ok) {
+            ok = (multiple.GetCounter() == oneByOne.GetCounter());
+        }
+        if (ok) {
+            ok = (multiple.GetSample() == oneByOne.GetSample());
+        }
+        if (ok) {
+            ok = (multiple.GetSum() == oneByOne.GetSum());
+        }
+        if (ok) {
+            ok = (multiple.GetMax() == oneByOne.GetMax());
+        }
+        if (ok) {
+            ok = (multiple.GetMin() == oneByOne.GetMin());
+        }
+    }
+    if (ok) {
+        ok = !multiple.PushSamples(NULL_PTR(const Type *), numberOfSamples);
+    }
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestSliding(const uint32 windowSize, const bool testMax) {
+    StatisticsHelperT<Type> myStatisticsHelper(windowSize);
+    const uint32 size = myStatisticsHelper.GetSize();
+    Type *history = new Type[size];
+    bool ok = true;
+    for (uint32 i = 0u; (i < (10u * size)) && (ok); i++) {
+        Type mySample;
+        uint32 phase = (i / (2u * size)) % 3u;
+        if (phase == 0u) {
+            /* Decreasing: the max leaves the window every sample */
+            mySample = static_cast<Type>(100u - (i % 100u));
+        }
+        else if (phase == 1u) {
+            /* Increasing: the min leaves the window every sample */
+            mySample = static_cast<Type>(i % 100u);
+        }
+        else {
+            mySample = static_cast<Type>(((i * 37u) + 11u) % 100u);
+        }
+        history[i % size] = mySample;
+        ok = myStatisticsHelper.PushSample(mySample);
+        uint32 n = ((i + 1u) < size) ? (i + 1u) : size;
+        Type expected = history[i % size];
+        for (uint32 k = 0u; k < n; k++) {
+            Type value = history[((i + size) - k) % size];
+            if (testMax) {
+                expected = (value > expected) ? value : expected;
+            }
+            else {
+                expected = (value < expected) ? value : expected;
+            }
+        }
+        if (ok) {
+            ok = ((testMax ? myStatisticsHelper.GetMax() : myStatisticsHelper.GetMin()) == expected);
+        }
+    }
+    delete[] history;
+    return ok;
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMax_Sliding(const uint32 windowSize) {
+    return TestSliding(windowSize, true);
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetMin_Sliding(const uint32 windowSize) {
+    return TestSliding(windowSize, false);
+}
+
+template<typename Type>
+bool StatisticsHelperTTest<Type>::TestGetSum_Compensated() {
+    StatisticsHelperT<Type> myStatisticsHelper(4);
+    /* Without compensation the small samples are lost in the sum while the large sample is in the window */
+    bool ok = myStatisticsHelper.PushSample(static_cast<Type>(1e8));
+    for (uint32 i = 0u; (i < 1000u) && (ok); i++) {
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(1));
+        if (((i % 10u) == 9u) && (ok)) {
+            ok = myStatisticsHelper.PushSample(static_cast<Type>(1e8));
+        }
+    }
+    for (uint32 i = 0u; (i < 4u) && (ok); i++) {
+        ok = myStatisticsHelper.PushSample(static_cast<Type>(1));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetSum() == static_cast<Type>(4));
+    }
+    if (ok) {
+        ok = (myStatisticsHelper.GetAvg() == static_cast<Type>(1));
+    }
+    return ok;
+}
+
 } /*namespace MARTe*/
 #endif /* STATISTICSHELPERTTEST_H_ */
 
@@ -133,3 +133,23 @@ TEST(TimeCorrectionGAMGTest,TestExecute_EstimationSlowChange) {
     TimeCorrectionGAMTest test;
     ASSERT_TRUE(test.TestExecute_EstimationSlowChange());
 }
+
+TEST(TimeCorrectionGAMGTest,TestInitialise_FalseBadMode) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_FalseBadMode());
+}
+
+TEST(TimeCorrectionGAMGTest,TestSetup_Estimator_FalseBadOutputType) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestSetup_Estimator_FalseBadOutputType());
+}
+
+TEST(TimeCorrectionGAMGTest,TestExecute_Estimator) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Estimator());
+}
+
+TEST(TimeCorrectionGAMGTest,TestExecute_EstimatorBackwardJump) {
+    TimeCorrectionGAMTest test;
+    ASSERT_TRUE(test.TestExecute_EstimatorBackwardJump());
+}
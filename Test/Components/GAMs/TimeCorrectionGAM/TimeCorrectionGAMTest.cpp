@@ -33,6 +33,7 @@
 #include "ConfigurationDatabase.h"
 #include "DataSourceI.h"
 #include "GAMSchedulerI.h"
+#include "MemoryOperationsHelper.h"
 #include "MemoryDataSourceI.h"
 #include "ObjectRegistryDatabase.h"
 #include "RealTimeApplication.h"
@@ -1332,3 +1333,361 @@ bool TimeCorrectionGAMTest::TestExecute_EstimationSlowChange() {
     return ret;
 }
 
+bool TimeCorrectionGAMTest::TestInitialise_FalseBadMode() {
+    const char8* config = "Mode=Kalman\n "
+            "ExpectedDelta=1000000\n "
+            "DeltaTolerance=20\n "
+            "FilterGain=0.9\n ";
+
+    HeapManager::AddHeap(GlobalObjectsDatabase::Instance()->GetStandardHeap());
+    ConfigurationDatabase cdb;
+    StreamString configStream = config;
+    configStream.Seek(0);
+    StandardParser parser(configStream, cdb);
+    bool ret = parser.Parse();
+    if (ret) {
+        TimeCorrectionGAMTestGAM gam;
+        cdb.MoveToRoot();
+        ret = !gam.Initialise(cdb);
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestSetup_Estimator_FalseBadOutputType() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           Mode = Estimator"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=1000"
+            "           FilterGain=0.1"
+            "           LocalFrequency=1e9"
+            "           TimeUnitsPerSecond=1e9"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "                LocalTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "               }"
+            "               Jitter = {"
+            "                   DataSource = DDB"
+            "                   Type = uint32"
+            "               }"
+            "               Drift = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = !InitialiseMemoryMapInputBrokerEnviroment(config);
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestExecute_Estimator() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           Mode = Estimator"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=1000"
+            "           FilterGain=0.1"
+            "           LocalFrequency=1e9"
+            "           TimeUnitsPerSecond=1e9"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "                LocalTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "               }"
+            "               Jitter = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "               }"
+            "               Drift = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+    }
+
+    if (ret) {
+        //The external clock runs 50 ppm faster than the local counter, which is read with +/-100 ns of jitter.
+        uint32 nIterations = 3000;
+        uint32 wrongTimeIndex = 2500;
+        uint64 externalDelta = 1000050;
+        uint64 startTime = 1000000000000ull;
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            uint64 expectedTime = startTime + (i * externalDelta);
+            input[0] = (i == wrongTimeIndex) ? (expectedTime + 100000u) : expectedTime;
+            input[1] = 1000u + (i * 1000000ull) + ((i * 7919u) % 201u) - 100u;
+            gam->Execute();
+            uint8 isCorrected = *(uint8*) (&output[4]);
+            ret = (isCorrected == ((i == wrongTimeIndex) ? 1u : 0u));
+            if ((ret) && (i > 1000u)) {
+                for (uint32 j = 0u; (j < 4u) && (ret); j++) {
+                    int64 error = (int64)(output[j] - (expectedTime + ((j * externalDelta) / 4u)));
+                    ret = (error < 200) && (error > -200);
+                }
+            }
+        }
+        if (ret) {
+            float64 jitter;
+            float64 drift;
+            char8 *statistics = reinterpret_cast<char8 *>(&output[4]);
+            ret = MemoryOperationsHelper::Copy(&jitter, &statistics[1], sizeof(float64));
+            ret &= MemoryOperationsHelper::Copy(&drift, &statistics[1 + sizeof(float64)], sizeof(float64));
+            ret &= (drift > 45.) && (drift < 55.);
+            ret &= (jitter > 0.) && (jitter < 100.);
+        }
+    }
+    return ret;
+}
+
+bool TimeCorrectionGAMTest::TestExecute_EstimatorBackwardJump() {
+
+    static const char8 * const config = ""
+            "$Application1 = {"
+            "    Class = RealTimeApplication"
+            "    +Functions = {"
+            "        Class = ReferenceContainer"
+            "        +GAMA = {"
+            "            Class = TimeCorrectionGAMTestGAM"
+            "           Mode = Estimator"
+            "           ExpectedDelta=1000000"
+            "           DeltaTolerance=1000"
+            "           FilterGain=0.1"
+            "           LocalFrequency=1e9"
+            "           TimeUnitsPerSecond=1e9"
+            "            InputSignals = {"
+            "                InputTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                   Frequency = 0"
+            "                }"
+            "                LocalTime = {"
+            "                   DataSource = Drv1"
+            "                   Type = uint64"
+            "                }"
+            "            }"
+            "            OutputSignals = {"
+            "               CorrectedTime = {"
+            "                   DataSource = DDB"
+            "                   Type = uint64"
+            "                   NumberOfElements = 4"
+            "               }"
+            "               IsCorrected = {"
+            "                   DataSource = DDB"
+            "                   Type = uint8"
+            "               }"
+            "               Jitter = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "               }"
+            "               Drift = {"
+            "                   DataSource = DDB"
+            "                   Type = float64"
+            "               }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Data = {"
+            "        Class = ReferenceContainer"
+            "        +DDB = {"
+            "            Class = GAMDataSource"
+            "        }"
+            "        +Drv1 = {"
+            "            Class = TimeCorrectionGAMTestDS"
+            "        }"
+            "        +Timings = {"
+            "            Class = TimingDataSource"
+            "        }"
+            "    }"
+            "    +States = {"
+            "        Class = ReferenceContainer"
+            "        +State1 = {"
+            "            Class = RealTimeState"
+            "            +Threads = {"
+            "                Class = ReferenceContainer"
+            "                +Thread1 = {"
+            "                    Class = RealTimeThread"
+            "                    Functions = {GAMA}"
+            "                }"
+            "            }"
+            "        }"
+            "    }"
+            "    +Scheduler = {"
+            "        Class = GAMScheduler"
+            "        TimingDataSource = Timings"
+            "    }"
+            "}";
+
+    bool ret = InitialiseMemoryMapInputBrokerEnviroment(config);
+
+    ReferenceT<TimeCorrectionGAMTestGAM> gam;
+    if (ret) {
+        gam = ObjectRegistryDatabase::Instance()->Find("Application1.Functions.GAMA");
+        ret = gam.IsValid();
+    }
+    uint64* input = NULL;
+    uint64* output = NULL;
+    if (ret) {
+        input = (uint64*) gam->GetInputSignalsMemory();
+        output = (uint64*) gam->GetOutputSignalsMemory();
+        ret = (input != NULL) && (output != NULL);
+    }
+
+    if (ret) {
+        //The external clock runs 50 ppm faster than the local counter and jumps 1 s backwards. The estimator shall hold over, lose the lock,
+        //and re-seed from the new time-stamps keeping the (positive) predicted rate.
+        uint32 nIterations = 2000;
+        uint32 jumpIndex = 1000;
+        uint64 externalDelta = 1000050;
+        uint64 startTime = 1000000000000ull;
+        uint64 backwardJump = 1000000000ull;
+        for (uint32 i = 0u; (i < nIterations) && (ret); i++) {
+            uint64 expectedTime = startTime + (i * externalDelta);
+            if (i >= jumpIndex) {
+                expectedTime -= backwardJump;
+            }
+            input[0] = expectedTime;
+            input[1] = 1000u + (i * 1000000ull);
+            gam->Execute();
+            uint8 isCorrected = *(uint8*) (&output[4]);
+            if ((i >= jumpIndex) && (i < (jumpIndex + TIME_CORRECTION_GAM_MAX_HOLDOVER_CYCLES))) {
+                ret = (isCorrected == 1u);
+            }
+            else {
+                ret = (isCorrected == 0u);
+            }
+            if ((ret) && ((i > 500u) && ((i < jumpIndex) || (i > (jumpIndex + TIME_CORRECTION_GAM_MAX_HOLDOVER_CYCLES))))) {
+                int64 error = (int64)(output[0] - expectedTime);
+                ret = (error < 200) && (error > -200);
+            }
+        }
+        if (ret) {
+            float64 drift;
+            char8 *statistics = reinterpret_cast<char8 *>(&output[4]);
+            ret = MemoryOperationsHelper::Copy(&drift, &statistics[1 + sizeof(float64)], sizeof(float64));
+            ret &= (drift > 45.) && (drift < 55.);
+        }
+    }
+    return ret;
+}
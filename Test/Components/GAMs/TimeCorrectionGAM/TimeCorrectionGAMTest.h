@@ -165,6 +165,30 @@ public:
      */
     bool TestExecute_EstimationSlowChange();
 
+    /**
+     * @brief Tests the TimeCorrectionGAM::Initialise method that fails if the
+     * Mode is neither Filter nor Estimator
+     */
+    bool TestInitialise_FalseBadMode();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Setup method in Estimator mode that fails if the
+     * jitter output signal is not float64
+     */
+    bool TestSetup_Estimator_FalseBadOutputType();
+
+    /**
+     * @brief Tests the TimeCorrectionGAM::Execute method in Estimator mode with a drifting
+     * external clock, a jittery local counter, a wrong time-stamp and a vector of time-stamps per cycle
+     */
+    bool TestExecute_Estimator();
+
+    /**
+     * @brief Tests that the TimeCorrectionGAM::Execute method in Estimator mode re-seeds after a backward jump of the time-stamps
+     * keeping the predicted rate
+     */
+    bool TestExecute_EstimatorBackwardJump();
+
 };
 
 /*---------------------------------------------------------------------------*/
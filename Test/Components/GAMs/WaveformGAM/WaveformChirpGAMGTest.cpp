@@ -85,6 +85,16 @@ TEST(WaveformChirpGAMTest, TestExecuteNyquistViolation) {
     ASSERT_TRUE(test.TestExecuteNyquistViolation());
 }
 
+TEST(WaveformChirpGAMTest, TestExecute_Recurrence) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestExecute_Recurrence());
+}
+
+TEST(WaveformChirpGAMTest, TestInitialiseWrongMethod) {
+    WaveformChirpGAMTest test;
+    ASSERT_TRUE(test.TestInitialiseWrongMethod());
+}
+
 TEST(WaveformChirpGAMTest, TestExecuteUInt8) {
     WaveformChirpGAMTest test;
     StreamString auxStr = "uint8";
@@ -283,5 +283,72 @@ bool WaveformChirpGAMTest::TestExecuteNyquistViolation() {
     return ok;
 }
 
+bool WaveformChirpGAMTest::TestExecute_Recurrence() {
+    using namespace MARTe;
+    bool ok = true;
+    uint32 timeIterationIncrement = 1000000u;
+    uint32 *timeIteration = NULL;
+    //More elements than WAVEFORM_RECURRENCE_RESEED_PERIOD so that the recurrence is re-seeded within the cycle.
+    uint32 sizeOutput = 1000u;
+    WaveformChirpGAMTestHelper gam(1, 1, sizeOutput, 1, "float64");
+    float64 *output = NULL;
+
+    gam.SetName("Test");
+    ok &= gam.InitialiseChirp1();
+    ok &= gam.config.Write("Method", "Recurrence");
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok &= gam.Initialise(gam.config);
+    }
+    if (ok) {
+        ok &= gam.InitialiseConfigDataBaseSignal1();
+    }
+    if (ok) {
+        ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    }
+    if (ok) {
+        ok &= gam.AllocateInputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.AllocateOutputSignalsMemory();
+    }
+    if (ok) {
+        ok &= gam.Setup();
+    }
+    if (ok) {
+        timeIteration = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+        *timeIteration = 0;
+        output = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    }
+    //The first two cycles compute the time increment.
+    for (uint32 n = 0u; (n < 5u) && ok; n++) {
+        ok = gam.Execute();
+        float64 t = static_cast<float64>(*timeIteration) / 1e6;
+        float64 it = static_cast<float64>(timeIterationIncrement) / sizeOutput / 1e6;
+        for (uint32 i = 0u; (i < sizeOutput) && (ok) && (n > 1u); i++) {
+            float64 refValue = gam.amplitude
+                    * sin(2.0 * FastMath::PI * gam.f1 * t + 2 * FastMath::PI * (gam.f2 - gam.f1) * t * t / 2.0 / gam.chirpDuration + gam.phase) + gam.offset;
+            ok = ((output[i] - refValue) < 1e-7) && ((output[i] - refValue) > -1e-7);
+            t += it;
+        }
+        *timeIteration += timeIterationIncrement;
+    }
+    return ok;
+}
+
+bool WaveformChirpGAMTest::TestInitialiseWrongMethod() {
+    using namespace MARTe;
+    bool ok = true;
+    WaveformChirpGAMTestHelper gam;
+    gam.SetName("Test");
+    ok &= gam.InitialiseChirp1();
+    ok &= gam.config.Write("Method", "Table");
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
 }
 
@@ -99,6 +99,16 @@ public:
      */
     bool TestExecuteNyquistViolation();
 
+    /**
+     * @brief Verifies the correctness of the data with float64 and Method = Recurrence.
+     */
+    bool TestExecute_Recurrence();
+
+    /**
+     * @brief Test that WaveformChirp::Initialise() fails with an unsupported Method.
+     */
+    bool TestInitialiseWrongMethod();
+
     /**
      * @brief Template test. Verifies the correctness of the data.
      */
@@ -213,6 +213,16 @@ TEST(WaveformSinGAMTest, TestFloat64Execute) {
     ASSERT_TRUE(test.TestFloat64Execute());
 }
 
+TEST(WaveformSinGAMTest, TestFloat64Execute_Recurrence) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestFloat64Execute_Recurrence());
+}
+
+TEST(WaveformSinGAMTest, TestInitialise_WrongMethod) {
+    WaveformSinGAMTest test;
+    ASSERT_TRUE(test.TestInitialise_WrongMethod());
+}
+
 TEST(WaveformSinGAMTest, TestSetup_StopTriggerGreaterThanStartTrigger) {
     WaveformSinGAMTest test;
     ASSERT_TRUE(test.TestSetup_StopTriggerGreaterThanStartTrigger());
@@ -1929,6 +1929,63 @@ bool WaveformSinGAMTest::TestFloat64Execute() {
     return ok;
 }
 
+bool WaveformSinGAMTest::TestFloat64Execute_Recurrence() {
+    bool ok = true;
+    using namespace MARTe;
+    using namespace FastMath;
+    //More elements than WAVEFORM_RECURRENCE_RESEED_PERIOD so that the recurrence is re-seeded within the cycle.
+    WaveformSinGAMTestHelper gam(1, 1, 1000, 1);
+    gam.SetName("Test");
+    ok &= gam.InitialiseWaveSin(10.0, 123.0, 0.3, 1.0);
+    ok &= gam.config.Write("Method", "Recurrence");
+    gam.config.MoveToRoot();
+    ok &= gam.Initialise(gam.config);
+
+    ok &= gam.InitialiseConfigDataBaseSignal1(Float64Bit);
+    ok &= gam.SetConfiguredDatabase(gam.configSignals);
+    ok &= gam.AllocateInputSignalsMemory();
+    ok &= gam.AllocateOutputSignalsMemory();
+    ok &= gam.Setup();
+
+    uint32 *gamMemoryIn = static_cast<uint32 *>(gam.GetInputSignalsMemory());
+    float64 *gamMemoryOut = static_cast<float64 *>(gam.GetOutputSignalsMemory());
+    *gamMemoryIn = 0;
+    for (uint32 i = 0u; i < gam.numberOfElementsOut; i++) {
+        gamMemoryOut[i] = 0;
+    }
+    if (ok) {
+        ok = gam.Execute();
+    }
+    *gamMemoryIn = 1000000;
+    if (ok) {
+        ok = gam.Execute();
+    }
+    for (uint32 n = 2u; (n < 5u) && (ok); n++) {
+        *gamMemoryIn = n * 1000000;
+        ok = gam.Execute();
+        for (uint32 i = 0; (i < gam.numberOfElementsOut) && (ok); i++) {
+            float64 aux = gam.amplitude * sin(2.0 * FastMath::PI * gam.frequency * (*gamMemoryIn / 1e6 + i * (1.0 / gam.numberOfElementsOut)) + gam.phase)
+                    + gam.offset;
+            ok = ((gamMemoryOut[i] - aux) < 1e-7) && ((gamMemoryOut[i] - aux) > -1e-7);
+        }
+    }
+    return ok;
+}
+
+bool WaveformSinGAMTest::TestInitialise_WrongMethod() {
+    bool ok = true;
+    using namespace MARTe;
+    WaveformSinGAMTestHelper gam;
+    gam.SetName("Test");
+    ok &= gam.InitialiseWaveSin();
+    ok &= gam.config.Write("Method", "Table");
+    gam.config.MoveToRoot();
+    if (ok) {
+        ok = !gam.Initialise(gam.config);
+    }
+    return ok;
+}
+
 bool WaveformSinGAMTest::TestSetup_StopTriggerGreaterThanStartTrigger() {
     bool ok = true;
     using namespace MARTe;
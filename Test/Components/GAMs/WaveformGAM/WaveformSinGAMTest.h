@@ -224,6 +224,16 @@ public:
      */
     bool TestFloat64Execute();
 
+    /**
+     * @brief Test the correctness of the output with float64 and Method = Recurrence.
+     */
+    bool TestFloat64Execute_Recurrence();
+
+    /**
+     * @brief Test that WaveformSin::Initialise() fails with an unsupported Method.
+     */
+    bool TestInitialise_WrongMethod();
+
     /**
      * @brief Test warning message of Waveform::Setup() when checking triggering parameters.
      */
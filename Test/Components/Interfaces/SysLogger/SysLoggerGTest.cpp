@@ -64,4 +64,34 @@ TEST(SysLoggerGTest,TestConsumeLogMessage) {
     ASSERT_TRUE(test.TestConsumeLogMessage());
 }
 
+TEST(SysLoggerGTest,TestInitialise_QueueSize) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_QueueSize());
+}
+
+TEST(SysLoggerGTest,TestInitialise_False_QueueSize) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestInitialise_False_QueueSize());
+}
+
+TEST(SysLoggerGTest,TestConsumeLogMessage_Socket) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestConsumeLogMessage_Socket());
+}
+
+TEST(SysLoggerGTest,TestGetQueueDepth) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestGetQueueDepth());
+}
+
+TEST(SysLoggerGTest,TestGetNumberOfDroppedMessages) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfDroppedMessages());
+}
+
+TEST(SysLoggerGTest,TestGetNumberOfSentMessages) {
+    SysLoggerTest test;
+    ASSERT_TRUE(test.TestGetNumberOfSentMessages());
+}
+
 	
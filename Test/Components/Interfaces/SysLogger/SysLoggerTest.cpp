@@ -24,19 +24,70 @@
 /*---------------------------------------------------------------------------*/
 /*                         Standard header includes                          */
 /*---------------------------------------------------------------------------*/
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 /*---------------------------------------------------------------------------*/
 /*                         Project header includes                           */
 /*---------------------------------------------------------------------------*/
 #include "ConfigurationDatabase.h"
+#include "MemoryOperationsHelper.h"
 #include "LoggerService.h"
 #include "ReferenceT.h"
+#include "Sleep.h"
+#include "StringHelper.h"
 #include "SysLogger.h"
 #include "SysLoggerTest.h"
 
 /*---------------------------------------------------------------------------*/
 /*                           Static definitions                              */
 /*---------------------------------------------------------------------------*/
+/**
+ * The socket where the SysLogger under test sends the messages.
+ */
+static const MARTe::char8 * const sysLoggerTestSocketPath = "/tmp/SysLoggerTest.sock";
+
+/**
+ * Creates a socket (replacing the syslog daemon) bound to sysLoggerTestSocketPath.
+ */
+static MARTe::int32 SysLoggerTestOpenServer() {
+    using namespace MARTe;
+    (void) unlink(sysLoggerTestSocketPath);
+    int32 fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd >= 0) {
+        struct sockaddr_un address;
+        (void) MemoryOperationsHelper::Set(&address, '\0', static_cast<uint32>(sizeof(address)));
+        address.sun_family = AF_UNIX;
+        (void) StringHelper::Copy(&address.sun_path[0], sysLoggerTestSocketPath);
+        bool ok = (bind(fd, reinterpret_cast<struct sockaddr *>(&address), static_cast<socklen_t>(sizeof(address))) == 0);
+        if (ok) {
+            struct timeval timeout;
+            timeout.tv_sec = 2;
+            timeout.tv_usec = 0;
+            ok = (setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, static_cast<socklen_t>(sizeof(timeout))) == 0);
+        }
+        if (!ok) {
+            (void) close(fd);
+            fd = -1;
+        }
+    }
+    return fd;
+}
+
+/**
+ * Calls ConsumeLogMessage with a page holding \a message.
+ */
+static void SysLoggerTestConsume(MARTe::SysLogger &logger,
+                                 const MARTe::ErrorManagement::ErrorType errorType,
+                                 const MARTe::char8 * const message) {
+    using namespace MARTe;
+    LoggerPage page;
+    page.errorInfo.header.errorType = errorType;
+    (void) StringHelper::Copy(&page.errorStrBuffer[0], message);
+    logger.ConsumeLogMessage(&page);
+}
 
 /*---------------------------------------------------------------------------*/
 /*                           Method definitions                              */
@@ -109,3 +160,154 @@ bool SysLoggerTest::TestConsumeLogMessage() {
 
     return ok;
 }
+
+bool SysLoggerTest::TestInitialise_QueueSize() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("QueueSize", 16);
+    cdb.Write("SocketPath", sysLoggerTestSocketPath);
+    return test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestInitialise_False_QueueSize() {
+    using namespace MARTe;
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "EtOofFRmC");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("QueueSize", 0);
+    return !test.Initialise(cdb);
+}
+
+bool SysLoggerTest::TestConsumeLogMessage_Socket() {
+    using namespace MARTe;
+    int32 server = SysLoggerTestOpenServer();
+    bool ok = (server >= 0);
+    SysLogger test;
+    if (ok) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Format", "m");
+        cdb.Write("Ident", "MARTe2SysLoggerTest");
+        cdb.Write("SocketPath", sysLoggerTestSocketPath);
+        ok = test.Initialise(cdb);
+    }
+    if (ok) {
+        SysLoggerTestConsume(test, ErrorManagement::Warning, "SysLoggerTestWarning");
+        SysLoggerTestConsume(test, ErrorManagement::Information, "SysLoggerTestInformation");
+        SysLoggerTestConsume(test, ErrorManagement::FatalError, "SysLoggerTestFatalError");
+    }
+    //LOG_USER | LOG_WARNING, LOG_USER | LOG_INFO and LOG_USER | LOG_CRIT
+    const char8 * const expectedHeaders[] = { "<12>", "<14>", "<10>" };
+    const char8 * const expectedMessages[] = { "MARTe2SysLoggerTest: SysLoggerTestWarning", "MARTe2SysLoggerTest: SysLoggerTestInformation",
+            "MARTe2SysLoggerTest: SysLoggerTestFatalError" };
+    uint32 m;
+    for (m = 0u; (m < 3u) && (ok); m++) {
+        char8 buffer[SYSLOGGER_MAX_MESSAGE_SIZE + 1u];
+        ssize_t size = recv(server, &buffer[0], SYSLOGGER_MAX_MESSAGE_SIZE, 0);
+        ok = (size > 0);
+        if (ok) {
+            buffer[size] = '\0';
+            ok = (StringHelper::CompareN(&buffer[0], expectedHeaders[m], 4u) == 0);
+        }
+        if (ok) {
+            ok = (StringHelper::SearchString(&buffer[0], expectedMessages[m]) != NULL_PTR(const char8 *));
+        }
+    }
+    if (server >= 0) {
+        (void) close(server);
+    }
+    (void) unlink(sysLoggerTestSocketPath);
+    return ok;
+}
+
+bool SysLoggerTest::TestGetQueueDepth() {
+    using namespace MARTe;
+    (void) unlink(sysLoggerTestSocketPath);
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "m");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("SocketPath", sysLoggerTestSocketPath);
+    cdb.Write("QueueSize", 4);
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        ok = (test.GetQueueDepth() == 0u);
+    }
+    if (ok) {
+        SysLoggerTestConsume(test, ErrorManagement::Information, "SysLoggerTestInformation");
+        SysLoggerTestConsume(test, ErrorManagement::Information, "SysLoggerTestInformation");
+        ok = (test.GetQueueDepth() == 2u);
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestGetNumberOfDroppedMessages() {
+    using namespace MARTe;
+    (void) unlink(sysLoggerTestSocketPath);
+    SysLogger test;
+    ConfigurationDatabase cdb;
+    cdb.Write("Format", "m");
+    cdb.Write("Ident", "MARTe2SysLoggerTest");
+    cdb.Write("SocketPath", sysLoggerTestSocketPath);
+    cdb.Write("QueueSize", 2);
+    bool ok = test.Initialise(cdb);
+    if (ok) {
+        uint32 m;
+        for (m = 0u; m < 5u; m++) {
+            SysLoggerTestConsume(test, ErrorManagement::Information, "SysLoggerTestInformation");
+        }
+        ok = (test.GetNumberOfDroppedMessages() == 3u);
+    }
+    if (ok) {
+        ok = (test.GetQueueDepth() == 2u);
+    }
+    return ok;
+}
+
+bool SysLoggerTest::TestGetNumberOfSentMessages() {
+    using namespace MARTe;
+    int32 server = SysLoggerTestOpenServer();
+    bool ok = (server >= 0);
+    SysLogger test;
+    if (ok) {
+        ConfigurationDatabase cdb;
+        cdb.Write("Format", "m");
+        cdb.Write("Ident", "MARTe2SysLoggerTest");
+        cdb.Write("SocketPath", sysLoggerTestSocketPath);
+        ok = test.Initialise(cdb);
+    }
+    const uint32 numberOfMessages = 100u;
+    if (ok) {
+        uint32 m;
+        for (m = 0u; m < numberOfMessages; m++) {
+            SysLoggerTestConsume(test, ErrorManagement::Information, "SysLoggerTestInformation");
+        }
+    }
+    uint32 m;
+    for (m = 0u; (m < numberOfMessages) && (ok); m++) {
+        char8 buffer[SYSLOGGER_MAX_MESSAGE_SIZE];
+        ok = (recv(server, &buffer[0], SYSLOGGER_MAX_MESSAGE_SIZE, 0) > 0);
+    }
+    if (ok) {
+        uint32 timeout = 200u;
+        while ((test.GetNumberOfSentMessages() != numberOfMessages) && (timeout > 0u)) {
+            Sleep::MSec(10);
+            timeout--;
+        }
+        ok = (test.GetNumberOfSentMessages() == numberOfMessages);
+    }
+    if (ok) {
+        ok = (test.GetQueueDepth() == 0u);
+    }
+    if (ok) {
+        ok = (test.GetNumberOfDroppedMessages() == 0u);
+    }
+    if (server >= 0) {
+        (void) close(server);
+    }
+    (void) unlink(sysLoggerTestSocketPath);
+    return ok;
+}
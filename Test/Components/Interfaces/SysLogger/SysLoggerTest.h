@@ -65,6 +65,36 @@ public:
      * @brief Tests the ConsumeLogMessage method .
      */
     bool TestConsumeLogMessage();
+
+    /**
+     * @brief Tests the Initialise method with a QueueSize and a SocketPath.
+     */
+    bool TestInitialise_QueueSize();
+
+    /**
+     * @brief Tests the Initialise method with QueueSize = 0.
+     */
+    bool TestInitialise_False_QueueSize();
+
+    /**
+     * @brief Tests that the ConsumeLogMessage method sends the messages, with the syslog header, to the SocketPath.
+     */
+    bool TestConsumeLogMessage_Socket();
+
+    /**
+     * @brief Tests the GetQueueDepth method while the socket is not available.
+     */
+    bool TestGetQueueDepth();
+
+    /**
+     * @brief Tests the GetNumberOfDroppedMessages method while the socket is not available.
+     */
+    bool TestGetNumberOfDroppedMessages();
+
+    /**
+     * @brief Tests the GetNumberOfSentMessages method.
+     */
+    bool TestGetNumberOfSentMessages();
 };
 
 /*---------------------------------------------------------------------------*/